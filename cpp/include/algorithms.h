@@ -46,6 +46,25 @@ gdf_error gdf_pagerank(gdf_graph *graph,
 												int max_iter,
 												bool has_guess);
 
+/**
+ * @Synopsis   Find the PageRank vertex values of the graph whose transposed adjacency list was compressed
+ *             (gdf_compress_adj_list with transposed=true), the SpMV decodes the columns on the fly.
+ *             The other parameters are the ones of gdf_pagerank.
+ *
+ * @Param[in] *compressed_transposed compressed transposed adjacency list
+ *
+ * @Param[out] *pagerank             The PageRank : pagerank[i] is the PageRank of vertex i.
+ *
+ * @Returns                          GDF_SUCCESS upon successful completion.
+ */
+/* ----------------------------------------------------------------------------*/
+gdf_error gdf_pagerank_compressed(const gdf_compressed_adj_list *compressed_transposed,
+                                  gdf_column *pagerank,
+                                  float alpha,
+                                  float tolerance,
+                                  int max_iter,
+                                  bool has_guess);
+
 /**
  * @Synopsis   Creates source, destination and value columns based on the specified R-MAT model
  *
@@ -106,6 +125,26 @@ gdf_error gdf_bfs(gdf_graph *graph,
 									int start_node,
 									bool directed);
 
+/**
+ * @Synopsis   Breadth first search traversal of a compressed adjacency list (see gdf_compress_adj_list),
+ *             following its rows. Unreached vertices get the distance INT_MAX and the predecessor -1.
+ *
+ * @Param[in] *compressed            compressed adjacency list
+ *
+ * @Param[out] *distances            Column of size V populated by the distance of every vertex from the starting node
+ *
+ * @Param[out] *predecessors         If not nullptr, column of size V populated by the bfs traversal predecessor of every vertex
+ *
+ * @Param[in] start_node             The starting node for breadth first search traversal
+ *
+ * @Returns                          GDF_SUCCESS upon successful completion.
+ */
+/* ----------------------------------------------------------------------------*/
+gdf_error gdf_bfs_compressed(const gdf_compressed_adj_list *compressed,
+                             gdf_column *distances,
+                             gdf_column *predecessors,
+                             int start_node);
+
 /**
  * Computes the Jaccard similarity coefficient for every pair of vertices in the graph
  * which are connected by an edge.
@@ -136,6 +175,16 @@ gdf_error gdf_jaccard_list(gdf_graph *graph,
 														gdf_column *second,
 														gdf_column *result);
 
+/**
+ * Computes the unweighted Jaccard similarity coefficient of every edge of a compressed
+ * adjacency list, as gdf_jaccard does on the adjacency list it was compressed from.
+ * @param compressed The input compressed adjacency list
+ * @param result The result values are stored here (in the order of the edges), memory needs to be pre-allocated
+ * @return Error code
+ */
+gdf_error gdf_jaccard_compressed(const gdf_compressed_adj_list *compressed,
+                                 gdf_column *result);
+
 /**
  * Computes the Overlap Coefficient for every pair of vertices in the graph which are
  * connected by an edge.
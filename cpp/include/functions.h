@@ -87,6 +87,22 @@ gdf_error gdf_add_adj_list(gdf_graph *graph);
 
 gdf_error gdf_add_transposed_adj_list(gdf_graph *graph);
 
+/**
+ * @Synopsis   Create both the adjacency list and the transposed adjacency list from the edge list of a gdf_graph.
+ *             Same result as gdf_add_adj_list followed by gdf_add_transposed_adj_list, but both directions share the
+ *             copy and the sort of the edge list and the degrees of both are counted in the same pass.
+ *             cuGRAPH allocates and owns the memory required for storing the created adjacency lists.
+ *             If one of them already exists, only the other one is created.
+ *
+ * @Param[in, out] *graph            in  : graph descriptor containing either a valid gdf_edge_list structure pointed by graph->edgeList
+ *                                         or a valid gdf_adj_list structure pointed by graph->adjList
+ *                                   out : graph->adjList and graph->transposedAdjList are set to gdf_adj_list structures
+ *
+ * @Returns                          GDF_SUCCESS upon successful completion. If both graph->edgeList and graph->adjList are nullptr then GDF_INVALID_API_CALL is returned.
+ */
+/* ----------------------------------------------------------------------------*/
+gdf_error gdf_add_adj_lists(gdf_graph *graph);
+
 /**
  * @Synopsis   Create the edge lists of a gdf_graph from its adjacency list.
  *             cuGRAPH allocates and owns the memory required for storing the created edge list.
@@ -146,6 +162,60 @@ gdf_error gdf_delete_transposed_adj_list(gdf_graph *graph);
 /* ----------------------------------------------------------------------------*/
 gdf_error gdf_get_two_hop_neighbors(gdf_graph* graph, gdf_column* first, gdf_column* second);
 
+/**
+ * @Synopsis   Extract the k-hop ego network of a set of seed vertices: the subgraph induced by the
+ *             vertices at distance at most radius from a seed (following graph->adjList).
+ *             The frontier is expanded level by level from the seeds, the work is proportional to the
+ *             number of edges out of the ego network vertices, not to the number of vertices of graph.
+ *
+ * @Param[in] *graph                 cuGRAPH graph descriptor, graph->adjList is added if missing
+ * @Param[in] *seeds                 gdf_column of seed vertex indices, same type as the graph indices
+ * @Param[in] radius                 maximum distance to the seeds (0 extracts the subgraph induced by the seeds)
+ *
+ * @Param[out] *ego                  Empty cuGRAPH graph descriptor which gets the adjacency list of the ego network
+ *                                   (and its edge_data if graph->adjList has edge_data)
+ * @Param[out] *vertex_map           An uninitialized gdf_column which will be initialized to contain the
+ *                                   index in graph of each vertex of ego (increasing)
+ *
+ * @Returns                          GDF_SUCCESS upon successful completion.
+ */
+/* ----------------------------------------------------------------------------*/
+gdf_error gdf_extract_ego_network(gdf_graph *graph,
+                                  const gdf_column *seeds,
+                                  int radius,
+                                  gdf_graph *ego,
+                                  gdf_column *vertex_map);
+
+/**
+ * @Synopsis   Compress graph->adjList (or graph->transposedAdjList) into a gdf_compressed_adj_list.
+ *             The neighbors of every row are cut in blocks of 32, a block keeps its first neighbor and
+ *             the offset of its deltas in the data, the deltas of a block are bit-packed at the bit width
+ *             of the largest one. The rows are decoded on the fly by gdf_bfs_compressed,
+ *             gdf_jaccard_compressed and gdf_pagerank_compressed.
+ *
+ * @Param[in] *graph                 cuGRAPH graph descriptor, the adjacency list is added if missing.
+ *                                   Its rows must be sorted (they are when it is built from an edge list)
+ * @Param[in] transposed             compress graph->transposedAdjList instead of graph->adjList
+ *
+ * @Param[out] *compressed           Empty compressed adjacency list, gets columns allocated by cugraph
+ *
+ * @Returns                          GDF_SUCCESS upon successful completion, GDF_INVALID_API_CALL if a row is not sorted.
+ */
+/* ----------------------------------------------------------------------------*/
+gdf_error gdf_compress_adj_list(gdf_graph *graph, bool transposed, gdf_compressed_adj_list *compressed);
+
+/**
+ * @Synopsis   Decode the indices of a compressed adjacency list (its offsets are compressed->offsets)
+ *
+ * @Param[in] *compressed            compressed adjacency list
+ *
+ * @Param[out] *indices              An uninitialized gdf_column which will be initialized to contain the indices
+ *
+ * @Returns                          GDF_SUCCESS upon successful completion.
+ */
+/* ----------------------------------------------------------------------------*/
+gdf_error gdf_decompress_adj_list(const gdf_compressed_adj_list *compressed, gdf_column *indices);
+
 /**
  * @Synopsis   Computes degree(in, out, in+out) of all the nodes of a gdf_graph
  *
@@ -131,3 +131,30 @@ gdf_error gdf_AnalyzeClustering_ratio_cut_nvgraph(gdf_graph* gdf_G,
                                                    const int n_clusters,
                                                    gdf_column* clustering,
                                                    float* score);
+
+/**
+ * Wrapper function for Nvgraph clustering analysis, all metrics in one pass over the graph
+ * @param gdf_G Pointer to GDF graph object
+ * @param n_clusters Number of clusters in the clustering
+ * @param clustering Pointer to GDF column containing the clustering to analyze
+ * @param modularity Pointer to a float in which the modularity will be written
+ * @param edge_cut Pointer to a float in which the edge cut will be written
+ * @param ratio_cut Pointer to a float in which the ratio cut will be written
+ * @param normalized_cut Pointer to a float in which the normalized cut will be written
+ * @param cluster_sizes Host array of n_clusters vertex counts, or nullptr
+ * @param cluster_volumes Host array of n_clusters sums of degrees, or nullptr
+ * @param cluster_cuts Host array of n_clusters weights of the edges leaving the cluster, or nullptr
+ * @param cluster_conductances Host array of n_clusters conductances, or nullptr
+ * @return Error code
+ */
+gdf_error gdf_AnalyzeClustering_nvgraph(gdf_graph* gdf_G,
+                                        const int n_clusters,
+                                        gdf_column* clustering,
+                                        float* modularity,
+                                        float* edge_cut,
+                                        float* ratio_cut,
+                                        float* normalized_cut,
+                                        int* cluster_sizes,
+                                        float* cluster_volumes,
+                                        float* cluster_cuts,
+                                        float* cluster_conductances);
@@ -66,6 +66,11 @@ using rmm_temp_allocator = rmm_allocator<char>; // Use this alias for thrust::cu
     if (stream == nullptr) ;                      \
     cudaFree( (ptr) );                              \
 }
+
+#define ALLOC_FREE_NOTHROW(ptr, stream){            \
+    if (stream == nullptr) ;                      \
+    cudaFree( (ptr) );                              \
+}
 #else
 
 #include <rmm/rmm.h>
@@ -90,5 +95,10 @@ using rmm_temp_allocator = rmm_allocator<char>;
   RMM_TRY_THROW( RMM_FREE( (ptr), (stream) ) )  \
 }
 
+// For destructors: the error is ignored instead of thrown
+#define ALLOC_FREE_NOTHROW(ptr, stream){            \
+  RMM_FREE( (ptr), (stream) );                    \
+}
+
 #endif
 
@@ -83,6 +83,26 @@ struct gdf_adj_list{
 
 };
 
+// Adjacency list with the neighbors of every row stored as bit-packed deltas (see src/compressed_adj_list.cuh),
+// always created by cugraph
+struct gdf_compressed_adj_list{
+  gdf_column *offsets; // rowPtr, as in gdf_adj_list
+  gdf_column *block_offsets; // first block of every row
+  gdf_column *block_bases; // first neighbor of every block
+  gdf_column *block_starts; // first word of every block in data
+  gdf_column *block_widths; // bits per delta of every block
+  gdf_column *data; // packed deltas
+  gdf_compressed_adj_list() : offsets(nullptr), block_offsets(nullptr), block_bases(nullptr), block_starts(nullptr), block_widths(nullptr), data(nullptr){}
+  ~gdf_compressed_adj_list() {
+    gdf_col_delete(offsets);
+    gdf_col_delete(block_offsets);
+    gdf_col_delete(block_bases);
+    gdf_col_delete(block_starts);
+    gdf_col_delete(block_widths);
+    gdf_col_delete(data);
+  }
+};
+
 struct gdf_dynamic{
   void *data; // handle to the dynamic graph struct
 };
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <vector>
+#ifdef NVGRAPH_USE_MPI
+#include <mpi.h>
+#endif
+#include "nvgraph_error.hxx"
+#include "2d_partitioning_host.hxx"
+
+namespace nvgraph
+{
+enum Transport2dType
+{
+    TRANSPORT_2D_INT32,
+    TRANSPORT_2D_INT64,
+    TRANSPORT_2D_FLOAT,
+    TRANSPORT_2D_DOUBLE
+};
+
+enum Transport2dOp
+{
+    TRANSPORT_2D_SUM,
+    TRANSPORT_2D_MIN,
+    TRANSPORT_2D_MAX
+};
+
+template <typename T> struct Transport2dTypeOf;
+template <> struct Transport2dTypeOf<int32_t> {static const Transport2dType value = TRANSPORT_2D_INT32;};
+template <> struct Transport2dTypeOf<int64_t> {static const Transport2dType value = TRANSPORT_2D_INT64;};
+template <> struct Transport2dTypeOf<float> {static const Transport2dType value = TRANSPORT_2D_FLOAT;};
+template <> struct Transport2dTypeOf<double> {static const Transport2dType value = TRANSPORT_2D_DOUBLE;};
+
+size_t transport2dTypeSize(Transport2dType type);
+
+/*! Exchanges of the vertex data of a 2D decomposition distributed over processes (ranks):
+ *  the allgathers, broadcasts and reductions of VertexData2D along the rows and columns of
+ *  blocks, over host memory. A group is the list of the ranks taking part in a collective,
+ *  it contains the calling rank and every rank of the group calls the collective with the
+ *  same list, in the same order with respect to the other collectives of its ranks.
+ *  The transport counts the bytes received by the rank, as the volume of a direct exchange
+ *  between the ranks of the group (the algorithms of an MPI library move more or less data).
+ */
+class Transport2dHost
+{
+    size_t m_bytes_received;
+
+protected:
+    virtual void doBroadcast(const std::vector<int>& group, int root, void* data, size_t bytes) = 0;
+    virtual void doAllgather(const std::vector<int>& group, const void* send, size_t bytes, void* recv) = 0;
+    virtual void doReduce(const std::vector<int>& group, int root, void* data, size_t count,
+                          Transport2dType type, Transport2dOp op) = 0;
+    virtual void doAllreduce(const std::vector<int>& group, void* data, size_t count,
+                             Transport2dType type, Transport2dOp op) = 0;
+
+public:
+    Transport2dHost() : m_bytes_received(0) {}
+    virtual ~Transport2dHost() {}
+
+    virtual int getRank() const = 0;
+    virtual int getSize() const = 0;
+
+    inline size_t getBytesReceived() const {return m_bytes_received;}
+    inline void resetBytesReceived() {m_bytes_received = 0;}
+
+    /*! Copies the bytes of data of rank root (in group) to data on the other ranks */
+    void broadcast(const std::vector<int>& group, int root, void* data, size_t bytes);
+
+    /*! Concatenates the bytes of send of the ranks of group into recv, in the group order */
+    void allgather(const std::vector<int>& group, const void* send, size_t bytes, void* recv);
+
+    /*! Reduces the count elements of data of the ranks of group in data on rank root */
+    void reduce(const std::vector<int>& group, int root, void* data, size_t count,
+                Transport2dType type, Transport2dOp op);
+
+    /*! Reduces the count elements of data of the ranks of group in data on every rank.
+     *  The elements are combined in the group order, every rank gets the same result.
+     */
+    void allreduce(const std::vector<int>& group, void* data, size_t count,
+                   Transport2dType type, Transport2dOp op);
+};
+
+/*! Shared state of the ranks of a loopback transport: the ranks are threads of one process,
+ *  the collectives read the buffers of the other ranks in place. For tests and single host runs.
+ */
+class LoopbackContext2dHost
+{
+    friend class LoopbackTransport2dHost;
+
+    int m_size;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    // arrivals and generation of the barrier of every group
+    std::map<std::vector<int>, std::pair<int, long long> > m_barriers;
+    // buffer published by every rank in its current collective
+    std::vector<const void*> m_slots;
+
+    void barrier(const std::vector<int>& group);
+
+public:
+    explicit LoopbackContext2dHost(int size);
+};
+
+class LoopbackTransport2dHost : public Transport2dHost
+{
+    LoopbackContext2dHost* m_context;
+    int m_rank;
+
+    // combines the elements of the ranks of group in the group order into result
+    void combine(const std::vector<int>& group, size_t count, Transport2dType type, Transport2dOp op,
+                 std::vector<char>& result) const;
+
+protected:
+    virtual void doBroadcast(const std::vector<int>& group, int root, void* data, size_t bytes);
+    virtual void doAllgather(const std::vector<int>& group, const void* send, size_t bytes, void* recv);
+    virtual void doReduce(const std::vector<int>& group, int root, void* data, size_t count,
+                          Transport2dType type, Transport2dOp op);
+    virtual void doAllreduce(const std::vector<int>& group, void* data, size_t count,
+                             Transport2dType type, Transport2dOp op);
+
+public:
+    LoopbackTransport2dHost(LoopbackContext2dHost* context, int rank);
+
+    virtual int getRank() const {return m_rank;}
+    virtual int getSize() const {return m_context->m_size;}
+};
+
+#ifdef NVGRAPH_USE_MPI
+/*! MPI transport, a rank per process of the communicator (built with -DNVGRAPH_MPI=ON).
+ *  The communicators of the groups are created on their first use and cached.
+ */
+class MpiTransport2dHost : public Transport2dHost
+{
+    MPI_Comm m_comm;
+    int m_rank;
+    int m_size;
+    std::map<std::vector<int>, MPI_Comm> m_group_comms;
+
+    MPI_Comm getGroupComm(const std::vector<int>& group);
+
+protected:
+    virtual void doBroadcast(const std::vector<int>& group, int root, void* data, size_t bytes);
+    virtual void doAllgather(const std::vector<int>& group, const void* send, size_t bytes, void* recv);
+    virtual void doReduce(const std::vector<int>& group, int root, void* data, size_t count,
+                          Transport2dType type, Transport2dOp op);
+    virtual void doAllreduce(const std::vector<int>& group, void* data, size_t count,
+                             Transport2dType type, Transport2dOp op);
+
+public:
+    /*! Duplicates comm, collective over comm */
+    explicit MpiTransport2dHost(MPI_Comm comm);
+    virtual ~MpiTransport2dHost();
+
+    virtual int getRank() const {return m_rank;}
+    virtual int getSize() const {return m_size;}
+};
+#endif
+
+/*! 2D decomposed matrix distributed over the ranks of a transport, rank b owns block b of the
+ *  decomposition (the transport has descr.getNumBlocks() ranks). The vertex data of row block i
+ *  live on the diagonal rank (i,i), they are sent to the other ranks of row (or column) i with
+ *  broadcasts and the partial results of the blocks are reduced into them, like the scatters
+ *  and reductions of VertexData2D.
+ *  The bytes received by the rank in every iteration of the last solve are kept, the sum over
+ *  the ranks is the volume exchanged by the iteration.
+ */
+template <typename GlobalType, typename LocalType, typename ValueType>
+class Matrix2dDistributedHost
+{
+    MatrixDecompositionDescriptionHost<GlobalType, LocalType> m_description;
+    Transport2dHost* m_transport;
+    int32_t m_block_row;
+    int32_t m_block_col;
+    std::vector<int> m_row_group;
+    std::vector<int> m_col_group;
+    std::vector<int> m_diagonal_group;
+    std::vector<int> m_all_group;
+    std::vector<LocalType> m_row_offsets;
+    std::vector<LocalType> m_col_indices;
+    std::vector<ValueType> m_values;
+    bool m_has_values;
+    std::vector<size_t> m_iteration_bytes;
+
+    inline bool isDiagonal() const {return m_block_row == m_block_col;}
+    inline int diagonalRank(int32_t rowId) const {return m_description.getDiagonalBlock(rowId);}
+    // number of vertices of row block i, without the padding of the last block
+    LocalType getBlockVertices(int32_t rowId) const;
+    // y = A_ij*x for the block of the rank
+    void blockSpmv(const ValueType* x, ValueType* y) const;
+    // copies the vertex data of every diagonal rank to out (numRows entries) on every rank
+    template <typename T>
+    void gatherVertexData(const std::vector<T>& data, T* out);
+
+public:
+    /*! Keeps the entries of the block of the rank, the other entries are skipped: every
+     *  process can pass the whole COO or only its part of it.
+     *  \param nnz Number of entries of rowIds, colIds and values
+     *  \param rowIds, colIds (host memory) global ids
+     *  \param values (host memory) NULL for a topology (all ones)
+     */
+    Matrix2dDistributedHost(const MatrixDecompositionDescriptionHost<GlobalType, LocalType>& descr,
+                            Transport2dHost* transport,
+                            GlobalType nnz,
+                            const GlobalType* rowIds,
+                            const GlobalType* colIds,
+                            const ValueType* values);
+
+    inline const MatrixDecompositionDescriptionHost<GlobalType, LocalType>& getMatrixDecompositionDescription() const {return m_description;}
+    inline LocalType getBlockNnz() const {return static_cast<LocalType>(m_col_indices.size());}
+    /*! Bytes received by the rank in every level (or iteration) of the last traverse (or pagerank) */
+    inline const std::vector<size_t>& getIterationBytes() const {return m_iteration_bytes;}
+
+    /*! Breadth first search from source, collective over the ranks. Same results as
+     *  Matrix2dHost::traverse: the frontier of row block i is broadcast along row i, the
+     *  candidate predecessors of column block j are min-reduced into the diagonal rank (j,j).
+     *  \param (output) distances, predecessors (host memory) numRows entries on every rank, can be NULL (the same on every rank)
+     */
+    NVGRAPH_ERROR traverse(GlobalType source, GlobalType* distances, GlobalType* predecessors);
+
+    /*! Pagerank of the matrix (the transposed transition matrix), collective over the ranks.
+     *  Same iterations as SubgraphViewHost::pagerank.
+     *  \param bookmark (host memory) numRows entries, 1 on the dangling vertices
+     *  \param guess (host memory) numRows entries, can be NULL
+     *  \param (output) pagerank (host memory) numRows entries on every rank
+     */
+    NVGRAPH_ERROR pagerank(ValueType damping_factor, const ValueType* bookmark, const ValueType* guess,
+                           float tolerance, int max_it, ValueType* pagerank);
+};
+
+} // end namespace nvgraph
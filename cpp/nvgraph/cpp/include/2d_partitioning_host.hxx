@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "nvgraph_error.hxx"
+
+namespace nvgraph
+{
+/*! Host counterpart of the 2D decomposition of 2d_partitioning.h, for multi-socket hosts.
+ *  The square matrix is cut in blockN x blockN blocks of offset rows and columns. Block b is
+ *  owned by the OpenMP thread b % numThreads: the thread allocates and first touches the block
+ *  and its vertex data, so they are in the memory of its NUMA node, and runs every operation
+ *  on the block. The teams are created with proc_bind(spread), run with OMP_PLACES=sockets
+ *  (or numa_domains) to pin a thread per node.
+ *  Vertex data are exchanged in shared memory: a block reads the data of the diagonal block
+ *  of its row or column in place (no scatter), and the reductions are split in slices, the
+ *  owner of block (i,j) reducing slice j of row i (or slice i of column j).
+ */
+template <typename GlobalType, typename LocalType>
+class MatrixDecompositionDescriptionHost
+{
+    GlobalType m_num_rows;
+    GlobalType m_nnz;
+    int32_t m_block_rows;
+    LocalType m_offset;
+    int m_num_threads;
+
+public:
+    /*! \param numRows Number of rows (and columns) of the matrix
+     *  \param blockN Number of rows (and columns) of blocks
+     *  \param nnz Number of non zeros of the matrix
+     *  \param numThreads Threads of the teams, 0 for min(blocks, omp_get_max_threads())
+     */
+    MatrixDecompositionDescriptionHost(GlobalType numRows, int32_t blockN, GlobalType nnz, int numThreads = 0);
+
+    inline GlobalType getNumRows() const {return m_num_rows;}
+    inline GlobalType getNnz() const {return m_nnz;}
+    inline int32_t getBlockRows() const {return m_block_rows;}
+    inline int32_t getBlockCols() const {return m_block_rows;}
+    inline int32_t getNumBlocks() const {return m_block_rows * m_block_rows;}
+    inline LocalType getOffset() const {return m_offset;}
+    inline int getNumThreads() const {return m_num_threads;}
+
+    inline int32_t getBlockId(int32_t rowId, int32_t colId) const {return rowId * m_block_rows + colId;}
+    inline int32_t getBlockRow(int32_t bId) const {return bId / m_block_rows;}
+    inline int32_t getBlockCol(int32_t bId) const {return bId % m_block_rows;}
+    inline int32_t getDiagonalBlock(int32_t rowId) const {return getBlockId(rowId, rowId);}
+
+    /*! Block of the global entry (globalRow, globalCol) and its local row and column */
+    inline void convertGlobaltoLocalRow(GlobalType globalRow, GlobalType globalCol,
+                                        LocalType& localRow, LocalType& localCol, int32_t& blockId) const
+    {
+        int32_t rowId = static_cast<int32_t>(globalRow / m_offset);
+        int32_t colId = static_cast<int32_t>(globalCol / m_offset);
+        blockId = getBlockId(rowId, colId);
+        localRow = static_cast<LocalType>(globalRow - static_cast<GlobalType>(rowId) * m_offset);
+        localCol = static_cast<LocalType>(globalCol - static_cast<GlobalType>(colId) * m_offset);
+    }
+
+    /*! Global id of the local index k of row (or column) block rowId */
+    inline GlobalType getGlobalId(int32_t rowId, LocalType k) const
+    {
+        return static_cast<GlobalType>(rowId) * m_offset + k;
+    }
+
+    /*! Slice s of nslices of the offset local indices */
+    inline LocalType getSliceBegin(int32_t s, int32_t nslices) const
+    {
+        return static_cast<LocalType>(static_cast<long long>(m_offset) * s / nslices);
+    }
+};
+
+/*! Vertex data of a host 2D decomposition: two buffers (current and alternate) of offset
+ *  elements per block, like VertexData2D. The data of row block i is valid in the diagonal
+ *  block (i,i), the other blocks hold partial results.
+ */
+template <typename GlobalType, typename LocalType, typename ValueType>
+class VertexData2DHost
+{
+    const MatrixDecompositionDescriptionHost<GlobalType, LocalType>* m_description;
+    LocalType m_n;
+    std::vector<std::vector<ValueType> > m_current;
+    std::vector<std::vector<ValueType> > m_alternate;
+
+public:
+    /*! Allocates the buffers of every block in the thread that owns it */
+    VertexData2DHost(const MatrixDecompositionDescriptionHost<GlobalType, LocalType>* descr);
+
+    inline LocalType getN() const {return m_n;}
+    inline const MatrixDecompositionDescriptionHost<GlobalType, LocalType>* getDescription() const {return m_description;}
+    inline ValueType* getCurrent(int32_t bId) {return m_current[bId].data();}
+    inline const ValueType* getCurrent(int32_t bId) const {return m_current[bId].data();}
+    inline ValueType* getAlternate(int32_t bId) {return m_alternate[bId].data();}
+    inline void swapBuffers() {m_current.swap(m_alternate);}
+
+    /*! Data of the row block of block bId, read in place in the diagonal block */
+    inline const ValueType* getRowData(int32_t bId) const
+    {
+        return getCurrent(m_description->getDiagonalBlock(m_description->getBlockRow(bId)));
+    }
+
+    /*! Data of the column block of block bId, read in place in the diagonal block */
+    inline const ValueType* getColumnData(int32_t bId) const
+    {
+        return getCurrent(m_description->getDiagonalBlock(m_description->getBlockCol(bId)));
+    }
+
+    /*! Sets the diagonal blocks from the numRows global values */
+    void setElements(const ValueType* vals);
+
+    /*! Copies the diagonal blocks to the numRows global values */
+    void getElements(ValueType* vals) const;
+
+    /*! Fills the diagonal blocks with val */
+    void fillElements(ValueType val);
+
+    /*! Reduces the current buffers of every row (column) of blocks into its diagonal block.
+     *  Collective: called by every thread of a team of getNumThreads() threads, the call
+     *  starts and ends with a barrier. Instantiated for std::plus.
+     */
+    template <typename Operator>
+    void rowReduce();
+    template <typename Operator>
+    void columnReduce();
+};
+
+/*! Host 2D decomposed matrix: a CSR per block, with the local rows and columns of the block */
+template <typename GlobalType, typename LocalType, typename ValueType>
+class Matrix2dHost
+{
+    MatrixDecompositionDescriptionHost<GlobalType, LocalType> m_description;
+    std::vector<std::vector<LocalType> > m_row_offsets;
+    std::vector<std::vector<LocalType> > m_col_indices;
+    std::vector<std::vector<ValueType> > m_values;
+    bool m_has_values;
+
+public:
+    /*! Builds the blocks from a COO in any order, every block in the thread that owns it.
+     *  The entries of a block row keep their input order.
+     *  \param rowIds, colIds (host memory) descr.getNnz() global ids
+     *  \param values (host memory) descr.getNnz() entries, NULL for a topology (all ones)
+     */
+    Matrix2dHost(const MatrixDecompositionDescriptionHost<GlobalType, LocalType>& descr,
+                 const GlobalType* rowIds,
+                 const GlobalType* colIds,
+                 const ValueType* values);
+
+    inline const MatrixDecompositionDescriptionHost<GlobalType, LocalType>& getMatrixDecompositionDescription() const {return m_description;}
+    inline const LocalType* getBlockRowOffsets(int32_t bId) const {return m_row_offsets[bId].data();}
+    inline const LocalType* getBlockColIndices(int32_t bId) const {return m_col_indices[bId].data();}
+    inline const ValueType* getBlockValues(int32_t bId) const {return m_has_values ? m_values[bId].data() : NULL;}
+    inline LocalType getBlockNnz(int32_t bId) const {return static_cast<LocalType>(m_col_indices[bId].size());}
+
+    /*! y = A*x: every block multiplies the data of its column block, then the rows are reduced.
+     *  x is read on the diagonal blocks, y is valid on the diagonal blocks, x and y are different.
+     */
+    void spmv(const VertexData2DHost<GlobalType, LocalType, ValueType>& x,
+              VertexData2DHost<GlobalType, LocalType, ValueType>& y) const;
+
+    /*! Breadth first search from source, following the row -> column entries. Level synchronous:
+     *  block (i,j) expands the frontier of row block i into candidates of column block j, the
+     *  candidates of every column block are reduced in slices into its next frontier.
+     *  distances[v] = INT_MAX (max of GlobalType) and predecessors[v] = -1 if v is not reached,
+     *  the predecessor of v is its lowest id neighbor in the previous level.
+     *  \param (output) distances (host memory) numRows entries, can be NULL
+     *  \param (output) predecessors (host memory) numRows entries, can be NULL
+     */
+    NVGRAPH_ERROR traverse(GlobalType source, GlobalType* distances, GlobalType* predecessors) const;
+};
+
+} // end namespace nvgraph
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <random>
+#include <vector>
+#include "nvgraph_error.hxx"
+#include "matrix_host.hxx"
+
+namespace nvgraph
+{
+/*! Host implicitly restarted Arnoldi solver.
+ *  Same algorithm and parameters as ImplicitArnoldi (IRAM, optionally MIRAMns
+ *  nested subspaces, Laplacian and Markov/pagerank operators), on a CSR matrix in
+ *  host memory. The Krylov basis is orthogonalized with classical Gram-Schmidt
+ *  with two passes (CGS2): each pass reads the basis once, block of rows by block
+ *  of rows, instead of once per basis vector as modified Gram-Schmidt does.
+ */
+template <typename IndexType_, typename ValueType_>
+class ImplicitArnoldiHost
+{
+public:
+    typedef IndexType_ IndexType;
+    typedef ValueType_ ValueType;
+
+private:
+    //Arnoldi
+    CsrMatrixHost<IndexType, ValueType> m_A;
+    std::vector<ValueType> m_V;               // Each colum is a vector of size n, colum major storage
+    std::vector<ValueType> m_f;               // residual vector during the basis refinement
+    ValueType* m_eigenvectors;
+    std::vector<ValueType> m_H;
+    std::vector<ValueType> m_H_select;
+    std::vector<ValueType> m_H_tmp;            // (lapack likes to overwrite input)
+    std::vector<ValueType> m_ritz_eigenvalues;
+    std::vector<ValueType> m_ritz_eigenvalues_i;
+    std::vector<ValueType> m_ritz_eigenvectors;
+    std::vector<ValueType> m_Q;
+    std::vector<ValueType> m_Q_tmp;            // (lapack likes to overwrite input)
+    std::vector<ValueType> m_mns_residuals;    // resuals of subspaces
+    std::vector<ValueType> m_mns_beta;         // resuals of subspaces
+    std::vector<ValueType> m_h;                // Gram-Schmidt coefficients, first pass
+    std::vector<ValueType> m_h2;               // Gram-Schmidt coefficients, second pass
+    std::vector<ValueType> m_partial;          // partial sums of the blocked dot products
+    std::mt19937_64 m_rng;                     // starting vector and breakdowns
+
+    std::vector<ValueType> m_a; // Markov
+    std::vector<ValueType> m_D; // Laplacian
+
+    ValueType m_beta;     // from arnoldi projection algorithm
+    ValueType m_residual; // is set by compute_residual()
+    ValueType m_damping; // for Markov and Pagerank
+
+    float m_tolerance;
+
+    int m_nr_eigenvalues; // the number of wanted eigenvals, also called k in the litterature
+    int m_n_eigenvalues; // the number of  eigenvals we keep in the solver, this greater or equal to k, this can be m_nr_eigenvalues or m_nr_eigenvalues+1
+    int m_krylov_size;   // the maximum size of the krylov sobspace, also called m in the litterature (m=k+p)
+    int m_iterations;    // a counter of restart, each restart cost m_krylov_size-m_n_eigenvalues arnoldi iterations (~spmv)
+    int m_max_iter; // maximum number of iterations
+
+    int m_parts; // laplacian related
+
+    //miramns related ints
+    int m_nested_subspaces;     // the number of subspace to evaluate in MIRAMns
+    int m_nested_subspaces_freq;     // the frequence at which we should evaluate subspaces in MIRAMns
+    int m_select;        // best subspace size
+    int m_select_idx; // best subspace number (0 indexed)
+    int m_safety_lower_bound;   // The smallest subspace to check is m_safety_lower_bound+m_nr_eigenvalues+1
+
+    bool m_converged;
+    bool m_markov;
+    bool m_miramns;
+    bool m_dirty_bit; // to know if H has changed, so if we need to call geev
+    bool m_laplacian;
+
+    // y = Op*x, where Op is A, its Laplacian or the Google matrix
+    void apply(const ValueType* x, ValueType* y);
+
+    // v = random unit vector orthogonal to the k first basis vectors
+    void random_vector(int k, ValueType* v);
+
+    // Warning : here an iteration is a restart
+    bool solve_it();
+
+    //  Input:  A V[0]
+    //  Output: V, H, f(=V[m_krylov_size])
+    bool solve_arnoldi(int lower_bound, int upper_bound);
+
+    //  Input:  H - a real square upper Hessenberg matrix
+    //  Output: w - eigenvalues of H sorted according to which
+    //              most wanted to least wanted order
+    //  Optionally compute the eigenvalues of H
+    void select_shifts(bool dirty_bit=false);
+
+    // reorder eigenpairs by largest real part
+    void LR(int subspace_sz);
+
+    // reorder eigenpairs by largest magnitude
+    void LM(int subspace_sz);
+
+    // reorder eigenpairs by smallest real part
+    void SR(int subspace_sz);
+
+    // Shifted QR steps on H, accumulated in Q (see ImplicitArnoldi::qr_step)
+    void qr_step();
+
+    // Update V and f using Q+ and H+
+    void refine_basis();
+
+    // Approximate residual of the largest Ritz pair of H
+    // Optionally compute the eigenvalues of H
+    void compute_residual(int subspace_size, bool dirty_bit=false);
+
+    void compute_eigenvectors();
+
+    void select_subspace();
+
+    // extract H_select from H
+    void extract_subspace(int m);
+
+    // clean everything outside of the new_sz*new_sz hessenberg matrix (in colum major)
+    void cleanup_subspace(std::vector<ValueType_>& v, int ld, int new_sz);
+
+    // subtract mu from the diagonal of the last m columns
+    void shift(std::vector<ValueType_>& H, int ld, int m, ValueType mu);
+
+public:
+    /*! Create a host Arnoldi solver for the dominant eigenpairs of a CSR matrix
+     *  \param n Number of rows and columns
+     *  \param nnz Number of non-zeros
+     *  \param csr_offsets (host memory) n+1 entries
+     *  \param csr_indices (host memory) nnz entries
+     *  \param csr_values (host memory) nnz entries, NULL for ones
+     */
+    ImplicitArnoldiHost(IndexType n, IndexType nnz,
+                        const IndexType* csr_offsets,
+                        const IndexType* csr_indices,
+                        const ValueType* csr_values);
+
+    /*! Create a host Arnoldi solver for the smallest eigenpairs of the Laplacian
+     *  of the adjacency matrix (csr_offsets, csr_indices, csr_values)
+     */
+    ImplicitArnoldiHost(IndexType n, IndexType nnz,
+                        const IndexType* csr_offsets,
+                        const IndexType* csr_indices,
+                        const ValueType* csr_values,
+                        int parts);
+
+    /*! Create a host Arnoldi solver for the equilibrium of a Markov chain (pagerank)
+     *  Op*x = alpha*A*x + (a'*x)/n, where a is dangling_nodes with its zeros replaced by 1-alpha.
+     *  \param dangling_nodes (host memory) n entries
+     */
+    ImplicitArnoldiHost(IndexType n, IndexType nnz,
+                        const IndexType* csr_offsets,
+                        const IndexType* csr_indices,
+                        const ValueType* csr_values,
+                        const ValueType* dangling_nodes,
+                        const float tolerance, const int max_iter, ValueType alpha=0.95);
+
+    void setup(const ValueType* initial_guess, const int restart_it, const int nEigVals); // public because we want to use and test that directly and/or separately
+
+    // Starting from  V, H, f :
+    // Call the QRstep, project the update, launch the arnlodi with the new base
+    // and check the quality of the new result
+    void implicit_restart(); // public because we want to use and test that directly and/or separately
+
+    /*! Compute the nEigVals wanted eigenpairs.
+     *  The total number of SPMV will be : m_krylov_size + (m_krylov_size-m_n_eigenvalues)*nb_restart
+     *  \param initial_guess (host memory) n entries, NULL for a random start
+     *  \param (output) eigVals (host memory) nEigVals entries, real parts
+     *  \param (output) eigVecs (host memory) n x nEigVals column major,
+     *                  the Markov eigenvector sums to one
+     */
+    NVGRAPH_ERROR solve(const int restart_it, const int nEigVals,
+                     const ValueType* initial_guess,
+                     ValueType* eigVals,
+                     ValueType* eigVecs,
+                     const int n_sub_space=0);
+
+    inline ValueType get_residual() const {return m_residual;}
+    inline int get_iterations() const {return m_iterations;}
+
+    // we use that for tests
+    std::vector<ValueType> get_H_copy() {return m_H;}
+    std::vector<ValueType> get_Hs_copy() {return m_H_select;}
+    std::vector<ValueType> get_ritz_eval_copy(){return m_ritz_eigenvalues;} // should be called after select_shifts
+    std::vector<ValueType> get_V_copy() {return m_V;}
+};
+
+} // end namespace nvgraph
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <nvgraph.h>
+#include "nvgraph_error.hxx"
+
+// number of keys (columns) above which the transpose scatters in two passes:
+// first to blocks of 2^CONVERT_HOST_BLOCK_BITS keys, then inside each block
+#define CONVERT_HOST_BLOCK_THR (1 << 16)
+#define CONVERT_HOST_BLOCK_BITS 14
+
+namespace nvgraph
+{
+/*! Host counterparts of the conversions of nvgraph_convert.hxx, all arrays are in host memory.
+ *  The transposes are a stable counting sort: every thread counts the keys of its slice of
+ *  the entries, the per thread counts are prefix summed into the offsets, then every thread
+ *  scatters its slice. Entries with the same key keep their input order, so the rows of a
+ *  CSC built from a CSR are sorted, like the ones of the cuSPARSE conversions.
+ *  Values can be NULL (topology only). p (nnz entries, can be NULL) receives the input
+ *  position of every output entry, out[k] = in[p[k]], to permute other edge sets later.
+ *  Above block_threshold keys the scatter is cache blocked (see CONVERT_HOST_BLOCK_THR).
+ */
+
+/*! Expand the m+1 row offsets to the row index of every entry */
+template <typename IndexType>
+void csr2coo_host(const IndexType* csrRowPtr, IndexType nnz, IndexType m, IndexType* cooRowInd);
+
+/*! Compress the row indices of a COO sorted by row into m+1 offsets */
+template <typename IndexType>
+void coo2csr_host(const IndexType* cooRowInd, IndexType nnz, IndexType m, IndexType* csrRowPtr);
+
+/*! Transpose a m x n CSR into a CSC (n+1 column offsets, row indices).
+ *  Also converts a CSC into a CSR with the roles of the arrays swapped.
+ */
+template <typename IndexType, typename ValueType>
+void csr2csc_host(IndexType m, IndexType n, IndexType nnz,
+                  const IndexType* csrRowPtr, const IndexType* csrColInd, const ValueType* csrVal,
+                  IndexType* cscRowInd, IndexType* cscColPtr, ValueType* cscVal,
+                  IndexType* p = NULL,
+                  IndexType block_threshold = CONVERT_HOST_BLOCK_THR);
+
+/*! Compress a COO in any order into a CSR with m rows.
+ *  The entries of a row keep their input order: a COO sorted by destination gives sorted rows.
+ */
+template <typename IndexType, typename ValueType>
+void coou2csr_host(IndexType m, IndexType nnz,
+                   const IndexType* cooRowInd, const IndexType* cooColInd, const ValueType* cooVal,
+                   IndexType* csrRowPtr, IndexType* csrColInd, ValueType* csrVal,
+                   IndexType* p = NULL,
+                   IndexType block_threshold = CONVERT_HOST_BLOCK_THR);
+
+/*! Same conversions as nvgraphConvertTopology, for the 32 bits CSR, CSC and COO topologies
+ *  in host memory. srcEdgeData and dstEdgeData can both be NULL to convert the topology only.
+ *  Sorted COO outputs are sorted by (source, destination) or (destination, source) like the
+ *  cuSPARSE ones, unsorted COO inputs are sorted by the two keys.
+ */
+template <typename ValueType>
+NVGRAPH_ERROR convert_topology_host(nvgraphTopologyType_t srcTType, const void* srcTopology, const ValueType* srcEdgeData,
+                                    nvgraphTopologyType_t dstTType, void* dstTopology, ValueType* dstEdgeData);
+
+} // end namespace nvgraph
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+// Number of rows per work block. Reductions are summed block by
+// block in a fixed order so results do not depend on the number of
+// threads, and a block of basis vectors stays in cache during the
+// restart product.
+#define DENSE_HOST_BLOCK 512
+
+// Get index of matrix entry
+#define IDX(i,j,lda) ((i)+(j)*(lda))
+
+namespace nvgraph {
+
+  /// Blocked dense kernels of the host eigensolvers
+  /** Column-major tall matrices, blocked over the rows and
+   *  parallelized with OpenMP.
+   */
+  namespace dense_host {
+
+    /// h = X'*y for the k first columns of X
+    template <typename IndexType_, typename ValueType_>
+    void blockedDots(IndexType_ n, IndexType_ k,
+                     const ValueType_ * X, IndexType_ ldx,
+                     const ValueType_ * y, ValueType_ * h,
+                     std::vector<ValueType_> & partial) {
+      IndexType_ nBlocks = (n+DENSE_HOST_BLOCK-1)/DENSE_HOST_BLOCK;
+      partial.resize(static_cast<size_t>(nBlocks)*k);
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ b=0; b<nBlocks; ++b) {
+        IndexType_ begin = b*DENSE_HOST_BLOCK;
+        IndexType_ end = std::min(n, begin+DENSE_HOST_BLOCK);
+        for(IndexType_ j=0; j<k; ++j) {
+          const ValueType_ * x = X+IDX(0,j,ldx);
+          ValueType_ s = 0;
+          #pragma omp simd reduction(+:s)
+          for(IndexType_ i=begin; i<end; ++i)
+            s += x[i]*y[i];
+          partial[static_cast<size_t>(b)*k+j] = s;
+        }
+      }
+      for(IndexType_ j=0; j<k; ++j)
+        h[j] = 0;
+      for(IndexType_ b=0; b<nBlocks; ++b)
+        for(IndexType_ j=0; j<k; ++j)
+          h[j] += partial[static_cast<size_t>(b)*k+j];
+    }
+
+    /// Euclidean norm of a vector
+    template <typename IndexType_, typename ValueType_>
+    ValueType_ nrm2(IndexType_ n, const ValueType_ * x,
+                    std::vector<ValueType_> & partial) {
+      ValueType_ s;
+      blockedDots(n, (IndexType_) 1, x, n, x, &s, partial);
+      return std::sqrt(s);
+    }
+
+    /// y = y - X*h for the k first columns of X
+    template <typename IndexType_, typename ValueType_>
+    void gemvMinus(IndexType_ n, IndexType_ k,
+                   const ValueType_ * X, IndexType_ ldx,
+                   const ValueType_ * h, ValueType_ * y) {
+      IndexType_ nBlocks = (n+DENSE_HOST_BLOCK-1)/DENSE_HOST_BLOCK;
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ b=0; b<nBlocks; ++b) {
+        IndexType_ begin = b*DENSE_HOST_BLOCK;
+        IndexType_ end = std::min(n, begin+DENSE_HOST_BLOCK);
+        for(IndexType_ j=0; j<k; ++j) {
+          const ValueType_ * x = X+IDX(0,j,ldx);
+          ValueType_ hj = h[j];
+          #pragma omp simd
+          for(IndexType_ i=begin; i<end; ++i)
+            y[i] -= hj*x[i];
+        }
+      }
+    }
+
+    /// Y = X*C, with X n x m, C m x k and Y n x k
+    /** Blocked over the rows, each block of the result is computed in
+     *  a thread buffer before it is written, so Y may be the k first
+     *  columns of X.
+     */
+    template <typename IndexType_, typename ValueType_>
+    void blockedGemm(IndexType_ n, IndexType_ m, IndexType_ k,
+                     const ValueType_ * X, IndexType_ ldx,
+                     const ValueType_ * C, IndexType_ ldc,
+                     ValueType_ * Y, IndexType_ ldy) {
+      IndexType_ nBlocks = (n+DENSE_HOST_BLOCK-1)/DENSE_HOST_BLOCK;
+      #pragma omp parallel
+      {
+        std::vector<ValueType_> tmp(static_cast<size_t>(DENSE_HOST_BLOCK)*k);
+        #pragma omp for schedule(static)
+        for(IndexType_ b=0; b<nBlocks; ++b) {
+          IndexType_ begin = b*DENSE_HOST_BLOCK;
+          IndexType_ len = std::min(n, begin+DENSE_HOST_BLOCK)-begin;
+          std::fill(tmp.begin(), tmp.end(), (ValueType_) 0);
+          for(IndexType_ j=0; j<k; ++j) {
+            ValueType_ * t = &tmp[static_cast<size_t>(j)*DENSE_HOST_BLOCK];
+            for(IndexType_ l=0; l<m; ++l) {
+              ValueType_ c = C[IDX(l,j,ldc)];
+              if(c == 0)
+                continue;
+              const ValueType_ * x = X+IDX(begin,l,ldx);
+              #pragma omp simd
+              for(IndexType_ i=0; i<len; ++i)
+                t[i] += c*x[i];
+            }
+          }
+          for(IndexType_ j=0; j<k; ++j)
+            memcpy(Y+IDX(begin,j,ldy), &tmp[static_cast<size_t>(j)*DENSE_HOST_BLOCK],
+                   len*sizeof(ValueType_));
+        }
+      }
+    }
+
+    /// C = X'*Y for the p first columns of X and the k first columns of Y
+    /** Partial products are summed block by block in a fixed order, as
+     *  in blockedDots.
+     */
+    template <typename IndexType_, typename ValueType_>
+    void blockedGemmT(IndexType_ n, IndexType_ p, IndexType_ k,
+                      const ValueType_ * X, IndexType_ ldx,
+                      const ValueType_ * Y, IndexType_ ldy,
+                      ValueType_ * C, IndexType_ ldc,
+                      std::vector<ValueType_> & partial) {
+      IndexType_ nBlocks = (n+DENSE_HOST_BLOCK-1)/DENSE_HOST_BLOCK;
+      size_t pk = static_cast<size_t>(p)*k;
+      partial.resize(nBlocks*pk);
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ b=0; b<nBlocks; ++b) {
+        IndexType_ begin = b*DENSE_HOST_BLOCK;
+        IndexType_ end = std::min(n, begin+DENSE_HOST_BLOCK);
+        for(IndexType_ j=0; j<k; ++j) {
+          const ValueType_ * y = Y+IDX(0,j,ldy);
+          for(IndexType_ l=0; l<p; ++l) {
+            const ValueType_ * x = X+IDX(0,l,ldx);
+            ValueType_ s = 0;
+            #pragma omp simd reduction(+:s)
+            for(IndexType_ i=begin; i<end; ++i)
+              s += x[i]*y[i];
+            partial[b*pk+IDX(l,j,p)] = s;
+          }
+        }
+      }
+      for(IndexType_ j=0; j<k; ++j)
+        for(IndexType_ l=0; l<p; ++l)
+          C[IDX(l,j,ldc)] = 0;
+      for(IndexType_ b=0; b<nBlocks; ++b)
+        for(IndexType_ j=0; j<k; ++j)
+          for(IndexType_ l=0; l<p; ++l)
+            C[IDX(l,j,ldc)] += partial[b*pk+IDX(l,j,p)];
+    }
+
+    /// Y = Y - X*C, with X n x p, C p x k and Y n x k
+    template <typename IndexType_, typename ValueType_>
+    void gemmMinus(IndexType_ n, IndexType_ p, IndexType_ k,
+                   const ValueType_ * X, IndexType_ ldx,
+                   const ValueType_ * C, IndexType_ ldc,
+                   ValueType_ * Y, IndexType_ ldy) {
+      IndexType_ nBlocks = (n+DENSE_HOST_BLOCK-1)/DENSE_HOST_BLOCK;
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ b=0; b<nBlocks; ++b) {
+        IndexType_ begin = b*DENSE_HOST_BLOCK;
+        IndexType_ end = std::min(n, begin+DENSE_HOST_BLOCK);
+        for(IndexType_ j=0; j<k; ++j) {
+          ValueType_ * y = Y+IDX(0,j,ldy);
+          for(IndexType_ l=0; l<p; ++l) {
+            const ValueType_ * x = X+IDX(0,l,ldx);
+            ValueType_ c = C[IDX(l,j,ldc)];
+            #pragma omp simd
+            for(IndexType_ i=begin; i<end; ++i)
+              y[i] -= c*x[i];
+          }
+        }
+      }
+    }
+
+  }
+
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+namespace nvgraph {
+
+  /// One level of a multilevel graph hierarchy (host memory)
+  /** The finest level points to the user arrays, the coarser ones
+   *  to their own storage (the *_s vectors).
+   */
+  template <typename IndexType_, typename ValueType_>
+  struct GraphLevelHost {
+    /// Number of vertices
+    IndexType_ n;
+    /// CSR offsets (n+1 entries)
+    const IndexType_ * rowPtr;
+    /// CSR column indices
+    const IndexType_ * colInd;
+    /// Edge weights, NULL for unit weights
+    const ValueType_ * val;
+    std::vector<IndexType_> rowPtr_s;
+    std::vector<IndexType_> colInd_s;
+    std::vector<ValueType_> val_s;
+    /// Vertex weights, empty for unit weights
+    std::vector<IndexType_> vwgt;
+    /// Vertex of the next coarser level containing each vertex
+    std::vector<IndexType_> coarse;
+
+    IndexType_ weight(IndexType_ v) const {
+      return vwgt.empty() ? 1 : vwgt[v];
+    }
+    ValueType_ edge(IndexType_ j) const {
+      return (val != NULL) ? val[j] : 1;
+    }
+  };
+
+  /// Heavy-edge matching on the host
+  /** Each unmatched vertex points to its most similar unmatched
+   *  neighbor (A_ij/max(d_i,d_j), the SCALED_BY_ROW_SUM similarity of
+   *  Size2Selector) and mutual pairs are matched, in up to 15 rounds.
+   *  Pairs heavier than maxVwgt are not formed and self loops are
+   *  ignored.
+   *
+   *  @param G Graph level.
+   *  @param maxVwgt Largest vertex weight of a pair.
+   *  @param match (Output, G.n entries) Matched vertex, -1 for
+   *    unmatched vertices.
+   *  @return Number of matched pairs.
+   */
+  template <typename IndexType_, typename ValueType_>
+  IndexType_ heavyEdgeMatching_host(const GraphLevelHost<IndexType_,ValueType_> & G,
+                                    IndexType_ maxVwgt,
+                                    std::vector<IndexType_> & match);
+
+  /// Contract matched pairs on the host
+  /** Each pair (or unmatched vertex) becomes a vertex of the coarse
+   *  graph whose weight is the sum of the fine weights. Parallel edges
+   *  are merged by adding their weights and edges inside a pair are
+   *  dropped, so the Laplacian of C is P'*L*P for the piecewise
+   *  constant prolongation P.
+   *
+   *  @param G Fine level. On exit, G.coarse maps its vertices to the
+   *    vertices of C.
+   *  @param match Matching of G (see heavyEdgeMatching_host).
+   *  @param C (Output) Coarse level, pointing to its own storage.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void contractGraph_host(GraphLevelHost<IndexType_,ValueType_> & G,
+                          const std::vector<IndexType_> & match,
+                          GraphLevelHost<IndexType_,ValueType_> & C);
+
+}
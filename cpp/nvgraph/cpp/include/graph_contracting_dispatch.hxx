@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/functional.h>
+#include "nvgraph_error.hxx"
+#include "csr_graph.hxx"
+#include "multi_valued_csr_graph.hxx"
+
+namespace nvgraph
+{
+  //(the C header will have something similar)
+  //add more enums for additional Functor Types;
+  //
+  //CAVEAT: NrFctrTypes MUST be last in enum!
+  //additions can be made anywhere between enum...=0 and NrFctrTypes!
+  //
+  typedef enum{Multiply=0, Sum, Min, Max, NrFctrTypes} SemiRingFunctorTypes;
+
+  //Partial specialization to select proper
+  //functor through an integer, at compile time
+  //
+  template<SemiRingFunctorTypes, typename ValueT>
+  struct SemiRingFctrSelector;
+
+  template<typename ValueT>
+  struct SemiRingFctrSelector<Multiply, ValueT>
+  {
+    typedef typename thrust::multiplies<ValueT> FctrType;
+  };
+
+  template<typename ValueT>
+  struct SemiRingFctrSelector<Sum, ValueT>
+  {
+    typedef typename thrust::plus<ValueT> FctrType;
+  };
+
+  template<typename ValueT>
+  struct SemiRingFctrSelector<Min, ValueT>
+  {
+    typedef typename thrust::minimum<ValueT> FctrType;
+  };
+
+  template<typename ValueT>
+  struct SemiRingFctrSelector<Max, ValueT>
+  {
+    typedef typename thrust::maximum<ValueT> FctrType;
+  };
+
+  //...add more specializations for additional Functor Types
+
+  //Tag type of a semiring operator
+  //
+  template<SemiRingFunctorTypes Op>
+  struct SemiRingTag
+  {
+    static const SemiRingFunctorTypes value = Op;
+  };
+
+  //Compile-time dispatch of a (combine, reduce) pair of operators:
+  //calls fctr.template apply<SemiRingTag<combine>, SemiRingTag<reduce> >(),
+  //so that only the pairs of operators used by fctr get instantiated
+  //(NrFctrTypes^2 per functor, instead of the NrFctrTypes^4 products
+  //of the vertex and edge operators)
+  //
+  template<typename CombineTag, typename Fctr>
+  void dispatch_semiring_reduce(SemiRingFunctorTypes reduce, Fctr& fctr)
+  {
+    switch( reduce )
+    {
+    case Multiply: fctr.template apply<CombineTag, SemiRingTag<Multiply> >(); break;
+    case Sum:      fctr.template apply<CombineTag, SemiRingTag<Sum> >();      break;
+    case Min:      fctr.template apply<CombineTag, SemiRingTag<Min> >();      break;
+    case Max:      fctr.template apply<CombineTag, SemiRingTag<Max> >();      break;
+    default:
+      FatalError("Unknown semiring operator in graph contraction.",NVGRAPH_ERR_BAD_PARAMETERS);
+    }
+  }
+
+  template<typename Fctr>
+  void dispatch_semiring(SemiRingFunctorTypes combine, SemiRingFunctorTypes reduce, Fctr& fctr)
+  {
+    switch( combine )
+    {
+    case Multiply: dispatch_semiring_reduce<SemiRingTag<Multiply> >(reduce, fctr); break;
+    case Sum:      dispatch_semiring_reduce<SemiRingTag<Sum> >(reduce, fctr);      break;
+    case Min:      dispatch_semiring_reduce<SemiRingTag<Min> >(reduce, fctr);      break;
+    case Max:      dispatch_semiring_reduce<SemiRingTag<Max> >(reduce, fctr);      break;
+    default:
+      FatalError("Unknown semiring operator in graph contraction.",NVGRAPH_ERR_BAD_PARAMETERS);
+    }
+  }
+
+  //Graph contraction (see GraphContractionVisitor for the semantics):
+  //S = aggregation matrix (n_aggregates x n, ones),
+  //contracted topology = pattern of S*G*St,
+  //contracted vertex data = S*v (vertex semiring),
+  //contracted edge data = (S*G)*St (edge semiring).
+  //
+  //The pattern is built once by sorting and every vertex (edge) set
+  //is then reduced in the same reduce_by_key pass;
+  //aggregates: (host memory) n entries, n must be the number of vertices
+  //of graph and every value of [0, max(aggregates)] must be used;
+  //
+  template<typename IndexT>
+  CsrGraph<IndexT>* contract_graph(CsrGraph<IndexT>& graph,
+                                   IndexT* aggregates,
+                                   size_t n,
+                                   cudaStream_t stream);
+
+  template<typename IndexT, typename ValueT>
+  MultiValuedCsrGraph<IndexT, ValueT>* contract_graph(MultiValuedCsrGraph<IndexT, ValueT>& graph,
+                                                      IndexT* aggregates,
+                                                      size_t n,
+                                                      cudaStream_t stream,
+                                                      SemiRingFunctorTypes VCombine,
+                                                      SemiRingFunctorTypes VReduce,
+                                                      SemiRingFunctorTypes ECombine,
+                                                      SemiRingFunctorTypes EReduce);
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vector>
+#include "nvgraph.h"
+#include "nvgraph_error.hxx"
+
+namespace nvgraph
+{
+/*! Host graph contraction.
+ *  Same result as GraphContractionVisitor (nvgraphContractGraph): with S the
+ *  n_aggregates x n aggregation matrix of ones, the contracted vertex data is S*x
+ *  (SpMV with the vertex semiring, starting from 0 like the device SpMV) and the
+ *  contracted edge data is (S*G)*S' (two SpGEMM with the edge semiring).
+ *  Nothing is sorted globally: S is built with a counting sort and each row of
+ *  the contracted graph is accumulated by one OpenMP thread in private dense
+ *  accumulators (owner/position arrays indexed by the column), the rows are then
+ *  merged into the contracted CSR with a prefix sum of their lengths.
+ */
+template <typename IndexType_, typename ValueType_>
+class GraphContractionHost
+{
+public:
+    typedef IndexType_ IndexType;
+    typedef ValueType_ ValueType;
+
+private:
+    IndexType m_n;
+    IndexType m_nnz;
+    const IndexType* m_row_offsets;
+    const IndexType* m_col_indices;
+    std::vector<IndexType> m_aggregates;
+    IndexType m_n_aggregates;
+
+    // Restriction operator S (CSR): the vertices of each aggregate, in increasing order
+    std::vector<IndexType> m_R_row_offsets;
+    std::vector<IndexType> m_R_column_indices;
+
+    // Contracted graph (CSR), set by contract()
+    std::vector<IndexType> m_cg_row_offsets;
+    std::vector<IndexType> m_cg_col_indices;
+
+    nvgraphSemiringOps_t m_v_combine;
+    nvgraphSemiringOps_t m_v_reduce;
+    nvgraphSemiringOps_t m_e_combine;
+    nvgraphSemiringOps_t m_e_reduce;
+
+public:
+    /*! Create a host contraction of a CSR graph
+     *  \param n Number of vertices
+     *  \param nnz Number of edges
+     *  \param csr_offsets (host memory) n+1 entries
+     *  \param csr_indices (host memory) nnz entries
+     *  \param aggregates (host memory) n entries, the aggregate of each vertex,
+     *                    every value of [0, max(aggregates)] must be used
+     *  \param aggregates_size Number of entries of aggregates, must be n
+     */
+    GraphContractionHost(IndexType n, IndexType nnz,
+                         const IndexType* csr_offsets,
+                         const IndexType* csr_indices,
+                         const IndexType* aggregates,
+                         size_t aggregates_size,
+                         nvgraphSemiringOps_t v_combine,
+                         nvgraphSemiringOps_t v_reduce,
+                         nvgraphSemiringOps_t e_combine,
+                         nvgraphSemiringOps_t e_reduce);
+
+    /*! Build the topology of the contracted graph and reduce the edge data.
+     *  \param n_edge_dims Number of edge data sets
+     *  \param edge_data (host memory) n_edge_dims arrays of nnz entries
+     *  \param (output) cg_edge_data n_edge_dims vectors, resized to the
+     *                  number of edges of the contracted graph
+     */
+    NVGRAPH_ERROR contract(size_t n_edge_dims,
+                           const ValueType* const* edge_data,
+                           std::vector<std::vector<ValueType> >& cg_edge_data);
+
+    /*! Reduce one vertex data set
+     *  \param vertex_data (host memory) n entries
+     *  \param (output) cg_vertex_data (host memory) get_num_aggregates() entries
+     */
+    void contract_vertex_data(const ValueType* vertex_data, ValueType* cg_vertex_data) const;
+
+    inline IndexType get_num_aggregates() const {return m_n_aggregates;}
+    inline const std::vector<IndexType>& get_row_ptr() const {return m_cg_row_offsets;}
+    inline const std::vector<IndexType>& get_col_ind() const {return m_cg_col_indices;}
+};
+
+} // end namespace nvgraph
@@ -22,6 +22,7 @@
 #include <multi_valued_csr_graph.hxx> //which includes all other headers... 
 #include <range_view.hxx> // TODO: to be changed to thrust/range_view.h, when toolkit gets in sync with Thrust
 #include <thrust_traits.hxx>
+#include <graph_contracting_dispatch.hxx>
 ///#include <graph_contracting_structs.hxx>
 #include <cassert>
 #include <thrust/device_vector.h>
@@ -791,45 +792,7 @@ namespace{ //unnamed..
 }//end unnamed namespace
 
 
-  //(the C header will have something similar)
-  //add more enums for additional Functor Types;
-  //
-  //CAVEAT: NrFctrTypes MUST be last in enum!
-  //additions can be made anywhere between enum...=0 and NrFctrTypes!
-  //
-  typedef enum{Multiply=0, Sum, Min, Max, NrFctrTypes} SemiRingFunctorTypes;
-
-  //Partial specialization to select proper
-  //functor through an integer, at compile time (?)
-  //
-  template<SemiRingFunctorTypes, typename ValueT> 
-  struct SemiRingFctrSelector;
-
-  template<typename ValueT>
-  struct SemiRingFctrSelector<Multiply, ValueT>
-  {
-    typedef typename thrust::multiplies<ValueT> FctrType;
-  };
-
-  template<typename ValueT>
-  struct SemiRingFctrSelector<Sum, ValueT>
-  {
-    typedef typename thrust::plus<ValueT> FctrType;
-  };
-
-  template<typename ValueT>
-  struct SemiRingFctrSelector<Min, ValueT>
-  {
-    typedef typename thrust::minimum<ValueT> FctrType;
-  };
-
-  template<typename ValueT>
-  struct SemiRingFctrSelector<Max, ValueT>
-  {
-    typedef typename thrust::maximum<ValueT> FctrType;
-  };
-
-  //...add more specializations for additional Functor Types
+  //SemiRingFunctorTypes and SemiRingFctrSelector: see graph_contracting_dispatch.hxx
 
   //Acyclic Visitor
   //         (A. Alexandrescu, "Modern C++ Design", Section 10.4), 
@@ -1204,496 +1167,6 @@ namespace{ //unnamed..
   };
 
 
-  
-
-
-  //###################################################### Nested-if-then-else solution: 
-  //
-  //easier on number of recursive template instantiations
-  //i.e., less-likely to run into compilation problems like:
-  //'error: excessive recursion at instantiation of function ...';
-  //or the newly(as of cuda8.0) available flag: -ftemplate-depth <depth>
-  //
-  //generic empty template:
-  //
-  template<typename VectorI,
-       typename VectorV,
-       typename T1,
-       typename T2,
-       typename T3,
-       size_t Level, size_t n, size_t N>
-  struct NestedTypedIfThenElser;    
-
-  //Level 3 (ceiling of recursion):
-  //
-  template<typename VectorI,
-       typename VectorV,
-       typename T1,
-       typename T2,
-       typename T3,
-       size_t n, size_t N>
-  struct NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 3, n, N>
-  {
-  typedef typename VectorI::value_type IndexT;
-    typedef typename VectorV::value_type ValueT;
-
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    if( i4 == n )//reached both ceiling of Level recursion and bottom of n value recursion
-    {
-      ///std::cout<<"OK: tuple("<<i1<<","<<i2<<","<<i3<<","<<i4<<") hit!\n";//stop, everything hit...
-      typedef typename SemiRingFctrSelector<(SemiRingFunctorTypes)n, ValueT>::FctrType T4;
-
-      typedef T1 VertexCombineFctr;
-      typedef T2 VertexReduceFctr;
-      typedef T3 EdgeCombineFctr;
-      typedef T4 EdgeReduceFctr;
-
-      VertexCombineFctr v_combine;
-      VertexReduceFctr  v_reduce;
-      EdgeCombineFctr   e_combine;
-      EdgeReduceFctr    e_reduce;
-
-      GraphContractionVisitor<VectorI,
-                              VectorV,
-                              VertexCombineFctr,
-                              VertexReduceFctr,
-                              EdgeCombineFctr,
-                              EdgeReduceFctr>
-      visitor(graph,
-          aggregates,
-          stream,
-          v_combine,
-          v_reduce,
-          e_combine,
-          e_reduce);
-      cudaCheckError();
-
-      graph.Accept(visitor);
-      cudaCheckError();
-      return visitor.get_contracted_graph();
-    }
-    else //continue with same level (3), but next decreasing n value
-    return NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 3, n-1, N>::iffer(i1, i2, i3, i4, 
-                                            graph, 
-                                            aggregates,
-                                            stream); 
-  }
-  };
-
-  //Level 3 bottom:
-  //
-  template<typename VectorI,
-       typename VectorV,
-       typename T1,
-       typename T2,
-       typename T3,
-       size_t N>
-  struct NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 3, 0, N>
-  {
-  typedef typename VectorI::value_type IndexT;
-    typedef typename VectorV::value_type ValueT;
-
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    if( i4 == 0 )
-    {
-      ///std::cout<<"OK: tuple("<<i1<<","<<i2<<","<<i3<<","<<i4<<") hit!\n";//stop, everything hit...
-      typedef typename SemiRingFctrSelector<(SemiRingFunctorTypes)0, ValueT>::FctrType T4;
-
-      typedef T1 VertexCombineFctr;
-      typedef T2 VertexReduceFctr;
-      typedef T3 EdgeCombineFctr;
-      typedef T4 EdgeReduceFctr;
-
-      VertexCombineFctr v_combine;
-      VertexReduceFctr  v_reduce;
-      EdgeCombineFctr   e_combine;
-      EdgeReduceFctr    e_reduce;
-
-      GraphContractionVisitor<VectorI,
-                              VectorV,
-                              VertexCombineFctr,
-                              VertexReduceFctr,
-                              EdgeCombineFctr,
-                              EdgeReduceFctr>
-      visitor(graph,
-          aggregates,
-          stream,
-          v_combine,
-          v_reduce,
-          e_combine,
-          e_reduce);
-
-      graph.Accept(visitor);
-      return visitor.get_contracted_graph();
-    }
-    else
-    {
-      std:: stringstream ss;
-      ss<<"ERROR: tuple("<<i1<<","<<i2<<","<<i3<<","<<i4<<") not hit on Level 3.";
-      FatalError(ss.str().c_str(),NVGRAPH_ERR_BAD_PARAMETERS);
-      //return 0;
-    }
-  }
-  };
-
-  //Level 2 generic:
-  //
-  template<typename VectorI,
-       typename VectorV,
-       typename T1,
-       typename T2,
-       typename T3,
-       size_t n, size_t N>
-  struct NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 2, n, N>
-  {
-  typedef typename VectorI::value_type IndexT;
-    typedef typename VectorV::value_type ValueT;
-
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    if( i3 == n )
-    {
-      typedef typename SemiRingFctrSelector<(SemiRingFunctorTypes)n, ValueT>::FctrType RT;//replace T3!
-      return NestedTypedIfThenElser<VectorI, VectorV, T1, T2, RT, 3, N-1, N>::iffer(i1, i2, i3, i4, 
-                                         graph, 
-                                         aggregates,
-                                         stream);//continue with next increasing level (3)
-      //with 1st possible value (N-1)
-    }
-    else
-    return NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 2, n-1, N>::iffer(i1, i2, i3, i4, 
-                                         graph, 
-                                         aggregates,
-                                         stream);//continue with same level (2), but next decreasing n value 
-  }
-  };
-
-  //Level 2 bottom:
-  //
-  template<typename VectorI,
-       typename VectorV,
-       typename T1,
-       typename T2,
-       typename T3,
-       size_t N>
-  struct NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 2, 0, N>
-  {
-  typedef typename VectorI::value_type IndexT;
-    typedef typename VectorV::value_type ValueT;
-
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    if( i3 == 0 )
-    {
-      typedef typename SemiRingFctrSelector<(SemiRingFunctorTypes)0, ValueT>::FctrType RT;//replace T3!
-      return NestedTypedIfThenElser<VectorI, VectorV, T1, T2, RT, 3, N-1, N>::iffer(i1, i2, i3, i4, 
-                                         graph, 
-                                         aggregates,
-                                         stream);//continue with next increasing level (3)
-      //with 1st possible value (N-1)
-    }
-    else
-    {
-      std:: stringstream ss;
-      ss<<"ERROR: tuple("<<i1<<","<<i2<<","<<i3<<","<<i4<<") not hit on Level 2.";
-      FatalError(ss.str().c_str(),NVGRAPH_ERR_BAD_PARAMETERS);
-      //return 0;
-    }
-  }
-  };
-
-  //Level 1 generic:
-  //
-  template<typename VectorI,
-       typename VectorV,
-       typename T1,
-       typename T2,
-       typename T3,
-       size_t n, size_t N>
-  struct NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 1, n, N>
-  {
-  typedef typename VectorI::value_type IndexT;
-  typedef typename VectorV::value_type ValueT;
-
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    if( i2 == n )
-    {
-      typedef typename SemiRingFctrSelector<(SemiRingFunctorTypes)n, ValueT>::FctrType RT;//replace T2!
-      return NestedTypedIfThenElser<VectorI, VectorV, T1, RT, T3, 2, N-1, N>::iffer(i1, i2, i3, i4, 
-                                         graph, 
-                                         aggregates,
-                                         stream);//continue with next increasing level (2)
-      //with 1st possible value (N-1)
-    }
-    else
-    return NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 1, n-1, N>::iffer(i1, i2, i3, i4, 
-                                         graph, 
-                                         aggregates,
-                                         stream);//continue with same level (1), but next decreasing n value 
-  }
-  };
-
-  //Level 1 bottom:
-  //
-  template<typename VectorI,
-       typename VectorV,
-       typename T1,
-       typename T2,
-       typename T3,
-       size_t N>
-  struct NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 1, 0, N>
-  {
-  typedef typename VectorI::value_type IndexT;
-  typedef typename VectorV::value_type ValueT;
-
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    if( i2 == 0 )
-    {
-      typedef typename SemiRingFctrSelector<(SemiRingFunctorTypes)0, ValueT>::FctrType RT;//replace T2!
-      return NestedTypedIfThenElser<VectorI, VectorV, T1, RT, T3, 2, N-1, N>::iffer(i1, i2, i3, i4, 
-                                         graph, 
-                                         aggregates,
-                                         stream);//continue with next increasing level (2)
-      //with 1st possible value (N-1)
-    }
-    else
-    {
-      std:: stringstream ss;
-      ss<<"ERROR: tuple("<<i1<<","<<i2<<","<<i3<<","<<i4<<") not hit on Level 1.";
-      FatalError(ss.str().c_str(),NVGRAPH_ERR_BAD_PARAMETERS);
-      //return 0;
-    }
-  }
-  };
-
-  //Level 0 generic:
-  //
-  template<typename VectorI,
-       typename VectorV,
-       typename T1,
-       typename T2,
-       typename T3,
-       size_t n, size_t N>
-  struct NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 0, n, N>
-  {
-  typedef typename VectorI::value_type IndexT;
-  typedef typename VectorV::value_type ValueT;
-
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    if( i1 == n )
-    {
-      typedef typename SemiRingFctrSelector<(SemiRingFunctorTypes)n, ValueT>::FctrType RT;//replace T1!
-      return NestedTypedIfThenElser<VectorI, VectorV, RT, T2, T3, 1, N-1, N>::iffer(i1, i2, i3, i4, 
-                                     graph, 
-                                     aggregates,
-                                     stream);//continue with next increasing level (1)
-      //with 1st possible value (N-1)
-    }
-    else
-    return NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 0, n-1, N>::iffer(i1, i2, i3, i4, 
-                                   graph, 
-                                   aggregates,
-                                   stream);//continue with same level (0), but next decreasing n value 
-  }
-  };
-
-  //Level 0 bottom:
-  //
-  template<typename VectorI,
-       typename VectorV,
-       typename T1,
-       typename T2,
-       typename T3,
-       size_t N>
-  struct NestedTypedIfThenElser<VectorI, VectorV, T1, T2, T3, 0, 0, N>
-  {
-  typedef typename VectorI::value_type IndexT;
-  typedef typename VectorV::value_type ValueT;
-
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    if( i1 == 0 )
-    {
-      typedef typename SemiRingFctrSelector<(SemiRingFunctorTypes)0, ValueT>::FctrType RT;//replace T1!
-      return NestedTypedIfThenElser<VectorI, VectorV, RT, T2, T3, 1, N-1, N>::iffer(i1, i2, i3, i4, 
-                                         graph, 
-                                         aggregates,
-                                         stream);//continue with next increasing level (1)
-      //with 1st possible value (N-1)
-    }
-    else
-    {
-      std:: stringstream ss;
-      ss<<"ERROR: tuple("<<i1<<","<<i2<<","<<i3<<","<<i4<<") not hit on Level 0.";
-      FatalError(ss.str().c_str(),NVGRAPH_ERR_BAD_PARAMETERS);
-      //return 0;
-    }
-  }
-  };
-
-  //Wrapper:
-  //
-  //N = # possible (consecutive 0-based) values
-  //that each tuple element can take
-  //
-  template<typename VectorI,
-       typename VectorV, 
-       size_t N>
-  struct NestedTypedIfThenElseWrapper
-  {
-  typedef typename VectorI::value_type IndexT;
-    typedef typename VectorV::value_type ValueT;
-
-  struct Unused{};//placeholder to be replaced by actual types
-  
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    return NestedTypedIfThenElser<VectorI, VectorV, Unused, Unused, Unused, 0, N-1, N>::iffer(i1, i2, i3, i4, 
-                                                graph, 
-                                                aggregates,
-                                                stream);
-  }
-  };
-
-
-  template<typename VectorI,
-       typename VectorV, 
-       typename T1,
-       size_t N>
-  struct NestedTypedIfThenElseWrapperT
-  {
-    typedef typename VectorI::value_type IndexT;
-    typedef typename VectorV::value_type ValueT;
-
-  struct Unused{};//placeholder to be replaced by actual types
-  
-  static CsrGraph<IndexT>* iffer(size_t i1, size_t i2, size_t i3, size_t i4, 
-                   CsrGraph<IndexT>& graph,
-                   VectorI& aggregates,
-                   cudaStream_t stream)
-  {
-    return NestedTypedIfThenElser<VectorI, VectorV, T1, Unused, Unused, 1, N-1, N>::iffer(i1, i2, i3, i4, 
-                                                graph, 
-                                                aggregates,
-                                                stream);
-  }
-  };
-
-
-  
-
-  template<typename IndexT, typename ValueT>
-  CsrGraph<IndexT>* contract_from_aggregates(CsrGraph<IndexT>& graph, 
-                                             IndexT* p_aggregates,
-                                             size_t n,
-                                             cudaStream_t stream,
-                                             const SemiRingFunctorTypes& vCombine,
-                                             const SemiRingFunctorTypes& vReduce,
-                                             const SemiRingFunctorTypes& eCombine,
-                                             const SemiRingFunctorTypes& eReduce)
-  {
-    typedef thrust::device_vector<IndexT> VectorI;
-    typedef thrust::device_vector<ValueT> VectorV;
-
-    VectorI aggregates(p_aggregates, p_aggregates+n);
-
-  //Nested if-then-else solution:
-  //
-  //(no need for constness, they're NOT template args)
-  //
-  return NestedTypedIfThenElseWrapper<VectorI, VectorV, NrFctrTypes>::iffer((size_t)vCombine, 
-                                      (size_t)vReduce, 
-                                      (size_t)eCombine, 
-                                      (size_t)eReduce, 
-                                      graph, aggregates, stream);
-
-  //Flatened if-then-else solution:
-  //
-     //const size_t M = NrFctrTypes;
-     //const size_t M2 = M*M;
-     //const size_t M3 = M2*M;
-  
-     //size_t i
-     //  = (size_t)vCombine * M3
-     //  + (size_t)vReduce *  M2
-     //  + (size_t)eCombine * M
-     //  + (size_t)eReduce;
-    
-    //return Selector<NComboTypes-1, NrFctrTypes, VectorI, VectorV>::iffer(i, graph, aggregates, stream);
-  }
-
-    template<typename IndexT, typename ValueT, typename T>
-  CsrGraph<IndexT>* contract_from_aggregates_t(CsrGraph<IndexT>& graph, 
-                                             IndexT* p_aggregates,
-                                             size_t n,
-                                             cudaStream_t stream,
-                                             const SemiRingFunctorTypes& vCombine,
-                                             const SemiRingFunctorTypes& vReduce,
-                                             const SemiRingFunctorTypes& eCombine,
-                                             const SemiRingFunctorTypes& eReduce)
-  {
-    typedef thrust::device_vector<IndexT> VectorI;
-    typedef thrust::device_vector<ValueT> VectorV;
-
-    VectorI aggregates(p_aggregates, p_aggregates+n);
-
-  //Nested if-then-else solution:
-  //
-  //(no need for constness, they're NOT template args)
-  //
-  return NestedTypedIfThenElseWrapperT<VectorI, VectorV, T, NrFctrTypes>::iffer((size_t)vCombine, 
-                                      (size_t)vReduce, 
-                                      (size_t)eCombine, 
-                                      (size_t)eReduce, 
-                                      graph, aggregates, stream);
-
-  //Flatened if-then-else solution:
-  //
-     //const size_t M = NrFctrTypes;
-     //const size_t M2 = M*M;
-     //const size_t M3 = M2*M;
-  
-     //size_t i
-     //  = (size_t)vCombine * M3
-     //  + (size_t)vReduce *  M2
-     //  + (size_t)eCombine * M
-     //  + (size_t)eReduce;
-    
-    //return Selector<NComboTypes-1, NrFctrTypes, VectorI, VectorV>::iffer(i, graph, aggregates, stream);
-  }
-
 }
 
 #endif
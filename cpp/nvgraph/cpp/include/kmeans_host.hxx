@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "nvgraph_error.hxx"
+
+// number of clusters from which the host k-means keeps one lower
+// bound per centroid (Elkan) instead of a single one (Hamerly)
+#define KMEANS_HOST_ELKAN_THR 20
+
+// default number of observation vectors per mini-batch
+#define KMEANS_HOST_BATCH 1024
+
+// number of k-means++ initializations tried by the mini-batch k-means
+#define KMEANS_HOST_MINIBATCH_INITS 3
+
+namespace nvgraph {
+
+  /// Find clusters with k-means algorithm on the host
+  /** Same algorithm and conventions as kmeans, on host memory.
+   *  Initial centroids are chosen with k-means++ algorithm. Empty
+   *  clusters are reinitialized with the observation vector that is
+   *  the farthest from its centroid.
+   *
+   *  Triangle inequality bounds skip most of the distance
+   *  computations: one lower bound per observation vector (Hamerly)
+   *  for k < KMEANS_HOST_ELKAN_THR, one per observation vector and
+   *  centroid (Elkan) otherwise.
+   *
+   *  @param n Number of observation vectors.
+   *  @param d Dimension of observation vectors.
+   *  @param k Number of clusters.
+   *  @param tol Tolerance for convergence. k-means stops when the
+   *    change in residual divided by n is less than tol.
+   *  @param maxiter Maximum number of k-means iterations.
+   *  @param obs (Input, host memory, d*n entries) Observation
+   *    matrix. Matrix is stored column-major and each column is an
+   *    observation vector. Matrix dimensions are d x n.
+   *  @param codes (Output, host memory, n entries) Cluster
+   *    assignments.
+   *  @param residual On exit, residual sum of squares (sum of squares
+   *    of distances between observation vectors and centroids).
+   *  @param On exit, number of k-means iterations.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR kmeans_host(IndexType_ n, IndexType_ d, IndexType_ k,
+                            ValueType_ tol, IndexType_ maxiter,
+                            const ValueType_ * __restrict__ obs,
+                            IndexType_ * __restrict__ codes,
+                            ValueType_ & residual,
+                            IndexType_ & iters);
+
+  /// Find clusters with k-means algorithm on the host
+  /** Same as above, also returns the clusters.
+   *
+   *  @param clusterSizes (Output, host memory, k entries) Number of
+   *    points in each cluster.
+   *  @param centroids (Output, host memory, d*k entries) Centroid
+   *    matrix. Matrix is stored column-major and each column is a
+   *    centroid. Matrix dimensions are d x k.
+   *  @param residual_host (Output, host memory, 1 entry) Residual sum
+   *    of squares.
+   *  @param iters_host (Output, host memory, 1 entry) Number of
+   *    k-means iterations.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR kmeans_host(IndexType_ n, IndexType_ d, IndexType_ k,
+                            ValueType_ tol, IndexType_ maxiter,
+                            const ValueType_ * __restrict__ obs,
+                            IndexType_ * __restrict__ codes,
+                            IndexType_ * __restrict__ clusterSizes,
+                            ValueType_ * __restrict__ centroids,
+                            ValueType_ * residual_host,
+                            IndexType_ * iters_host);
+
+  /// Find clusters with mini-batch k-means algorithm on the host
+  /** Each iteration draws batchSize observation vectors, assigns them
+   *  to their closest centroid and moves each centroid towards the
+   *  mean of its points with a per-centroid learning rate
+   *  (points in the batch / points seen so far). Initial centroids
+   *  are the best of KMEANS_HOST_MINIBATCH_INITS k-means++ runs on
+   *  samples. A final pass
+   *  assigns every observation vector, so codes and residual have
+   *  the same meaning as with kmeans_host.
+   *
+   *  @param n Number of observation vectors.
+   *  @param d Dimension of observation vectors.
+   *  @param k Number of clusters.
+   *  @param tol Tolerance for convergence. Stops when the change in
+   *    the (smoothed) batch residual divided by the batch size is
+   *    less than tol.
+   *  @param maxiter Maximum number of mini-batches.
+   *  @param batchSize Number of observation vectors per mini-batch.
+   *  @param obs (Input, host memory, d*n entries) Observation
+   *    matrix, column-major d x n.
+   *  @param codes (Output, host memory, n entries) Cluster
+   *    assignments.
+   *  @param clusterSizes (Output, host memory, k entries) Number of
+   *    points in each cluster.
+   *  @param centroids (Output, host memory, d*k entries) Centroid
+   *    matrix, column-major d x k.
+   *  @param residual_host (Output, host memory, 1 entry) Residual sum
+   *    of squares of the final assignment.
+   *  @param iters_host (Output, host memory, 1 entry) Number of
+   *    mini-batches.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR kmeans_minibatch_host(IndexType_ n, IndexType_ d, IndexType_ k,
+                                      ValueType_ tol, IndexType_ maxiter,
+                                      IndexType_ batchSize,
+                                      const ValueType_ * __restrict__ obs,
+                                      IndexType_ * __restrict__ codes,
+                                      IndexType_ * __restrict__ clusterSizes,
+                                      ValueType_ * __restrict__ centroids,
+                                      ValueType_ * residual_host,
+                                      IndexType_ * iters_host);
+
+  /// Find clusters with mini-batch k-means algorithm on the host
+  /** Same as above without the clusters.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR kmeans_minibatch_host(IndexType_ n, IndexType_ d, IndexType_ k,
+                                      ValueType_ tol, IndexType_ maxiter,
+                                      IndexType_ batchSize,
+                                      const ValueType_ * __restrict__ obs,
+                                      IndexType_ * __restrict__ codes,
+                                      ValueType_ & residual,
+                                      IndexType_ & iters);
+
+}
+
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "nvgraph_error.hxx"
+#include "matrix.hxx"
+
+namespace nvgraph {
+
+  /// Compute smallest eigenvectors of symmetric matrix on the host
+  /** Computes the algebraically smallest eigenvalues and their
+   *  eigenvectors with an implicitly restarted Lanczos method. The
+   *  matrix products must be on host memory (see matrix_host.hxx).
+   *
+   *  Each restart applies the unwanted Ritz values as exact shifts
+   *  to the tridiagonal system (implicit QR steps) and compresses the
+   *  Lanczos vectors with a single blocked product. The tridiagonal
+   *  eigenproblem is solved with LAPACK (steqr).
+   *
+   *  Without full reorthogonalization, the loss of orthogonality of
+   *  the Lanczos vectors is estimated with Simon's recurrence and
+   *  the vectors are reorthogonalized (classical Gram-Schmidt, two
+   *  passes) only when it exceeds sqrt(eps) (partial
+   *  reorthogonalization).
+   *
+   *  @param A Matrix (host products).
+   *  @param nEigVecs Number of eigenvectors to compute.
+   *  @param maxIter Maximum number of Lanczos steps.
+   *  @param restartIter Maximum size of Lanczos system before
+   *    performing an implicit restart. Should be at least
+   *    nEigVecs+2.
+   *  @param tol Convergence tolerance. Lanczos iteration will
+   *    terminate when the residual norm of every wanted Ritz pair is
+   *    less than tol times the largest Ritz value in magnitude.
+   *  @param reorthogonalize Whether to fully reorthogonalize Lanczos
+   *    vectors at every step instead of partially.
+   *  @param iter On exit, total number of Lanczos iterations
+   *    performed.
+   *  @param eigVals (Output, host memory, nEigVecs entries)
+   *    Smallest eigenvalues of matrix, in increasing order.
+   *  @param eigVecs (Output, host memory, n*nEigVecs entries)
+   *    Eigenvectors corresponding to smallest eigenvalues of
+   *    matrix. Vectors are stored as columns of a column-major matrix
+   *    with dimensions n x nEigVecs.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_host(const Matrix<IndexType_,ValueType_> & A,
+                                                 IndexType_ nEigVecs,
+                                                 IndexType_ maxIter,
+                                                 IndexType_ restartIter,
+                                                 ValueType_ tol,
+                                                 bool reorthogonalize,
+                                                 IndexType_ & iter,
+                                                 ValueType_ * __restrict__ eigVals,
+                                                 ValueType_ * __restrict__ eigVecs);
+
+  /// Compute largest eigenvectors of symmetric matrix on the host
+  /** Same as computeSmallestEigenvectors_host for the algebraically
+   *  largest eigenvalues.
+   *
+   *  @param eigVals (Output, host memory, nEigVecs entries)
+   *    Largest eigenvalues of matrix, in increasing order.
+   *  @param eigVecs (Output, host memory, n*nEigVecs entries)
+   *    Eigenvectors corresponding to largest eigenvalues of
+   *    matrix, column-major n x nEigVecs.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeLargestEigenvectors_host(const Matrix<IndexType_,ValueType_> & A,
+                                                IndexType_ nEigVecs,
+                                                IndexType_ maxIter,
+                                                IndexType_ restartIter,
+                                                ValueType_ tol,
+                                                bool reorthogonalize,
+                                                IndexType_ & iter,
+                                                ValueType_ * __restrict__ eigVals,
+                                                ValueType_ * __restrict__ eigVecs);
+
+  /// Compute smallest eigenvectors of symmetric matrix with block
+  /// Lanczos method on the host
+  /** The Krylov basis is extended blockSize vectors at a time, so
+   *  every step is a single product with a block of vectors (SpMM)
+   *  and the orthogonalizations are matrix-matrix products. Vectors
+   *  are fully reorthogonalized (block classical Gram-Schmidt, two
+   *  passes) and the Ritz pairs are extracted from the projected
+   *  matrix. The method is restarted by keeping the wanted Ritz
+   *  vectors and some of the unwanted ones closest to them (thick
+   *  restart).
+   *
+   *  @param A Matrix (host products).
+   *  @param nEigVecs Number of eigenvectors to compute.
+   *  @param blockSize Number of vectors per block.
+   *  @param maxIter Maximum number of matrix-vector products (a block
+   *    product counts blockSize).
+   *  @param restartIter Maximum size of the basis before restart. At
+   *    least nEigVecs+2*blockSize is used.
+   *  @param tol Convergence tolerance, same as
+   *    computeSmallestEigenvectors_host.
+   *  @param iter On exit, number of matrix-vector products performed.
+   *  @param eigVals (Output, host memory, nEigVecs entries)
+   *    Smallest eigenvalues of matrix, in increasing order.
+   *  @param eigVecs (Output, host memory, n*nEigVecs entries)
+   *    Eigenvectors corresponding to smallest eigenvalues of
+   *    matrix, column-major n x nEigVecs.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_block_host(const Matrix<IndexType_,ValueType_> & A,
+                                                       IndexType_ nEigVecs,
+                                                       IndexType_ blockSize,
+                                                       IndexType_ maxIter,
+                                                       IndexType_ restartIter,
+                                                       ValueType_ tol,
+                                                       IndexType_ & iter,
+                                                       ValueType_ * __restrict__ eigVals,
+                                                       ValueType_ * __restrict__ eigVecs);
+
+  /// Compute largest eigenvectors of symmetric matrix with block
+  /// Lanczos method on the host
+  /** Same as computeSmallestEigenvectors_block_host for the
+   *  algebraically largest eigenvalues, returned in increasing order.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeLargestEigenvectors_block_host(const Matrix<IndexType_,ValueType_> & A,
+                                                      IndexType_ nEigVecs,
+                                                      IndexType_ blockSize,
+                                                      IndexType_ maxIter,
+                                                      IndexType_ restartIter,
+                                                      ValueType_ tol,
+                                                      IndexType_ & iter,
+                                                      ValueType_ * __restrict__ eigVals,
+                                                      ValueType_ * __restrict__ eigVecs);
+
+  /// Eigenvalues and eigenvectors of a small dense symmetric matrix
+  /// on the host
+  /** Householder tridiagonalization followed by LAPACK (steqr). Used
+   *  for the Rayleigh-Ritz step of the eigensolvers, including the
+   *  device ones (see subspace.hxx).
+   *
+   *  @param m Dimension of the matrix.
+   *  @param H (Input, host memory, m*m entries) Symmetric matrix,
+   *    leading dimension ldh.
+   *  @param eigVals (Output, host memory, m entries) Eigenvalues in
+   *    increasing order.
+   *  @param eigVecs (Output, host memory, m*m entries) Orthonormal
+   *    eigenvectors, column-major m x m.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void symmetricEigenvectors_host(IndexType_ m,
+                                  const ValueType_ * H, IndexType_ ldh,
+                                  ValueType_ * __restrict__ eigVals,
+                                  ValueType_ * __restrict__ eigVecs);
+
+  /// Compute smallest eigenvectors of symmetric matrix with LOBPCG
+  /// on the host
+  /** Locally optimal block preconditioned conjugate gradient: every
+   *  iteration does a Rayleigh-Ritz step on the current Ritz vectors,
+   *  the previous search directions and the preconditioned residuals,
+   *  with one block product of nEigVecs vectors. The preconditioner
+   *  is the one set on A with prec_setup (e.g. JacobiPreconditionerHost
+   *  or AggregationPreconditionerHost on a LaplacianMatrixHost), and
+   *  is applied with A.prec_solve. Without one, this is plain LOBPCG.
+   *
+   *  @param A Matrix (host products).
+   *  @param nEigVecs Number of eigenvectors to compute. At most n/3.
+   *  @param maxIter Maximum number of LOBPCG iterations.
+   *  @param tol Convergence tolerance. The iteration terminates when
+   *    the residual norm of every Ritz pair is less than tol times the
+   *    largest Ritz value in magnitude.
+   *  @param iter On exit, number of LOBPCG iterations performed.
+   *  @param eigVals (Output, host memory, nEigVecs entries)
+   *    Smallest eigenvalues of matrix, in increasing order.
+   *  @param eigVecs (Output, host memory, n*nEigVecs entries)
+   *    Corresponding eigenvectors, column-major n x nEigVecs.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_lobpcg_host(const Matrix<IndexType_,ValueType_> & A,
+                                                        IndexType_ nEigVecs,
+                                                        IndexType_ maxIter,
+                                                        ValueType_ tol,
+                                                        IndexType_ & iter,
+                                                        ValueType_ * __restrict__ eigVals,
+                                                        ValueType_ * __restrict__ eigVecs);
+
+  /// Compute smallest eigenvectors of symmetric matrix with
+  /// randomized subspace iteration on the host
+  /** Approximate eigenvectors for a fixed amount of work: a Gaussian
+   *  block of nEigVecs+10 vectors goes through maxIter steps of
+   *  subspace (power) iteration with sigma*I-A, where sigma estimates
+   *  the spectral radius, and the Ritz pairs are extracted from the
+   *  projection of A on the final block. Every step is one block
+   *  product (SpMM) and a Cholesky QR orthonormalization, and there
+   *  is no convergence test.
+   *
+   *  @param A Matrix (host products).
+   *  @param nEigVecs Number of eigenvectors to compute.
+   *  @param maxIter Number of subspace iterations.
+   *  @param iter On exit, number of matrix-vector products performed
+   *    (a block product counts the block size).
+   *  @param eigVals (Output, host memory, nEigVecs entries)
+   *    Approximate smallest eigenvalues of matrix, in increasing
+   *    order.
+   *  @param eigVecs (Output, host memory, n*nEigVecs entries)
+   *    Corresponding approximate eigenvectors, column-major
+   *    n x nEigVecs.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_subspace_host(const Matrix<IndexType_,ValueType_> & A,
+                                                          IndexType_ nEigVecs,
+                                                          IndexType_ maxIter,
+                                                          IndexType_ & iter,
+                                                          ValueType_ * __restrict__ eigVals,
+                                                          ValueType_ * __restrict__ eigVecs);
+
+  /// Compute largest eigenvectors of symmetric matrix with
+  /// randomized subspace iteration on the host
+  /** Same as computeSmallestEigenvectors_subspace_host with sigma*I+A,
+   *  for the algebraically largest eigenvalues, returned in
+   *  increasing order.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeLargestEigenvectors_subspace_host(const Matrix<IndexType_,ValueType_> & A,
+                                                         IndexType_ nEigVecs,
+                                                         IndexType_ maxIter,
+                                                         IndexType_ & iter,
+                                                         ValueType_ * __restrict__ eigVals,
+                                                         ValueType_ * __restrict__ eigVecs);
+
+}
@@ -123,6 +123,9 @@ namespace nvgraph {
     virtual ValueType_ getEdgeSum() const;
   };
 
+  template <typename IndexType_, typename ValueType_> class LaplacianMatrix;
+  template <typename IndexType_, typename ValueType_> class ModularityMatrix;
+
   /// Sparse matrix class in CSR format
   template <typename IndexType_, typename ValueType_>
   class CsrMatrix : public Matrix<IndexType_, ValueType_> {
@@ -149,6 +152,10 @@ namespace nvgraph {
     /// notice we only want to factor once
     bool factored;  
 
+    // Fused products read the CSR arrays directly
+    friend class LaplacianMatrix<IndexType_, ValueType_>;
+    friend class ModularityMatrix<IndexType_, ValueType_>;
+
   public:
     /// Constructor
     CsrMatrix(bool _trans, bool _sym,
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <stddef.h>
+
+// Compiled for the host and the device with nvcc, for the host only
+// otherwise
+#ifdef __CUDACC__
+#define NVGRAPH_HOST_DEVICE __host__ __device__ __forceinline__
+#else
+#define NVGRAPH_HOST_DEVICE inline
+#endif
+
+namespace nvgraph {
+
+  // An entry of the Laplacian product L*x = D*x - A*x or of the
+  // modularity product B*x = A*x - (d'*x/edge_sum)*d only needs one
+  // CSR row of the adjacency matrix A. The host (matrix_host.cpp) and
+  // device (matrix.cu) matrix classes reduce the row and apply the
+  // diagonal or rank-one correction and the alpha/beta update in the
+  // same pass, instead of streaming the vectors once for A*x and once
+  // for each correction.
+
+  /// Partial dot product of a CSR row with a vector
+  /** Sums the entries begin, begin+stride, ... before end. A thread
+   *  reduces a whole row with stride 1, the lanes of a warp split it
+   *  with the warp size as stride.
+   *
+   *  @param csrColInd Column index of each matrix entry.
+   *  @param csrVal Matrix entry values, NULL for unit weights.
+   *  @param x Vector.
+   *  @return Partial sum.
+   */
+  template <typename IndexType_, typename ValueType_> NVGRAPH_HOST_DEVICE
+  ValueType_ csrRowDot(IndexType_ begin, IndexType_ end, IndexType_ stride,
+                       const IndexType_ * __restrict__ csrColInd,
+                       const ValueType_ * __restrict__ csrVal,
+                       const ValueType_ * __restrict__ x) {
+    ValueType_ sum = 0;
+    if(csrVal != NULL) {
+      for(IndexType_ j=begin; j<end; j+=stride)
+        sum += csrVal[j]*x[csrColInd[j]];
+    }
+    else {
+      for(IndexType_ j=begin; j<end; j+=stride)
+        sum += x[csrColInd[j]];
+    }
+    return sum;
+  }
+
+  /// Entry of a Laplacian product, y = alpha*(d*x-ax) + beta*y
+  /** @param d Degree of the vertex.
+   *  @param x Entry of the input vector.
+   *  @param ax Entry of A*x.
+   *  @param y Entry of the output vector, set (not scaled) when beta
+   *    is zero so that NaNs are not propagated.
+   */
+  template <typename ValueType_> NVGRAPH_HOST_DEVICE
+  void laplacianUpdate(ValueType_ alpha, ValueType_ d, ValueType_ x, ValueType_ ax,
+                       ValueType_ beta, ValueType_ & y) {
+    ValueType_ t = alpha*(d*x - ax);
+    y = (beta == 0) ? t : t + beta*y;
+  }
+
+  /// Entry of a modularity product, y = alpha*(ax-gamma*d) + beta*y
+  /** @param ax Entry of A*x.
+   *  @param gamma d'*x/edge_sum, the same for every entry.
+   *  @param d Degree of the vertex.
+   *  @param y Entry of the output vector, set (not scaled) when beta
+   *    is zero.
+   */
+  template <typename ValueType_> NVGRAPH_HOST_DEVICE
+  void modularityUpdate(ValueType_ alpha, ValueType_ ax, ValueType_ gamma, ValueType_ d,
+                        ValueType_ beta, ValueType_ & y) {
+    ValueType_ t = alpha*(ax - gamma*d);
+    y = (beta == 0) ? t : t + beta*y;
+  }
+
+}
+
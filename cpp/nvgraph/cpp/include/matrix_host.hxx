@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <vector>
+
+#include "matrix.hxx"
+#include "graph_coarsening_host.hxx"
+
+namespace nvgraph {
+
+  // The classes below implement the Matrix interface on host
+  // memory: x and y in mv and mm are host pointers and the products
+  // are computed with OpenMP. CUDA streams are stored but unused.
+
+  template <typename IndexType_, typename ValueType_> class LaplacianMatrixHost;
+  template <typename IndexType_, typename ValueType_> class ModularityMatrixHost;
+  template <typename IndexType_, typename ValueType_> class JacobiPreconditionerHost;
+  template <typename IndexType_, typename ValueType_> class AggregationPreconditionerHost;
+
+  /// Sparse matrix class in CSR format (host memory)
+  template <typename IndexType_, typename ValueType_>
+  class CsrMatrixHost : public Matrix<IndexType_, ValueType_> {
+
+  private:
+    /// Number of non-zero entries
+    const IndexType_ nnz;
+    /// Matrix entry values (host memory), NULL for unit weights
+    const ValueType_ * csrValA;
+    /// Pointer to first entry in each row (host memory)
+    const IndexType_ * csrRowPtrA;
+    /// Column index of each matrix entry (host memory)
+    const IndexType_ * csrColIndA;
+
+    // Fused products and preconditioners read the CSR arrays directly
+    friend class LaplacianMatrixHost<IndexType_, ValueType_>;
+    friend class ModularityMatrixHost<IndexType_, ValueType_>;
+    friend class JacobiPreconditionerHost<IndexType_, ValueType_>;
+    friend class AggregationPreconditionerHost<IndexType_, ValueType_>;
+
+  public:
+    /// Constructor
+    CsrMatrixHost(IndexType_ _m, IndexType_ _n, IndexType_ _nnz,
+                  const ValueType_ * _csrValA,
+                  const IndexType_ * _csrRowPtrA,
+                  const IndexType_ * _csrColIndA);
+
+    /// Destructor
+    virtual ~CsrMatrixHost();
+
+    /// Get and Set CUDA stream
+    virtual void setCUDAStream(cudaStream_t _s);
+    virtual void getCUDAStream(cudaStream_t *_s);
+
+    /// Matrix-vector product
+    virtual void mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+                    ValueType_ beta, ValueType_ * __restrict__ y) const;
+    /// Matrix-set of k vectors product
+    virtual void mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const;
+
+    /// Color and Reorder
+    virtual void color(IndexType_ *c, IndexType_ *p) const;
+    virtual void reorder(IndexType_ *p) const;
+
+    /// Incomplete Cholesky (setup, factor and solve)
+    virtual void prec_setup(Matrix<IndexType_,ValueType_> * _M);
+    virtual void prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const;
+
+    //Get the sum of all edges
+    virtual ValueType_ getEdgeSum() const;
+  };
+
+  /// Graph Laplacian matrix (host memory)
+  template <typename IndexType_, typename ValueType_>
+  class LaplacianMatrixHost
+    : public Matrix<IndexType_, ValueType_> {
+
+  private:
+    /// Adjacency matrix (host products)
+    const Matrix<IndexType_, ValueType_> * A;
+    /// Degree of each vertex
+    std::vector<ValueType_> D;
+    /// Preconditioning matrix
+    Matrix<IndexType_, ValueType_> * M;
+
+  public:
+    /// Constructor
+    LaplacianMatrixHost(const Matrix<IndexType_,ValueType_> & _A);
+
+    /// Destructor
+    virtual ~LaplacianMatrixHost();
+
+    /// Get and Set CUDA stream
+    virtual void setCUDAStream(cudaStream_t _s);
+    virtual void getCUDAStream(cudaStream_t *_s);
+
+    /// Matrix-vector product
+    virtual void mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+                    ValueType_ beta, ValueType_ * __restrict__ y) const;
+    /// Matrix-set of k vectors product
+    virtual void mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const;
+
+    /// Scale a set of k vectors by a diagonal
+    virtual void dm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const;
+
+    /// Color and Reorder
+    virtual void color(IndexType_ *c, IndexType_ *p) const;
+    virtual void reorder(IndexType_ *p) const;
+
+    /// Solve preconditioned system M x = f for a set of k vectors
+    virtual void prec_setup(Matrix<IndexType_,ValueType_> * _M);
+    virtual void prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const;
+
+    //Get the sum of all edges
+    virtual ValueType_ getEdgeSum() const;
+  };
+
+  ///  Modularity matrix (host memory)
+  template <typename IndexType_, typename ValueType_>
+  class ModularityMatrixHost
+    : public Matrix<IndexType_, ValueType_> {
+
+  private:
+    /// Adjacency matrix (host products)
+    const Matrix<IndexType_, ValueType_> * A;
+    /// Degree of each vertex
+    std::vector<ValueType_> D;
+    IndexType_ nnz;
+    ValueType_ edge_sum;
+
+    /// Preconditioning matrix
+    Matrix<IndexType_, ValueType_> * M;
+
+  public:
+    /// Constructor
+    ModularityMatrixHost(const Matrix<IndexType_,ValueType_> & _A, IndexType_ _nnz);
+
+    /// Destructor
+    virtual ~ModularityMatrixHost();
+
+    /// Get and Set CUDA stream
+    virtual void setCUDAStream(cudaStream_t _s);
+    virtual void getCUDAStream(cudaStream_t *_s);
+
+    /// Matrix-vector product
+    virtual void mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+                    ValueType_ beta, ValueType_ * __restrict__ y) const;
+    /// Matrix-set of k vectors product
+    virtual void mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const;
+
+    /// Scale a set of k vectors by a diagonal
+    virtual void dm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const;
+
+    /// Color and Reorder
+    virtual void color(IndexType_ *c, IndexType_ *p) const;
+    virtual void reorder(IndexType_ *p) const;
+
+    /// Solve preconditioned system M x = f for a set of k vectors
+    virtual void prec_setup(Matrix<IndexType_,ValueType_> * _M);
+    virtual void prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const;
+
+    //Get the sum of all edges
+    virtual ValueType_ getEdgeSum() const;
+  };
+
+  /// Jacobi preconditioner of a graph Laplacian (host memory)
+  /** M = D, the diagonal of the Laplacian of the adjacency matrix
+   *  (weighted degrees, without self loops). Set it on a
+   *  LaplacianMatrixHost with prec_setup.
+   */
+  template <typename IndexType_, typename ValueType_>
+  class JacobiPreconditionerHost
+    : public Matrix<IndexType_, ValueType_> {
+
+  private:
+    /// Diagonal of the Laplacian
+    std::vector<ValueType_> D;
+
+  public:
+    /// Constructor
+    JacobiPreconditionerHost(const CsrMatrixHost<IndexType_,ValueType_> & _A);
+
+    /// Destructor
+    virtual ~JacobiPreconditionerHost();
+
+    /// Get and Set CUDA stream
+    virtual void setCUDAStream(cudaStream_t _s);
+    virtual void getCUDAStream(cudaStream_t *_s);
+
+    /// Matrix-vector product (with D)
+    virtual void mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+                    ValueType_ beta, ValueType_ * __restrict__ y) const;
+    /// Matrix-set of k vectors product (with D)
+    virtual void mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const;
+
+    /// Color and Reorder
+    virtual void color(IndexType_ *c, IndexType_ *p) const;
+    virtual void reorder(IndexType_ *p) const;
+
+    /// Solve D x = f for a set of k vectors
+    virtual void prec_setup(Matrix<IndexType_,ValueType_> * _M);
+    virtual void prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const;
+
+    //Get the sum of all edges
+    virtual ValueType_ getEdgeSum() const;
+  };
+
+  /// Aggregation multigrid preconditioner of a graph Laplacian (host
+  /// memory)
+  /** prec_setup builds a hierarchy of graphs by heavy-edge matching
+   *  and contraction (see graph_coarsening_host.hxx), so that each
+   *  coarse Laplacian is the Galerkin product P'*L*P with the
+   *  piecewise constant prolongation P. prec_solve applies one
+   *  V-cycle with damped Jacobi smoothing (one sweep before and after
+   *  the coarse correction, a few sweeps on the coarsest graph). Set
+   *  it on a LaplacianMatrixHost with prec_setup.
+   */
+  template <typename IndexType_, typename ValueType_>
+  class AggregationPreconditionerHost
+    : public Matrix<IndexType_, ValueType_> {
+
+  private:
+    /// Adjacency matrix
+    const CsrMatrixHost<IndexType_, ValueType_> * A;
+    /// Number of vertices below which coarsening stops
+    IndexType_ coarsestSize;
+    /// Graph hierarchy, the finest level is A
+    std::vector< GraphLevelHost<IndexType_,ValueType_> > levels;
+    /// Diagonal of the Laplacian of each level
+    std::vector< std::vector<ValueType_> > D;
+
+    /// Apply one V-cycle from level l: x = M_l\b
+    void vcycle(size_t l, const ValueType_ * b, ValueType_ * x) const;
+
+  public:
+    /// Constructor
+    AggregationPreconditionerHost(const CsrMatrixHost<IndexType_,ValueType_> & _A,
+                                  IndexType_ _coarsestSize = 100);
+
+    /// Destructor
+    virtual ~AggregationPreconditionerHost();
+
+    /// Get and Set CUDA stream
+    virtual void setCUDAStream(cudaStream_t _s);
+    virtual void getCUDAStream(cudaStream_t *_s);
+
+    /// Matrix-vector product (not implemented, M is implicit)
+    virtual void mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+                    ValueType_ beta, ValueType_ * __restrict__ y) const;
+    /// Matrix-set of k vectors product (not implemented, M is implicit)
+    virtual void mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const;
+
+    /// Color and Reorder
+    virtual void color(IndexType_ *c, IndexType_ *p) const;
+    virtual void reorder(IndexType_ *p) const;
+
+    /// Build the hierarchy (setup) and apply a V-cycle to a set of k
+    /// vectors (solve)
+    virtual void prec_setup(Matrix<IndexType_,ValueType_> * _M);
+    virtual void prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const;
+
+    //Get the sum of all edges
+    virtual ValueType_ getEdgeSum() const;
+  };
+
+}
+
@@ -31,6 +31,11 @@ namespace nvgraph {
    *  @param maxIter_lanczos Maximum number of Lanczos iterations.
    *  @param restartIter_lanczos Maximum size of Lanczos system before
    *    implicit restart.
+   *  @param randomized_subspace Whether to compute approximate
+   *    eigenvectors with maxIter_lanczos steps of randomized subspace
+   *    iteration (computeLargestEigenvectors_subspace) instead of the
+   *    Lanczos method. The work is fixed and restartIter_lanczos and
+   *    tol_lanczos are ignored.
    *  @param tol_lanczos Convergence tolerance for Lanczos method.
    *  @param maxIter_kmeans Maximum number of k-means iterations.
    *  @param tol_kmeans Convergence tolerance for k-means algorithm.
@@ -48,6 +53,7 @@ namespace nvgraph {
            IndexType_ nEigVecs,
            IndexType_ maxIter_lanczos,
            IndexType_ restartIter_lanczos,
+           bool randomized_subspace,
            ValueType_ tol_lanczos,
            IndexType_ maxIter_kmeans,
            ValueType_ tol_kmeans,
@@ -106,7 +106,12 @@ extern "C" {
 	{
 		NVGRAPH_MODULARITY_MAXIMIZATION = 0, //maximize modularity with Lanczos solver
 		NVGRAPH_BALANCED_CUT_LANCZOS = 1, //minimize balanced cut with Lanczos solver
-		NVGRAPH_BALANCED_CUT_LOBPCG = 2 //minimize balanced cut with LOPCG solver
+		NVGRAPH_BALANCED_CUT_LOBPCG = 2, //minimize balanced cut with LOPCG solver
+		NVGRAPH_MODULARITY_MAXIMIZATION_BLOCK_LANCZOS = 3, //maximize modularity with block Lanczos solver (nvgraphSpectralClusteringHost only)
+		NVGRAPH_BALANCED_CUT_BLOCK_LANCZOS = 4, //minimize balanced cut with block Lanczos solver (nvgraphSpectralClusteringHost only)
+		NVGRAPH_MODULARITY_MAXIMIZATION_SUBSPACE = 5, //maximize modularity with randomized subspace iteration (evs_max_iter iterations, default 20, no tolerance)
+		NVGRAPH_BALANCED_CUT_SUBSPACE = 6, //minimize balanced cut with randomized subspace iteration (evs_max_iter iterations, default 20, no tolerance)
+		NVGRAPH_BALANCED_CUT_MULTILEVEL = 7 //minimize balanced cut with multilevel coarsening, recursive spectral bisection and refinement (nvgraphSpectralClusteringHost only)
 	} nvgraphSpectralClusteringType_t;
 
 	struct SpectralClusteringParameter {
@@ -127,6 +132,13 @@ extern "C" {
 		NVGRAPH_RATIO_CUT // sum for all clusters of the number of edges going outside of the cluster divided by the number of vertex inside the cluster
 	} nvgraphClusteringMetric_t;
 
+	struct nvgraphClusteringScores {
+		float modularity; // NVGRAPH_MODULARITY
+		float edge_cut; // NVGRAPH_EDGE_CUT
+		float ratio_cut; // NVGRAPH_RATIO_CUT
+		float normalized_cut; // sum for all clusters of the weight of the edges going outside of the cluster divided by the sum of the degrees of the cluster
+	};
+
 	struct nvgraphCSRTopology32I_st {
 		int nvertices; // n+1
 		int nedges; // nnz
@@ -442,6 +454,23 @@ extern "C" {
 																			nvgraphClusteringMetric_t metric,
 																			float * score);
 
+	/* nvGRAPH analyze clustering, all metrics
+	 * Same input as nvgraphAnalyzeClustering, every metric computed in one pass over the graph.
+	 * Optional per cluster table (host memory, n_clusters entries each, NULL to skip):
+	 * number of vertices, volume (sum of the degrees), cut (weight of the edges going outside
+	 * of the cluster) and conductance (cut / min(volume, total volume - volume)).
+	 */
+	nvgraphStatus_t NVGRAPH_API nvgraphAnalyzeClusteringAll(nvgraphHandle_t handle,
+																				const nvgraphGraphDescr_t graph_descr,
+																				const size_t weight_index,
+																				const int n_clusters,
+																				const int* clustering,
+																				struct nvgraphClusteringScores * scores,
+																				int * cluster_sizes,
+																				float * cluster_volumes,
+																				float * cluster_cuts,
+																				float * cluster_conductances);
+
 	/* nvGRAPH Triangles counting
 	 * count number of triangles (cycles of size 3) formed by graph edges
 	 */
@@ -82,7 +82,27 @@ cudaError_t csrmv_mp(
 	ValueType_ beta,
 	ValueType_ *dVectorY,
 	Semiring SR, //this parameter is of type enum and gives the semiring name
-	cudaStream_t stream = 0);	
+	cudaStream_t stream = 0);
+
+//semiring product of a csr matrix with a dense block of k vectors
+//the blocks are stored row major (x[i*k + j] is the entry i of the j th vector) so that
+//the k values gathered for each nonzero are contiguous in memory
+//y = alpha op A op x plus beta op y
+template <typename IndexType_, typename ValueType_>
+cudaError_t csrmm_mp(
+	IndexType_ m,
+	IndexType_ n,
+	IndexType_ nnz,
+	IndexType_ k,
+	ValueType_ alpha,
+	const ValueType_ * dValues, //all must be preallocated on the device
+	const IndexType_ * dRowOffsets,
+	const IndexType_ * dColIndices,
+	const ValueType_ * dBlockX,
+	ValueType_ beta,
+	ValueType_ * dBlockY,
+	Semiring SR, //this parameter is of type enum and gives the semiring name
+	cudaStream_t stream = 0);
 } //end nvgraph namespace
 
 template<typename IndexType_, typename ValueType_>
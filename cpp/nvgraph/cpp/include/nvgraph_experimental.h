@@ -111,6 +111,237 @@ nvgraphStatus_t NVGRAPH_API nvgraphKrylovPagerank(nvgraphHandle_t handle,
                                    const int has_guess,
                                    const size_t pagerank_index); 
 
+/* nvGRAPH many-to-many shortest paths
+ * Shortest path distance from each of the num_sources vertices in source_verts to each of the
+ * num_destinations vertices in destination_verts (every vertex if destination_verts is NULL).
+ * distances is a num_destinations x num_sources row major matrix (host or device memory).
+ * The graph must be in CSC format, like for nvgraphSssp.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphSsspMulti(nvgraphHandle_t handle,
+                                   const nvgraphGraphDescr_t descrG,
+                                   const size_t weight_index,
+                                   const int *source_verts,
+                                   const size_t num_sources,
+                                   const int *destination_verts,
+                                   const size_t num_destinations,
+                                   void *distances);
+
+/* nvGRAPH host WidestPath
+ * Same result as nvgraphWidestPath for each of the num_sources vertices in source_verts,
+ * computed on the host from a CSC topology and weights in host memory.
+ * widest_path is a num_sources x nvertices row major array in host memory.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphWidestPathHost(const nvgraphCSCTopology32I_t topology,
+                                   const cudaDataType_t weight_type,
+                                   const void *weights,
+                                   const int *source_verts,
+                                   const size_t num_sources,
+                                   void *widest_path);
+
+/* nvGRAPH host KrylovPagerank
+ * Same result as nvgraphKrylovPagerank, computed on the host from a CSC topology in host memory.
+ * weights, bookmark (the dangling nodes, see nvgraphPagerank) and rank have the weight_type type
+ * and are in host memory. rank holds the initial guess when has_guess is set.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphKrylovPagerankHost(const nvgraphCSCTopology32I_t topology,
+                                   const cudaDataType_t weight_type,
+                                   const void *weights,
+                                   const void *alpha,
+                                   const void *bookmark,
+                                   const float tolerance,
+                                   const int max_iter,
+                                   const int subspace_size,
+                                   const int has_guess,
+                                   void *rank);
+
+/* nvGRAPH host TriangleCount
+ * Same input and result as nvgraphTriangleCount (lower triangular CSR),
+ * computed on the host from a topology in host memory.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphTriangleCountHost(const nvgraphCSRTopology32I_t topology,
+                                   uint64_t *result);
+
+/* nvGRAPH host approximate TriangleCount
+ * Estimate the number of triangles by sampling wedges (paths u-v-w) and checking if they are closed.
+ * error is the absolute error on the fraction of closed wedges and confidence the probability that
+ * [lower, upper] holds the exact count, both in (0,1). lower and upper can be NULL.
+ * Same input as nvgraphTriangleCountHost, the result only depends on seed.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphTriangleCountApproxHost(const nvgraphCSRTopology32I_t topology,
+                                   const float error,
+                                   const float confidence,
+                                   const unsigned long long seed,
+                                   double *estimate,
+                                   double *lower,
+                                   double *upper);
+
+/* nvGRAPH host per vertex triangles
+ * vertex_triangles[v] is the number of triangles v belongs to and clustering[v] its local
+ * clustering coefficient (CUDA_R_32F or CUDA_R_64F). Either output can be NULL.
+ * Both are nvertices arrays in host memory.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphTriangleCountVertexHost(const nvgraphCSRTopology32I_t topology,
+                                   const cudaDataType_t clustering_type,
+                                   uint64_t *vertex_triangles,
+                                   void *clustering);
+
+/* nvGRAPH host k-truss decomposition
+ * edge_support[e] is the number of triangles edge e belongs to and truss[e] the largest k
+ * such that e is in the k-truss. Either output can be NULL.
+ * Both are nedges arrays in host memory, indexed like topology->destination_indices.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphKTrussHost(const nvgraphCSRTopology32I_t topology,
+                                   int *edge_support,
+                                   int *truss);
+
+/* Preconditioners of the host LOBPCG eigensolver (NVGRAPH_BALANCED_CUT_LOBPCG) */
+typedef enum
+{
+   NVGRAPH_PRECONDITIONER_NONE = 0,        // plain LOBPCG
+   NVGRAPH_PRECONDITIONER_JACOBI = 1,      // divide by the vertex degrees
+   NVGRAPH_PRECONDITIONER_AGGREGATION = 2  // V-cycle of an aggregation multigrid (heavy-edge matching)
+} nvgraphPreconditionerType_t;
+
+/* nvGRAPH host spectral clustering
+ * Same as nvgraphSpectralClustering on a host CSR topology with the NVGRAPH_MODULARITY_MAXIMIZATION
+ * or NVGRAPH_BALANCED_CUT_LANCZOS algorithm, or their block Lanczos variants
+ * (NVGRAPH_MODULARITY_MAXIMIZATION_BLOCK_LANCZOS, NVGRAPH_BALANCED_CUT_BLOCK_LANCZOS) which multiply
+ * the graph by blocks of up to 4 vectors at once. NVGRAPH_BALANCED_CUT_MULTILEVEL coarsens the graph
+ * by heavy-edge matching, bisects the coarsest graph recursively with its Fiedler vector and refines
+ * the projected partition at every level, keeping parts within 3% of n/n_clusters vertices;
+ * eig_vals and eig_vects then hold the eigenpairs of the coarsest graph, interpolated to the
+ * vertices. NVGRAPH_BALANCED_CUT_LOBPCG computes the eigenvectors with a preconditioned LOBPCG
+ * solver (n_eig_vects at most nvertices/3); params->opt can point to an nvgraphPreconditionerType_t,
+ * NULL selects NVGRAPH_PRECONDITIONER_AGGREGATION. edge_weights (weight_type CUDA_R_32F or
+ * CUDA_R_64F) can be NULL for unit weights. clustering, eig_vals and eig_vects are in host memory.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphSpectralClusteringHost(const nvgraphCSRTopology32I_t topology,
+                                   const cudaDataType_t weight_type,
+                                   const void *edge_weights,
+                                   const struct SpectralClusteringParameter *params,
+                                   int *clustering,
+                                   void *eig_vals,
+                                   void *eig_vects);
+
+/* nvGRAPH spectral clustering with mini-batch k-means
+ * Same as nvgraphSpectralClustering, the whitened eigenvectors are clustered on the host by
+ * mini-batches of kmean_batch_size vertices (0 selects 1024) instead of full k-means iterations.
+ * params->kmean_max_iter is then the number of mini-batches. Only the NVGRAPH_BALANCED_CUT_LANCZOS
+ * and NVGRAPH_BALANCED_CUT_SUBSPACE algorithms are supported.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphSpectralClusteringMiniBatch(nvgraphHandle_t handle,
+                                   const nvgraphGraphDescr_t graph_descr,
+                                   const size_t weight_index,
+                                   const struct SpectralClusteringParameter *params,
+                                   const int kmean_batch_size,
+                                   int *clustering,
+                                   void *eig_vals,
+                                   void *eig_vects);
+
+/* nvGRAPH host spectral clustering with mini-batch k-means
+ * Same as nvgraphSpectralClusteringHost with mini-batches of kmean_batch_size vertices
+ * (0 selects 1024), like nvgraphSpectralClusteringMiniBatch. Every algorithm but
+ * NVGRAPH_BALANCED_CUT_MULTILEVEL, which does not run k-means, is supported.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphSpectralClusteringMiniBatchHost(const nvgraphCSRTopology32I_t topology,
+                                   const cudaDataType_t weight_type,
+                                   const void *edge_weights,
+                                   const struct SpectralClusteringParameter *params,
+                                   const int kmean_batch_size,
+                                   int *clustering,
+                                   void *eig_vals,
+                                   void *eig_vects);
+
+/* nvGRAPH host contraction
+ * Same arguments and result as nvgraphContractGraph, the contracted graph is built on the host
+ * (aggregates is in host memory) and stored in contrdescrG like the one of nvgraphContractGraph.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphContractGraphHost(nvgraphHandle_t handle,
+                                   nvgraphGraphDescr_t descrG,
+                                   nvgraphGraphDescr_t contrdescrG,
+                                   int *aggregates,
+                                   size_t numaggregates,
+                                   nvgraphSemiringOps_t VertexCombineOp,
+                                   nvgraphSemiringOps_t VertexReduceOp,
+                                   nvgraphSemiringOps_t EdgeCombineOp,
+                                   nvgraphSemiringOps_t EdgeReduceOp,
+                                   int flag);
+
+/* nvGRAPH host subgraph views
+ * Same result as nvgraphExtractSubgraphByVertex (subvertices) or nvgraphExtractSubgraphByEdge (subedges)
+ * followed by nvgraphTraversal (BFS) or nvgraphPagerank, without extracting the subgraph: the algorithms
+ * run on the topology in host memory and skip the vertices and edges that are not in the subgraph.
+ * Exactly one of subvertices and subedges must be set. Vertices are numbered like in the extracted
+ * subgraph (subgraph vertices in increasing order): source_vert, distances, predecessors, bookmark
+ * and rank have one entry per subgraph vertex. weights are the nedges weights of the whole graph.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewTraversalHost(const nvgraphCSRTopology32I_t topology,
+                                   const int *subvertices,
+                                   size_t numvertices,
+                                   const int *subedges,
+                                   size_t numedges,
+                                   const int source_vert,
+                                   int *distances,
+                                   int *predecessors);
+
+nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewPagerankHost(const nvgraphCSCTopology32I_t topology,
+                                   const cudaDataType_t weight_type,
+                                   const void *weights,
+                                   const int *subvertices,
+                                   size_t numvertices,
+                                   const int *subedges,
+                                   size_t numedges,
+                                   const void *alpha,
+                                   const void *bookmark,
+                                   const float tolerance,
+                                   const int max_iter,
+                                   const int has_guess,
+                                   void *rank);
+
+/* nvGRAPH subgraph views
+ * Same as nvgraphSubgraphViewTraversalHost and nvgraphSubgraphViewPagerankHost on a graph in device
+ * memory: descrG has an NVGRAPH_CSR_32 topology for the traversal and an NVGRAPH_CSC_32 topology with
+ * edge data (weight_index) for Pagerank. subvertices, subedges, distances, predecessors, bookmark
+ * and rank can be in host or device memory. The predecessor of a vertex is one of its neighbours
+ * at the previous level, not always the one of the host traversal.
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewTraversal(nvgraphHandle_t handle,
+                                   const nvgraphGraphDescr_t descrG,
+                                   const int *subvertices,
+                                   size_t numvertices,
+                                   const int *subedges,
+                                   size_t numedges,
+                                   const int source_vert,
+                                   int *distances,
+                                   int *predecessors);
+
+nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewPagerank(nvgraphHandle_t handle,
+                                   const nvgraphGraphDescr_t descrG,
+                                   const size_t weight_index,
+                                   const int *subvertices,
+                                   size_t numvertices,
+                                   const int *subedges,
+                                   size_t numedges,
+                                   const void *alpha,
+                                   const void *bookmark,
+                                   const float tolerance,
+                                   const int max_iter,
+                                   const int has_guess,
+                                   void *rank);
+
+/* nvGRAPH host topology conversion
+ * Same conversions as nvgraphConvertTopology for topologies and edge data in host memory,
+ * computed with a parallel counting sort. srcEdgeData and dstEdgeData can both be NULL
+ * to convert the topology only (dataType is then ignored).
+ */
+nvgraphStatus_t NVGRAPH_API nvgraphConvertTopologyHost(nvgraphTopologyType_t srcTType,
+                                   void *srcTopology,
+                                   void *srcEdgeData,
+                                   cudaDataType_t *dataType,
+                                   nvgraphTopologyType_t dstTType,
+                                   void *dstTopology,
+                                   void *dstEdgeData);
+
 #if defined(__cplusplus) 
 } //extern "C"
 #endif
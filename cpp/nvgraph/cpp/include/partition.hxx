@@ -44,9 +44,18 @@ namespace nvgraph {
    *  @param maxIter_lanczos Maximum number of Lanczos iterations.
    *  @param restartIter_lanczos Maximum size of Lanczos system before
    *    implicit restart.
+   *  @param randomized_subspace Whether to compute approximate
+   *    eigenvectors with maxIter_lanczos steps of randomized subspace
+   *    iteration (computeSmallestEigenvectors_subspace) instead of the
+   *    Lanczos method. The work is fixed and restartIter_lanczos and
+   *    tol_lanczos are ignored.
    *  @param tol_lanczos Convergence tolerance for Lanczos method.
    *  @param maxIter_kmeans Maximum number of k-means iterations.
    *  @param tol_kmeans Convergence tolerance for k-means algorithm.
+   *  @param batchSize_kmeans Number of rows per mini-batch of
+   *    kmeans_minibatch_host, 0 for kmeans (full batch). The
+   *    whitened eigenvectors are then clustered on the host.
+   *    maxIter_kmeans is the number of mini-batches.
    *  @param parts (Output, device memory, n entries) Partition
    *    assignments.
    *  @param iters_lanczos On exit, number of Lanczos iterations
@@ -61,9 +70,11 @@ namespace nvgraph {
 		       IndexType_ nEigVecs,
 		       IndexType_ maxIter_lanczos,
 		       IndexType_ restartIter_lanczos,
+		       bool randomized_subspace,
 		       ValueType_ tol_lanczos,
 		       IndexType_ maxIter_kmeans,
 		       ValueType_ tol_kmeans,
+		       IndexType_ batchSize_kmeans,
 		       IndexType_ * __restrict__ parts,
            Vector<ValueType_> &eigVals,
            Vector<ValueType_> &eigVecs,
@@ -105,5 +116,40 @@ namespace nvgraph {
 			      const IndexType_ * __restrict__ parts,
 			      ValueType_ & edgeCut, ValueType_ & cost);
 
+  /// Analyze a clustering in one pass over the graph
+  /** Size, volume (sum of the degrees), cut (weight of the edges
+   *  leaving the cluster) and conductance of every cluster, and the
+   *  modularity, edge cut, ratio cut and normalized cut of the
+   *  clustering, from a single scan of the rows. Graph is assumed to
+   *  be weighted and undirected.
+   *
+   *  @param G Weighted graph in CSR format
+   *  @param nClusters Number of clusters.
+   *  @param clusters (Input, device memory, n entries) Cluster
+   *    assignments.
+   *  @param clusterSize (Output, host memory, nClusters entries)
+   *  @param clusterVolume (Output, host memory, nClusters entries)
+   *  @param clusterCut (Output, host memory, nClusters entries)
+   *  @param clusterConductance (Output, host memory, nClusters
+   *    entries) cut/min(volume, total volume - volume).
+   *  @param modularity On exit, modularity (as analyzeModularity).
+   *  @param edgeCut On exit, weight of edges cut by clustering.
+   *  @param ratioCut On exit, cost of analyzePartition.
+   *  @param normalizedCut On exit, sum of cut/volume.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR analyzeClustering(ValuedCsrGraph<IndexType_,ValueType_> & G,
+			      IndexType_ nClusters,
+			      const IndexType_ * __restrict__ clusters,
+			      IndexType_ * __restrict__ clusterSize,
+			      ValueType_ * __restrict__ clusterVolume,
+			      ValueType_ * __restrict__ clusterCut,
+			      ValueType_ * __restrict__ clusterConductance,
+			      ValueType_ & modularity,
+			      ValueType_ & edgeCut,
+			      ValueType_ & ratioCut,
+			      ValueType_ & normalizedCut);
+
 }
 
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "nvgraph_error.hxx"
+#include "matrix.hxx"
+
+namespace nvgraph {
+
+  /// Spectral graph partition on the host
+  /** Same algorithm as partition with the Lanczos eigensolver, on
+   *  host memory: smallest eigenvectors of the Laplacian with
+   *  computeSmallestEigenvectors_host, then kmeans_host on the
+   *  whitened eigenvectors.
+   *
+   *  @param n Number of vertices.
+   *  @param nnz Number of edges.
+   *  @param csrRowPtr (Input, host memory, n+1 entries) CSR offsets
+   *    of the (symmetric) adjacency matrix.
+   *  @param csrColInd (Input, host memory, nnz entries) CSR column
+   *    indices.
+   *  @param csrVal (Input, host memory, nnz entries) Edge weights,
+   *    NULL for unit weights.
+   *  @param nParts Number of partitions.
+   *  @param nEigVecs Number of eigenvectors to compute.
+   *  @param maxIter_lanczos Maximum number of Lanczos iterations.
+   *  @param restartIter_lanczos Maximum size of Lanczos system before
+   *    implicit restart.
+   *  @param blockSize_lanczos Number of vectors per block. 1 selects
+   *    computeSmallestEigenvectors_host, larger values the block
+   *    Lanczos method (computeSmallestEigenvectors_block_host).
+   *  @param randomized_subspace Whether to compute approximate
+   *    eigenvectors with maxIter_lanczos steps of randomized subspace
+   *    iteration (computeSmallestEigenvectors_subspace_host) instead.
+   *    The work is fixed and restartIter_lanczos, blockSize_lanczos
+   *    and tol_lanczos are ignored.
+   *  @param tol_lanczos Convergence tolerance for Lanczos method.
+   *  @param maxIter_kmeans Maximum number of k-means iterations.
+   *  @param tol_kmeans Convergence tolerance for k-means algorithm.
+   *  @param batchSize_kmeans Number of rows per mini-batch of
+   *    kmeans_minibatch_host, 0 for kmeans_host (full batch).
+   *    maxIter_kmeans is then the number of mini-batches.
+   *  @param parts (Output, host memory, n entries) Partition
+   *    assignments.
+   *  @param eigVals (Output, host memory, nEigVecs entries)
+   *    Eigenvalues.
+   *  @param eigVecs (Output, host memory, n*nEigVecs entries)
+   *    Whitened eigenvectors, column-major n x nEigVecs.
+   *  @param iters_lanczos On exit, number of Lanczos iterations
+   *    performed.
+   *  @param iters_kmeans On exit, number of k-means iterations
+   *    performed.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR partition_host(IndexType_ n, IndexType_ nnz,
+                               const IndexType_ * csrRowPtr,
+                               const IndexType_ * csrColInd,
+                               const ValueType_ * csrVal,
+                               IndexType_ nParts,
+                               IndexType_ nEigVecs,
+                               IndexType_ maxIter_lanczos,
+                               IndexType_ restartIter_lanczos,
+                               IndexType_ blockSize_lanczos,
+                               bool randomized_subspace,
+                               ValueType_ tol_lanczos,
+                               IndexType_ maxIter_kmeans,
+                               ValueType_ tol_kmeans,
+                               IndexType_ batchSize_kmeans,
+                               IndexType_ * __restrict__ parts,
+                               ValueType_ * __restrict__ eigVals,
+                               ValueType_ * __restrict__ eigVecs,
+                               IndexType_ & iters_lanczos,
+                               IndexType_ & iters_kmeans);
+
+  /// Spectral graph partition with LOBPCG on the host
+  /** Same algorithm as partition_lobpcg, on host memory: smallest
+   *  eigenvectors of the Laplacian with
+   *  computeSmallestEigenvectors_lobpcg_host, then kmeans_host on the
+   *  whitened eigenvectors.
+   *
+   *  @param M Preconditioner of the Laplacian, set with prec_setup
+   *    (JacobiPreconditionerHost, AggregationPreconditionerHost), or
+   *    NULL for none.
+   *  @param maxIter_lanczos Maximum number of LOBPCG iterations.
+   *  @param tol_lanczos Convergence tolerance for LOBPCG.
+   *  @param iters_lanczos On exit, number of LOBPCG iterations
+   *    performed.
+   *
+   *  Other parameters are the same as partition_host. nEigVecs must
+   *  be at most n/3.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR partition_lobpcg_host(IndexType_ n, IndexType_ nnz,
+                                      const IndexType_ * csrRowPtr,
+                                      const IndexType_ * csrColInd,
+                                      const ValueType_ * csrVal,
+                                      Matrix<IndexType_,ValueType_> * M,
+                                      IndexType_ nParts,
+                                      IndexType_ nEigVecs,
+                                      IndexType_ maxIter_lanczos,
+                                      ValueType_ tol_lanczos,
+                                      IndexType_ maxIter_kmeans,
+                                      ValueType_ tol_kmeans,
+                                      IndexType_ batchSize_kmeans,
+                                      IndexType_ * __restrict__ parts,
+                                      ValueType_ * __restrict__ eigVals,
+                                      ValueType_ * __restrict__ eigVecs,
+                                      IndexType_ & iters_lanczos,
+                                      IndexType_ & iters_kmeans);
+
+  /// Spectral modularity maximization on the host
+  /** Same algorithm as modularity_maximization, on host memory:
+   *  largest eigenvectors of the modularity matrix with
+   *  computeLargestEigenvectors_host (or its block or subspace
+   *  variant), then kmeans_host on the whitened eigenvectors.
+   *  Parameters are the same as partition_host.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR modularity_maximization_host(IndexType_ n, IndexType_ nnz,
+                                             const IndexType_ * csrRowPtr,
+                                             const IndexType_ * csrColInd,
+                                             const ValueType_ * csrVal,
+                                             IndexType_ nClusters,
+                                             IndexType_ nEigVecs,
+                                             IndexType_ maxIter_lanczos,
+                                             IndexType_ restartIter_lanczos,
+                                             IndexType_ blockSize_lanczos,
+                                             bool randomized_subspace,
+                                             ValueType_ tol_lanczos,
+                                             IndexType_ maxIter_kmeans,
+                                             ValueType_ tol_kmeans,
+                                             IndexType_ batchSize_kmeans,
+                                             IndexType_ * __restrict__ clusters,
+                                             ValueType_ * __restrict__ eigVals,
+                                             ValueType_ * __restrict__ eigVecs,
+                                             IndexType_ & iters_lanczos,
+                                             IndexType_ & iters_kmeans);
+
+  /// Analyze a graph partition on the host
+  /** Same quantities as analyzePartition, on host memory, plus the
+   *  imbalance of the partition sizes.
+   *
+   *  @param n Number of vertices.
+   *  @param nnz Number of edges.
+   *  @param csrRowPtr (Input, host memory, n+1 entries) CSR offsets
+   *    of the (symmetric) adjacency matrix.
+   *  @param csrColInd (Input, host memory, nnz entries) CSR column
+   *    indices.
+   *  @param csrVal (Input, host memory, nnz entries) Edge weights,
+   *    NULL for unit weights.
+   *  @param nParts Number of partitions.
+   *  @param parts (Input, host memory, n entries) Partition
+   *    assignments.
+   *  @param edgeCut On exit, weight of edges cut by partition.
+   *  @param cost On exit, partition cost function,
+   *    \sum_i (Edges cut by ith partition)/(Vertices in ith partition).
+   *  @param imbalance On exit, size of the largest partition divided
+   *    by n/nParts (1 for a perfectly balanced partition).
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR analyzePartition_host(IndexType_ n, IndexType_ nnz,
+                                      const IndexType_ * csrRowPtr,
+                                      const IndexType_ * csrColInd,
+                                      const ValueType_ * csrVal,
+                                      IndexType_ nParts,
+                                      const IndexType_ * __restrict__ parts,
+                                      ValueType_ & edgeCut,
+                                      ValueType_ & cost,
+                                      ValueType_ & imbalance);
+
+}
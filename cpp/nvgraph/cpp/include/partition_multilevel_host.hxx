@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "nvgraph_error.hxx"
+
+namespace nvgraph {
+
+  /// Multilevel graph partition on the host
+  /** Minimizes the weight of the edges cut by a partition of a
+   *  weighted undirected graph into nParts parts of nearly equal size.
+   *
+   *  Coarsening: vertices are paired by heavy-edge matching with the
+   *  similarity of size2_selector (SCALED_BY_ROW_SUM,
+   *  A_ij/max(d_i,d_j)), and each pair is contracted into one vertex
+   *  whose weight is the number of original vertices it holds. This
+   *  is repeated until the graph has at most coarsestSize vertices or
+   *  the matching stalls.
+   *
+   *  The coarsest graph is partitioned by recursive spectral
+   *  bisection: the vertices are split at the weighted median of the
+   *  Fiedler vector (computeSmallestEigenvectors_host), and each half
+   *  again, which keeps the parts balanced where k-means on the
+   *  eigenvectors does not.
+   *
+   *  Uncoarsening: the partition is projected back level by level and
+   *  refined at each level with size-constrained label propagation.
+   *  The moves with positive FM gain are computed in parallel and
+   *  committed in decreasing order of gain, after their gain and the
+   *  size constraint are checked again. Overweight parts are
+   *  rebalanced first.
+   *
+   *  @param n Number of vertices.
+   *  @param nnz Number of edges.
+   *  @param csrRowPtr (Input, host memory, n+1 entries) CSR offsets
+   *    of the (symmetric) adjacency matrix.
+   *  @param csrColInd (Input, host memory, nnz entries) CSR column
+   *    indices.
+   *  @param csrVal (Input, host memory, nnz entries) Edge weights,
+   *    NULL for unit weights.
+   *  @param nParts Number of partitions.
+   *  @param nEigVecs Number of eigenvectors of the coarsest graph to
+   *    return.
+   *  @param maxIter_lanczos Maximum number of Lanczos iterations.
+   *  @param restartIter_lanczos Maximum size of Lanczos system before
+   *    implicit restart.
+   *  @param tol_lanczos Convergence tolerance for Lanczos method.
+   *  @param coarsestSize Number of vertices below which coarsening
+   *    stops. Should be several times nParts.
+   *  @param maxIter_refine Maximum number of refinement passes at
+   *    each level.
+   *  @param imbalance_tol Allowed imbalance: parts hold at most
+   *    (1+imbalance_tol)*n/nParts vertices, plus the heaviest vertex
+   *    of the current level during refinement.
+   *  @param parts (Output, host memory, n entries) Partition
+   *    assignments.
+   *  @param eigVals (Output, host memory, nEigVecs entries)
+   *    Eigenvalues of the Laplacian of the coarsest graph.
+   *  @param eigVecs (Output, host memory, n*nEigVecs entries)
+   *    Eigenvectors of the Laplacian of the coarsest graph, interpolated to
+   *    the original vertices (each vertex takes the value of the
+   *    coarse vertex that contains it).
+   *  @param levels On exit, number of coarsening levels.
+   *  @param edgeCut On exit, weight of edges cut by partition (see
+   *    analyzePartition_host).
+   *  @param imbalance On exit, size of the largest partition divided
+   *    by n/nParts.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR partition_multilevel_host(IndexType_ n, IndexType_ nnz,
+                                          const IndexType_ * csrRowPtr,
+                                          const IndexType_ * csrColInd,
+                                          const ValueType_ * csrVal,
+                                          IndexType_ nParts,
+                                          IndexType_ nEigVecs,
+                                          IndexType_ maxIter_lanczos,
+                                          IndexType_ restartIter_lanczos,
+                                          ValueType_ tol_lanczos,
+                                          IndexType_ coarsestSize,
+                                          IndexType_ maxIter_refine,
+                                          ValueType_ imbalance_tol,
+                                          IndexType_ * __restrict__ parts,
+                                          ValueType_ * __restrict__ eigVals,
+                                          ValueType_ * __restrict__ eigVecs,
+                                          IndexType_ & levels,
+                                          ValueType_ & edgeCut,
+                                          ValueType_ & imbalance);
+
+}
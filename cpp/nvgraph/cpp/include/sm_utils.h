@@ -291,6 +291,15 @@ namespace utils
         return 0.0;
     #endif
     }
+
+    /// Sum of a value over the threads of a warp (result in lane 0)
+    template <typename T>
+    static __device__ __forceinline__ T warp_sum(T s)
+    {
+        for (int offset = 16; offset > 0; offset /= 2)
+            s += shfl_down(s, offset);
+        return s;
+    }
 }
 
 }
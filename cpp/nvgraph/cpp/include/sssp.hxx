@@ -66,5 +66,47 @@ public:
     inline int get_iterations() const {return m_iterations;}
 };
 
+template <typename IndexType_, typename ValueType_>
+class SsspMulti
+{
+public:
+    typedef IndexType_ IndexType;
+    typedef ValueType_ ValueType;
+
+private:
+    ValuedCsrGraph <IndexType, ValueType> m_network ;
+    Vector <ValueType> m_dist; // n x batch_size block, one column per source of the current batch
+    Vector <ValueType> m_tmp;
+
+    IndexType m_batch_size;
+    ValueType m_residual;
+    int m_iterations;
+
+    cudaStream_t m_stream;
+
+    bool solve_it(IndexType num_cols);
+
+public:
+    // Create a many-to-many shortest path solver attached to the transposed of a weighted network
+    // *** network is the transposed/CSC***
+    // The work buffers (n x batch_size) are allocated once and reused for every batch of sources
+    SsspMulti(const ValuedCsrGraph <IndexType, ValueType>& network, IndexType batch_size = 32, cudaStream_t stream = 0);
+
+    /*! Find the shortest paths from a set of sources to a set of destinations.
+     *  The sources are relaxed batch_size at a time with a MinPlus csrmm on a dense block.
+     *
+     *  \param num_sources Number of sources.
+     *  \param sources (device memory) The sources.
+     *  \param num_destinations Number of destinations.
+     *  \param destinations (device memory) The destinations, NULL to keep every vertex (num_destinations must be n).
+     *  \param (output) distances (device memory) num_destinations x num_sources row major matrix,
+     *                            distances[d*num_sources + s] is the shortest path from sources[s] to destinations[d].
+     */
+    NVGRAPH_ERROR solve(IndexType num_sources, const IndexType* sources,
+                        IndexType num_destinations, const IndexType* destinations,
+                        ValueType* distances);
+    inline int get_iterations() const {return m_iterations;}
+};
+
 } // end namespace nvgraph
 
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "nvgraph_error.hxx"
+#include "nvgraph_vector.hxx"
+
+namespace nvgraph
+{
+/*! Device subgraph view.
+ *  Same view as SubgraphViewHost over compressed (CSR or CSC) arrays in device memory:
+ *  the remap table (sorted parent ids of the subgraph vertices) and for edge subsets the
+ *  sorted subset edges with their offsets per subgraph vertex are built on the device,
+ *  the parent arrays are only referenced. The kernels map the parent id of an edge end
+ *  to the subgraph with a binary search in the remap table and skip the edges that are
+ *  not in the view.
+ *  Vertex data are in the subgraph numbering (device memory, get_num_vertices() entries),
+ *  edge data (weights) are the parent arrays.
+ */
+template <typename IndexType_>
+class SubgraphView
+{
+public:
+    typedef IndexType_ IndexType;
+
+private:
+    IndexType m_n;
+    IndexType m_nnz;
+    const IndexType* m_row_offsets;
+    const IndexType* m_col_indices;
+    cudaStream_t m_stream;
+
+    Vector<IndexType> m_vertices;     // subgraph vertex -> parent vertex, increasing
+    Vector<IndexType> m_edges;        // parent edges of the view, increasing, empty for a vertex subset
+    Vector<IndexType> m_edge_offsets; // subgraph vertex -> its first entry of m_edges, empty for a vertex subset
+    IndexType m_num_vertices;
+    IndexType m_num_edges;
+    bool m_use_edges;
+
+public:
+    /*! Create a view of a subgraph
+     *  \param n Number of vertices of the parent graph
+     *  \param nnz Number of edges of the parent graph
+     *  \param row_offsets (device memory) n+1 entries, not copied
+     *  \param col_indices (device memory) nnz entries, not copied
+     *  \param subset (host or device memory) vertices of the subgraph, or edges (indices in
+     *                col_indices) if use_edges is set; in any order, duplicates are ignored
+     *  \param use_edges Selects the edge semantics (subgraph of the edges of subset and their end vertices)
+     */
+    SubgraphView(IndexType n, IndexType nnz,
+                 const IndexType* row_offsets,
+                 const IndexType* col_indices,
+                 const IndexType* subset,
+                 size_t subset_size,
+                 bool use_edges = false,
+                 cudaStream_t stream = 0);
+
+    /*! Breadth first search from source (subgraph numbering), following the row -> column edges.
+     *  Same distances as SubgraphViewHost::traverse, the predecessor of a vertex is one of its
+     *  neighbours of the previous level.
+     *  \param (output) distances (device memory) get_num_vertices() entries, can be NULL
+     *  \param (output) predecessors (device memory) get_num_vertices() entries, can be NULL
+     */
+    NVGRAPH_ERROR traverse(IndexType source, IndexType* distances, IndexType* predecessors) const;
+
+    /*! y = alpha*A*x + beta*y with the edges of the view, A[i][j] = values[e] for the edge e of
+     *  row i and column j
+     *  \param values (device memory) the parent nnz entries, NULL for ones
+     *  \param x, (input/output) y (device memory) get_num_vertices() entries
+     */
+    template <typename ValueType>
+    void csrmv(ValueType alpha, const ValueType* values, const ValueType* x, ValueType beta, ValueType* y) const;
+
+    /*! Same iterations as Pagerank on the subgraph, the view must be over the
+     *  transposed transition matrix (CSC) like the graph of nvgraphPagerank.
+     *  \param weights (device memory) the parent nnz entries
+     *  \param bookmark (device memory) get_num_vertices() entries, 1 for the dangling nodes
+     *  \param guess (device memory) get_num_vertices() entries, NULL for a uniform guess
+     *  \param (output) pagerank (device memory) get_num_vertices() entries
+     */
+    template <typename ValueType>
+    NVGRAPH_ERROR pagerank(const ValueType* weights, ValueType damping_factor,
+                           const ValueType* bookmark, const ValueType* guess,
+                           float tolerance, int max_it, ValueType* pagerank) const;
+
+    inline IndexType get_num_vertices() const {return m_num_vertices;}
+    inline IndexType get_num_edges() const {return m_num_edges;}
+    /*! (device memory) parent ids of the subgraph vertices, get_num_vertices() entries */
+    inline const IndexType* get_raw_vertices() const {return m_vertices.raw();}
+};
+
+} // end namespace nvgraph
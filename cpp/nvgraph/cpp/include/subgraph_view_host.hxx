@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include "nvgraph_error.hxx"
+
+namespace nvgraph
+{
+/*! Host subgraph view.
+ *  Same subgraph as nvgraphExtractSubgraphByVertex / ByEdge, without building it:
+ *  the view keeps pointers to the parent compressed (CSR or CSC) arrays, a remap table
+ *  (sorted parent ids of the subgraph vertices, the subgraph numbering of the extraction)
+ *  and for edge subsets the sorted subset edges with their offsets per subgraph vertex.
+ *  Its storage is proportional to the subgraph, the parent id of an edge end is mapped
+ *  to the subgraph by a binary search in the remap table. The algorithms below walk the
+ *  parent arrays and skip the edges that are not in the view.
+ *  Vertex data (sources, distances, ranks...) are in the subgraph numbering,
+ *  edge data (weights) are the parent arrays.
+ */
+template <typename IndexType_>
+class SubgraphViewHost
+{
+public:
+    typedef IndexType_ IndexType;
+
+private:
+    IndexType m_n;
+    IndexType m_nnz;
+    const IndexType* m_row_offsets;
+    const IndexType* m_col_indices;
+
+    std::vector<IndexType> m_vertices;     // subgraph vertex -> parent vertex, increasing
+    std::vector<IndexType> m_edges;        // parent edges of the view, increasing, empty for a vertex subset
+    std::vector<IndexType> m_edge_offsets; // subgraph vertex -> its first entry of m_edges, empty for a vertex subset
+    IndexType m_num_edges;
+
+    // subgraph vertex of parent vertex v, -1 outside of the view
+    inline IndexType get_local(IndexType v) const
+    {
+        typename std::vector<IndexType>::const_iterator it = std::lower_bound(m_vertices.begin(), m_vertices.end(), v);
+        return (it != m_vertices.end() && *it == v) ? static_cast<IndexType>(it - m_vertices.begin()) : -1;
+    }
+
+    // calls f(e, j) for every edge e of the view from subgraph vertex i to subgraph vertex j
+    template <typename Function>
+    inline void for_each_edge(IndexType i, Function f) const
+    {
+        if (!m_edge_offsets.empty())
+        {
+            for (IndexType k = m_edge_offsets[i]; k < m_edge_offsets[i + 1]; k++)
+                f(m_edges[k], get_local(m_col_indices[m_edges[k]]));
+            return;
+        }
+        IndexType p = m_vertices[i];
+        for (IndexType e = m_row_offsets[p]; e < m_row_offsets[p + 1]; e++)
+        {
+            IndexType j = get_local(m_col_indices[e]);
+            if (j >= 0)
+                f(e, j);
+        }
+    }
+
+public:
+    /*! Create a view of a subgraph
+     *  \param n Number of vertices of the parent graph
+     *  \param nnz Number of edges of the parent graph
+     *  \param row_offsets (host memory) n+1 entries, not copied
+     *  \param col_indices (host memory) nnz entries, not copied
+     *  \param subset (host memory) vertices of the subgraph, or edges (indices in col_indices)
+     *                if use_edges is set; in any order, duplicates are ignored
+     *  \param use_edges Selects the edge semantics (subgraph of the edges of subset and their end vertices)
+     */
+    SubgraphViewHost(IndexType n, IndexType nnz,
+                     const IndexType* row_offsets,
+                     const IndexType* col_indices,
+                     const IndexType* subset,
+                     size_t subset_size,
+                     bool use_edges = false);
+
+    /*! Breadth first search from source (subgraph numbering), following the row -> column edges.
+     *  Same outputs as Bfs: distances[v] = INT_MAX and predecessors[v] = -1 if v is not reached.
+     *  \param (output) distances (host memory) get_num_vertices() entries, can be NULL
+     *  \param (output) predecessors (host memory) get_num_vertices() entries, can be NULL
+     */
+    NVGRAPH_ERROR traverse(IndexType source, IndexType* distances, IndexType* predecessors) const;
+
+    /*! y = A*x with the edges of the view, A[i][j] = values[e] for the edge e of row i and column j
+     *  \param values (host memory) the parent nnz entries
+     *  \param x, (output) y (host memory) get_num_vertices() entries
+     */
+    template <typename ValueType>
+    void spmv(const ValueType* values, const ValueType* x, ValueType* y) const;
+
+    /*! Same iterations as Pagerank on the subgraph, the view must be over the
+     *  transposed transition matrix (CSC) like the graph of nvgraphPagerank.
+     *  \param weights (host memory) the parent nnz entries
+     *  \param bookmark (host memory) get_num_vertices() entries, 1 for the dangling nodes
+     *  \param guess (host memory) get_num_vertices() entries, NULL for a uniform guess
+     *  \param (output) pagerank (host memory) get_num_vertices() entries
+     */
+    template <typename ValueType>
+    NVGRAPH_ERROR pagerank(const ValueType* weights, ValueType damping_factor,
+                           const ValueType* bookmark, const ValueType* guess,
+                           float tolerance, int max_it, ValueType* pagerank) const;
+
+    inline IndexType get_num_vertices() const {return static_cast<IndexType>(m_vertices.size());}
+    inline IndexType get_num_edges() const {return m_num_edges;}
+    inline const std::vector<IndexType>& get_vertices() const {return m_vertices;}
+};
+
+} // end namespace nvgraph
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "nvgraph_error.hxx"
+#include "matrix.hxx"
+
+namespace nvgraph {
+
+  /// Compute smallest eigenvectors of symmetric matrix with
+  /// randomized subspace iteration
+  /** Approximate eigenvectors for a fixed amount of work, as a fast
+   *  alternative to the Lanczos method (see lanczos.hxx). A Gaussian
+   *  block of nEigVecs+10 vectors goes through maxIter steps of
+   *  subspace (power) iteration with sigma*I-A, where sigma estimates
+   *  the spectral radius, and the Ritz pairs are extracted from the
+   *  projection of A on the final block. Every step is one block
+   *  product (Matrix::mm) and a Cholesky QR orthonormalization, and
+   *  there is no convergence test.
+   *
+   *  CNMEM must be initialized before calling this function.
+   *
+   *  @param A Matrix.
+   *  @param nEigVecs Number of eigenvectors to compute.
+   *  @param maxIter Number of subspace iterations.
+   *  @param iter On exit, number of matrix-vector products performed
+   *    (a block product counts the block size).
+   *  @param eigVals_dev (Output, device memory, nEigVecs entries)
+   *    Approximate smallest eigenvalues of matrix, in increasing
+   *    order.
+   *  @param eigVecs_dev (Output, device memory, n*nEigVecs entries)
+   *    Corresponding approximate eigenvectors. Vectors are stored as
+   *    columns of a column-major matrix with dimensions n x nEigVecs.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_subspace(const Matrix<IndexType_,ValueType_> & A,
+                                                     IndexType_ nEigVecs,
+                                                     IndexType_ maxIter,
+                                                     IndexType_ & iter,
+                                                     ValueType_ * __restrict__ eigVals_dev,
+                                                     ValueType_ * __restrict__ eigVecs_dev);
+
+  /// Compute largest eigenvectors of symmetric matrix with
+  /// randomized subspace iteration
+  /** Same as computeSmallestEigenvectors_subspace with sigma*I+A, for
+   *  the algebraically largest eigenvalues, returned in increasing
+   *  order.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeLargestEigenvectors_subspace(const Matrix<IndexType_,ValueType_> & A,
+                                                    IndexType_ nEigVecs,
+                                                    IndexType_ maxIter,
+                                                    IndexType_ & iter,
+                                                    ValueType_ * __restrict__ eigVals_dev,
+                                                    ValueType_ * __restrict__ eigVecs_dev);
+
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include <nvgraph_error.hxx>
+
+namespace nvgraph
+{
+
+namespace triangles_counting
+{
+
+// out-degree above which the neighbors of a vertex are scattered in a bitmap
+// instead of being merged with the neighbors of each of its successors
+#define TCOUNT_HOST_HUB_THR 1024
+
+/*! Host triangles counting.
+ *  Takes the same input as TrianglesCount (lower triangular CSR, a full symmetric CSR works too
+ *  since only the entries below the diagonal are read).
+ *  The edges are oriented from the lower to the higher (degree, id) rank and the vertices are
+ *  renumbered by rank, so every out-going list is sorted and holds at most sqrt(2*nnz) vertices.
+ *  The sorted lists are intersected with SSE2/AVX2 block compares, hubs use a per thread bitmap.
+ *  Per vertex and per edge outputs are indexed like the input (edges by their position in
+ *  col_indices, entries on or above the diagonal get 0).
+ */
+template <typename IndexType>
+class TrianglesCountHost
+{
+private:
+    IndexType               m_n;
+    IndexType               m_nnz;
+    std::vector<IndexType>  m_offsets;   // oriented graph, renumbered by rank
+    std::vector<IndexType>  m_indices;
+    std::vector<IndexType>  m_edges;     // input edge of each oriented edge
+    std::vector<IndexType>  m_vertices;  // input vertex of each rank
+    std::vector<IndexType>  m_degree;    // undirected degree of the input vertices
+    uint64_t                m_triangles_number;
+
+    // support of the oriented edges
+    void oriented_support(std::vector<IndexType>& support) const;
+
+public:
+    TrianglesCountHost(IndexType n, IndexType nnz, const IndexType* row_offsets, const IndexType* col_indices);
+
+    NVGRAPH_ERROR count(IndexType hub_threshold = TCOUNT_HOST_HUB_THR);
+    inline uint64_t get_triangles_count() const {return m_triangles_number;}
+
+    /*! Number of triangles each vertex belongs to.
+     *  \param (output) triangles (host memory) n entries
+     */
+    NVGRAPH_ERROR count_per_vertex(uint64_t* triangles) const;
+
+    /*! Local clustering coefficient: triangles(v) / (deg(v)*(deg(v)-1)/2), 0 if deg(v) < 2.
+     *  \param (output) triangles (host memory) n entries, can be NULL
+     *  \param (output) coefficients (host memory) n entries
+     */
+    template <typename ValueType>
+    NVGRAPH_ERROR clustering_coefficient(uint64_t* triangles, ValueType* coefficients) const;
+
+    /*! Support of each edge (number of triangles it belongs to).
+     *  \param (output) support (host memory) nnz entries
+     */
+    NVGRAPH_ERROR edge_support(IndexType* support) const;
+
+    /*! Truss number of each edge: largest k such that the edge is in the k-truss
+     *  (every edge of the k-truss is in at least k-2 triangles of the k-truss).
+     *  Edges are peeled by increasing support from a bucket queue, the support of the
+     *  two other edges of each triangle destroyed by a removal is decremented in place.
+     *  \param (output) truss (host memory) nnz entries
+     */
+    NVGRAPH_ERROR ktruss(IndexType* truss) const;
+};
+
+/*! Approximate host triangles counting by wedge sampling.
+ *  A wedge is a path u-v-w, it is closed if (u,w) is an edge, and the number of triangles is
+ *  (closed wedges)/3. Wedges are sampled uniformly (center drawn proportionally to deg*(deg-1)/2,
+ *  then two distinct neighbors), and by Hoeffding inequality ln(2/(1-confidence))/(2*error^2)
+ *  samples bound the error on the closed fraction by error with probability confidence.
+ *  Same input as TrianglesCountHost.
+ */
+template <typename IndexType>
+class TrianglesCountSampling
+{
+private:
+    IndexType               m_n;
+    std::vector<IndexType>  m_offsets;   // full symmetric adjacency, sorted lists
+    std::vector<IndexType>  m_indices;
+    std::vector<double>     m_wedges;    // inclusive prefix sum of the wedges centered on each vertex
+    double                  m_estimate;
+    double                  m_lower;
+    double                  m_upper;
+    uint64_t                m_samples;
+
+    inline bool is_edge(IndexType u, IndexType v) const;
+
+public:
+    TrianglesCountSampling(IndexType n, IndexType nnz, const IndexType* row_offsets, const IndexType* col_indices);
+
+    /*! \param error absolute error on the fraction of closed wedges, in (0,1)
+     *  \param confidence probability that the interval holds the exact count, in (0,1)
+     *  \param seed the samples only depend on the seed, not on the number of threads
+     */
+    NVGRAPH_ERROR count(double error, double confidence, uint64_t seed = 0);
+    inline double get_estimate() const {return m_estimate;}
+    inline double get_lower_bound() const {return m_lower;}
+    inline double get_upper_bound() const {return m_upper;}
+    inline uint64_t get_samples() const {return m_samples;}
+};
+
+// number of common entries of two sorted lists of unique values
+uint64_t intersect_count(const int* a, int na, const int* b, int nb);
+
+} // end namespace triangles_counting
+
+} // end namespace nvgraph
+
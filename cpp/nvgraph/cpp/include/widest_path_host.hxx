@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <vector>
+#include "nvgraph_error.hxx"
+
+namespace nvgraph
+{
+/*! Host widest path (bottleneck) solver.
+ *  Same conventions as WidestPath so results can be compared with nvgraphWidestPath:
+ *  the input network is the transposed/CSC, result[source] = max value,
+ *  result[i] = -max value if i cannot be reached from the source.
+ *  Each source is solved with a modified Dijkstra on a max-heap, the sources are
+ *  distributed over the OpenMP threads that all read the same CSR.
+ */
+template <typename IndexType_, typename ValueType_>
+class WidestPathHost
+{
+public:
+    typedef IndexType_ IndexType;
+    typedef ValueType_ ValueType;
+
+private:
+    IndexType m_n;
+    IndexType m_nnz;
+    // out-going edges (CSR), built once from the CSC and shared read-only by all the threads
+    std::vector<IndexType> m_row_offsets;
+    std::vector<IndexType> m_col_indices;
+    std::vector<ValueType> m_values;
+
+    void solve_one(IndexType source, ValueType* result, std::vector<char>& done) const;
+
+public:
+    /*! Create a host widest path solver attached to the transposed of a weighted network
+     *  \param n Number of vertices
+     *  \param nnz Number of edges
+     *  \param csc_offsets (host memory) destination offsets, n+1 entries
+     *  \param csc_indices (host memory) source indices, nnz entries
+     *  \param csc_values (host memory) edge weights, nnz entries
+     */
+    WidestPathHost(IndexType n, IndexType nnz,
+                   const IndexType* csc_offsets,
+                   const IndexType* csc_indices,
+                   const ValueType* csc_values);
+
+    /*! Find the widest path from  the vertex source to every other vertices.
+     *  \param (output) result (host memory) n entries
+     */
+    NVGRAPH_ERROR solve(IndexType source, ValueType* result) const;
+
+    /*! Find the widest path from a batch of sources, in parallel.
+     *  \param (output) result (host memory) num_sources x n row major,
+     *                  result[s*n + i] is the widest path from sources[s] to i.
+     */
+    NVGRAPH_ERROR solve(IndexType num_sources, const IndexType* sources, ValueType* result) const;
+
+    inline IndexType get_num_vertices() const {return m_n;}
+};
+
+} // end namespace nvgraph
+
@@ -0,0 +1,605 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "nvgraph_error.hxx"
+#include "2d_distributed_host.hxx"
+
+namespace nvgraph
+{
+namespace
+{
+template <typename T>
+void combine_elements(T* acc, const T* in, size_t count, Transport2dOp op)
+{
+    switch (op)
+    {
+    case TRANSPORT_2D_SUM:
+        for (size_t k = 0; k < count; k++)
+            acc[k] += in[k];
+        break;
+    case TRANSPORT_2D_MIN:
+        for (size_t k = 0; k < count; k++)
+            acc[k] = std::min(acc[k], in[k]);
+        break;
+    case TRANSPORT_2D_MAX:
+        for (size_t k = 0; k < count; k++)
+            acc[k] = std::max(acc[k], in[k]);
+        break;
+    }
+}
+
+void combine_elements(void* acc, const void* in, size_t count, Transport2dType type, Transport2dOp op)
+{
+    switch (type)
+    {
+    case TRANSPORT_2D_INT32:
+        combine_elements(static_cast<int32_t*>(acc), static_cast<const int32_t*>(in), count, op);
+        break;
+    case TRANSPORT_2D_INT64:
+        combine_elements(static_cast<int64_t*>(acc), static_cast<const int64_t*>(in), count, op);
+        break;
+    case TRANSPORT_2D_FLOAT:
+        combine_elements(static_cast<float*>(acc), static_cast<const float*>(in), count, op);
+        break;
+    case TRANSPORT_2D_DOUBLE:
+        combine_elements(static_cast<double*>(acc), static_cast<const double*>(in), count, op);
+        break;
+    }
+}
+
+// sum over the diagonal ranks of f(k) on their row block
+template <typename ValueType, typename LocalType, typename F>
+ValueType diagonal_sum(Transport2dHost* transport, const std::vector<int>& group, LocalType n, F f)
+{
+    ValueType sum = 0;
+    for (LocalType k = 0; k < n; k++)
+        sum += f(k);
+    transport->allreduce(group, &sum, 1, Transport2dTypeOf<ValueType>::value, TRANSPORT_2D_SUM);
+    return sum;
+}
+} // end anonymous namespace
+
+size_t transport2dTypeSize(Transport2dType type)
+{
+    switch (type)
+    {
+    case TRANSPORT_2D_INT32: return sizeof(int32_t);
+    case TRANSPORT_2D_INT64: return sizeof(int64_t);
+    case TRANSPORT_2D_FLOAT: return sizeof(float);
+    case TRANSPORT_2D_DOUBLE: return sizeof(double);
+    }
+    FatalError("Wrong type in 2D transport.", NVGRAPH_ERR_BAD_PARAMETERS);
+}
+
+void Transport2dHost::broadcast(const std::vector<int>& group, int root, void* data, size_t bytes)
+{
+    if (getRank() != root)
+        m_bytes_received += bytes;
+    doBroadcast(group, root, data, bytes);
+}
+
+void Transport2dHost::allgather(const std::vector<int>& group, const void* send, size_t bytes, void* recv)
+{
+    m_bytes_received += (group.size() - 1) * bytes;
+    doAllgather(group, send, bytes, recv);
+}
+
+void Transport2dHost::reduce(const std::vector<int>& group, int root, void* data, size_t count,
+                             Transport2dType type, Transport2dOp op)
+{
+    if (getRank() == root)
+        m_bytes_received += (group.size() - 1) * count * transport2dTypeSize(type);
+    doReduce(group, root, data, count, type, op);
+}
+
+void Transport2dHost::allreduce(const std::vector<int>& group, void* data, size_t count,
+                                Transport2dType type, Transport2dOp op)
+{
+    m_bytes_received += (group.size() - 1) * count * transport2dTypeSize(type);
+    doAllreduce(group, data, count, type, op);
+}
+
+LoopbackContext2dHost::LoopbackContext2dHost(int size)
+    : m_size(size), m_slots(size, NULL)
+{
+    if (size <= 0)
+        FatalError("Wrong number of ranks in loopback transport.", NVGRAPH_ERR_BAD_PARAMETERS);
+}
+
+void LoopbackContext2dHost::barrier(const std::vector<int>& group)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    std::pair<int, long long>& b = m_barriers[group];
+    long long generation = b.second;
+    if (++b.first == static_cast<int>(group.size()))
+    {
+        b.first = 0;
+        b.second++;
+        m_cond.notify_all();
+    }
+    else
+    {
+        while (b.second == generation)
+            m_cond.wait(lock);
+    }
+}
+
+LoopbackTransport2dHost::LoopbackTransport2dHost(LoopbackContext2dHost* context, int rank)
+    : m_context(context), m_rank(rank)
+{
+    if (context == NULL || rank < 0 || rank >= context->m_size)
+        FatalError("Wrong rank in loopback transport.", NVGRAPH_ERR_BAD_PARAMETERS);
+}
+
+void LoopbackTransport2dHost::combine(const std::vector<int>& group, size_t count, Transport2dType type,
+                                      Transport2dOp op, std::vector<char>& result) const
+{
+    size_t bytes = count * transport2dTypeSize(type);
+    result.resize(bytes);
+    if (bytes == 0)
+        return;
+    memcpy(&result[0], m_context->m_slots[group[0]], bytes);
+    for (size_t r = 1; r < group.size(); r++)
+        combine_elements(&result[0], m_context->m_slots[group[r]], count, type, op);
+}
+
+// Every collective publishes the buffer of the rank, reads the buffers of the group after a
+// barrier, and waits on a second barrier before the buffers can be reused.
+void LoopbackTransport2dHost::doBroadcast(const std::vector<int>& group, int root, void* data, size_t bytes)
+{
+    m_context->m_slots[m_rank] = data;
+    m_context->barrier(group);
+    if (m_rank != root && bytes > 0)
+        memcpy(data, m_context->m_slots[root], bytes);
+    m_context->barrier(group);
+}
+
+void LoopbackTransport2dHost::doAllgather(const std::vector<int>& group, const void* send, size_t bytes, void* recv)
+{
+    m_context->m_slots[m_rank] = send;
+    m_context->barrier(group);
+    for (size_t r = 0; r < group.size() && bytes > 0; r++)
+        memcpy(static_cast<char*>(recv) + r * bytes, m_context->m_slots[group[r]], bytes);
+    m_context->barrier(group);
+}
+
+void LoopbackTransport2dHost::doReduce(const std::vector<int>& group, int root, void* data, size_t count,
+                                       Transport2dType type, Transport2dOp op)
+{
+    std::vector<char> result;
+    m_context->m_slots[m_rank] = data;
+    m_context->barrier(group);
+    if (m_rank == root)
+        combine(group, count, type, op, result);
+    m_context->barrier(group);
+    if (m_rank == root && !result.empty())
+        memcpy(data, &result[0], result.size());
+}
+
+void LoopbackTransport2dHost::doAllreduce(const std::vector<int>& group, void* data, size_t count,
+                                          Transport2dType type, Transport2dOp op)
+{
+    std::vector<char> result;
+    m_context->m_slots[m_rank] = data;
+    m_context->barrier(group);
+    combine(group, count, type, op, result);
+    m_context->barrier(group);
+    if (!result.empty())
+        memcpy(data, &result[0], result.size());
+}
+
+#ifdef NVGRAPH_USE_MPI
+#define CHECK_MPI(call)                                                       \
+    {                                                                         \
+        int _e = (call);                                                      \
+        if (_e != MPI_SUCCESS)                                                \
+        {                                                                     \
+            std::stringstream _error;                                         \
+            _error << "MPI failure: '#" << _e << "'";                         \
+            FatalError(_error.str(), NVGRAPH_ERR_UNKNOWN);                    \
+        }                                                                     \
+    }
+
+namespace
+{
+MPI_Datatype mpi_type(Transport2dType type)
+{
+    switch (type)
+    {
+    case TRANSPORT_2D_INT32: return MPI_INT32_T;
+    case TRANSPORT_2D_INT64: return MPI_INT64_T;
+    case TRANSPORT_2D_FLOAT: return MPI_FLOAT;
+    case TRANSPORT_2D_DOUBLE: return MPI_DOUBLE;
+    }
+    return MPI_DATATYPE_NULL;
+}
+
+MPI_Op mpi_op(Transport2dOp op)
+{
+    switch (op)
+    {
+    case TRANSPORT_2D_SUM: return MPI_SUM;
+    case TRANSPORT_2D_MIN: return MPI_MIN;
+    case TRANSPORT_2D_MAX: return MPI_MAX;
+    }
+    return MPI_OP_NULL;
+}
+
+int group_rank(const std::vector<int>& group, int rank)
+{
+    return static_cast<int>(std::find(group.begin(), group.end(), rank) - group.begin());
+}
+
+// the counts of MPI are int
+int mpi_count(size_t count)
+{
+    if (count > static_cast<size_t>(std::numeric_limits<int>::max()))
+        FatalError("Message too large in MPI 2D transport.", NVGRAPH_ERR_BAD_PARAMETERS);
+    return static_cast<int>(count);
+}
+} // end anonymous namespace
+
+MpiTransport2dHost::MpiTransport2dHost(MPI_Comm comm)
+{
+    CHECK_MPI(MPI_Comm_dup(comm, &m_comm));
+    CHECK_MPI(MPI_Comm_rank(m_comm, &m_rank));
+    CHECK_MPI(MPI_Comm_size(m_comm, &m_size));
+}
+
+MpiTransport2dHost::~MpiTransport2dHost()
+{
+    for (std::map<std::vector<int>, MPI_Comm>::iterator it = m_group_comms.begin(); it != m_group_comms.end(); ++it)
+        MPI_Comm_free(&it->second);
+    MPI_Comm_free(&m_comm);
+}
+
+// MPI_Comm_create_group is collective over the group only, so every row and column
+// creates its communicator on its own.
+MPI_Comm MpiTransport2dHost::getGroupComm(const std::vector<int>& group)
+{
+    std::map<std::vector<int>, MPI_Comm>::iterator it = m_group_comms.find(group);
+    if (it != m_group_comms.end())
+        return it->second;
+    MPI_Group all, sub;
+    MPI_Comm comm;
+    CHECK_MPI(MPI_Comm_group(m_comm, &all));
+    CHECK_MPI(MPI_Group_incl(all, static_cast<int>(group.size()), &group[0], &sub));
+    CHECK_MPI(MPI_Comm_create_group(m_comm, sub, 0, &comm));
+    MPI_Group_free(&sub);
+    MPI_Group_free(&all);
+    m_group_comms[group] = comm;
+    return comm;
+}
+
+void MpiTransport2dHost::doBroadcast(const std::vector<int>& group, int root, void* data, size_t bytes)
+{
+    CHECK_MPI(MPI_Bcast(data, mpi_count(bytes), MPI_BYTE, group_rank(group, root), getGroupComm(group)));
+}
+
+void MpiTransport2dHost::doAllgather(const std::vector<int>& group, const void* send, size_t bytes, void* recv)
+{
+    CHECK_MPI(MPI_Allgather(const_cast<void*>(send), mpi_count(bytes), MPI_BYTE,
+                            recv, mpi_count(bytes), MPI_BYTE, getGroupComm(group)));
+}
+
+void MpiTransport2dHost::doReduce(const std::vector<int>& group, int root, void* data, size_t count,
+                                  Transport2dType type, Transport2dOp op)
+{
+    // the root reduces in place, the other ranks only send
+    const void* send = m_rank == root ? MPI_IN_PLACE : data;
+    void* recv = m_rank == root ? data : NULL;
+    CHECK_MPI(MPI_Reduce(const_cast<void*>(send), recv, mpi_count(count), mpi_type(type), mpi_op(op),
+                         group_rank(group, root), getGroupComm(group)));
+}
+
+void MpiTransport2dHost::doAllreduce(const std::vector<int>& group, void* data, size_t count,
+                                     Transport2dType type, Transport2dOp op)
+{
+    CHECK_MPI(MPI_Allreduce(MPI_IN_PLACE, data, mpi_count(count), mpi_type(type), mpi_op(op),
+                            getGroupComm(group)));
+}
+#endif
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+Matrix2dDistributedHost<GlobalType, LocalType, ValueType>::Matrix2dDistributedHost(const MatrixDecompositionDescriptionHost<GlobalType, LocalType>& descr,
+                                                                                   Transport2dHost* transport,
+                                                                                   GlobalType nnz,
+                                                                                   const GlobalType* rowIds,
+                                                                                   const GlobalType* colIds,
+                                                                                   const ValueType* values)
+    : m_description(descr), m_transport(transport), m_has_values(values != NULL)
+{
+    if (transport == NULL || transport->getSize() != descr.getNumBlocks() || nnz < 0
+        || (nnz > 0 && (rowIds == NULL || colIds == NULL)))
+        FatalError("Wrong input in distributed host 2D matrix.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    const int32_t block = transport->getRank();
+    const int32_t blockRows = descr.getBlockRows();
+    m_block_row = descr.getBlockRow(block);
+    m_block_col = descr.getBlockCol(block);
+    for (int32_t k = 0; k < blockRows; k++)
+    {
+        m_row_group.push_back(descr.getBlockId(m_block_row, k));
+        m_col_group.push_back(descr.getBlockId(k, m_block_col));
+        m_diagonal_group.push_back(descr.getDiagonalBlock(k));
+    }
+    for (int32_t b = 0; b < descr.getNumBlocks(); b++)
+        m_all_group.push_back(b);
+
+    // count, prefix sum, then scatter the entries of the block
+    const LocalType offset = descr.getOffset();
+    std::vector<GlobalType> entries;
+    m_row_offsets.assign(offset + 1, 0);
+    for (GlobalType e = 0; e < nnz; e++)
+    {
+        LocalType localRow, localCol;
+        int32_t bId;
+        descr.convertGlobaltoLocalRow(rowIds[e], colIds[e], localRow, localCol, bId);
+        if (bId == block)
+        {
+            entries.push_back(e);
+            m_row_offsets[localRow + 1]++;
+        }
+    }
+    for (LocalType k = 0; k < offset; k++)
+        m_row_offsets[k + 1] += m_row_offsets[k];
+    m_col_indices.resize(entries.size());
+    if (m_has_values)
+        m_values.resize(entries.size());
+    for (size_t f = 0; f < entries.size(); f++)
+    {
+        LocalType localRow, localCol;
+        int32_t bId;
+        GlobalType e = entries[f];
+        descr.convertGlobaltoLocalRow(rowIds[e], colIds[e], localRow, localCol, bId);
+        LocalType pos = m_row_offsets[localRow]++;
+        m_col_indices[pos] = localCol;
+        if (m_has_values)
+            m_values[pos] = values[e];
+    }
+    for (LocalType k = offset; k > 0; k--)
+        m_row_offsets[k] = m_row_offsets[k - 1];
+    m_row_offsets[0] = 0;
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+LocalType Matrix2dDistributedHost<GlobalType, LocalType, ValueType>::getBlockVertices(int32_t rowId) const
+{
+    GlobalType remaining = m_description.getNumRows() - m_description.getGlobalId(rowId, 0);
+    return static_cast<LocalType>(std::min(remaining, static_cast<GlobalType>(m_description.getOffset())));
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+void Matrix2dDistributedHost<GlobalType, LocalType, ValueType>::blockSpmv(const ValueType* x, ValueType* y) const
+{
+    const LocalType offset = m_description.getOffset();
+    #pragma omp parallel for schedule(static)
+    for (LocalType k = 0; k < offset; k++)
+    {
+        ValueType sum = 0;
+        for (LocalType e = m_row_offsets[k]; e < m_row_offsets[k + 1]; e++)
+            sum += (m_has_values ? m_values[e] : static_cast<ValueType>(1)) * x[m_col_indices[e]];
+        y[k] = sum;
+    }
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+template <typename T>
+void Matrix2dDistributedHost<GlobalType, LocalType, ValueType>::gatherVertexData(const std::vector<T>& data, T* out)
+{
+    std::vector<T> buffer(m_description.getOffset());
+    for (int32_t i = 0; i < m_description.getBlockRows(); i++)
+    {
+        if (isDiagonal() && m_block_row == i)
+            buffer = data;
+        m_transport->broadcast(m_all_group, diagonalRank(i), &buffer[0], buffer.size() * sizeof(T));
+        std::copy(buffer.begin(), buffer.begin() + getBlockVertices(i), out + m_description.getGlobalId(i, 0));
+    }
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+NVGRAPH_ERROR Matrix2dDistributedHost<GlobalType, LocalType, ValueType>::traverse(GlobalType source, GlobalType* distances, GlobalType* predecessors)
+{
+    if (source < 0 || source >= m_description.getNumRows())
+        FatalError("Wrong source vertex in distributed host 2D traversal.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    const GlobalType unreached = std::numeric_limits<GlobalType>::max();
+    const LocalType offset = m_description.getOffset();
+    const Transport2dType globalType = Transport2dTypeOf<GlobalType>::value;
+
+    // on the diagonal rank: distances, predecessors and frontier of the row block
+    std::vector<GlobalType> dist, pred;
+    std::vector<LocalType> frontier;
+    if (isDiagonal())
+    {
+        dist.assign(offset, unreached);
+        pred.assign(offset, -1);
+        int32_t i = static_cast<int32_t>(source / offset);
+        if (i == m_block_row)
+        {
+            LocalType k = static_cast<LocalType>(source - m_description.getGlobalId(i, 0));
+            dist[k] = 0;
+            frontier.push_back(k);
+        }
+    }
+    // on every rank: frontiers of the row and column blocks, visited vertices of the column block
+    // and lowest candidate predecessor of every local column (unreached if none)
+    std::vector<LocalType> rowFrontier, colFrontier;
+    std::vector<char> visited(offset, 0);
+    std::vector<GlobalType> cand(offset, unreached);
+
+    m_iteration_bytes.clear();
+    for (GlobalType level = 1; ; level++)
+    {
+        size_t bytes = m_transport->getBytesReceived();
+
+        // the diagonal ranks send their frontier along their row and their column
+        LocalType sizes[2] = {0, 0};
+        if (isDiagonal())
+        {
+            sizes[0] = sizes[1] = static_cast<LocalType>(frontier.size());
+            rowFrontier = colFrontier = frontier;
+        }
+        m_transport->broadcast(m_row_group, diagonalRank(m_block_row), &sizes[0], sizeof(LocalType));
+        m_transport->broadcast(m_col_group, diagonalRank(m_block_col), &sizes[1], sizeof(LocalType));
+        rowFrontier.resize(sizes[0]);
+        colFrontier.resize(sizes[1]);
+        if (sizes[0] > 0)
+            m_transport->broadcast(m_row_group, diagonalRank(m_block_row), &rowFrontier[0], sizes[0] * sizeof(LocalType));
+        if (sizes[1] > 0)
+            m_transport->broadcast(m_col_group, diagonalRank(m_block_col), &colFrontier[0], sizes[1] * sizeof(LocalType));
+        for (size_t f = 0; f < colFrontier.size(); f++)
+            visited[colFrontier[f]] = 1;
+
+        // expand the frontier of row block i into the candidates of column block j,
+        // the frontier is sorted so the first candidate is the lowest
+        for (size_t f = 0; f < rowFrontier.size(); f++)
+        {
+            LocalType u = rowFrontier[f];
+            for (LocalType e = m_row_offsets[u]; e < m_row_offsets[u + 1]; e++)
+            {
+                LocalType v = m_col_indices[e];
+                if (!visited[v] && cand[v] == unreached)
+                    cand[v] = m_description.getGlobalId(m_block_row, u);
+            }
+        }
+        m_transport->reduce(m_col_group, diagonalRank(m_block_col), &cand[0], offset, globalType, TRANSPORT_2D_MIN);
+
+        GlobalType count = 0;
+        if (isDiagonal())
+        {
+            frontier.clear();
+            for (LocalType k = 0; k < offset; k++)
+            {
+                if (cand[k] != unreached && dist[k] == unreached)
+                {
+                    dist[k] = level;
+                    pred[k] = cand[k];
+                    frontier.push_back(k);
+                }
+            }
+            count = static_cast<GlobalType>(frontier.size());
+        }
+        std::fill(cand.begin(), cand.end(), unreached);
+        m_transport->allreduce(m_all_group, &count, 1, globalType, TRANSPORT_2D_SUM);
+        m_iteration_bytes.push_back(m_transport->getBytesReceived() - bytes);
+        if (count == 0)
+            break;
+    }
+
+    if (distances)
+        gatherVertexData(dist, distances);
+    if (predecessors)
+        gatherVertexData(pred, predecessors);
+    return NVGRAPH_OK;
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+NVGRAPH_ERROR Matrix2dDistributedHost<GlobalType, LocalType, ValueType>::pagerank(ValueType damping_factor, const ValueType* bookmark,
+                                                                                  const ValueType* guess, float tolerance, int max_it,
+                                                                                  ValueType* pagerank)
+{
+    if (bookmark == NULL || pagerank == NULL)
+        FatalError("Wrong input in distributed host 2D Pagerank.", NVGRAPH_ERR_BAD_PARAMETERS);
+    if (damping_factor > 0.999 || damping_factor < 0.0001)
+        FatalError("Wrong damping factor value in Pagerank solver.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    const LocalType offset = m_description.getOffset();
+    const LocalType nv = getBlockVertices(m_block_row);
+    const GlobalType first = m_description.getGlobalId(m_block_row, 0);
+    const ValueType tol = static_cast<ValueType>(tolerance);
+    const Transport2dType valueType = Transport2dTypeOf<ValueType>::value;
+
+    // on the diagonal rank, the padding of the last block stays 0:
+    // a = alpha*a + (1-alpha)e on the dangling nodes, b = 1/n (see SubgraphViewHost::pagerank)
+    const ValueType b = static_cast<ValueType>(1.0 / m_description.getNumRows());
+    std::vector<ValueType> a, tmp, pr;
+    if (isDiagonal())
+    {
+        a.assign(offset, 0);
+        tmp.assign(offset, 0);
+        pr.assign(offset, 0);
+        for (LocalType k = 0; k < nv; k++)
+        {
+            a[k] = bookmark[first + k] == 0.0 ? 1.0 - damping_factor : bookmark[first + k];
+            tmp[k] = guess ? guess[first + k] : b;
+        }
+    }
+    // on every rank: the column block of x and the partial product of the block
+    std::vector<ValueType> x(offset), y(offset);
+
+    bool converged = false;
+    m_iteration_bytes.clear();
+    for (int it = 0; it < max_it && !converged; it++)
+    {
+        size_t bytes = m_transport->getBytesReceived();
+
+        if (it == 0 && isDiagonal())
+        {
+            ValueType nrm = std::sqrt(diagonal_sum<ValueType>(m_transport, m_diagonal_group, nv, [&](LocalType k) {return tmp[k] * tmp[k];}));
+            for (LocalType k = 0; k < nv; k++)
+                tmp[k] /= nrm;
+        }
+
+        // pr = A*tmp: x is sent along the columns, the partial products are reduced along the rows
+        if (isDiagonal())
+            x = tmp;
+        m_transport->broadcast(m_col_group, diagonalRank(m_block_col), &x[0], offset * sizeof(ValueType));
+        blockSpmv(&x[0], &y[0]);
+        m_transport->reduce(m_row_group, diagonalRank(m_block_row), &y[0], offset, valueType, TRANSPORT_2D_SUM);
+
+        ValueType residual = 0;
+        if (isDiagonal())
+        {
+            ValueType gamma = diagonal_sum<ValueType>(m_transport, m_diagonal_group, nv, [&](LocalType k) {return a[k] * tmp[k];});
+            for (LocalType k = 0; k < nv; k++)
+                pr[k] = damping_factor * y[k] + gamma * b;
+            ValueType nrm = std::sqrt(diagonal_sum<ValueType>(m_transport, m_diagonal_group, nv, [&](LocalType k) {return pr[k] * pr[k];}));
+            for (LocalType k = 0; k < nv; k++)
+            {
+                pr[k] /= nrm;
+                tmp[k] -= pr[k];
+                residual += tmp[k] * tmp[k];
+            }
+        }
+        // every rank takes the same decision
+        m_transport->allreduce(m_all_group, &residual, 1, valueType, TRANSPORT_2D_SUM);
+        if (std::sqrt(residual) < tol)
+            converged = true;
+        std::swap(pr, tmp);
+        m_iteration_bytes.push_back(m_transport->getBytesReceived() - bytes);
+    }
+
+    // tmp holds the last iterate
+    if (isDiagonal())
+    {
+        ValueType nrm1 = diagonal_sum<ValueType>(m_transport, m_diagonal_group, nv, [&](LocalType k) {return std::fabs(tmp[k]);});
+        for (LocalType k = 0; k < nv; k++)
+            tmp[k] /= nrm1;
+    }
+    gatherVertexData(tmp, pagerank);
+    return converged ? NVGRAPH_OK : NVGRAPH_ERR_NOT_CONVERGED;
+}
+
+template class Matrix2dDistributedHost<int, int, float>;
+template class Matrix2dDistributedHost<int, int, double>;
+
+} // end namespace nvgraph
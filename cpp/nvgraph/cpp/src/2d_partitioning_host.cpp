@@ -0,0 +1,432 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "nvgraph_error.hxx"
+#include "2d_partitioning_host.hxx"
+
+namespace nvgraph
+{
+namespace
+{
+inline int get_num_threads()
+{
+#ifdef _OPENMP
+    return omp_get_num_threads();
+#else
+    return 1;
+#endif
+}
+
+inline int get_thread_num()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+inline int get_max_threads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+} // end anonymous namespace
+
+// Every team runs with the same number of threads and binding, so that block b is always
+// owned by the thread (and the NUMA node) that first touched its memory.
+#define FOR_OWNED_BLOCKS(b, numBlocks) \
+    for (int32_t b = get_thread_num(); b < (numBlocks); b += get_num_threads())
+
+template <typename GlobalType, typename LocalType>
+MatrixDecompositionDescriptionHost<GlobalType, LocalType>::MatrixDecompositionDescriptionHost(GlobalType numRows, int32_t blockN,
+                                                                                              GlobalType nnz, int numThreads)
+    : m_num_rows(numRows), m_nnz(nnz), m_block_rows(blockN)
+{
+    if (numRows <= 0 || nnz < 0 || blockN <= 0 || blockN > numRows)
+        FatalError("Wrong input in host 2D decomposition.", NVGRAPH_ERR_BAD_PARAMETERS);
+    m_offset = static_cast<LocalType>((numRows + blockN - 1) / blockN);
+    if (numThreads <= 0)
+        numThreads = std::min(getNumBlocks(), get_max_threads());
+    m_num_threads = std::min(numThreads, getNumBlocks());
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+VertexData2DHost<GlobalType, LocalType, ValueType>::VertexData2DHost(const MatrixDecompositionDescriptionHost<GlobalType, LocalType>* descr)
+    : m_description(descr), m_n(descr->getOffset()),
+      m_current(descr->getNumBlocks()), m_alternate(descr->getNumBlocks())
+{
+    const int32_t numBlocks = descr->getNumBlocks();
+    #pragma omp parallel num_threads(descr->getNumThreads()) proc_bind(spread)
+    {
+        FOR_OWNED_BLOCKS(b, numBlocks)
+        {
+            m_current[b].assign(m_n, ValueType(0));
+            m_alternate[b].assign(m_n, ValueType(0));
+        }
+    }
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+void VertexData2DHost<GlobalType, LocalType, ValueType>::setElements(const ValueType* vals)
+{
+    const int32_t numBlocks = m_description->getNumBlocks();
+    const GlobalType numRows = m_description->getNumRows();
+    #pragma omp parallel num_threads(m_description->getNumThreads()) proc_bind(spread)
+    {
+        FOR_OWNED_BLOCKS(b, numBlocks)
+        {
+            int32_t i = m_description->getBlockRow(b);
+            if (i != m_description->getBlockCol(b))
+                continue;
+            for (LocalType k = 0; k < m_n; k++)
+            {
+                GlobalType v = m_description->getGlobalId(i, k);
+                m_current[b][k] = v < numRows ? vals[v] : ValueType(0);
+            }
+        }
+    }
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+void VertexData2DHost<GlobalType, LocalType, ValueType>::getElements(ValueType* vals) const
+{
+    const int32_t numBlocks = m_description->getNumBlocks();
+    const GlobalType numRows = m_description->getNumRows();
+    #pragma omp parallel num_threads(m_description->getNumThreads()) proc_bind(spread)
+    {
+        FOR_OWNED_BLOCKS(b, numBlocks)
+        {
+            int32_t i = m_description->getBlockRow(b);
+            if (i != m_description->getBlockCol(b))
+                continue;
+            for (LocalType k = 0; k < m_n; k++)
+            {
+                GlobalType v = m_description->getGlobalId(i, k);
+                if (v < numRows)
+                    vals[v] = m_current[b][k];
+            }
+        }
+    }
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+void VertexData2DHost<GlobalType, LocalType, ValueType>::fillElements(ValueType val)
+{
+    const int32_t numBlocks = m_description->getNumBlocks();
+    #pragma omp parallel num_threads(m_description->getNumThreads()) proc_bind(spread)
+    {
+        FOR_OWNED_BLOCKS(b, numBlocks)
+            if (m_description->getBlockRow(b) == m_description->getBlockCol(b))
+                std::fill(m_current[b].begin(), m_current[b].end(), val);
+    }
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+template <typename Operator>
+void VertexData2DHost<GlobalType, LocalType, ValueType>::rowReduce()
+{
+    const int32_t blockRows = m_description->getBlockRows();
+    const int32_t numBlocks = m_description->getNumBlocks();
+    Operator op;
+    #pragma omp barrier
+    // the owner of block (i,j) reduces slice j of row i into block (i,i)
+    FOR_OWNED_BLOCKS(b, numBlocks)
+    {
+        int32_t i = m_description->getBlockRow(b), j = m_description->getBlockCol(b);
+        ValueType* diag = m_current[m_description->getDiagonalBlock(i)].data();
+        LocalType begin = m_description->getSliceBegin(j, blockRows), end = m_description->getSliceBegin(j + 1, blockRows);
+        for (int32_t c = 0; c < blockRows; c++)
+        {
+            if (c == i)
+                continue;
+            const ValueType* other = m_current[m_description->getBlockId(i, c)].data();
+            for (LocalType k = begin; k < end; k++)
+                diag[k] = op(diag[k], other[k]);
+        }
+    }
+    #pragma omp barrier
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+template <typename Operator>
+void VertexData2DHost<GlobalType, LocalType, ValueType>::columnReduce()
+{
+    const int32_t blockRows = m_description->getBlockRows();
+    const int32_t numBlocks = m_description->getNumBlocks();
+    Operator op;
+    #pragma omp barrier
+    // the owner of block (i,j) reduces slice i of column j into block (j,j)
+    FOR_OWNED_BLOCKS(b, numBlocks)
+    {
+        int32_t i = m_description->getBlockRow(b), j = m_description->getBlockCol(b);
+        ValueType* diag = m_current[m_description->getDiagonalBlock(j)].data();
+        LocalType begin = m_description->getSliceBegin(i, blockRows), end = m_description->getSliceBegin(i + 1, blockRows);
+        for (int32_t r = 0; r < blockRows; r++)
+        {
+            if (r == j)
+                continue;
+            const ValueType* other = m_current[m_description->getBlockId(r, j)].data();
+            for (LocalType k = begin; k < end; k++)
+                diag[k] = op(diag[k], other[k]);
+        }
+    }
+    #pragma omp barrier
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+Matrix2dHost<GlobalType, LocalType, ValueType>::Matrix2dHost(const MatrixDecompositionDescriptionHost<GlobalType, LocalType>& descr,
+                                                             const GlobalType* rowIds,
+                                                             const GlobalType* colIds,
+                                                             const ValueType* values)
+    : m_description(descr),
+      m_row_offsets(descr.getNumBlocks()), m_col_indices(descr.getNumBlocks()), m_values(descr.getNumBlocks()),
+      m_has_values(values != NULL)
+{
+    const GlobalType nnz = descr.getNnz();
+    const GlobalType numRows = descr.getNumRows();
+    const int32_t numBlocks = descr.getNumBlocks();
+    const LocalType offset = descr.getOffset();
+    if (nnz > 0 && (rowIds == NULL || colIds == NULL))
+        FatalError("Wrong input in host 2D matrix.", NVGRAPH_ERR_BAD_PARAMETERS);
+    for (GlobalType e = 0; e < nnz; e++)
+        if (rowIds[e] < 0 || rowIds[e] >= numRows || colIds[e] < 0 || colIds[e] >= numRows)
+            FatalError("Row and column ids must be less than the number of rows of the host 2D matrix.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // every thread scans the COO for the entries of its blocks, and counting sorts them by row
+    #pragma omp parallel num_threads(descr.getNumThreads()) proc_bind(spread)
+    {
+        LocalType localRow, localCol;
+        int32_t b;
+        FOR_OWNED_BLOCKS(bId, numBlocks)
+            m_row_offsets[bId].assign(offset + 1, 0);
+        for (GlobalType e = 0; e < nnz; e++)
+        {
+            descr.convertGlobaltoLocalRow(rowIds[e], colIds[e], localRow, localCol, b);
+            if (b % get_num_threads() == get_thread_num())
+                m_row_offsets[b][localRow + 1]++;
+        }
+        FOR_OWNED_BLOCKS(bId, numBlocks)
+        {
+            std::vector<LocalType>& offsets = m_row_offsets[bId];
+            for (LocalType r = 0; r < offset; r++)
+                offsets[r + 1] += offsets[r];
+            m_col_indices[bId].resize(offsets[offset]);
+            if (values)
+                m_values[bId].resize(offsets[offset]);
+        }
+        // offsets[r] is the next position of row r, the end of row r after the scatter
+        for (GlobalType e = 0; e < nnz; e++)
+        {
+            descr.convertGlobaltoLocalRow(rowIds[e], colIds[e], localRow, localCol, b);
+            if (b % get_num_threads() != get_thread_num())
+                continue;
+            LocalType d = m_row_offsets[b][localRow]++;
+            m_col_indices[b][d] = localCol;
+            if (values)
+                m_values[b][d] = values[e];
+        }
+        FOR_OWNED_BLOCKS(bId, numBlocks)
+        {
+            std::vector<LocalType>& offsets = m_row_offsets[bId];
+            for (LocalType r = offset; r > 0; r--)
+                offsets[r] = offsets[r - 1];
+            offsets[0] = 0;
+        }
+    }
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+void Matrix2dHost<GlobalType, LocalType, ValueType>::spmv(const VertexData2DHost<GlobalType, LocalType, ValueType>& x,
+                                                          VertexData2DHost<GlobalType, LocalType, ValueType>& y) const
+{
+    const int32_t numBlocks = m_description.getNumBlocks();
+    const LocalType offset = m_description.getOffset();
+    #pragma omp parallel num_threads(m_description.getNumThreads()) proc_bind(spread)
+    {
+        FOR_OWNED_BLOCKS(b, numBlocks)
+        {
+            const LocalType* offsets = getBlockRowOffsets(b);
+            const LocalType* indices = getBlockColIndices(b);
+            const ValueType* vals = getBlockValues(b);
+            const ValueType* xj = x.getColumnData(b);
+            ValueType* yb = y.getCurrent(b);
+            for (LocalType r = 0; r < offset; r++)
+            {
+                ValueType sum = 0;
+                for (LocalType e = offsets[r]; e < offsets[r + 1]; e++)
+                    sum += (vals ? vals[e] : ValueType(1)) * xj[indices[e]];
+                yb[r] = sum;
+            }
+        }
+        y.template rowReduce<std::plus<ValueType> >();
+    }
+}
+
+template <typename GlobalType, typename LocalType, typename ValueType>
+NVGRAPH_ERROR Matrix2dHost<GlobalType, LocalType, ValueType>::traverse(GlobalType source, GlobalType* distances, GlobalType* predecessors) const
+{
+    const GlobalType numRows = m_description.getNumRows();
+    if (source < 0 || source >= numRows)
+        FatalError("Wrong source vertex in host 2D traversal.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    const GlobalType unreached = std::numeric_limits<GlobalType>::max();
+    const int32_t blockRows = m_description.getBlockRows();
+    const int32_t numBlocks = m_description.getNumBlocks();
+    const LocalType offset = m_description.getOffset();
+
+    // per row block, on its diagonal block: distances, predecessors, frontier and next frontier flags
+    std::vector<std::vector<GlobalType> > dist(blockRows), pred(blockRows);
+    std::vector<std::vector<LocalType> > frontier(blockRows);
+    std::vector<std::vector<char> > next(blockRows);
+    // per block: candidate predecessor of every local column, -1 if none
+    std::vector<std::vector<GlobalType> > cand(numBlocks);
+
+    #pragma omp parallel num_threads(m_description.getNumThreads()) proc_bind(spread)
+    {
+        FOR_OWNED_BLOCKS(b, numBlocks)
+        {
+            cand[b].assign(offset, -1);
+            int32_t i = m_description.getBlockRow(b);
+            if (i == m_description.getBlockCol(b))
+            {
+                dist[i].assign(offset, unreached);
+                pred[i].assign(offset, -1);
+                next[i].assign(offset, 0);
+                frontier[i].reserve(offset);
+            }
+        }
+        #pragma omp barrier
+        #pragma omp single
+        {
+            int32_t i = static_cast<int32_t>(source / offset);
+            LocalType k = static_cast<LocalType>(source - m_description.getGlobalId(i, 0));
+            dist[i][k] = 0;
+            frontier[i].push_back(k);
+        }
+
+        for (GlobalType level = 1; ; level++)
+        {
+            // expand the frontier of row block i into the candidates of column block j
+            FOR_OWNED_BLOCKS(b, numBlocks)
+            {
+                int32_t i = m_description.getBlockRow(b), j = m_description.getBlockCol(b);
+                const LocalType* offsets = getBlockRowOffsets(b);
+                const LocalType* indices = getBlockColIndices(b);
+                const GlobalType* dj = dist[j].data();
+                GlobalType* c = cand[b].data();
+                for (size_t f = 0; f < frontier[i].size(); f++)
+                {
+                    LocalType u = frontier[i][f];
+                    for (LocalType e = offsets[u]; e < offsets[u + 1]; e++)
+                    {
+                        LocalType v = indices[e];
+                        if (dj[v] == unreached && c[v] < 0)
+                            c[v] = m_description.getGlobalId(i, u);
+                    }
+                }
+            }
+            #pragma omp barrier
+
+            // the owner of block (i,j) reduces slice i of the candidates of column block j
+            FOR_OWNED_BLOCKS(b, numBlocks)
+            {
+                int32_t i = m_description.getBlockRow(b), j = m_description.getBlockCol(b);
+                LocalType begin = m_description.getSliceBegin(i, blockRows), end = m_description.getSliceBegin(i + 1, blockRows);
+                for (int32_t r = 0; r < blockRows; r++)
+                {
+                    GlobalType* c = cand[m_description.getBlockId(r, j)].data();
+                    for (LocalType k = begin; k < end; k++)
+                    {
+                        if (c[k] >= 0 && dist[j][k] == unreached)
+                        {
+                            dist[j][k] = level;
+                            pred[j][k] = c[k];
+                            next[j][k] = 1;
+                        }
+                        c[k] = -1;
+                    }
+                }
+            }
+            #pragma omp barrier
+
+            // the diagonal blocks compact their next frontier
+            FOR_OWNED_BLOCKS(b, numBlocks)
+            {
+                int32_t i = m_description.getBlockRow(b);
+                if (i != m_description.getBlockCol(b))
+                    continue;
+                frontier[i].clear();
+                for (LocalType k = 0; k < offset; k++)
+                    if (next[i][k])
+                    {
+                        frontier[i].push_back(k);
+                        next[i][k] = 0;
+                    }
+            }
+            #pragma omp barrier
+
+            size_t total = 0;
+            for (int32_t i = 0; i < blockRows; i++)
+                total += frontier[i].size();
+            if (total == 0)
+                break;
+        }
+
+        FOR_OWNED_BLOCKS(b, numBlocks)
+        {
+            int32_t i = m_description.getBlockRow(b);
+            if (i != m_description.getBlockCol(b))
+                continue;
+            for (LocalType k = 0; k < offset; k++)
+            {
+                GlobalType v = m_description.getGlobalId(i, k);
+                if (v >= numRows)
+                    break;
+                if (distances)
+                    distances[v] = dist[i][k];
+                if (predecessors)
+                    predecessors[v] = pred[i][k];
+            }
+        }
+    }
+    return NVGRAPH_OK;
+}
+
+template class MatrixDecompositionDescriptionHost<int, int>;
+template class VertexData2DHost<int, int, int>;
+template class VertexData2DHost<int, int, float>;
+template class VertexData2DHost<int, int, double>;
+template void VertexData2DHost<int, int, int>::rowReduce<std::plus<int> >();
+template void VertexData2DHost<int, int, float>::rowReduce<std::plus<float> >();
+template void VertexData2DHost<int, int, double>::rowReduce<std::plus<double> >();
+template void VertexData2DHost<int, int, int>::columnReduce<std::plus<int> >();
+template void VertexData2DHost<int, int, float>::columnReduce<std::plus<float> >();
+template void VertexData2DHost<int, int, double>::columnReduce<std::plus<double> >();
+template class Matrix2dHost<int, int, float>;
+template class Matrix2dHost<int, int, double>;
+
+} // end namespace nvgraph
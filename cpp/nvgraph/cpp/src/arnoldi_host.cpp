@@ -0,0 +1,787 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include "arnoldi_host.hxx"
+#include "dense_host.hxx"
+#include "nvgraph_lapack.hxx"
+#include "nvgraph_error.hxx"
+
+namespace nvgraph
+{
+
+using namespace dense_host;
+
+template <typename IndexType_, typename ValueType_>
+ImplicitArnoldiHost<IndexType_, ValueType_>::ImplicitArnoldiHost(IndexType n, IndexType nnz,
+                                                                  const IndexType* csr_offsets,
+                                                                  const IndexType* csr_indices,
+                                                                  const ValueType* csr_values)
+    :m_A(n, n, nnz, csr_values, csr_offsets, csr_indices), m_tolerance(1.0E-12), m_iterations(0), m_max_iter(500),
+     m_markov(false), m_dirty_bit(false), m_laplacian(false)
+{
+}
+
+template <typename IndexType_, typename ValueType_>
+ImplicitArnoldiHost<IndexType_, ValueType_>::ImplicitArnoldiHost(IndexType n, IndexType nnz,
+                                                                  const IndexType* csr_offsets,
+                                                                  const IndexType* csr_indices,
+                                                                  const ValueType* csr_values,
+                                                                  int parts)
+    :m_A(n, n, nnz, csr_values, csr_offsets, csr_indices), m_tolerance(1.0E-9), m_iterations(0), m_max_iter(500),
+     m_parts(parts), m_markov(false), m_dirty_bit(false), m_laplacian(true)
+{
+}
+
+template <typename IndexType_, typename ValueType_>
+ImplicitArnoldiHost<IndexType_, ValueType_>::ImplicitArnoldiHost(IndexType n, IndexType nnz,
+                                                                  const IndexType* csr_offsets,
+                                                                  const IndexType* csr_indices,
+                                                                  const ValueType* csr_values,
+                                                                  const ValueType* dangling_nodes,
+                                                                  const float tolerance, const int max_iter, ValueType alpha)
+    :m_A(n, n, nnz, csr_values, csr_offsets, csr_indices), m_a(dangling_nodes, dangling_nodes+n), m_damping(alpha),
+     m_tolerance(tolerance), m_iterations(0), m_max_iter(max_iter),
+     m_markov(true), m_dirty_bit(false), m_laplacian(false)
+{
+}
+
+template <typename IndexType_, typename ValueType_>
+NVGRAPH_ERROR ImplicitArnoldiHost<IndexType_, ValueType_>::solve(const int restart_it, const int nEigVals,
+                                                                const ValueType* initial_guess,
+                                                                ValueType* eigVals,
+                                                                ValueType* eigVecs,
+                                                                const int nested_subspaces_freq)
+{
+    m_nested_subspaces_freq = nested_subspaces_freq;
+
+    setup(initial_guess, restart_it, nEigVals);
+    m_eigenvectors = eigVecs;
+    bool converged = false;
+    int i = 0;
+    while (!converged && i< m_max_iter)
+    {
+        // re-add the extra eigenvalue in case QR step changed it.
+        m_n_eigenvalues = m_nr_eigenvalues+1;
+        converged = solve_it();
+        i++;
+    }
+    m_iterations = i;
+    if (!m_miramns)
+    {
+        if (m_laplacian)
+        {
+            SR(m_krylov_size);
+        }
+        else if  (m_markov)
+        {
+             LR(m_select);
+        }
+        else
+        {
+            LM(m_krylov_size);
+        }
+     }
+    compute_eigenvectors();
+    std::copy(m_ritz_eigenvalues.begin(), m_ritz_eigenvalues.begin()+m_nr_eigenvalues, eigVals);
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::setup(const ValueType* initial_guess, const int restart_it, const int nEigVals)
+{
+    m_krylov_size = restart_it;
+    m_select = m_krylov_size;
+    m_nr_eigenvalues = nEigVals;
+
+    // We always compute an extra eigenvalue to make sure we always have m_nr_eigenvalues
+    // So even if the double shifted QR consume the m_n_eigenvalues^th eigenvalue we are fine
+    m_n_eigenvalues = m_nr_eigenvalues+1;
+
+    // General parameter check
+    if(m_krylov_size >= static_cast<int>(m_A.n))
+        FatalError("ARNOLDI: The krylov subspace size is larger than the matrix", NVGRAPH_ERR_BAD_PARAMETERS);
+    if(m_n_eigenvalues >= m_krylov_size)
+        FatalError("ARNOLDI: The number of required eigenvalues +1 is larger than the maximum krylov subspace size", NVGRAPH_ERR_BAD_PARAMETERS);
+    if(m_krylov_size < 3)
+        FatalError("ARNOLDI: Sould perform at least 3 iterations before restart", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // Some checks on optional Markov parameters
+    if (m_markov)
+    {
+        if (m_nr_eigenvalues != 1)
+            FatalError("ARNOLDI: Only one eigenpair is needed for the equilibrium of a Markov chain", NVGRAPH_ERR_BAD_PARAMETERS);
+        if (m_damping > 0.99999 || m_damping < 0.0001)
+           FatalError("ARNOLDI: Wrong damping factor value", NVGRAPH_ERR_BAD_PARAMETERS);
+    }
+
+    // Some checks on optional miramns parameters
+    if ( m_nested_subspaces_freq <= 0)
+    {
+        m_nested_subspaces = 0;
+        m_miramns=false;
+    }
+    else
+    {
+        m_safety_lower_bound = 7;
+        if( m_nested_subspaces_freq > (m_krylov_size-(m_safety_lower_bound+m_nr_eigenvalues+1))) // ie not enough space betwen the number of ev and the max size of the subspace
+        {
+            m_miramns=false;
+        }
+        else
+        {
+            m_miramns=true;
+            // We allways count the smallest, the largest plus every size matching m_nested_subspaces_freq between them.
+            m_nested_subspaces = 2 + (m_krylov_size-(m_safety_lower_bound+m_nr_eigenvalues+1)-1)/m_nested_subspaces_freq;
+        }
+    }
+
+    m_residual = 1.0E6;
+
+    //Allocations
+    IndexType n = m_A.n;
+    m_V.assign(static_cast<size_t>(n)*(m_krylov_size + 1), 0);
+    m_f.resize(n);
+    m_h.resize(m_krylov_size + 1);
+    m_h2.resize(m_krylov_size + 1);
+    m_ritz_eigenvalues.resize(m_krylov_size);
+    m_ritz_eigenvalues_i.resize(m_krylov_size);
+    m_ritz_eigenvectors.resize(m_krylov_size * m_krylov_size);
+    m_H.assign(m_krylov_size * m_krylov_size, 0);
+    m_H_select.resize(m_select*m_select);
+    m_H_tmp.resize(m_krylov_size * m_krylov_size);
+    m_Q.resize(m_krylov_size * m_krylov_size);
+    if(m_miramns)
+    {
+        m_mns_residuals.resize(m_nested_subspaces);
+        m_mns_beta.resize(m_nested_subspaces);
+    }
+
+    // Same seed as the device solver, the sequence differs
+    m_rng.seed(123456);
+    if (initial_guess == NULL)
+    {
+        random_vector(0, &m_V[0]);
+    }
+    else
+    {
+        std::copy(initial_guess, initial_guess+n, m_V.begin());
+    }
+
+    if(m_markov)
+    {
+        // a = alpha*a + (1-alpha)e on the non dangling nodes
+        for (IndexType i = 0; i < n; ++i)
+            if (m_a[i] == 0)
+                m_a[i] = 1 - m_damping;
+    }
+
+    if (m_laplacian)
+    {
+        // degree matrix
+        std::vector<ValueType> ones(n, 1);
+        m_D.resize(n);
+        m_A.mv(1, &ones[0], 0, &m_D[0]);
+    }
+
+    // normalize
+    ValueType nrm = nrm2(n, &m_V[0], m_partial);
+    if (nrm == 0)
+        FatalError("ARNOLDI: The initial guess is zero", NVGRAPH_ERR_BAD_PARAMETERS);
+    #pragma omp parallel for schedule(static)
+    for (IndexType i = 0; i < n; ++i)
+        m_V[i] /= nrm;
+    m_iterations = 0;
+    // arnoldi from 0 to k
+    solve_arnoldi(0,m_krylov_size);
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::apply(const ValueType* x, ValueType* y)
+{
+    IndexType n = m_A.n;
+    if (m_laplacian)
+    {
+        // L = D-A
+        m_A.mv(-1, x, 0, y);
+        #pragma omp parallel for schedule(static)
+        for (IndexType i = 0; i < n; ++i)
+            y[i] += m_D[i]*x[i];
+    }
+    else if (m_markov)
+    {
+        // alpha*A*x + (a'*x)/n
+        ValueType dot_res;
+        blockedDots(n, (IndexType) 1, &m_a[0], n, x, &dot_res, m_partial);
+        m_A.mv(m_damping, x, 0, y);
+        ValueType c = dot_res/n;
+        #pragma omp parallel for schedule(static)
+        for (IndexType i = 0; i < n; ++i)
+            y[i] += c;
+    }
+    else
+        m_A.mv(1, x, 0, y);
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::random_vector(int k, ValueType* v)
+{
+    IndexType n = m_A.n;
+    std::normal_distribution<double> normalDist(0.0, 1.0);
+    for (IndexType i = 0; i < n; ++i)
+        v[i] = static_cast<ValueType>(normalDist(m_rng));
+    if (k > 0)
+    {
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            blockedDots(n, (IndexType) k, &m_V[0], n, v, &m_h[0], m_partial);
+            gemvMinus(n, (IndexType) k, &m_V[0], n, &m_h[0], v);
+        }
+    }
+    ValueType nrm = nrm2(n, v, m_partial);
+    #pragma omp parallel for schedule(static)
+    for (IndexType i = 0; i < n; ++i)
+        v[i] /= nrm;
+}
+
+template <typename IndexType_, typename ValueType_>
+bool ImplicitArnoldiHost<IndexType_, ValueType_>::solve_arnoldi(int lower_bound, int upper_bound)
+{
+    int mns_residuals_idx = 0;
+    IndexType n = m_A.n;
+
+    if (m_miramns)
+    {
+        std::fill (m_mns_residuals.begin(),m_mns_residuals.end(),0.0);
+    }
+
+    for (int i = lower_bound; i < upper_bound; ++i)
+    {
+        ValueType* vi = &m_V[static_cast<size_t>(i)*n];
+        ValueType* w = vi+n;
+        // beta = norm(f); v = f/beta;
+        if (i>0 && i == lower_bound)
+        {
+            m_beta = nrm2(n, vi, m_partial);
+            // f = 0: V spans an invariant subspace, continue with any
+            // orthogonal vector and H(i,i-1) = 0
+            if (m_beta == 0)
+                random_vector(i, vi);
+            else
+            {
+                #pragma omp parallel for schedule(static)
+                for (IndexType r = 0; r < n; ++r)
+                    vi[r] /= m_beta;
+            }
+        }
+
+        //  Compute H, V and f
+        apply(vi, w);
+
+        // Classical Gram-Schmidt with two passes (CGS2): H(0:i,i) = V(:,0:i)'*AVi and
+        // V(i+1) -= V(:,0:i)*H(0:i,i), each pass with a single sweep over the basis
+        blockedDots(n, (IndexType) (i+1), &m_V[0], n, w, &m_h[0], m_partial);
+        gemvMinus(n, (IndexType) (i+1), &m_V[0], n, &m_h[0], w);
+        blockedDots(n, (IndexType) (i+1), &m_V[0], n, w, &m_h2[0], m_partial);
+        gemvMinus(n, (IndexType) (i+1), &m_V[0], n, &m_h2[0], w);
+        for (int j = 0; j <= i; ++j)
+            m_H[i*m_krylov_size + j] = m_h[j] + m_h2[j];
+
+        if (i > 0)
+        {
+            // H(i+1,i) = ||Vi|| <=> H(i,i-1) = ||Vi||
+            m_H[(i-1)*m_krylov_size + i] = m_beta;
+        }
+        //||Vi+1||
+        m_beta = nrm2(n, w, m_partial);
+        if (i+1 < upper_bound)
+        {
+            if (m_beta == 0)
+                random_vector(i+1, w);
+            else
+            {
+                #pragma omp parallel for schedule(static)
+                for (IndexType r = 0; r < n; ++r)
+                    w[r] /= m_beta;
+            }
+        }
+
+        if (m_miramns)
+        {
+            // The smallest subspaces is always m_safety_lower_bound+m_nr_eigenvalues+1
+            // The largest is allways max_krylov_size,
+            // Between that we check the quality at every stride (m_nested_subspaces_freq).
+            if( i == m_safety_lower_bound+m_nr_eigenvalues ||
+                i+1 == upper_bound ||
+                (i > m_safety_lower_bound+m_nr_eigenvalues && ((i-(m_safety_lower_bound+m_nr_eigenvalues))%m_nested_subspaces_freq == 0)) )
+            {
+                compute_residual(i+1,true); // it is i+1 just because at an iteration i the subspace size is i+1
+                m_mns_beta[mns_residuals_idx] = m_beta;
+                //store current residual
+                m_mns_residuals[mns_residuals_idx] = m_residual;
+                mns_residuals_idx++;
+
+                // early exit if converged
+                if (m_residual<m_tolerance)
+                {
+                    // prepare for exit here
+                    m_select = i+1;
+
+                    if (m_laplacian)
+                    {
+                        SR(m_select);
+                    }
+                    else if  (m_markov)
+                    {
+                         LR(m_select);
+                    }
+                    else
+                    {
+                        LM(m_select);
+                    }
+
+                    return true;
+                }
+            }
+        }
+    }
+    // this is where we compute the residual after the arnoldi reduction in IRAM
+    if (!m_miramns)
+        compute_residual(m_krylov_size, true);
+
+    return m_converged;
+}
+
+template <typename IndexType_, typename ValueType_>
+bool ImplicitArnoldiHost<IndexType_, ValueType_>::solve_it()
+{
+
+    if (m_residual<m_tolerance) return true; // no need to do the k...p arnoldi steps
+
+    if (m_miramns)
+    {
+        int prev = m_select;
+        select_subspace();
+        extract_subspace(prev);
+    }
+    implicit_restart();
+
+    return solve_arnoldi(m_n_eigenvalues, m_krylov_size); // arnoldi from k to m
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::select_subspace()
+{
+    typename std::vector<ValueType_>::iterator it = std::min_element(m_mns_residuals.begin(), m_mns_residuals.end());
+
+    m_residual = *it;
+    int dist = static_cast<int>(std::distance(m_mns_residuals.begin(), it));
+    m_select = std::min((m_safety_lower_bound+m_nr_eigenvalues) + (m_nested_subspaces_freq*dist) +1, m_krylov_size);
+    m_select_idx = dist ;
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::extract_subspace(int m)
+{
+
+    if (m != m_select || m_H_select.size() == 0)
+    {
+        m_H_select.resize(m_select*m_select);
+        m_H_tmp.resize(m_select*m_select);
+        m_Q.resize(m_select*m_select);
+        m_Q_tmp.resize(m_select*m_select);
+    }
+
+    for(int i = 0; i<m_select; i++)
+    {
+        for(int j = 0; j<m_select; j++)
+        {
+           m_H_select[i*m_select+j] = m_H[i*m_krylov_size+j];
+        }
+    }
+    // retrieve || f || if needed
+    if (m_select < m_krylov_size)
+        m_beta = m_mns_beta[m_select_idx];
+
+    m_dirty_bit = true;
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::compute_residual(int subspace_size, bool dirty_bit)
+{
+    if (m_miramns)
+    {
+        if (dirty_bit)
+        {
+            if (static_cast<int>(m_H_tmp.size()) != subspace_size*subspace_size)
+                m_H_tmp.resize(subspace_size*subspace_size);
+
+            for(int i = 0; i<subspace_size; i++)
+            {
+                for(int j = 0; j<subspace_size; j++)
+                {
+                   m_H_tmp[i*subspace_size+j] = m_H[i*m_krylov_size+j];
+                }
+            }
+            Lapack<ValueType_>::geev(&m_H_tmp[0], &m_ritz_eigenvalues[0], &m_ritz_eigenvalues_i[0], &m_ritz_eigenvectors[0], NULL, subspace_size , subspace_size, subspace_size);
+        }
+    }
+    else
+    {
+        if (dirty_bit)
+        {
+            // we change m_H_tmp size during miramns
+            if (m_H_tmp.size() != m_H.size())
+                m_H_tmp.resize(m_H.size());
+            std::copy(m_H.begin(), m_H.end(), m_H_tmp.begin());
+            Lapack<ValueType_>::geev(&m_H_tmp[0], &m_ritz_eigenvalues[0],  &m_ritz_eigenvalues_i[0], &m_ritz_eigenvectors[0], NULL, m_krylov_size , m_krylov_size, m_krylov_size);
+        }
+    }
+
+    // sort
+    if (m_laplacian)
+    {
+        SR(subspace_size);
+    }
+    else if  (m_markov)
+    {
+          LR(m_select);
+     }
+    else
+    {
+        LM(subspace_size);
+    }
+    ValueType_ last_ritz_vector, residual_norm, tmp_residual;
+    ValueType_ lam;
+    m_residual = 0.0f;
+
+    // Convergence check  by approximating the residual of the Ritz pairs.
+    if  (m_markov)
+    {
+         // unlike the device solver a zero residual is accepted: the
+         // Ritz vector is exact when H has deflated
+         last_ritz_vector = m_ritz_eigenvectors[subspace_size-1];
+         m_residual = std::abs(last_ritz_vector * m_beta);
+    }
+    else
+    {
+        for (int i = 0; i < m_n_eigenvalues; i++)
+        {
+            last_ritz_vector = m_ritz_eigenvectors[i * subspace_size + subspace_size-1];
+            residual_norm = std::abs(last_ritz_vector * m_beta);
+            if(m_ritz_eigenvalues_i[i])
+                lam = std::sqrt(m_ritz_eigenvalues[i]*m_ritz_eigenvalues[i] + m_ritz_eigenvalues_i[i]*m_ritz_eigenvalues_i[i]);
+            else
+                lam = std::abs(m_ritz_eigenvalues[i]);
+
+            tmp_residual = residual_norm / lam;
+            if (m_residual<tmp_residual)
+                m_residual = tmp_residual;
+        }
+    }
+
+    if (m_residual < m_tolerance)
+    {
+        m_converged = true;
+    }
+    else
+    {
+        m_converged = false;
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::implicit_restart()
+{
+    // optim:  avoid the cpy here
+    if (!m_miramns) std::copy(m_H.begin(), m_H.end(), m_H_select.begin());
+    select_shifts(m_dirty_bit);
+
+    qr_step();
+
+    refine_basis();
+
+    // optim:  avoid the cpy here
+    if (!m_miramns) std::copy(m_H_select.begin(), m_H_select.end(), m_H.begin());
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::select_shifts(bool dirty_bit)
+{
+    // dirty_bit is false by default
+    if (dirty_bit)
+    {
+        std::copy(m_H_select.begin(), m_H_select.end(), m_H_tmp.begin());
+        Lapack<ValueType_>::geev(&m_H_tmp[0], &m_ritz_eigenvalues[0],&m_ritz_eigenvalues_i[0], &m_ritz_eigenvectors[0], NULL, m_select , m_select, m_select);
+    }
+    m_dirty_bit = false;
+    if (m_laplacian)
+    {
+        SR(m_select);
+    }
+    else if  (m_markov)
+    {
+         LR(m_select);
+    }
+    else
+    {
+        LM(m_select);
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::LR(int subspace_sz)
+{
+    // Eigen values of interest have the largest real part
+    std::vector<std::pair<int,ValueType_> > items;
+    for (int i = 0; i < subspace_sz; ++i)
+        items.push_back(std::make_pair( i, m_ritz_eigenvalues[i]));
+
+    // this is a reverse  key value sort by algebraic value
+    std::sort(items.begin(), items.end(),[](const std::pair<int,ValueType_> &left, const std::pair<int,ValueType_> &right)
+                                             {return left.second > right.second; });
+
+    // Now we need to reorder the vectors accordingly
+    std::vector<ValueType_> ritz_tmp(m_ritz_eigenvectors);
+
+    for (int i = 0; i < subspace_sz; ++i)
+    {
+        std::copy(ritz_tmp.begin() + (items[i].first*subspace_sz),
+                  ritz_tmp.begin() + (items[i].first*subspace_sz + subspace_sz),
+                  m_ritz_eigenvectors.begin()+(i*subspace_sz));
+        m_ritz_eigenvalues[i] = items[i].second;
+    }
+    std::vector<ValueType_> tmp_i(m_ritz_eigenvalues_i);
+    for (int i = 0; i < subspace_sz; ++i)
+    {
+        m_ritz_eigenvalues_i[i] = tmp_i[items[i].first];
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::LM(int subspace_sz)
+{
+    std::vector<std::pair<int, ValueType_ > > kv;
+
+    for (int i = 0; i < subspace_sz; ++i)
+        kv.push_back(std::make_pair( i, m_ritz_eigenvalues[i]*m_ritz_eigenvalues[i] + m_ritz_eigenvalues_i[i]*m_ritz_eigenvalues_i[i]));
+
+    // this is a reverse  key value sort by magnitude
+    std::sort(kv.begin(), kv.end(),[](const std::pair<int,ValueType_> &left, const std::pair<int,ValueType_> &right)
+                                       {return left.second > right.second; });
+
+    // Now we need to reorder the vectors accordingly
+    std::vector<ValueType_> ritz_tmp(m_ritz_eigenvectors);
+    std::vector<ValueType_> ev(m_ritz_eigenvalues);
+    std::vector<ValueType_> ev_i(m_ritz_eigenvalues_i);
+    for (int i = 0; i < subspace_sz; ++i)
+    {
+        std::copy(ritz_tmp.begin() + (kv[i].first*subspace_sz),
+                  ritz_tmp.begin() + (kv[i].first*subspace_sz + subspace_sz),
+                  m_ritz_eigenvectors.begin()+(i*subspace_sz));
+        m_ritz_eigenvalues[i] = ev[kv[i].first];
+        m_ritz_eigenvalues_i[i] = ev_i[kv[i].first];
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::SR(int subspace_sz)
+{
+    // Eigen values of interest have the smallest real part
+    std::vector<std::pair<int,ValueType_> > items;
+    for (int i = 0; i < subspace_sz; ++i)
+        items.push_back(std::make_pair( i, m_ritz_eigenvalues[i]));
+
+    std::sort(items.begin(), items.end(),[](const std::pair<int,ValueType_> &left, const std::pair<int,ValueType_> &right)
+                                             {return left.second < right.second; });
+
+    // Now we need to reorder the vectors accordingly
+    std::vector<ValueType_> ritz_tmp(m_ritz_eigenvectors);
+
+    for (int i = 0; i < subspace_sz; ++i)
+    {
+        std::copy(ritz_tmp.begin() + (items[i].first*subspace_sz),
+                  ritz_tmp.begin() + (items[i].first*subspace_sz + subspace_sz),
+                  m_ritz_eigenvectors.begin()+(i*subspace_sz));
+        m_ritz_eigenvalues[i] = items[i].second;
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::qr_step()
+{
+    ValueType_ mu, mu_i, mu_i_sq;
+    int n = m_select;
+    int ld = m_select;
+    std::vector<ValueType> tau(n);
+    std::vector<ValueType> work(n);
+    int lwork = -1;
+    // workspace query
+    std::copy (m_H_select.begin(),m_H_select.end(), m_H_tmp.begin());
+    Lapack<ValueType_>::geqrf(n, n, &m_H_tmp[0], ld, &tau[0], &work[0], &lwork);
+    // work is a real array used as workspace. On exit, if LWORK = -1, work[0] contains the optimal LWORK.
+    lwork = static_cast<int>(work[0]);
+    work.resize(lwork);
+    // Q0 = I
+    m_Q.assign(m_Q.size(),0.0);
+    shift(m_Q, m_select, m_select, -1);
+
+    int i = m_select-1;
+    while (i >= m_n_eigenvalues)
+    {
+        //Get the shift
+        mu_i = m_ritz_eigenvalues_i[i];
+        mu = m_ritz_eigenvalues[i];
+        shift(m_H_tmp, m_select, m_select, mu);
+
+        if (mu_i )
+        {
+            //Complex case
+            //Double shift
+            //(H - re_mu*I)^2 + im_mu^2*I)
+
+            if (i==m_n_eigenvalues)
+            {
+                // if we are in this case we will consume the  next eigen value which is a wanted eigenalue
+                // fortunately  m_n_eigenvalues = m_nr_eigenvalues +1 (we alway compute one more eigenvalue)
+                m_n_eigenvalues -=1;
+            }
+            std::vector<ValueType> A(m_select*m_select);
+
+            for (int ii = 0; ii < m_select; ii++)
+                for (int k = 0; k < m_select; k++)
+                    for (int j = 0; j < m_select; j++)
+                        A[ii*m_select+j] +=  m_H_tmp[ii*m_select+k]* m_H_tmp[k*m_select+j];
+            mu_i_sq = mu_i*mu_i;
+            std::copy (A.begin(),A.end(), m_H_tmp.begin());
+            shift(m_H_tmp, m_select, m_select, -mu_i_sq);
+        }
+
+        // [Q,R] = qr(H - mu*I);
+        Lapack<ValueType_>::geqrf(n, n, &m_H_tmp[0], ld, &tau[0], &work[0], &lwork);
+        //H+ = (Q)'* H * Q ;
+        Lapack<ValueType_>::ormqr(false, true, n, n, n, &m_H_tmp[0], ld, &tau[0], &m_H_select[0], n, &work[0], &lwork);
+        Lapack<ValueType_>::ormqr(true, false, n, n, n, &m_H_tmp[0], ld, &tau[0], &m_H_select[0], n, &work[0], &lwork);
+
+        //Q+ = Q+*Q;
+        Lapack<ValueType_>::ormqr(true, false, n, n, n, &m_H_tmp[0], ld, &tau[0], &m_Q[0], n, &work[0], &lwork);
+
+        // clean up below subdiagonal (column major storage)
+        cleanup_subspace(m_H_select, m_select,m_select);
+
+        std::copy (m_H_select.begin(),m_H_select.end(), m_H_tmp.begin());
+        if (mu_i)
+              i-=2; //complex
+        else
+              i-=1; //real
+    }
+
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::refine_basis()
+{
+    // f+ = V(:,1:m)*Q(:,n_ev+1)*H(n_ev+1,n_ev) + f*Q(m,n_ev)
+    // V+ = V(:,1:m)*Q(:,1:n_ev)
+    IndexType n = m_A.n;
+    int nev = m_n_eigenvalues,
+        nk = m_select;
+    ValueType_ alpha, beta;
+
+    alpha = m_Q[(nev-1) * nk + nk - 1];
+    // retrieve f from v[m_select] if needed
+    if (m_select!=m_krylov_size)
+        alpha *= m_beta;
+    beta = m_H_select[(nev-1) * nk + nev ];
+
+    const ValueType_* f = &m_V[static_cast<size_t>(nk)*n];
+    const ValueType_* q = &m_Q[nev*nk];
+    blockedGemm(n, (IndexType) nk, (IndexType) 1, &m_V[0], n, q, (IndexType) nk, &m_f[0], n);
+    #pragma omp parallel for schedule(static)
+    for (IndexType r = 0; r < n; ++r)
+        m_f[r] = beta*m_f[r] + alpha*f[r];
+
+    // in place, blockedGemm writes each block of rows once it is computed
+    blockedGemm(n, (IndexType) nk, (IndexType) nev, &m_V[0], n, &m_Q[0], (IndexType) nk, &m_V[0], n);
+    std::copy(m_f.begin(), m_f.end(), m_V.begin() + static_cast<size_t>(nev)*n);
+
+    // update H
+    if (m_miramns)
+    {
+        for(int i = 0; i<m_select; i++)
+            for(int j = 0; j<m_select; j++)
+               m_H[i*m_krylov_size+j] = m_H_select[i*m_select+j];
+        cleanup_subspace(m_H, m_krylov_size,m_n_eigenvalues);
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::compute_eigenvectors()
+{
+    IndexType n = m_A.n;
+    int nev = m_nr_eigenvalues,
+        nk = m_select;
+    blockedGemm(n, (IndexType) nk, (IndexType) nev, &m_V[0], n,
+                &m_ritz_eigenvectors[0], (IndexType) nk, m_eigenvectors, n);
+    //sum 1 for pagerank
+    if(m_markov)
+    {
+        ValueType_ sum = 0;
+        for (IndexType r = 0; r < n; ++r)
+            sum += m_eigenvectors[r];
+        #pragma omp parallel for schedule(static)
+        for (IndexType r = 0; r < n; ++r)
+            m_eigenvectors[r] /= sum;
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::cleanup_subspace(std::vector<ValueType_>& v, int ld, int new_sz)
+{
+    //    In               Out
+    // * * 0 0 0        * * 0 0 0
+    // * * * 0 0        * * * 0 0
+    // * * * * 0        * * * * 0
+    // * * * * *        * * * * 0  <--- new_sz
+    // * * * * *        0 0 0 0 0
+
+    for (int i = 0; i < new_sz-1; i++)
+      for (int j = i+2; j < new_sz; j++)
+          v[i*ld + j] = 0;
+    for (int i = new_sz; i < ld; i++)
+      for (int j = 0; j < ld; j++)
+        v[i*ld + j] = 0;
+    for (int i = 0; i < new_sz; i++)
+      for (int j = new_sz; j < ld; j++)
+        v[i*ld + j] = 0;
+}
+
+template <typename IndexType_, typename ValueType_>
+void ImplicitArnoldiHost<IndexType_, ValueType_>::shift(std::vector<ValueType_>& H, int ld, int m, ValueType mu)
+{
+    int start = ld-m;
+    for (int i = start; i < ld; i++)
+        H[i*ld+i-start] -= mu;
+}
+
+template class ImplicitArnoldiHost<int, double>;
+template class ImplicitArnoldiHost<int, float>;
+} // end namespace nvgraph
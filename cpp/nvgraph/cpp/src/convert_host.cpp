@@ -0,0 +1,527 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "nvgraph_error.hxx"
+#include "convert_host.hxx"
+
+namespace nvgraph
+{
+namespace
+{
+inline int get_num_threads()
+{
+#ifdef _OPENMP
+    return omp_get_num_threads();
+#else
+    return 1;
+#endif
+}
+
+inline int get_thread_num()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+// slice t of nt of [0, n)
+template <typename IndexType>
+inline IndexType slice_begin(IndexType n, int t, int nt)
+{
+    return static_cast<IndexType>(static_cast<long long>(n) * t / nt);
+}
+
+// a[0..n-1] counts -> a[0..n] offsets, a[n] = total
+template <typename IndexType>
+void exclusive_scan(IndexType* a, IndexType n)
+{
+    std::vector<IndexType> partial;
+    #pragma omp parallel
+    {
+        const int nt = get_num_threads();
+        const int t = get_thread_num();
+        #pragma omp single
+        partial.assign(nt + 1, 0);
+
+        const IndexType begin = slice_begin(n, t, nt), end = slice_begin(n, t + 1, nt);
+        IndexType s = 0;
+        for (IndexType i = begin; i < end; i++)
+            s += a[i];
+        partial[t + 1] = s;
+        #pragma omp barrier
+        #pragma omp single
+        for (int k = 0; k < nt; k++)
+            partial[k + 1] += partial[k];
+
+        s = partial[t];
+        for (IndexType i = begin; i < end; i++)
+        {
+            IndexType c = a[i];
+            a[i] = s;
+            s += c;
+        }
+    }
+    a[n] = partial.back();
+}
+
+// row of the entries of a CSR (offsets) or a COO (indices)
+template <typename IndexType>
+struct EntryRows
+{
+    const IndexType* offsets;
+    const IndexType* indices;
+    IndexType m;
+    IndexType row;
+
+    EntryRows(const IndexType* offsets_, const IndexType* indices_, IndexType m_)
+        : offsets(offsets_), indices(indices_), m(m_), row(0) {}
+
+    // start of a slice, then the entries must be visited in increasing order
+    inline void seek(IndexType k)
+    {
+        if (offsets)
+            row = static_cast<IndexType>(std::upper_bound(offsets, offsets + m + 1, k) - offsets) - 1;
+    }
+    inline IndexType operator()(IndexType k)
+    {
+        if (!offsets)
+            return indices[k];
+        while (offsets[row + 1] <= k)
+            row++;
+        return row;
+    }
+};
+
+struct DirectKeys
+{
+    template <typename IndexType>
+    static inline IndexType get(const IndexType* keys, IndexType k, int) {return keys[k];}
+};
+
+struct BlockKeys
+{
+    template <typename IndexType>
+    static inline IndexType get(const IndexType* keys, IndexType k, int bits) {return keys[k] >> bits;}
+};
+
+// Stable counting sort of the nnz entries by Keys::get(keys, k, bits) < nkeys:
+// offsets (nkeys+1) receives the start of every key, out(d, k, row) moves entry k to d.
+template <typename Keys, typename IndexType, typename Out>
+void counting_scatter(IndexType nkeys, IndexType nnz, const IndexType* keys, int bits,
+                      EntryRows<IndexType> rows, IndexType* offsets, Out out)
+{
+    std::vector<IndexType> count;
+    int nthreads = 1;
+
+    // per thread histogram of its slice
+    #pragma omp parallel
+    {
+        #pragma omp single
+        {
+            nthreads = get_num_threads();
+            count.assign(static_cast<size_t>(nthreads) * nkeys, 0);
+        }
+        const int t = get_thread_num();
+        IndexType* c = &count[static_cast<size_t>(t) * nkeys];
+        const IndexType begin = slice_begin(nnz, t, nthreads), end = slice_begin(nnz, t + 1, nthreads);
+        for (IndexType k = begin; k < end; k++)
+            c[Keys::get(keys, k, bits)]++;
+    }
+
+    // key totals, and the start of every thread inside its keys
+    #pragma omp parallel for schedule(static)
+    for (IndexType j = 0; j < nkeys; j++)
+    {
+        IndexType s = 0;
+        for (int t = 0; t < nthreads; t++)
+        {
+            IndexType c = count[static_cast<size_t>(t) * nkeys + j];
+            count[static_cast<size_t>(t) * nkeys + j] = s;
+            s += c;
+        }
+        offsets[j] = s;
+    }
+    exclusive_scan(offsets, nkeys);
+
+    // every thread scatters its slice in order, after the slices of the previous threads
+    #pragma omp parallel num_threads(nthreads)
+    {
+        const int t = get_thread_num();
+        IndexType* c = &count[static_cast<size_t>(t) * nkeys];
+        const IndexType begin = slice_begin(nnz, t, nthreads), end = slice_begin(nnz, t + 1, nthreads);
+        EntryRows<IndexType> r = rows;
+        r.seek(begin);
+        for (IndexType k = begin; k < end; k++)
+        {
+            IndexType j = Keys::get(keys, k, bits);
+            out(offsets[j] + c[j]++, k, r(k));
+        }
+    }
+}
+
+template <typename IndexType, typename ValueType>
+struct FinalOut
+{
+    const ValueType* vals;
+    IndexType* others;
+    ValueType* out_vals;
+    IndexType* p;
+
+    inline void operator()(IndexType d, IndexType k, IndexType row) const
+    {
+        others[d] = row;
+        if (out_vals)
+            out_vals[d] = vals[k];
+        if (p)
+            p[d] = k;
+    }
+};
+
+template <typename IndexType>
+struct BlockOut
+{
+    const IndexType* keys;
+    IndexType* tmp_keys;
+    IndexType* tmp_others;
+    IndexType* tmp_src;
+
+    inline void operator()(IndexType d, IndexType k, IndexType row) const
+    {
+        tmp_keys[d] = keys[k];
+        tmp_others[d] = row;
+        tmp_src[d] = k;
+    }
+};
+
+// entry k of key keys[k] and row rows(k) goes to others, out_vals, p;
+// offsets (nkeys+1) receives the start of every key
+template <typename IndexType, typename ValueType>
+void transpose(IndexType nkeys, IndexType nnz, const IndexType* keys, EntryRows<IndexType> rows,
+               const ValueType* vals, IndexType* offsets, IndexType* others, ValueType* out_vals,
+               IndexType* p, IndexType block_threshold)
+{
+    if (nkeys < 0 || nnz < 0 || offsets == NULL || (nnz > 0 && (keys == NULL || others == NULL)))
+        FatalError("Wrong input in host conversion.", NVGRAPH_ERR_BAD_PARAMETERS);
+    if (vals == NULL)
+        out_vals = NULL;
+
+    FinalOut<IndexType, ValueType> out = {vals, others, out_vals, p};
+    if (nkeys <= block_threshold)
+    {
+        counting_scatter<DirectKeys>(nkeys, nnz, keys, 0, rows, offsets, out);
+        return;
+    }
+
+    // Cache blocked: the histograms and the write streams of the first pass are per block
+    // of 2^CONVERT_HOST_BLOCK_BITS keys, the second pass sorts every block on its own
+    // with a histogram that stays in cache
+    const int bits = CONVERT_HOST_BLOCK_BITS;
+    const IndexType block_size = static_cast<IndexType>(1) << bits;
+    const IndexType nblocks = (nkeys + block_size - 1) >> bits;
+    std::vector<IndexType> block_offsets(nblocks + 1);
+    std::vector<IndexType> tmp_keys(nnz), tmp_others(nnz), tmp_src(nnz);
+    BlockOut<IndexType> block_out = {keys, tmp_keys.data(), tmp_others.data(), tmp_src.data()};
+    counting_scatter<BlockKeys>(nblocks, nnz, keys, bits, rows, &block_offsets[0], block_out);
+
+    #pragma omp parallel
+    {
+        std::vector<IndexType> c(block_size);
+        #pragma omp for schedule(dynamic, 1)
+        for (IndexType b = 0; b < nblocks; b++)
+        {
+            const IndexType first_key = b << bits;
+            const IndexType nk = std::min(block_size, nkeys - first_key);
+            const IndexType begin = block_offsets[b], end = block_offsets[b + 1];
+            std::fill(c.begin(), c.begin() + nk, 0);
+            for (IndexType i = begin; i < end; i++)
+                c[tmp_keys[i] - first_key]++;
+            IndexType s = begin;
+            for (IndexType j = 0; j < nk; j++)
+            {
+                offsets[first_key + j] = s;
+                s += c[j];
+                c[j] = offsets[first_key + j];
+            }
+            for (IndexType i = begin; i < end; i++)
+                out(c[tmp_keys[i] - first_key]++, tmp_src[i], tmp_others[i]);
+        }
+    }
+    offsets[nkeys] = nnz;
+}
+
+template <typename T>
+inline void copy_array(const T* src, size_t n, T* dst)
+{
+    if (src == NULL || dst == NULL)
+        return;
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < static_cast<long>(n); i++)
+        dst[i] = src[i];
+}
+
+// COO -> compressed by keys: keys_sorted (others_sorted) if the COO is sorted by keys (others),
+// a COO sorted by neither is sorted by others first so that the compressed lists are sorted
+template <typename ValueType>
+void compress_coo(int n, int nnz, const int* keys, const int* others, const ValueType* vals,
+                  bool keys_sorted, bool others_sorted,
+                  int* offsets, int* out_others, ValueType* out_vals)
+{
+    if (keys_sorted)
+    {
+        coo2csr_host(keys, nnz, n, offsets);
+        copy_array(others, nnz, out_others);
+        copy_array(vals, nnz, out_vals);
+    }
+    else if (others_sorted)
+    {
+        coou2csr_host(n, nnz, keys, others, vals, offsets, out_others, out_vals);
+    }
+    else
+    {
+        std::vector<int> tmp_offsets(n + 1), tmp_keys(nnz);
+        std::vector<ValueType> tmp_vals(vals ? nnz : 0);
+        coou2csr_host(n, nnz, others, keys, vals, &tmp_offsets[0], tmp_keys.data(), vals ? tmp_vals.data() : NULL);
+        csr2csc_host(n, n, nnz, &tmp_offsets[0], tmp_keys.data(), vals ? tmp_vals.data() : NULL,
+                     out_others, offsets, out_vals);
+    }
+}
+} // end anonymous namespace
+
+template <typename IndexType>
+void csr2coo_host(const IndexType* csrRowPtr, IndexType nnz, IndexType m, IndexType* cooRowInd)
+{
+    if (m < 0 || nnz < 0 || csrRowPtr == NULL || (nnz > 0 && cooRowInd == NULL))
+        FatalError("Wrong input in host csr2coo.", NVGRAPH_ERR_BAD_PARAMETERS);
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for (IndexType i = 0; i < m; i++)
+        for (IndexType e = csrRowPtr[i]; e < csrRowPtr[i + 1]; e++)
+            cooRowInd[e] = i;
+}
+
+template <typename IndexType>
+void coo2csr_host(const IndexType* cooRowInd, IndexType nnz, IndexType m, IndexType* csrRowPtr)
+{
+    if (m < 0 || nnz < 0 || csrRowPtr == NULL || (nnz > 0 && cooRowInd == NULL))
+        FatalError("Wrong input in host coo2csr.", NVGRAPH_ERR_BAD_PARAMETERS);
+    // first entry of every row in the sorted row indices
+    #pragma omp parallel for schedule(static)
+    for (IndexType i = 0; i <= m; i++)
+        csrRowPtr[i] = static_cast<IndexType>(std::lower_bound(cooRowInd, cooRowInd + nnz, i) - cooRowInd);
+}
+
+template <typename IndexType, typename ValueType>
+void csr2csc_host(IndexType m, IndexType n, IndexType nnz,
+                  const IndexType* csrRowPtr, const IndexType* csrColInd, const ValueType* csrVal,
+                  IndexType* cscRowInd, IndexType* cscColPtr, ValueType* cscVal,
+                  IndexType* p, IndexType block_threshold)
+{
+    if (m < 0 || csrRowPtr == NULL)
+        FatalError("Wrong input in host csr2csc.", NVGRAPH_ERR_BAD_PARAMETERS);
+    EntryRows<IndexType> rows(csrRowPtr, NULL, m);
+    transpose(n, nnz, csrColInd, rows, csrVal, cscColPtr, cscRowInd, cscVal, p, block_threshold);
+}
+
+template <typename IndexType, typename ValueType>
+void coou2csr_host(IndexType m, IndexType nnz,
+                   const IndexType* cooRowInd, const IndexType* cooColInd, const ValueType* cooVal,
+                   IndexType* csrRowPtr, IndexType* csrColInd, ValueType* csrVal,
+                   IndexType* p, IndexType block_threshold)
+{
+    if (nnz > 0 && cooColInd == NULL)
+        FatalError("Wrong input in host coo2csr.", NVGRAPH_ERR_BAD_PARAMETERS);
+    // the "rows" of the transpose are the column indices
+    EntryRows<IndexType> rows(NULL, cooColInd, m);
+    transpose(m, nnz, cooRowInd, rows, cooVal, csrRowPtr, csrColInd, csrVal, p, block_threshold);
+}
+
+template <typename ValueType>
+NVGRAPH_ERROR convert_topology_host(nvgraphTopologyType_t srcTType, const void* srcTopology, const ValueType* srcEdgeData,
+                                    nvgraphTopologyType_t dstTType, void* dstTopology, ValueType* dstEdgeData)
+{
+    if (srcTopology == NULL || dstTopology == NULL || ((srcEdgeData == NULL) != (dstEdgeData == NULL)))
+        FatalError("Wrong input in host topology conversion.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    int n, nnz;
+    if (srcTType == NVGRAPH_CSR_32)
+    {
+        const nvgraphCSRTopology32I_st* srcT = static_cast<const nvgraphCSRTopology32I_st*>(srcTopology);
+        n = srcT->nvertices;
+        nnz = srcT->nedges;
+    }
+    else if (srcTType == NVGRAPH_CSC_32)
+    {
+        const nvgraphCSCTopology32I_st* srcT = static_cast<const nvgraphCSCTopology32I_st*>(srcTopology);
+        n = srcT->nvertices;
+        nnz = srcT->nedges;
+    }
+    else if (srcTType == NVGRAPH_COO_32)
+    {
+        const nvgraphCOOTopology32I_st* srcT = static_cast<const nvgraphCOOTopology32I_st*>(srcTopology);
+        n = srcT->nvertices;
+        nnz = srcT->nedges;
+    }
+    else
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+    if (n < 0 || nnz < 0)
+        FatalError("Wrong input in host topology conversion.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    if (srcTType == NVGRAPH_CSR_32 || srcTType == NVGRAPH_CSC_32)
+    {
+        // a CSC is the CSR of the transposed graph, convert it as such and swap the roles back
+        const bool transposed = (srcTType == NVGRAPH_CSC_32);
+        const int *offsets, *indices;
+        if (transposed)
+        {
+            const nvgraphCSCTopology32I_st* srcT = static_cast<const nvgraphCSCTopology32I_st*>(srcTopology);
+            offsets = srcT->destination_offsets;
+            indices = srcT->source_indices;
+        }
+        else
+        {
+            const nvgraphCSRTopology32I_st* srcT = static_cast<const nvgraphCSRTopology32I_st*>(srcTopology);
+            offsets = srcT->source_offsets;
+            indices = srcT->destination_indices;
+        }
+
+        if (dstTType == NVGRAPH_CSR_32 || dstTType == NVGRAPH_CSC_32)
+        {
+            int *dst_offsets, *dst_indices;
+            if (dstTType == NVGRAPH_CSR_32)
+            {
+                nvgraphCSRTopology32I_t dstT = static_cast<nvgraphCSRTopology32I_t>(dstTopology);
+                dstT->nvertices = n;
+                dstT->nedges = nnz;
+                dst_offsets = dstT->source_offsets;
+                dst_indices = dstT->destination_indices;
+            }
+            else
+            {
+                nvgraphCSCTopology32I_t dstT = static_cast<nvgraphCSCTopology32I_t>(dstTopology);
+                dstT->nvertices = n;
+                dstT->nedges = nnz;
+                dst_offsets = dstT->destination_offsets;
+                dst_indices = dstT->source_indices;
+            }
+            if ((dstTType == NVGRAPH_CSC_32) == transposed)
+            {
+                copy_array(offsets, n + 1, dst_offsets);
+                copy_array(indices, nnz, dst_indices);
+                copy_array(srcEdgeData, nnz, dstEdgeData);
+            }
+            else
+                csr2csc_host(n, n, nnz, offsets, indices, srcEdgeData, dst_indices, dst_offsets, dstEdgeData);
+        }
+        else if (dstTType == NVGRAPH_COO_32)
+        {
+            nvgraphCOOTopology32I_t dstT = static_cast<nvgraphCOOTopology32I_t>(dstTopology);
+            dstT->nvertices = n;
+            dstT->nedges = nnz;
+            int* rows = transposed ? dstT->destination_indices : dstT->source_indices;
+            int* cols = transposed ? dstT->source_indices : dstT->destination_indices;
+            const nvgraphTag_t other = transposed ? NVGRAPH_SORTED_BY_SOURCE : NVGRAPH_SORTED_BY_DESTINATION;
+            if (dstT->tag == other)
+            {
+                // sorted by the other end: transpose, then expand the offsets
+                std::vector<int> tmp_offsets(n + 1);
+                csr2csc_host(n, n, nnz, offsets, indices, srcEdgeData, rows, &tmp_offsets[0], dstEdgeData);
+                csr2coo_host(&tmp_offsets[0], nnz, n, cols);
+            }
+            else if (dstT->tag == NVGRAPH_DEFAULT || dstT->tag == NVGRAPH_UNSORTED || dstT->tag == (transposed ? NVGRAPH_SORTED_BY_DESTINATION : NVGRAPH_SORTED_BY_SOURCE))
+            {
+                csr2coo_host(offsets, nnz, n, rows);
+                copy_array(indices, nnz, cols);
+                copy_array(srcEdgeData, nnz, dstEdgeData);
+            }
+            else
+                return NVGRAPH_ERR_BAD_PARAMETERS;
+        }
+        else
+            return NVGRAPH_ERR_BAD_PARAMETERS;
+        return NVGRAPH_OK;
+    }
+
+    // COO source
+    const nvgraphCOOTopology32I_st* srcT = static_cast<const nvgraphCOOTopology32I_st*>(srcTopology);
+    const bool by_source = (srcT->tag == NVGRAPH_SORTED_BY_SOURCE);
+    const bool by_destination = (srcT->tag == NVGRAPH_SORTED_BY_DESTINATION);
+    if (!by_source && !by_destination && srcT->tag != NVGRAPH_DEFAULT && srcT->tag != NVGRAPH_UNSORTED)
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+
+    if (dstTType == NVGRAPH_CSR_32)
+    {
+        nvgraphCSRTopology32I_t dstT = static_cast<nvgraphCSRTopology32I_t>(dstTopology);
+        dstT->nvertices = n;
+        dstT->nedges = nnz;
+        compress_coo(n, nnz, srcT->source_indices, srcT->destination_indices, srcEdgeData, by_source, by_destination,
+                     dstT->source_offsets, dstT->destination_indices, dstEdgeData);
+    }
+    else if (dstTType == NVGRAPH_CSC_32)
+    {
+        nvgraphCSCTopology32I_t dstT = static_cast<nvgraphCSCTopology32I_t>(dstTopology);
+        dstT->nvertices = n;
+        dstT->nedges = nnz;
+        compress_coo(n, nnz, srcT->destination_indices, srcT->source_indices, srcEdgeData, by_destination, by_source,
+                     dstT->destination_offsets, dstT->source_indices, dstEdgeData);
+    }
+    else if (dstTType == NVGRAPH_COO_32)
+    {
+        nvgraphCOOTopology32I_t dstT = static_cast<nvgraphCOOTopology32I_t>(dstTopology);
+        dstT->nvertices = n;
+        dstT->nedges = nnz;
+        if (dstT->tag == srcT->tag || dstT->tag == NVGRAPH_DEFAULT || dstT->tag == NVGRAPH_UNSORTED)
+        {
+            copy_array(srcT->source_indices, nnz, dstT->source_indices);
+            copy_array(srcT->destination_indices, nnz, dstT->destination_indices);
+            copy_array(srcEdgeData, nnz, dstEdgeData);
+        }
+        else if (dstT->tag == NVGRAPH_SORTED_BY_SOURCE || dstT->tag == NVGRAPH_SORTED_BY_DESTINATION)
+        {
+            // compress by the new key, then expand the offsets
+            const bool to_source = (dstT->tag == NVGRAPH_SORTED_BY_SOURCE);
+            std::vector<int> tmp_offsets(n + 1);
+            if (to_source)
+                compress_coo(n, nnz, srcT->source_indices, srcT->destination_indices, srcEdgeData, false, by_destination,
+                             &tmp_offsets[0], dstT->destination_indices, dstEdgeData);
+            else
+                compress_coo(n, nnz, srcT->destination_indices, srcT->source_indices, srcEdgeData, false, by_source,
+                             &tmp_offsets[0], dstT->source_indices, dstEdgeData);
+            csr2coo_host(&tmp_offsets[0], nnz, n, to_source ? dstT->source_indices : dstT->destination_indices);
+        }
+        else
+            return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    else
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+    return NVGRAPH_OK;
+}
+
+template void csr2coo_host<int>(const int*, int, int, int*);
+template void coo2csr_host<int>(const int*, int, int, int*);
+template void csr2csc_host<int, float>(int, int, int, const int*, const int*, const float*, int*, int*, float*, int*, int);
+template void csr2csc_host<int, double>(int, int, int, const int*, const int*, const double*, int*, int*, double*, int*, int);
+template void coou2csr_host<int, float>(int, int, const int*, const int*, const float*, int*, int*, float*, int*, int);
+template void coou2csr_host<int, double>(int, int, const int*, const int*, const double*, int*, int*, double*, int*, int);
+template NVGRAPH_ERROR convert_topology_host<float>(nvgraphTopologyType_t, const void*, const float*, nvgraphTopologyType_t, void*, float*);
+template NVGRAPH_ERROR convert_topology_host<double>(nvgraphTopologyType_t, const void*, const double*, nvgraphTopologyType_t, void*, double*);
+
+} // end namespace nvgraph
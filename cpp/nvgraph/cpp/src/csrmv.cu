@@ -741,6 +741,94 @@ cudaError_t csrmv_mp(
 	return callSemiringSpmv(spParams, SR, stream);
 }
 
+//one warp per row, the lanes of the warp stride over the k columns of the dense blocks
+//so that the reads of x for a given nonzero are coalesced
+template<typename IndexType_, typename ValueType_, typename SemiRingType_>
+__global__ void csrmm_warp_kernel(IndexType_ m, IndexType_ k,
+	const IndexType_ * __restrict__ dRowOffsets, const IndexType_ * __restrict__ dColIndices, const ValueType_ * __restrict__ dValues,
+	const ValueType_ * __restrict__ dBlockX, ValueType_ * __restrict__ dBlockY, SemiRingType_ SR, ValueType_ alpha, ValueType_ beta)
+{
+	const int lane = threadIdx.x & 31;
+	const IndexType_ num_warps = (blockDim.x * gridDim.x) >> 5;
+	for (IndexType_ row = (blockDim.x * blockIdx.x + threadIdx.x) >> 5; row < m; row += num_warps)
+	{
+		IndexType_ row_start = dRowOffsets[row];
+		IndexType_ row_end = dRowOffsets[row + 1];
+		for (IndexType_ j = lane; j < k; j += 32)
+		{
+			ValueType_ dot;
+			SR.setPlus_ident(dot);
+			for (IndexType_ i = row_start; i < row_end; i++)
+				dot = SR.plus(SR.times(dValues[i], dBlockX[static_cast<size_t>(dColIndices[i]) * k + j]), dot);
+			size_t pos = static_cast<size_t>(row) * k + j;
+			dBlockY[pos] = SR.plus(SR.times(alpha, dot), SR.times(beta, dBlockY[pos]));
+		}
+	}
+}
+
+template<typename IndexType_, typename ValueType_>
+cudaError_t csrmm_mp(
+	IndexType_ m,
+	IndexType_ n,
+	IndexType_ nnz,
+	IndexType_ k,
+	ValueType_ alpha,
+	const ValueType_ * dValues,
+	const IndexType_ * dRowOffsets,
+	const IndexType_ * dColIndices,
+	const ValueType_ * dBlockX,
+	ValueType_ beta,
+	ValueType_ * dBlockY,
+	Semiring SR,
+	cudaStream_t stream)
+{
+	if (m <= 0 || k <= 0)
+		return cudaSuccess;
+	const int numThreads = 256;
+	const int numBlocks = static_cast<int>(std::min<size_t>((static_cast<size_t>(m) * 32 + numThreads - 1) / numThreads, 65535));
+	switch(SR)
+	{
+		case PlusTimes:
+		{
+			PlusTimesSemiring<ValueType_> plustimes;
+			csrmm_warp_kernel<<<numBlocks, numThreads, 0, stream>>>(m, k, dRowOffsets, dColIndices, dValues, dBlockX, dBlockY, plustimes, alpha, beta);
+		}
+		break;
+		case MinPlus:
+		{
+			MinPlusSemiring<ValueType_> minplus;
+			csrmm_warp_kernel<<<numBlocks, numThreads, 0, stream>>>(m, k, dRowOffsets, dColIndices, dValues, dBlockX, dBlockY, minplus, alpha, beta);
+		}
+		break;
+		case MaxMin:
+		{
+			MaxMinSemiring<ValueType_> maxmin;
+			csrmm_warp_kernel<<<numBlocks, numThreads, 0, stream>>>(m, k, dRowOffsets, dColIndices, dValues, dBlockX, dBlockY, maxmin, alpha, beta);
+		}
+		break;
+		case OrAndBool:
+		{
+			OrAndBoolSemiring<ValueType_> orandbool;
+			csrmm_warp_kernel<<<numBlocks, numThreads, 0, stream>>>(m, k, dRowOffsets, dColIndices, dValues, dBlockX, dBlockY, orandbool, alpha, beta);
+		}
+		break;
+		case LogPlus:
+		{
+			LogPlusSemiring<ValueType_> logplus;
+			csrmm_warp_kernel<<<numBlocks, numThreads, 0, stream>>>(m, k, dRowOffsets, dColIndices, dValues, dBlockX, dBlockY, logplus, alpha, beta);
+		}
+		break;
+	}
+	return cudaGetLastError();
+}
+
+template cudaError_t csrmm_mp<int, float>(int m, int n, int nnz, int k, float alpha,
+	const float * dValues, const int * dRowOffsets, const int * dColIndices,
+	const float * dBlockX, float beta, float * dBlockY, Semiring SR, cudaStream_t stream);
+template cudaError_t csrmm_mp<int, double>(int m, int n, int nnz, int k, double alpha,
+	const double * dValues, const int * dRowOffsets, const int * dColIndices,
+	const double * dBlockX, double beta, double * dBlockY, Semiring SR, cudaStream_t stream);
+
 //declare template types to be called
 template cudaError_t csrmv_mp<int, double>(
 	int n,
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "graph_coarsening_host.hxx"
+
+#include <algorithm>
+
+// Matching rounds per level (Size2Selector default)
+#define COARSENING_MATCHING_ITER 15
+// Fraction of unmatched vertices below which matching stops
+// (Size2Selector default)
+#define COARSENING_UNMATCHED_TOL 0.05
+
+namespace nvgraph {
+
+  namespace {
+
+    /// Symmetric pseudo-random key of an edge, breaks ties between
+    /// equally heavy edges so that a locally dominant edge always
+    /// exists
+    static inline unsigned long long edgeKey(unsigned long long u,
+                                             unsigned long long v) {
+      unsigned long long x = (u < v) ? (u << 32) | v : (v << 32) | u;
+      x ^= x >> 33;
+      x *= 0xff51afd7ed558ccdULL;
+      x ^= x >> 33;
+      x *= 0xc4ceb9fe1a85ec53ULL;
+      x ^= x >> 33;
+      return x;
+    }
+
+  }
+
+  // =========================================================
+  // Heavy-edge matching
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  IndexType_ heavyEdgeMatching_host(const GraphLevelHost<IndexType_,ValueType_> & G,
+                                    IndexType_ maxVwgt,
+                                    std::vector<IndexType_> & match) {
+    IndexType_ n = G.n;
+    std::vector<ValueType_> degree(n);
+    std::vector<IndexType_> candidate(n);
+    match.assign(n, -1);
+
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for(IndexType_ v=0; v<n; ++v) {
+      ValueType_ d = 0;
+      for(IndexType_ j=G.rowPtr[v]; j<G.rowPtr[v+1]; ++j)
+        if(G.colInd[j] != v)
+          d += G.edge(j);
+      degree[v] = d;
+    }
+
+    IndexType_ nPairs = 0;
+    for(int it=0; it<COARSENING_MATCHING_ITER; ++it) {
+
+      // Most similar unmatched neighbor
+      #pragma omp parallel for schedule(dynamic, 1024)
+      for(IndexType_ v=0; v<n; ++v) {
+        candidate[v] = -1;
+        if(match[v] >= 0)
+          continue;
+        ValueType_ bestSim = -1;
+        unsigned long long bestKey = 0;
+        for(IndexType_ j=G.rowPtr[v]; j<G.rowPtr[v+1]; ++j) {
+          IndexType_ u = G.colInd[j];
+          if(u == v || match[u] >= 0 || G.weight(u)+G.weight(v) > maxVwgt)
+            continue;
+          ValueType_ dmax = std::max(degree[v], degree[u]);
+          ValueType_ sim = (dmax > 0) ? G.edge(j)/dmax : 0;
+          unsigned long long key = edgeKey(u, v);
+          if(sim > bestSim || (sim == bestSim && key > bestKey)) {
+            bestSim = sim;
+            bestKey = key;
+            candidate[v] = u;
+          }
+        }
+      }
+
+      // Match mutual candidates
+      IndexType_ newPairs = 0;
+      #pragma omp parallel for schedule(static) reduction(+:newPairs)
+      for(IndexType_ v=0; v<n; ++v) {
+        IndexType_ u = candidate[v];
+        if(u >= 0 && candidate[u] == v) {
+          match[v] = u;
+          if(v < u)
+            ++newPairs;
+        }
+      }
+      nPairs += newPairs;
+      if(newPairs == 0 || n-2*nPairs < COARSENING_UNMATCHED_TOL*n)
+        break;
+    }
+    return nPairs;
+  }
+
+  // =========================================================
+  // Contraction
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  void contractGraph_host(GraphLevelHost<IndexType_,ValueType_> & G,
+                          const std::vector<IndexType_> & match,
+                          GraphLevelHost<IndexType_,ValueType_> & C) {
+    IndexType_ n = G.n;
+
+    // Number coarse vertices after the first vertex of each pair
+    G.coarse.resize(n);
+    std::vector<IndexType_> first;
+    for(IndexType_ v=0; v<n; ++v) {
+      if(match[v] < 0 || v < match[v]) {
+        G.coarse[v] = first.size();
+        first.push_back(v);
+      }
+    }
+    IndexType_ nc = first.size();
+    for(IndexType_ v=0; v<n; ++v)
+      if(match[v] >= 0 && v > match[v])
+        G.coarse[v] = G.coarse[match[v]];
+
+    C.n = nc;
+    C.vwgt.resize(nc);
+    C.rowPtr_s.assign(nc+1, 0);
+    for(IndexType_ c=0; c<nc; ++c) {
+      IndexType_ v = first[c];
+      C.vwgt[c] = G.weight(v) + ((match[v] >= 0) ? G.weight(match[v]) : 0);
+    }
+
+    #pragma omp parallel
+    {
+      std::vector<IndexType_> owner(nc, -1);
+      std::vector<IndexType_> pos(nc);
+
+      // Count distinct coarse neighbors
+      #pragma omp for schedule(dynamic, 256)
+      for(IndexType_ c=0; c<nc; ++c) {
+        IndexType_ count = 0;
+        IndexType_ members[2] = {first[c], match[first[c]]};
+        for(int m=0; m<2 && members[m]>=0; ++m) {
+          IndexType_ v = members[m];
+          for(IndexType_ j=G.rowPtr[v]; j<G.rowPtr[v+1]; ++j) {
+            IndexType_ cu = G.coarse[G.colInd[j]];
+            if(cu != c && owner[cu] != c) {
+              owner[cu] = c;
+              ++count;
+            }
+          }
+        }
+        C.rowPtr_s[c+1] = count;
+      }
+
+      #pragma omp single
+      {
+        for(IndexType_ c=0; c<nc; ++c)
+          C.rowPtr_s[c+1] += C.rowPtr_s[c];
+        C.colInd_s.resize(C.rowPtr_s[nc]);
+        C.val_s.resize(C.rowPtr_s[nc]);
+      }
+
+      // Merge parallel edges
+      std::fill(owner.begin(), owner.end(), -1);
+      #pragma omp for schedule(dynamic, 256)
+      for(IndexType_ c=0; c<nc; ++c) {
+        IndexType_ k = C.rowPtr_s[c];
+        IndexType_ members[2] = {first[c], match[first[c]]};
+        for(int m=0; m<2 && members[m]>=0; ++m) {
+          IndexType_ v = members[m];
+          for(IndexType_ j=G.rowPtr[v]; j<G.rowPtr[v+1]; ++j) {
+            IndexType_ cu = G.coarse[G.colInd[j]];
+            if(cu == c)
+              continue;
+            if(owner[cu] != c) {
+              owner[cu] = c;
+              pos[cu] = k;
+              C.colInd_s[k] = cu;
+              C.val_s[k] = G.edge(j);
+              ++k;
+            }
+            else
+              C.val_s[pos[cu]] += G.edge(j);
+          }
+        }
+      }
+    }
+
+    C.rowPtr = &C.rowPtr_s[0];
+    C.colInd = C.colInd_s.empty() ? NULL : &C.colInd_s[0];
+    C.val = C.val_s.empty() ? NULL : &C.val_s[0];
+  }
+
+  // =========================================================
+  // Explicit instantiation
+  // =========================================================
+
+  template int heavyEdgeMatching_host<int,float>
+  (const GraphLevelHost<int,float> & G, int maxVwgt, std::vector<int> & match);
+  template int heavyEdgeMatching_host<int,double>
+  (const GraphLevelHost<int,double> & G, int maxVwgt, std::vector<int> & match);
+  template void contractGraph_host<int,float>
+  (GraphLevelHost<int,float> & G, const std::vector<int> & match, GraphLevelHost<int,float> & C);
+  template void contractGraph_host<int,double>
+  (GraphLevelHost<int,double> & G, const std::vector<int> & match, GraphLevelHost<int,double> & C);
+
+}
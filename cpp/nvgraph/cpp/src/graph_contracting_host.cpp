@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <vector>
+#include "nvgraph_error.hxx"
+#include "graph_contracting_host.hxx"
+
+namespace nvgraph
+{
+namespace
+{
+// a (op) b, the host counterpart of SemiRingFctrSelector
+template <typename ValueType>
+inline ValueType semiring_op(nvgraphSemiringOps_t op, ValueType a, ValueType b)
+{
+    switch (op)
+    {
+        case NVGRAPH_MULTIPLY: return a * b;
+        case NVGRAPH_SUM:      return a + b;
+        case NVGRAPH_MIN:      return (b < a) ? b : a;
+        default:               return (a < b) ? b : a;
+    }
+}
+
+inline bool valid_semiring_op(nvgraphSemiringOps_t op)
+{
+    return op == NVGRAPH_MULTIPLY || op == NVGRAPH_SUM || op == NVGRAPH_MIN || op == NVGRAPH_MAX;
+}
+} // end anonymous namespace
+
+template <typename IndexType_, typename ValueType_>
+GraphContractionHost<IndexType_, ValueType_>::GraphContractionHost(IndexType n, IndexType nnz,
+                                                                   const IndexType* csr_offsets,
+                                                                   const IndexType* csr_indices,
+                                                                   const IndexType* aggregates,
+                                                                   size_t aggregates_size,
+                                                                   nvgraphSemiringOps_t v_combine,
+                                                                   nvgraphSemiringOps_t v_reduce,
+                                                                   nvgraphSemiringOps_t e_combine,
+                                                                   nvgraphSemiringOps_t e_reduce)
+    : m_n(n), m_nnz(nnz), m_row_offsets(csr_offsets), m_col_indices(csr_indices), m_n_aggregates(0),
+      m_v_combine(v_combine), m_v_reduce(v_reduce), m_e_combine(e_combine), m_e_reduce(e_reduce)
+{
+    if (n < 0 || nnz < 0 || csr_offsets == NULL || (nnz > 0 && csr_indices == NULL))
+        FatalError("Wrong input in host graph contraction.", NVGRAPH_ERR_BAD_PARAMETERS);
+    if (!valid_semiring_op(v_combine) || !valid_semiring_op(v_reduce) ||
+        !valid_semiring_op(e_combine) || !valid_semiring_op(e_reduce))
+        FatalError("Unknown semiring operator in host graph contraction.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // same checks as validate_contractor_input()
+    if (aggregates_size == 0 || aggregates == NULL)
+        FatalError("0-sized array input in graph contraction.", NVGRAPH_ERR_BAD_PARAMETERS);
+    if (aggregates_size != static_cast<size_t>(n))
+        FatalError("Aggregate array size must match number of vertices of original graph", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    IndexType min_agg = *std::min_element(aggregates, aggregates + n);
+    IndexType max_agg = *std::max_element(aggregates, aggregates + n);
+    if (min_agg != 0)
+        FatalError("Aggregate array values must start from 0.", NVGRAPH_ERR_BAD_PARAMETERS);
+    if (max_agg > n - 1)
+        FatalError("Aggregate array values must be less than number of vertices of original graph.", NVGRAPH_ERR_BAD_PARAMETERS);
+    m_n_aggregates = max_agg + 1;
+
+    // S by counting sort: the vertices of an aggregate stay in increasing order,
+    // as after the (stable) sort_by_key of computeRestrictionOperator()
+    m_aggregates.assign(aggregates, aggregates + n);
+    m_R_row_offsets.assign(m_n_aggregates + 1, 0);
+    m_R_column_indices.resize(n);
+    for (IndexType v = 0; v < n; v++)
+        m_R_row_offsets[m_aggregates[v] + 1]++;
+    for (IndexType a = 0; a < m_n_aggregates; a++)
+    {
+        if (m_R_row_offsets[a + 1] == 0)
+            FatalError("Aggregate array intermediate values (between 0 and max(aggregates)) are missing.", NVGRAPH_ERR_BAD_PARAMETERS);
+        m_R_row_offsets[a + 1] += m_R_row_offsets[a];
+    }
+    std::vector<IndexType> pos(m_R_row_offsets.begin(), m_R_row_offsets.end() - 1);
+    for (IndexType v = 0; v < n; v++)
+        m_R_column_indices[pos[m_aggregates[v]]++] = v;
+}
+
+template <typename IndexType_, typename ValueType_>
+NVGRAPH_ERROR GraphContractionHost<IndexType_, ValueType_>::contract(size_t n_edge_dims,
+                                                                     const ValueType* const* edge_data,
+                                                                     std::vector<std::vector<ValueType> >& cg_edge_data)
+{
+    const IndexType n = m_n;
+    const IndexType n_agg = m_n_aggregates;
+    const size_t nd = n_edge_dims;
+    if (nd > 0 && m_nnz > 0 && edge_data == NULL)
+        FatalError("Wrong input in host graph contraction.", NVGRAPH_ERR_BAD_PARAMETERS);
+    for (size_t d = 0; d < nd && m_nnz > 0; d++)
+        if (edge_data[d] == NULL)
+            FatalError("Wrong input in host graph contraction.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    m_cg_row_offsets.assign(n_agg + 1, 0);
+    cg_edge_data.resize(nd);
+
+    #pragma omp parallel
+    {
+        // dense accumulators of the row being built, owner[] tells which row wrote the slot last
+        std::vector<IndexType> owner(n, -1);     // columns of S*G (vertices)
+        std::vector<IndexType> pos(n);
+        std::vector<IndexType> owner_c(n_agg, -1); // columns of S*G*S' (aggregates)
+        std::vector<IndexType> pos_c(n_agg);
+        std::vector<IndexType> touched;          // non-zero columns of the current row of S*G
+        std::vector<ValueType> L;                // and their values, nd per column
+        std::vector<char> seen;
+
+        // count the distinct aggregates reached from each aggregate
+        #pragma omp for schedule(dynamic, 256)
+        for (IndexType a = 0; a < n_agg; a++)
+        {
+            IndexType count = 0;
+            for (IndexType r = m_R_row_offsets[a]; r < m_R_row_offsets[a + 1]; r++)
+            {
+                IndexType v = m_R_column_indices[r];
+                for (IndexType j = m_row_offsets[v]; j < m_row_offsets[v + 1]; j++)
+                {
+                    IndexType c = m_aggregates[m_col_indices[j]];
+                    if (owner_c[c] != a)
+                    {
+                        owner_c[c] = a;
+                        count++;
+                    }
+                }
+            }
+            m_cg_row_offsets[a + 1] = count;
+        }
+
+        #pragma omp single
+        {
+            for (IndexType a = 0; a < n_agg; a++)
+                m_cg_row_offsets[a + 1] += m_cg_row_offsets[a];
+            m_cg_col_indices.resize(m_cg_row_offsets[n_agg]);
+            for (size_t d = 0; d < nd; d++)
+                cg_edge_data[d].resize(m_cg_row_offsets[n_agg]);
+        }
+
+        std::fill(owner_c.begin(), owner_c.end(), -1);
+        #pragma omp for schedule(dynamic, 256)
+        for (IndexType a = 0; a < n_agg; a++)
+        {
+            // row a of L = S*G: reduce the edges of the vertices of a, per end vertex
+            touched.clear();
+            L.clear();
+            for (IndexType r = m_R_row_offsets[a]; r < m_R_row_offsets[a + 1]; r++)
+            {
+                IndexType v = m_R_column_indices[r];
+                for (IndexType j = m_row_offsets[v]; j < m_row_offsets[v + 1]; j++)
+                {
+                    IndexType k = m_col_indices[j];
+                    if (owner[k] != a)
+                    {
+                        owner[k] = a;
+                        pos[k] = touched.size();
+                        touched.push_back(k);
+                        for (size_t d = 0; d < nd; d++)
+                            L.push_back(semiring_op(m_e_combine, ValueType(1), edge_data[d][j]));
+                    }
+                    else
+                    {
+                        ValueType* l = &L[pos[k] * nd];
+                        for (size_t d = 0; d < nd; d++)
+                            l[d] = semiring_op(m_e_reduce, l[d], semiring_op(m_e_combine, ValueType(1), edge_data[d][j]));
+                    }
+                }
+            }
+
+            // row a of L*S': columns sorted like the device SpGEMM output
+            IndexType begin = m_cg_row_offsets[a];
+            IndexType len = m_cg_row_offsets[a + 1] - begin;
+            IndexType* cols = len > 0 ? &m_cg_col_indices[begin] : NULL;
+            IndexType count = 0;
+            for (size_t t = 0; t < touched.size(); t++)
+            {
+                IndexType c = m_aggregates[touched[t]];
+                if (owner_c[c] != a)
+                {
+                    owner_c[c] = a;
+                    cols[count++] = c;
+                }
+            }
+            std::sort(cols, cols + len);
+            for (IndexType i = 0; i < len; i++)
+                pos_c[cols[i]] = i;
+
+            if (nd == 0)
+                continue;
+            seen.assign(len, 0);
+            for (size_t t = 0; t < touched.size(); t++)
+            {
+                IndexType i = pos_c[m_aggregates[touched[t]]];
+                const ValueType* l = &L[t * nd];
+                for (size_t d = 0; d < nd; d++)
+                {
+                    ValueType x = semiring_op(m_e_combine, l[d], ValueType(1));
+                    ValueType& y = cg_edge_data[d][begin + i];
+                    y = seen[i] ? semiring_op(m_e_reduce, y, x) : x;
+                }
+                seen[i] = 1;
+            }
+        }
+    }
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType_, typename ValueType_>
+void GraphContractionHost<IndexType_, ValueType_>::contract_vertex_data(const ValueType* vertex_data,
+                                                                        ValueType* cg_vertex_data) const
+{
+    if (vertex_data == NULL || cg_vertex_data == NULL)
+        FatalError("Wrong input in host graph contraction.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    #pragma omp parallel for schedule(static)
+    for (IndexType a = 0; a < m_n_aggregates; a++)
+    {
+        ValueType y = 0;
+        for (IndexType r = m_R_row_offsets[a]; r < m_R_row_offsets[a + 1]; r++)
+            y = semiring_op(m_v_reduce, y, semiring_op(m_v_combine, ValueType(1), vertex_data[m_R_column_indices[r]]));
+        cg_vertex_data[a] = y;
+    }
+}
+
+template class GraphContractionHost<int, float>;
+template class GraphContractionHost<int, double>;
+
+} // end namespace nvgraph
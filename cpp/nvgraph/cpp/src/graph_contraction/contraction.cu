@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <graph_contracting_dispatch.hxx>
+#include <debug_macros.h>
+
+#include <vector>
+#include <thrust/device_vector.h>
+#include <thrust/device_ptr.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/binary_search.h>
+#include <thrust/sort.h>
+#include <thrust/scan.h>
+#include <thrust/unique.h>
+#include <thrust/inner_product.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+#include <thrust/for_each.h>
+
+namespace nvgraph
+{
+namespace{ //unnamed..
+
+  typedef unsigned long long KeyT;
+
+  //key of edge e: (aggregate of its source, its destination), row major
+  //
+  template<typename IndexT>
+  struct EdgeKeyFctr
+  {
+    const IndexT* rows;
+    const IndexT* cols;
+    const IndexT* aggregates;
+    KeyT n;
+
+    __host__ __device__ KeyT operator()(IndexT e) const
+    {
+      return static_cast<KeyT>(aggregates[rows[e]])*n + cols[e];
+    }
+  };
+
+  //key of entry (i,k) of S*G: (i, aggregate of k), row major
+  //
+  template<typename IndexT>
+  struct PartialKeyFctr
+  {
+    const IndexT* aggregates;
+    KeyT n;
+    KeyT n_aggregates;
+
+    __host__ __device__ KeyT operator()(KeyT key) const
+    {
+      return (key/n)*n_aggregates + aggregates[key%n];
+    }
+  };
+
+  struct KeyColumnFctr
+  {
+    KeyT n_cols;
+
+    __host__ __device__ KeyT operator()(KeyT key) const
+    {
+      return key%n_cols;
+    }
+  };
+
+  struct KeyRowStartFctr
+  {
+    KeyT n_cols;
+
+    __host__ __device__ KeyT operator()(KeyT row) const
+    {
+      return row*n_cols;
+    }
+  };
+
+  //key of input i of a fused reduce_by_key over n_sets sets of n_in values:
+  //(set, segment of the value in the set)
+  //
+  template<typename IndexT>
+  struct SegmentKeyFctr
+  {
+    const IndexT* seg;
+    size_t n_in;
+    size_t n_out;
+
+    __host__ __device__ size_t operator()(size_t i) const
+    {
+      return (i/n_in)*n_out + seg[i%n_in];
+    }
+  };
+
+  //input i of a fused reduce_by_key: combine(1, src[set][perm[p]]),
+  //the matrices S and St only hold ones
+  //(all the semiring operators are commutative);
+  //if InitZero the first value of each segment is reduced with 0 first,
+  //like cusp SpMV that starts from y = 0
+  //
+  template<typename IndexT, typename ValueT, typename CombineT, typename ReduceT, bool InitZero>
+  struct GatherCombineFctr
+  {
+    ValueT* const* src;
+    const IndexT* perm;
+    const IndexT* seg;
+    size_t n_in;
+    CombineT combine;
+    ReduceT reduce;
+
+    __host__ __device__ ValueT operator()(size_t i) const
+    {
+      size_t p = i%n_in;
+      ValueT x = combine(ValueT(1), src[i/n_in][perm[p]]);
+      if( InitZero && (p == 0 || seg[p] != seg[p-1]) )
+        x = reduce(ValueT(0), x);
+      return x;
+    }
+  };
+
+  //dst[set][j] = result of a fused reduce_by_key
+  //
+  template<typename ValueT>
+  struct ScatterFctr
+  {
+    ValueT* const* dst;
+    const ValueT* res;
+    size_t n_out;
+
+    __host__ __device__ void operator()(size_t i) const
+    {
+      dst[i/n_out][i%n_out] = res[i];
+    }
+  };
+
+  //seg[p] = number of distinct keys in keys[0..p) ; returns number of distinct keys
+  //
+  template<typename IndexT>
+  size_t make_segments(const thrust::device_vector<KeyT>& keys,
+                       thrust::device_vector<IndexT>& seg)
+  {
+    size_t n = keys.size();
+    seg.resize(n);
+    if( n == 0 )
+      return 0;
+    seg[0] = 0;
+    thrust::transform(keys.begin()+1, keys.end(), keys.begin(), seg.begin()+1, thrust::not_equal_to<KeyT>());
+    thrust::inclusive_scan(seg.begin(), seg.end(), seg.begin());
+    cudaCheckError();
+    return static_cast<size_t>(seg.back()) + 1;
+  }
+
+  //Sparsity of the contraction, shared by every vertex and edge set:
+  //
+  template<typename IndexT>
+  struct ContractionPattern
+  {
+    size_t n;
+    size_t nnz;
+    size_t n_aggregates;
+    thrust::device_vector<IndexT> aggregates;
+
+    //S*v: vertices sorted by aggregate and their aggregate
+    thrust::device_vector<IndexT> vertex_perm;
+    thrust::device_vector<IndexT> vertex_seg;
+
+    //S*G: edges sorted by (aggregate of source, destination) and their entry in S*G
+    thrust::device_vector<IndexT> edge_perm;
+    thrust::device_vector<IndexT> edge_seg;
+    size_t n_partial;
+
+    //(S*G)*St: entries of S*G sorted by (row, aggregate of column) and their entry in S*G*St
+    thrust::device_vector<IndexT> partial_perm;
+    thrust::device_vector<IndexT> partial_seg;
+
+    //S*G*St:
+    thrust::device_vector<IndexT> row_offsets;
+    thrust::device_vector<IndexT> col_indices;
+
+    ContractionPattern(CsrGraph<IndexT>& graph, const IndexT* h_aggregates, size_t sz_aggregates):
+      n(graph.get_num_vertices()),
+      nnz(graph.get_num_edges()),
+      n_aggregates(0),
+      n_partial(0)
+    {
+      //same checks as validate_contractor_input():
+      //
+      if( sz_aggregates == 0 )
+        FatalError("0-sized array input in graph contraction.",NVGRAPH_ERR_BAD_PARAMETERS);
+      if( sz_aggregates != n )
+        FatalError("Aggregate array size must match number of vertices of original graph",NVGRAPH_ERR_BAD_PARAMETERS);
+
+      aggregates.assign(h_aggregates, h_aggregates+n);
+      vertex_seg = aggregates;
+      vertex_perm.resize(n);
+      thrust::sequence(vertex_perm.begin(), vertex_perm.end());
+      thrust::stable_sort_by_key(vertex_seg.begin(), vertex_seg.end(), vertex_perm.begin());
+      cudaCheckError();
+
+      IndexT agg_min = vertex_seg.front();
+      IndexT agg_max = vertex_seg.back();
+      if( agg_min != 0 )
+        FatalError("Aggregate array values must start from 0.",NVGRAPH_ERR_BAD_PARAMETERS);
+      if( static_cast<size_t>(agg_max) > n-1 )
+        FatalError("Aggregate array values must be less than number of vertices of original graph.",NVGRAPH_ERR_BAD_PARAMETERS);
+      size_t counts = thrust::inner_product(vertex_seg.begin(), vertex_seg.end()-1,
+                                            vertex_seg.begin()+1,
+                                            size_t(1),
+                                            thrust::plus<size_t>(),
+                                            thrust::not_equal_to<IndexT>());
+      cudaCheckError();
+      if( counts != static_cast<size_t>(agg_max)+1 )
+        FatalError("Aggregate array intermediate values (between 0 and max(aggregates)) are missing.",NVGRAPH_ERR_BAD_PARAMETERS);
+      n_aggregates = counts;
+
+      row_offsets.assign(n_aggregates+1, 0);
+      if( nnz == 0 )
+        return;
+
+      //S*G:
+      //
+      thrust::device_ptr<IndexT> g_row_offsets(graph.get_raw_row_offsets());
+      thrust::device_vector<IndexT> rows(nnz);
+      thrust::upper_bound(g_row_offsets+1, g_row_offsets+n+1,
+                          thrust::counting_iterator<IndexT>(0),
+                          thrust::counting_iterator<IndexT>(nnz),
+                          rows.begin());
+
+      EdgeKeyFctr<IndexT> edge_key = {rows.data().get(), graph.get_raw_column_indices(), aggregates.data().get(), n};
+      thrust::device_vector<KeyT> keys(nnz);
+      thrust::transform(thrust::counting_iterator<IndexT>(0),
+                        thrust::counting_iterator<IndexT>(nnz),
+                        keys.begin(),
+                        edge_key);
+      edge_perm.resize(nnz);
+      thrust::sequence(edge_perm.begin(), edge_perm.end());
+      //stable: the edges of an entry stay in increasing source order, like the cusp SpGEMM products
+      thrust::stable_sort_by_key(keys.begin(), keys.end(), edge_perm.begin());
+      cudaCheckError();
+
+      n_partial = make_segments(keys, edge_seg);
+      thrust::device_vector<KeyT> partial_keys(n_partial);
+      thrust::unique_copy(keys.begin(), keys.end(), partial_keys.begin());
+      cudaCheckError();
+
+      //(S*G)*St:
+      //
+      PartialKeyFctr<IndexT> partial_key = {aggregates.data().get(), n, n_aggregates};
+      keys.resize(n_partial);
+      thrust::transform(partial_keys.begin(), partial_keys.end(), keys.begin(), partial_key);
+      partial_perm.resize(n_partial);
+      thrust::sequence(partial_perm.begin(), partial_perm.end());
+      thrust::stable_sort_by_key(keys.begin(), keys.end(), partial_perm.begin());
+      cudaCheckError();
+
+      size_t cg_nnz = make_segments(keys, partial_seg);
+      thrust::device_vector<KeyT> cg_keys(cg_nnz);
+      thrust::unique_copy(keys.begin(), keys.end(), cg_keys.begin());
+
+      KeyColumnFctr key_column = {n_aggregates};
+      col_indices.resize(cg_nnz);
+      thrust::transform(cg_keys.begin(), cg_keys.end(), col_indices.begin(), key_column);
+
+      KeyRowStartFctr row_start = {n_aggregates};
+      thrust::lower_bound(cg_keys.begin(), cg_keys.end(),
+                          thrust::make_transform_iterator(thrust::counting_iterator<KeyT>(0), row_start),
+                          thrust::make_transform_iterator(thrust::counting_iterator<KeyT>(n_aggregates+1), row_start),
+                          row_offsets.begin());
+      cudaCheckError();
+    }
+
+    void copy_topology(CsrGraph<IndexT>& dst) const
+    {
+      thrust::copy(row_offsets.begin(), row_offsets.end(), thrust::device_pointer_cast(dst.get_raw_row_offsets()));
+      thrust::copy(col_indices.begin(), col_indices.end(), thrust::device_pointer_cast(dst.get_raw_column_indices()));
+      cudaCheckError();
+    }
+  };
+
+  //reduce n_sets sets of n_in values into n_sets sets of n_out values in one pass:
+  //out[set*n_out + seg[p]] = reduce over p of combine(1, src[set][perm[p]])
+  //
+  template<typename IndexT, typename ValueT, typename CombineT, typename ReduceT, bool InitZero>
+  void fused_reduce_by_key(size_t n_in,
+                           size_t n_out,
+                           const thrust::device_vector<ValueT*>& src,
+                           const thrust::device_vector<IndexT>& perm,
+                           const thrust::device_vector<IndexT>& seg,
+                           thrust::device_vector<ValueT>& out)
+  {
+    size_t n_sets = src.size();
+    out.resize(n_sets*n_out);
+
+    SegmentKeyFctr<IndexT> key = {seg.data().get(), n_in, n_out};
+    GatherCombineFctr<IndexT, ValueT, CombineT, ReduceT, InitZero> value =
+      {src.data().get(), perm.data().get(), seg.data().get(), n_in, CombineT(), ReduceT()};
+    thrust::counting_iterator<size_t> first(0);
+
+    thrust::reduce_by_key(thrust::make_transform_iterator(first, key),
+                          thrust::make_transform_iterator(first + n_sets*n_in, key),
+                          thrust::make_transform_iterator(first, value),
+                          thrust::make_discard_iterator(),
+                          out.begin(),
+                          thrust::equal_to<size_t>(),
+                          ReduceT());
+    cudaCheckError();
+  }
+
+  template<typename ValueT>
+  void scatter_sets(const thrust::device_vector<ValueT>& res,
+                    size_t n_out,
+                    const thrust::device_vector<ValueT*>& dst)
+  {
+    ScatterFctr<ValueT> scatter = {dst.data().get(), res.data().get(), n_out};
+    thrust::for_each(thrust::counting_iterator<size_t>(0),
+                     thrust::counting_iterator<size_t>(res.size()),
+                     scatter);
+    cudaCheckError();
+  }
+
+  //Vertex sets: S*v, for all sets at once
+  //
+  template<typename IndexT, typename ValueT>
+  struct VertexDataReducer
+  {
+    const ContractionPattern<IndexT>& pattern;
+    thrust::device_vector<ValueT*> src;
+    thrust::device_vector<ValueT*> dst;
+
+    VertexDataReducer(const ContractionPattern<IndexT>& p): pattern(p) {}
+
+    template<typename CombineTag, typename ReduceTag>
+    void apply(void)
+    {
+      typedef typename SemiRingFctrSelector<CombineTag::value, ValueT>::FctrType CombineT;
+      typedef typename SemiRingFctrSelector<ReduceTag::value, ValueT>::FctrType ReduceT;
+
+      if( src.empty() )
+        return;
+
+      thrust::device_vector<ValueT> y;
+      fused_reduce_by_key<IndexT, ValueT, CombineT, ReduceT, true>(pattern.n, pattern.n_aggregates,
+                                                                   src, pattern.vertex_perm, pattern.vertex_seg, y);
+      scatter_sets(y, pattern.n_aggregates, dst);
+    }
+  };
+
+  //Edge sets: (S*G)*St, for all sets at once
+  //
+  template<typename IndexT, typename ValueT>
+  struct EdgeDataReducer
+  {
+    const ContractionPattern<IndexT>& pattern;
+    thrust::device_vector<ValueT*> src;
+    thrust::device_vector<ValueT*> dst;
+
+    EdgeDataReducer(const ContractionPattern<IndexT>& p): pattern(p) {}
+
+    template<typename CombineTag, typename ReduceTag>
+    void apply(void)
+    {
+      typedef typename SemiRingFctrSelector<CombineTag::value, ValueT>::FctrType CombineT;
+      typedef typename SemiRingFctrSelector<ReduceTag::value, ValueT>::FctrType ReduceT;
+
+      size_t n_sets = src.size();
+      if( n_sets == 0 || pattern.n_partial == 0 )
+        return;
+
+      //L = S*G:
+      thrust::device_vector<ValueT> L;
+      fused_reduce_by_key<IndexT, ValueT, CombineT, ReduceT, false>(pattern.nnz, pattern.n_partial,
+                                                                    src, pattern.edge_perm, pattern.edge_seg, L);
+
+      //R = L*St:
+      std::vector<ValueT*> h_L_sets(n_sets);
+      for(size_t i=0;i<n_sets;++i)
+        h_L_sets[i] = L.data().get() + i*pattern.n_partial;
+      thrust::device_vector<ValueT*> L_sets(h_L_sets.begin(), h_L_sets.end());
+
+      thrust::device_vector<ValueT> R;
+      fused_reduce_by_key<IndexT, ValueT, CombineT, ReduceT, false>(pattern.n_partial, pattern.col_indices.size(),
+                                                                    L_sets, pattern.partial_perm, pattern.partial_seg, R);
+      scatter_sets(R, pattern.col_indices.size(), dst);
+    }
+  };
+}//end unnamed namespace
+
+  template<typename IndexT>
+  CsrGraph<IndexT>* contract_graph(CsrGraph<IndexT>& graph,
+                                   IndexT* aggregates,
+                                   size_t n,
+                                   cudaStream_t stream)
+  {
+    ContractionPattern<IndexT> pattern(graph, aggregates, n);
+
+    CsrGraph<IndexT>* contracted_graph = new CsrGraph<IndexT>(pattern.n_aggregates, pattern.col_indices.size(), stream);
+    pattern.copy_topology(*contracted_graph);
+    return contracted_graph;
+  }
+
+  template<typename IndexT, typename ValueT>
+  MultiValuedCsrGraph<IndexT, ValueT>* contract_graph(MultiValuedCsrGraph<IndexT, ValueT>& graph,
+                                                      IndexT* aggregates,
+                                                      size_t n,
+                                                      cudaStream_t stream,
+                                                      SemiRingFunctorTypes VCombine,
+                                                      SemiRingFunctorTypes VReduce,
+                                                      SemiRingFunctorTypes ECombine,
+                                                      SemiRingFunctorTypes EReduce)
+  {
+    ContractionPattern<IndexT> pattern(graph, aggregates, n);
+
+    //There can be a contracted graph with no edges,
+    //but such a case warrants a warning:
+    //
+    if( pattern.col_indices.empty() )
+      WARNING("Contracted graph is disjointed (no edges)");
+
+    MultiValuedCsrGraph<IndexT, ValueT>* contracted_graph =
+      new MultiValuedCsrGraph<IndexT, ValueT>(pattern.n_aggregates, pattern.col_indices.size(), stream);
+    try
+    {
+      pattern.copy_topology(*contracted_graph);
+
+      size_t n_vertex_sets = graph.get_num_vertex_dim();
+      size_t n_edge_sets = graph.get_num_edge_dim();
+      contracted_graph->allocateVertexData(n_vertex_sets, stream);
+      contracted_graph->allocateEdgeData(n_edge_sets, stream);
+
+      std::vector<ValueT*> h_src(n_vertex_sets), h_dst(n_vertex_sets);
+      for(size_t i=0;i<n_vertex_sets;++i)
+      {
+        h_src[i] = graph.get_raw_vertex_dim(i);
+        h_dst[i] = contracted_graph->get_raw_vertex_dim(i);
+      }
+      VertexDataReducer<IndexT, ValueT> vertex_reducer(pattern);
+      vertex_reducer.src.assign(h_src.begin(), h_src.end());
+      vertex_reducer.dst.assign(h_dst.begin(), h_dst.end());
+      dispatch_semiring(VCombine, VReduce, vertex_reducer);
+
+      h_src.resize(n_edge_sets);
+      h_dst.resize(n_edge_sets);
+      for(size_t i=0;i<n_edge_sets;++i)
+      {
+        h_src[i] = graph.get_raw_edge_dim(i);
+        h_dst[i] = contracted_graph->get_raw_edge_dim(i);
+      }
+      EdgeDataReducer<IndexT, ValueT> edge_reducer(pattern);
+      edge_reducer.src.assign(h_src.begin(), h_src.end());
+      edge_reducer.dst.assign(h_dst.begin(), h_dst.end());
+      dispatch_semiring(ECombine, EReduce, edge_reducer);
+    }
+    catch(...)
+    {
+      delete contracted_graph;
+      throw;
+    }
+    return contracted_graph;
+  }
+
+  template CsrGraph<int>* contract_graph<int>(CsrGraph<int>& graph,
+                                              int* aggregates,
+                                              size_t n,
+                                              cudaStream_t stream);
+
+  template MultiValuedCsrGraph<int, float>* contract_graph<int, float>(MultiValuedCsrGraph<int, float>& graph,
+                                                                       int* aggregates,
+                                                                       size_t n,
+                                                                       cudaStream_t stream,
+                                                                       SemiRingFunctorTypes VCombine,
+                                                                       SemiRingFunctorTypes VReduce,
+                                                                       SemiRingFunctorTypes ECombine,
+                                                                       SemiRingFunctorTypes EReduce);
+
+  template MultiValuedCsrGraph<int, double>* contract_graph<int, double>(MultiValuedCsrGraph<int, double>& graph,
+                                                                         int* aggregates,
+                                                                         size_t n,
+                                                                         cudaStream_t stream,
+                                                                         SemiRingFunctorTypes VCombine,
+                                                                         SemiRingFunctorTypes VReduce,
+                                                                         SemiRingFunctorTypes ECombine,
+                                                                         SemiRingFunctorTypes EReduce);
+}
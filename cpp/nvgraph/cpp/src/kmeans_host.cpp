@@ -0,0 +1,767 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "kmeans_host.hxx"
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "debug_macros.h"
+
+// =========================================================
+// Useful macros
+// =========================================================
+
+// Number of fixed work chunks, random draws only depend on the
+// chunk so results do not depend on the number of threads
+#define KMEANS_HOST_CHUNKS 256
+
+// Get index of matrix entry
+#define IDX(i,j,lda) ((i)+(j)*(lda))
+
+namespace {
+
+  // =========================================================
+  // Helper functions
+  // =========================================================
+
+  /// Square of the Euclidean distance between two vectors
+  template <typename IndexType_, typename ValueType_> static inline
+  ValueType_ dist2(IndexType_ d,
+                   const ValueType_ * __restrict__ x,
+                   const ValueType_ * __restrict__ y) {
+    ValueType_ s = 0;
+    #pragma omp simd reduction(+:s)
+    for(IndexType_ j=0; j<d; ++j) {
+      ValueType_ t = x[j]-y[j];
+      s += t*t;
+    }
+    return s;
+  }
+
+  /// Choose initial cluster centroids for k-means algorithm
+  /** Centroids are randomly chosen with k-means++ algorithm. The
+   *  observation vectors are split in fixed chunks, each pass
+   *  updates the distance to the closest centroid and draws a
+   *  candidate per chunk with weighted reservoir sampling, the next
+   *  centroid is the candidate of a chunk drawn proportionally to
+   *  the chunk sums.
+   *
+   *  @param n Number of observation vectors.
+   *  @param d Dimension of observation vectors.
+   *  @param k Number of clusters.
+   *  @param obs (Input, d*n entries) Observation matrix.
+   *  @param centroids (Output, d*k entries) Centroid matrix.
+   */
+  template <typename IndexType_, typename ValueType_> static
+  void initializeCentroids(IndexType_ n, IndexType_ d, IndexType_ k,
+                           const ValueType_ * __restrict__ obs,
+                           ValueType_ * __restrict__ centroids) {
+
+    std::vector<ValueType_> dists(n, std::numeric_limits<ValueType_>::max());
+    std::vector<double> chunkSums(KMEANS_HOST_CHUNKS);
+    std::vector<IndexType_> chunkPicks(KMEANS_HOST_CHUNKS);
+    std::mt19937_64 rng(123456);
+    std::uniform_real_distribution<double> uniformDist(0,1);
+
+    // First centroid is chosen uniformly
+    IndexType_ obsIndex = static_cast<IndexType_>(rng() % n);
+    std::copy(obs+IDX(0,obsIndex,d), obs+IDX(0,obsIndex+1,d), centroids);
+
+    for(IndexType_ c=1; c<k; ++c) {
+      const ValueType_ * last = centroids+IDX(0,c-1,d);
+
+      #pragma omp parallel for schedule(dynamic, 1)
+      for(int chunk=0; chunk<KMEANS_HOST_CHUNKS; ++chunk) {
+        std::mt19937_64 gen(123456 + static_cast<uint64_t>(c)*KMEANS_HOST_CHUNKS + chunk);
+        std::uniform_real_distribution<double> draw(0,1);
+        IndexType_ begin = static_cast<IndexType_>(static_cast<int64_t>(n)*chunk/KMEANS_HOST_CHUNKS);
+        IndexType_ end = static_cast<IndexType_>(static_cast<int64_t>(n)*(chunk+1)/KMEANS_HOST_CHUNKS);
+        double sum = 0;
+        IndexType_ pick = begin;
+        for(IndexType_ i=begin; i<end; ++i) {
+          dists[i] = std::min(dists[i], dist2(d, obs+IDX(0,i,d), last));
+          if(dists[i] > 0) {
+            sum += dists[i];
+            if(draw(gen)*sum < dists[i])
+              pick = i;
+          }
+        }
+        chunkSums[chunk] = sum;
+        chunkPicks[chunk] = pick;
+      }
+
+      // Probabilities are proportional to square of distance to
+      // closest centroid (see k-means++ algorithm)
+      double total = 0;
+      for(int chunk=0; chunk<KMEANS_HOST_CHUNKS; ++chunk)
+        total += chunkSums[chunk];
+      if(total > 0) {
+        double r = uniformDist(rng)*total;
+        int chunk = 0;
+        while(chunk < KMEANS_HOST_CHUNKS-1 && (r >= chunkSums[chunk] || chunkSums[chunk] == 0)) {
+          r -= chunkSums[chunk];
+          ++chunk;
+        }
+        while(chunkSums[chunk] == 0)
+          --chunk;
+        obsIndex = chunkPicks[chunk];
+      }
+      else {
+        WARNING("k-means++ could not pick a distinct centroid");
+        obsIndex = static_cast<IndexType_>(rng() % n);
+      }
+      std::copy(obs+IDX(0,obsIndex,d), obs+IDX(0,obsIndex+1,d), centroids+IDX(0,c,d));
+    }
+  }
+
+  /// Find the closest centroid of an observation vector
+  /** @param dists (Output, k entries) Euclidean distance to each
+   *    centroid, can be NULL.
+   *  @param second (Output) Distance to the second closest centroid.
+   */
+  template <typename IndexType_, typename ValueType_> static inline
+  IndexType_ closestCentroid(IndexType_ d, IndexType_ k,
+                             const ValueType_ * __restrict__ x,
+                             const ValueType_ * __restrict__ centroids,
+                             ValueType_ * __restrict__ dists,
+                             ValueType_ & best,
+                             ValueType_ & second) {
+    IndexType_ code = 0;
+    best = second = std::numeric_limits<ValueType_>::max();
+    for(IndexType_ c=0; c<k; ++c) {
+      ValueType_ dc = sqrt(dist2(d, x, centroids+IDX(0,c,d)));
+      if(dists != NULL)
+        dists[c] = dc;
+      if(dc < best) {
+        second = best;
+        best = dc;
+        code = c;
+      }
+      else if(dc < second)
+        second = dc;
+    }
+    return code;
+  }
+
+  /// Sum observation vectors of each cluster and residual
+  /** Also sets the upper bounds to the exact distances.
+   *
+   *  @param sums (Output, d*k entries) Sum of the observation
+   *    vectors in each cluster.
+   *  @param clusterSizes (Output, k entries) Number of points in
+   *    each cluster.
+   *  @param upper (Output, n entries) Euclidean distance between
+   *    observation vectors and their centroid.
+   *  @return Residual sum of squares.
+   */
+  template <typename IndexType_, typename ValueType_> static
+  double accumulateClusters(IndexType_ n, IndexType_ d, IndexType_ k,
+                            const ValueType_ * __restrict__ obs,
+                            const ValueType_ * __restrict__ centroids,
+                            const IndexType_ * __restrict__ codes,
+                            std::vector<double> & sums,
+                            IndexType_ * __restrict__ clusterSizes,
+                            ValueType_ * __restrict__ upper) {
+    double residual = 0;
+    std::fill(sums.begin(), sums.end(), 0);
+    std::fill(clusterSizes, clusterSizes+k, 0);
+
+    #pragma omp parallel reduction(+:residual)
+    {
+      std::vector<double> threadSums(static_cast<size_t>(d)*k, 0);
+      std::vector<IndexType_> threadSizes(k, 0);
+      #pragma omp for schedule(static)
+      for(IndexType_ i=0; i<n; ++i) {
+        const ValueType_ * x = obs+IDX(0,i,d);
+        IndexType_ c = codes[i];
+        ValueType_ dd = dist2(d, x, centroids+IDX(0,c,d));
+        upper[i] = sqrt(dd);
+        residual += dd;
+        double * s = &threadSums[IDX(0,c,d)];
+        for(IndexType_ j=0; j<d; ++j)
+          s[j] += x[j];
+        ++threadSizes[c];
+      }
+      #pragma omp critical
+      {
+        for(size_t j=0; j<threadSums.size(); ++j)
+          sums[j] += threadSums[j];
+        for(IndexType_ c=0; c<k; ++c)
+          clusterSizes[c] += threadSizes[c];
+      }
+    }
+    return residual;
+  }
+
+  /// Update cluster centroids for k-means algorithm
+  /** Empty clusters get the observation vector the farthest from
+   *  its centroid, among clusters with more than one point.
+   *
+   *  @param moves (Output, k entries) Euclidean distance between the
+   *    previous and the new position of each centroid.
+   */
+  template <typename IndexType_, typename ValueType_> static
+  void updateCentroids(IndexType_ n, IndexType_ d, IndexType_ k,
+                       const ValueType_ * __restrict__ obs,
+                       const IndexType_ * __restrict__ codes,
+                       const std::vector<double> & sums,
+                       const IndexType_ * __restrict__ clusterSizes,
+                       const ValueType_ * __restrict__ upper,
+                       ValueType_ * __restrict__ centroids,
+                       ValueType_ * __restrict__ moves) {
+    std::vector<ValueType_> centroid(d);
+    std::vector<char> taken;
+    for(IndexType_ c=0; c<k; ++c) {
+      if(clusterSizes[c] > 0) {
+        for(IndexType_ j=0; j<d; ++j)
+          centroid[j] = static_cast<ValueType_>(sums[IDX(j,c,d)]/clusterSizes[c]);
+      }
+      else {
+        if(taken.empty())
+          taken.assign(n, 0);
+        IndexType_ far = -1;
+        for(IndexType_ i=0; i<n; ++i)
+          if(!taken[i] && clusterSizes[codes[i]] > 1 && (far < 0 || upper[i] > upper[far]))
+            far = i;
+        if(far < 0) {
+          WARNING("could not replace empty centroid");
+          moves[c] = 0;
+          continue;
+        }
+        taken[far] = 1;
+        std::copy(obs+IDX(0,far,d), obs+IDX(0,far+1,d), centroid.begin());
+      }
+      moves[c] = sqrt(dist2(d, &centroid[0], centroids+IDX(0,c,d)));
+      std::copy(centroid.begin(), centroid.end(), centroids+IDX(0,c,d));
+    }
+  }
+
+  /// Assign observation vectors with Hamerly bounds
+  /** @param upper (Input/Output, n entries) Upper bound on the
+   *    distance to the assigned centroid.
+   *  @param lower (Input/Output, n entries) Lower bound on the
+   *    distance to every other centroid.
+   *  @param half (Input, k entries) Half the distance between each
+   *    centroid and its closest centroid.
+   */
+  template <typename IndexType_, typename ValueType_> static
+  void assignHamerly(IndexType_ n, IndexType_ d, IndexType_ k,
+                     const ValueType_ * __restrict__ obs,
+                     const ValueType_ * __restrict__ centroids,
+                     const ValueType_ * __restrict__ half,
+                     IndexType_ * __restrict__ codes,
+                     ValueType_ * __restrict__ upper,
+                     ValueType_ * __restrict__ lower) {
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for(IndexType_ i=0; i<n; ++i) {
+      const ValueType_ * x = obs+IDX(0,i,d);
+      ValueType_ bound = std::max(half[codes[i]], lower[i]);
+      if(upper[i] <= bound)
+        continue;
+      upper[i] = sqrt(dist2(d, x, centroids+IDX(0,codes[i],d)));
+      if(upper[i] <= bound)
+        continue;
+      codes[i] = closestCentroid(d, k, x, centroids, (ValueType_*) NULL, upper[i], lower[i]);
+    }
+  }
+
+  /// Assign observation vectors with Elkan bounds
+  /** @param upper (Input/Output, n entries) Upper bound on the
+   *    distance to the assigned centroid.
+   *  @param lower (Input/Output, k*n entries) Lower bound on the
+   *    distance to each centroid.
+   *  @param centroidDists (Input, k*k entries) Distance between
+   *    centroids.
+   *  @param half (Input, k entries) Half the distance between each
+   *    centroid and its closest centroid.
+   */
+  template <typename IndexType_, typename ValueType_> static
+  void assignElkan(IndexType_ n, IndexType_ d, IndexType_ k,
+                   const ValueType_ * __restrict__ obs,
+                   const ValueType_ * __restrict__ centroids,
+                   const ValueType_ * __restrict__ centroidDists,
+                   const ValueType_ * __restrict__ half,
+                   IndexType_ * __restrict__ codes,
+                   ValueType_ * __restrict__ upper,
+                   ValueType_ * __restrict__ lower) {
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for(IndexType_ i=0; i<n; ++i) {
+      const ValueType_ * x = obs+IDX(0,i,d);
+      ValueType_ * l = lower+IDX(0,i,k);
+      IndexType_ a = codes[i];
+      ValueType_ u = upper[i];
+      if(u <= half[a])
+        continue;
+      bool tight = false;
+      for(IndexType_ c=0; c<k; ++c) {
+        if(c == a || u <= l[c] || u <= centroidDists[IDX(a,c,k)]/2)
+          continue;
+        if(!tight) {
+          u = sqrt(dist2(d, x, centroids+IDX(0,a,d)));
+          l[a] = u;
+          tight = true;
+          if(u <= l[c] || u <= centroidDists[IDX(a,c,k)]/2)
+            continue;
+        }
+        ValueType_ dc = sqrt(dist2(d, x, centroids+IDX(0,c,d)));
+        l[c] = dc;
+        if(dc < u) {
+          a = c;
+          u = dc;
+        }
+      }
+      codes[i] = a;
+      upper[i] = u;
+    }
+  }
+
+}
+
+namespace nvgraph {
+
+  // =========================================================
+  // k-means algorithm
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR kmeans_host(IndexType_ n, IndexType_ d, IndexType_ k,
+                            ValueType_ tol, IndexType_ maxiter,
+                            const ValueType_ * __restrict__ obs,
+                            IndexType_ * __restrict__ codes,
+                            IndexType_ * __restrict__ clusterSizes,
+                            ValueType_ * __restrict__ centroids,
+                            ValueType_ * residual_host,
+                            IndexType_ * iters_host) {
+
+    // -------------------------------------------------------
+    // Variable declarations
+    // -------------------------------------------------------
+
+    // Current iteration
+    IndexType_ iter;
+
+    // Residual sum of squares at previous iteration
+    double residualPrev = 0;
+    double residual = 0;
+
+    // Elkan or Hamerly bounds
+    const bool elkan = (k >= KMEANS_HOST_ELKAN_THR);
+
+    // -------------------------------------------------------
+    // Initialization
+    // -------------------------------------------------------
+
+    // Check that parameters are valid
+    if(n < 1) {
+      WARNING("invalid parameter (n<1)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    if(d < 1) {
+      WARNING("invalid parameter (d<1)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    if(k < 1) {
+      WARNING("invalid parameter (k<1)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    if(tol < 0) {
+      WARNING("invalid parameter (tol<0)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    if(maxiter < 0) {
+      WARNING("invalid parameter (maxiter<0)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+
+    std::vector<double> sums(static_cast<size_t>(d)*k);
+    std::vector<ValueType_> upper(n);
+    *iters_host = 0;
+
+    // Trivial cases
+    if(k == 1) {
+      std::fill(codes, codes+n, 0);
+      accumulateClusters(n, d, k, obs, obs, codes, sums, clusterSizes, &upper[0]);
+      for(IndexType_ j=0; j<d; ++j)
+        centroids[j] = static_cast<ValueType_>(sums[j]/n);
+      *residual_host = static_cast<ValueType_>(accumulateClusters(n, d, k, obs, centroids, codes,
+                                                                  sums, clusterSizes, &upper[0]));
+      return NVGRAPH_OK;
+    }
+    if(n <= k) {
+      for(IndexType_ i=0; i<n; ++i)
+        codes[i] = i;
+      std::fill(clusterSizes, clusterSizes+n, 1);
+      std::fill(clusterSizes+n, clusterSizes+k, 0);
+      std::copy(obs, obs+IDX(0,n,d), centroids);
+      *residual_host = 0;
+      return NVGRAPH_OK;
+    }
+
+    // -------------------------------------------------------
+    // k-means++ algorithm
+    // -------------------------------------------------------
+
+    // Choose initial cluster centroids
+    initializeCentroids(n, d, k, obs, centroids);
+
+    // Initial assignment, every bound is exact
+    std::vector<ValueType_> lower(elkan ? static_cast<size_t>(k)*n : n);
+    #pragma omp parallel for schedule(static)
+    for(IndexType_ i=0; i<n; ++i) {
+      ValueType_ second;
+      codes[i] = closestCentroid(d, k, obs+IDX(0,i,d), centroids,
+                                 elkan ? &lower[IDX(0,i,k)] : (ValueType_*) NULL,
+                                 upper[i], second);
+      if(!elkan)
+        lower[i] = second;
+    }
+    residual = accumulateClusters(n, d, k, obs, centroids, codes, sums, clusterSizes, &upper[0]);
+
+    // Apply k-means iteration until convergence
+    std::vector<ValueType_> moves(k), half(k), centroidDists(elkan ? static_cast<size_t>(k)*k : 0);
+    for(iter=0; iter<maxiter; ) {
+
+      // Update cluster centroids
+      updateCentroids(n, d, k, obs, codes, sums, clusterSizes, &upper[0], centroids, &moves[0]);
+
+      // Bounds are moved by the centroid displacements
+      IndexType_ maxMove = 0;
+      for(IndexType_ c=1; c<k; ++c)
+        if(moves[c] > moves[maxMove])
+          maxMove = c;
+      ValueType_ secondMove = 0;
+      for(IndexType_ c=0; c<k; ++c)
+        if(c != maxMove)
+          secondMove = std::max(secondMove, moves[c]);
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ i=0; i<n; ++i) {
+        upper[i] += moves[codes[i]];
+        if(elkan) {
+          for(IndexType_ c=0; c<k; ++c)
+            lower[IDX(c,i,k)] = std::max(lower[IDX(c,i,k)]-moves[c], ValueType_(0));
+        }
+        else
+          lower[i] -= (codes[i] == maxMove) ? secondMove : moves[maxMove];
+      }
+
+      // Distances between centroids
+      #pragma omp parallel for schedule(dynamic, 1)
+      for(IndexType_ c=0; c<k; ++c) {
+        ValueType_ closest = std::numeric_limits<ValueType_>::max();
+        for(IndexType_ c2=0; c2<k; ++c2) {
+          if(c2 == c)
+            continue;
+          ValueType_ dc = sqrt(dist2(d, centroids+IDX(0,c,d), centroids+IDX(0,c2,d)));
+          if(elkan)
+            centroidDists[IDX(c,c2,k)] = dc;
+          closest = std::min(closest, dc);
+        }
+        half[c] = closest/2;
+      }
+
+      // Determine centroid closest to each observation
+      if(elkan)
+        assignElkan(n, d, k, obs, centroids, &centroidDists[0], &half[0], codes, &upper[0], &lower[0]);
+      else
+        assignHamerly(n, d, k, obs, centroids, &half[0], codes, &upper[0], &lower[0]);
+
+      residualPrev = residual;
+      residual = accumulateClusters(n, d, k, obs, centroids, codes, sums, clusterSizes, &upper[0]);
+      ++iter;
+
+      // Check for convergence
+      if(fabs(residualPrev-residual)/n < tol)
+        break;
+    }
+
+    // Warning if k-means has failed to converge
+    if(fabs(residualPrev-residual)/n >= tol)
+      WARNING("k-means failed to converge");
+
+    *residual_host = static_cast<ValueType_>(residual);
+    *iters_host = iter;
+    return NVGRAPH_OK;
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR kmeans_host(IndexType_ n, IndexType_ d, IndexType_ k,
+                            ValueType_ tol, IndexType_ maxiter,
+                            const ValueType_ * __restrict__ obs,
+                            IndexType_ * __restrict__ codes,
+                            ValueType_ & residual,
+                            IndexType_ & iters) {
+    if(k < 1 || d < 1) {
+      WARNING("invalid parameter (k<1 or d<1)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    std::vector<IndexType_> clusterSizes(k);
+    std::vector<ValueType_> centroids(static_cast<size_t>(d)*k);
+    return kmeans_host<IndexType_,ValueType_>(n, d, k, tol, maxiter,
+                                             obs, codes,
+                                             &clusterSizes[0],
+                                             &centroids[0],
+                                             &residual, &iters);
+  }
+
+  // =========================================================
+  // Mini-batch k-means algorithm
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR kmeans_minibatch_host(IndexType_ n, IndexType_ d, IndexType_ k,
+                                      ValueType_ tol, IndexType_ maxiter,
+                                      IndexType_ batchSize,
+                                      const ValueType_ * __restrict__ obs,
+                                      IndexType_ * __restrict__ codes,
+                                      IndexType_ * __restrict__ clusterSizes,
+                                      ValueType_ * __restrict__ centroids,
+                                      ValueType_ * residual_host,
+                                      IndexType_ * iters_host) {
+
+    // -------------------------------------------------------
+    // Variable declarations
+    // -------------------------------------------------------
+
+    // Current iteration
+    IndexType_ iter;
+
+    // Smoothed batch residual per point, weight of the last batch
+    double smoothed = 0, smoothedPrev = 0;
+    const double smoothing = 0.1;
+
+    // Random number generator
+    std::mt19937_64 rng(123456);
+
+    // -------------------------------------------------------
+    // Initialization
+    // -------------------------------------------------------
+
+    // Check that parameters are valid
+    if(batchSize < 1) {
+      WARNING("invalid parameter (batchSize<1)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+
+    // Small problems are solved with every observation vector
+    if(k == 1 || n <= k || batchSize >= n || n < 1 || d < 1 || k < 1 || tol < 0 || maxiter < 0)
+      return kmeans_host<IndexType_,ValueType_>(n, d, k, tol, maxiter, obs, codes,
+                                                clusterSizes, centroids,
+                                                residual_host, iters_host);
+
+    // Choose initial cluster centroids with k-means++ on samples,
+    // keep the ones with the lowest residual on a validation sample
+    // (mini-batches cannot move two centroids out of one cluster)
+    IndexType_ sampleSize = std::min(n, std::max(4*batchSize, 16*k));
+    std::vector<ValueType_> sample(static_cast<size_t>(d)*sampleSize);
+    std::vector<IndexType_> validation(sampleSize);
+    std::vector<ValueType_> candidates(static_cast<size_t>(d)*k);
+    double bestResidual = std::numeric_limits<double>::max();
+    for(IndexType_ s=0; s<sampleSize; ++s)
+      validation[s] = static_cast<IndexType_>(rng() % n);
+    for(int init=0; init<KMEANS_HOST_MINIBATCH_INITS; ++init) {
+      for(IndexType_ s=0; s<sampleSize; ++s) {
+        IndexType_ i = static_cast<IndexType_>(rng() % n);
+        std::copy(obs+IDX(0,i,d), obs+IDX(0,i+1,d), &sample[IDX(0,s,d)]);
+      }
+      initializeCentroids(sampleSize, d, k, &sample[0], &candidates[0]);
+      double initResidual = 0;
+      #pragma omp parallel for schedule(static) reduction(+:initResidual)
+      for(IndexType_ s=0; s<sampleSize; ++s) {
+        ValueType_ best, second;
+        closestCentroid(d, k, obs+IDX(0,validation[s],d), &candidates[0],
+                        (ValueType_*) NULL, best, second);
+        initResidual += static_cast<double>(best)*best;
+      }
+      if(initResidual < bestResidual) {
+        bestResidual = initResidual;
+        std::copy(candidates.begin(), candidates.end(), centroids);
+      }
+    }
+
+    // -------------------------------------------------------
+    // Mini-batch iterations
+    // -------------------------------------------------------
+
+    // Number of points seen by each centroid, sets its learning rate
+    std::vector<double> seen(k, 0);
+    std::vector<IndexType_> batch(batchSize), batchCodes(batchSize), batchSizes(k);
+    std::vector<double> batchSums(static_cast<size_t>(d)*k);
+
+    for(iter=0; iter<maxiter; ) {
+
+      for(IndexType_ b=0; b<batchSize; ++b)
+        batch[b] = static_cast<IndexType_>(rng() % n);
+
+      // Determine centroid closest to each observation of the batch
+      double batchResidual = 0;
+      #pragma omp parallel for schedule(static) reduction(+:batchResidual)
+      for(IndexType_ b=0; b<batchSize; ++b) {
+        ValueType_ best, second;
+        batchCodes[b] = closestCentroid(d, k, obs+IDX(0,batch[b],d), centroids,
+                                        (ValueType_*) NULL, best, second);
+        batchResidual += static_cast<double>(best)*best;
+      }
+
+      // Move centroids towards the mean of their batch points
+      std::fill(batchSums.begin(), batchSums.end(), 0);
+      std::fill(batchSizes.begin(), batchSizes.end(), 0);
+      for(IndexType_ b=0; b<batchSize; ++b) {
+        const ValueType_ * x = obs+IDX(0,batch[b],d);
+        double * sum = &batchSums[IDX(0,batchCodes[b],d)];
+        for(IndexType_ j=0; j<d; ++j)
+          sum[j] += x[j];
+        ++batchSizes[batchCodes[b]];
+      }
+      for(IndexType_ c=0; c<k; ++c) {
+        if(batchSizes[c] == 0)
+          continue;
+        seen[c] += batchSizes[c];
+        double eta = batchSizes[c]/seen[c];
+        ValueType_ * centroid = centroids+IDX(0,c,d);
+        for(IndexType_ j=0; j<d; ++j)
+          centroid[j] = static_cast<ValueType_>((1-eta)*centroid[j] + eta*batchSums[IDX(j,c,d)]/batchSizes[c]);
+      }
+      ++iter;
+
+      // Check for convergence
+      smoothedPrev = smoothed;
+      smoothed = (iter == 1) ? batchResidual/batchSize
+        : (1-smoothing)*smoothed + smoothing*batchResidual/batchSize;
+      if(iter > 1 && fabs(smoothedPrev-smoothed) < tol)
+        break;
+    }
+
+    // Warning if k-means has failed to converge
+    if(fabs(smoothedPrev-smoothed) >= tol)
+      WARNING("mini-batch k-means failed to converge");
+
+    // -------------------------------------------------------
+    // Final assignment of every observation vector
+    // -------------------------------------------------------
+
+    #pragma omp parallel for schedule(static)
+    for(IndexType_ i=0; i<n; ++i) {
+      ValueType_ best, second;
+      codes[i] = closestCentroid(d, k, obs+IDX(0,i,d), centroids,
+                                 (ValueType_*) NULL, best, second);
+    }
+    std::vector<double> sums(static_cast<size_t>(d)*k);
+    std::vector<ValueType_> dists(n);
+    *residual_host = static_cast<ValueType_>(accumulateClusters(n, d, k, obs, centroids, codes,
+                                                                sums, clusterSizes, &dists[0]));
+    *iters_host = iter;
+    return NVGRAPH_OK;
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR kmeans_minibatch_host(IndexType_ n, IndexType_ d, IndexType_ k,
+                                      ValueType_ tol, IndexType_ maxiter,
+                                      IndexType_ batchSize,
+                                      const ValueType_ * __restrict__ obs,
+                                      IndexType_ * __restrict__ codes,
+                                      ValueType_ & residual,
+                                      IndexType_ & iters) {
+    if(k < 1 || d < 1) {
+      WARNING("invalid parameter (k<1 or d<1)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    std::vector<IndexType_> clusterSizes(k);
+    std::vector<ValueType_> centroids(static_cast<size_t>(d)*k);
+    return kmeans_minibatch_host<IndexType_,ValueType_>(n, d, k, tol, maxiter, batchSize,
+                                                       obs, codes,
+                                                       &clusterSizes[0],
+                                                       &centroids[0],
+                                                       &residual, &iters);
+  }
+
+  // =========================================================
+  // Explicit instantiations
+  // =========================================================
+
+  template
+  NVGRAPH_ERROR kmeans_host<int, float>(int n, int d, int k,
+                                        float tol, int maxiter,
+                                        const float * __restrict__ obs,
+                                        int * __restrict__ codes,
+                                        float & residual,
+                                        int & iters);
+  template
+  NVGRAPH_ERROR kmeans_host<int, double>(int n, int d, int k,
+                                         double tol, int maxiter,
+                                         const double * __restrict__ obs,
+                                         int * __restrict__ codes,
+                                         double & residual,
+                                         int & iters);
+  template
+  NVGRAPH_ERROR kmeans_host<int, float>(int n, int d, int k,
+                                        float tol, int maxiter,
+                                        const float * __restrict__ obs,
+                                        int * __restrict__ codes,
+                                        int * __restrict__ clusterSizes,
+                                        float * __restrict__ centroids,
+                                        float * residual_host,
+                                        int * iters_host);
+  template
+  NVGRAPH_ERROR kmeans_host<int, double>(int n, int d, int k,
+                                         double tol, int maxiter,
+                                         const double * __restrict__ obs,
+                                         int * __restrict__ codes,
+                                         int * __restrict__ clusterSizes,
+                                         double * __restrict__ centroids,
+                                         double * residual_host,
+                                         int * iters_host);
+  template
+  NVGRAPH_ERROR kmeans_minibatch_host<int, float>(int n, int d, int k,
+                                                  float tol, int maxiter,
+                                                  int batchSize,
+                                                  const float * __restrict__ obs,
+                                                  int * __restrict__ codes,
+                                                  float & residual,
+                                                  int & iters);
+  template
+  NVGRAPH_ERROR kmeans_minibatch_host<int, double>(int n, int d, int k,
+                                                   double tol, int maxiter,
+                                                   int batchSize,
+                                                   const double * __restrict__ obs,
+                                                   int * __restrict__ codes,
+                                                   double & residual,
+                                                   int & iters);
+  template
+  NVGRAPH_ERROR kmeans_minibatch_host<int, float>(int n, int d, int k,
+                                                  float tol, int maxiter,
+                                                  int batchSize,
+                                                  const float * __restrict__ obs,
+                                                  int * __restrict__ codes,
+                                                  int * __restrict__ clusterSizes,
+                                                  float * __restrict__ centroids,
+                                                  float * residual_host,
+                                                  int * iters_host);
+  template
+  NVGRAPH_ERROR kmeans_minibatch_host<int, double>(int n, int d, int k,
+                                                   double tol, int maxiter,
+                                                   int batchSize,
+                                                   const double * __restrict__ obs,
+                                                   int * __restrict__ codes,
+                                                   int * __restrict__ clusterSizes,
+                                                   double * __restrict__ centroids,
+                                                   double * residual_host,
+                                                   int * iters_host);
+}
@@ -0,0 +1,1391 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "lanczos_host.hxx"
+
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "nvgraph_lapack.hxx"
+#include "dense_host.hxx"
+#include "debug_macros.h"
+
+// =========================================================
+// Useful macros
+// =========================================================
+
+// Columns added to the wanted eigenvectors in the randomized
+// subspace iteration
+#define SUBSPACE_HOST_OVERSAMPLE 10
+
+// Get index of matrix entry
+#define IDX(i,j,lda) ((i)+(j)*(lda))
+
+namespace nvgraph {
+
+  namespace {
+
+    // =========================================================
+    // Helper functions
+    // =========================================================
+
+    using namespace dense_host;
+
+    /// Orthogonalize a vector against the k first Lanczos vectors
+    /** Classical Gram-Schmidt with two passes.
+     *
+     *  @return Sum of the removed components along the last of the k
+     *    vectors.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    ValueType_ orthogonalize(IndexType_ n, IndexType_ k,
+                             const ValueType_ * lanczosVecs,
+                             ValueType_ * r,
+                             std::vector<ValueType_> & h,
+                             std::vector<ValueType_> & partial) {
+      ValueType_ last = 0;
+      h.resize(k);
+      for(int pass=0; pass<2; ++pass) {
+        blockedDots(n, k, lanczosVecs, n, r, &h[0], partial);
+        gemvMinus(n, k, lanczosVecs, n, &h[0], r);
+        last += h[k-1];
+      }
+      return last;
+    }
+
+    /// Random unit vector orthogonal to the k first Lanczos vectors
+    /** @return False if no such vector could be found (the Lanczos
+     *    vectors span the whole space).
+     */
+    template <typename IndexType_, typename ValueType_> static
+    bool randomVector(IndexType_ n, IndexType_ k,
+                      const ValueType_ * lanczosVecs,
+                      ValueType_ * r,
+                      std::mt19937_64 & rng,
+                      std::vector<ValueType_> & h,
+                      std::vector<ValueType_> & partial) {
+      std::normal_distribution<double> normalDist(0,1);
+      for(IndexType_ i=0; i<n; ++i)
+        r[i] = static_cast<ValueType_>(normalDist(rng));
+      ValueType_ nrm = nrm2(n, r, partial);
+      if(k > 0)
+        orthogonalize(n, k, lanczosVecs, r, h, partial);
+      ValueType_ nrmOrth = nrm2(n, r, partial);
+      if(!(nrmOrth > std::sqrt(std::numeric_limits<ValueType_>::epsilon())*nrm))
+        return false;
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ i=0; i<n; ++i)
+        r[i] /= nrmOrth;
+      return true;
+    }
+
+    /// Estimates of the orthogonality between Lanczos vectors
+    /** cur[j] estimates v_k'*v_j for the current Lanczos vector v_k
+     *  and prev[j] estimates v_{k-1}'*v_j (Simon's recurrence).
+     */
+    template <typename ValueType_>
+    struct LanczosOmega {
+      std::vector<ValueType_> prev;
+      std::vector<ValueType_> cur;
+      std::vector<ValueType_> next;
+      /// Whether the next Lanczos vector must be reorthogonalized
+      bool pending;
+
+      /// Reset estimates when vectors 0..k are orthonormal
+      void reset(size_t k) {
+        ValueType_ eps = std::numeric_limits<ValueType_>::epsilon();
+        std::fill(prev.begin(), prev.end(), eps);
+        std::fill(cur.begin(), cur.end(), eps);
+        if(k > 0)
+          prev[k-1] = 1;
+        cur[k] = 1;
+        pending = false;
+      }
+    };
+
+    /// Perform Lanczos iteration
+    /** @param A Matrix (host products).
+     *  @param iter Pointer to current Lanczos iteration. On exit, the
+     *    variable is set equal to the final Lanczos iteration.
+     *  @param maxIter Maximum Lanczos iteration. This function will
+     *    perform a maximum of maxIter-*iter iterations.
+     *  @param locked Number of Lanczos vectors kept at the last
+     *    restart. Without full reorthogonalization, every new vector
+     *    is orthogonalized against them and the other ones are
+     *    partially reorthogonalized.
+     *  @param reorthogonalize Whether to fully reorthogonalize
+     *    Lanczos vectors at every step.
+     *  @param anorm Estimate of the matrix norm, updated.
+     *  @param alpha (Output, maxIter entries) Diagonal entries of
+     *    Lanczos system.
+     *  @param beta (Output, maxIter entries) Off-diagonal entries of
+     *    Lanczos system.
+     *  @param lanczosVecs (Input/output, n*(maxIter+1) entries)
+     *    Lanczos vectors, column-major n x (maxIter+1).
+     *  @param omega Orthogonality estimates.
+     *  @return Zero if successful. Non-zero if the Lanczos vectors
+     *    span the whole space.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    int performLanczosIteration(const Matrix<IndexType_, ValueType_> * A,
+                                IndexType_ * iter,
+                                IndexType_ maxIter,
+                                IndexType_ locked,
+                                bool reorthogonalize,
+                                ValueType_ & anorm,
+                                ValueType_ * __restrict__ alpha,
+                                ValueType_ * __restrict__ beta,
+                                ValueType_ * __restrict__ lanczosVecs,
+                                LanczosOmega<ValueType_> & omega,
+                                std::mt19937_64 & rng,
+                                std::vector<ValueType_> & h,
+                                std::vector<ValueType_> & partial) {
+
+      const ValueType_ eps = std::numeric_limits<ValueType_>::epsilon();
+      const ValueType_ sqrtEps = std::sqrt(eps);
+      IndexType_ n = A->n;
+      // Rounding error of a product, relative to the matrix norm
+      const ValueType_ eps1 = std::sqrt(static_cast<ValueType_>(n))*eps/2;
+
+      for(IndexType_ k=*iter; k<maxIter; ++k) {
+        const ValueType_ * v = lanczosVecs+IDX(0,k,n);
+        ValueType_ * r = lanczosVecs+IDX(0,k+1,n);
+
+        // r = A*v_k - beta_{k-1}*v_{k-1} - alpha_k*v_k
+        A->mv(1, v, 0, r);
+        if(k > 0)
+          gemvMinus(n, (IndexType_) 1, lanczosVecs+IDX(0,k-1,n), n, beta+k-1, r);
+        blockedDots(n, (IndexType_) 1, v, n, r, alpha+k, partial);
+        gemvMinus(n, (IndexType_) 1, v, n, alpha+k, r);
+
+        // Selective orthogonalization against the vectors kept at
+        // the last restart, which span the converging Ritz vectors
+        if(!reorthogonalize && locked > 0) {
+          h.resize(locked);
+          blockedDots(n, locked, lanczosVecs, n, r, &h[0], partial);
+          gemvMinus(n, locked, lanczosVecs, n, &h[0], r);
+        }
+
+        ValueType_ b = nrm2(n, r, partial);
+        anorm = std::max(anorm, std::fabs(alpha[k]) + b + (k > 0 ? beta[k-1] : 0));
+
+        // Update orthogonality estimates
+        bool doReorth = reorthogonalize || omega.pending;
+        if(!reorthogonalize) {
+          ValueType_ * w = &omega.next[0];
+          const ValueType_ * wCur = &omega.cur[0];
+          const ValueType_ * wPrev = &omega.prev[0];
+          ValueType_ wMax = 0;
+          for(IndexType_ j=0; j<locked; ++j)
+            w[j] = eps1;
+          for(IndexType_ j=locked; j<k; ++j) {
+            ValueType_ t = beta[j]*wCur[j+1] + (alpha[j]-alpha[k])*wCur[j];
+            if(j > 0)
+              t += beta[j-1]*wCur[j-1];
+            t -= beta[k-1]*wPrev[j];
+            t += (t >= 0 ? eps1 : -eps1)*(anorm + beta[j]);
+            w[j] = (b > 0) ? t/b : 1;
+            wMax = std::max(wMax, std::fabs(w[j]));
+          }
+          w[k] = eps1;
+          w[k+1] = 1;
+          if(wMax > sqrtEps) {
+            // Reorthogonalize this vector and the next one
+            doReorth = true;
+            omega.pending = true;
+          }
+          else if(omega.pending) {
+            omega.pending = false;
+          }
+        }
+
+        // Reorthogonalize against all previous Lanczos vectors
+        if(doReorth) {
+          alpha[k] += orthogonalize(n, k+1, lanczosVecs, r, h, partial);
+          b = nrm2(n, r, partial);
+          if(!reorthogonalize)
+            for(IndexType_ j=0; j<=k; ++j)
+              omega.next[j] = eps1;
+        }
+
+        // Restart with a random direction if an invariant subspace
+        // has been found
+        if(b <= eps*anorm) {
+          beta[k] = 0;
+          if(!randomVector(n, k+1, lanczosVecs, r, rng, h, partial)) {
+            *iter = k+1;
+            return 1;
+          }
+          if(!reorthogonalize)
+            for(IndexType_ j=0; j<=k; ++j)
+              omega.next[j] = eps1;
+        }
+        else {
+          beta[k] = b;
+          ValueType_ scale = 1/b;
+          #pragma omp parallel for schedule(static)
+          for(IndexType_ i=0; i<n; ++i)
+            r[i] *= scale;
+        }
+
+        if(!reorthogonalize) {
+          omega.prev.swap(omega.cur);
+          omega.cur.swap(omega.next);
+        }
+        *iter = k+1;
+      }
+
+      return 0;
+    }
+
+    /// Implicit QR step on a symmetric tridiagonal matrix
+    /** T is overwritten with R*T*R' where R is the orthogonal factor
+     *  of a QR step with shift mu, and Q with Q*R'. The bulge is
+     *  chased down with Givens rotations.
+     *
+     *  @param m Dimension of T.
+     *  @param d (Input/output, m entries) Diagonal of T.
+     *  @param e (Input/output, m-1 entries) Off-diagonal of T.
+     *  @param mu Shift.
+     *  @param Q (Input/output, m*m entries) Accumulated transform.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    void implicitQRStep(IndexType_ m, ValueType_ * d, ValueType_ * e,
+                        ValueType_ mu, ValueType_ * Q) {
+      ValueType_ x = d[0]-mu;
+      ValueType_ z = e[0];
+      for(IndexType_ k=0; k<m-1; ++k) {
+        ValueType_ r = std::sqrt(x*x+z*z);
+        ValueType_ c = 1;
+        ValueType_ s = 0;
+        if(r > 0) {
+          c = x/r;
+          s = z/r;
+        }
+        if(k > 0)
+          e[k-1] = r;
+        ValueType_ a = d[k];
+        ValueType_ b = e[k];
+        ValueType_ f = d[k+1];
+        d[k]   = c*c*a + 2*c*s*b + s*s*f;
+        d[k+1] = s*s*a - 2*c*s*b + c*c*f;
+        e[k]   = c*s*(f-a) + (c*c-s*s)*b;
+        if(k < m-2) {
+          x = e[k];
+          z = s*e[k+1];
+          e[k+1] *= c;
+        }
+        for(IndexType_ i=0; i<m; ++i) {
+          ValueType_ q0 = Q[IDX(i,k,m)];
+          ValueType_ q1 = Q[IDX(i,k+1,m)];
+          Q[IDX(i,k,m)]   = c*q0 + s*q1;
+          Q[IDX(i,k+1,m)] = c*q1 - s*q0;
+        }
+      }
+    }
+
+    /// Implicit restart of Lanczos method
+    /** The unwanted Ritz values are applied as exact shifts, then
+     *  the iter_new first Lanczos vectors and the new residual are
+     *  obtained with one blocked product.
+     *
+     *  @param n Matrix dimension.
+     *  @param iter Current Lanczos iteration.
+     *  @param iter_new Lanczos iteration after restart.
+     *  @param shifts (iter-iter_new entries) Unwanted Ritz values.
+     *  @param alpha (Input/output, iter entries) Diagonal entries of
+     *    Lanczos system.
+     *  @param beta (Input/output, iter entries) Off-diagonal entries
+     *    of Lanczos system.
+     *  @param lanczosVecs (Input/output, n*(iter+1) entries) Lanczos
+     *    vectors.
+     *  @return Zero if successful. Non-zero if the Lanczos vectors
+     *    span the whole space.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    int lanczosRestart(IndexType_ n, IndexType_ iter, IndexType_ iter_new,
+                       const ValueType_ * shifts,
+                       ValueType_ anorm,
+                       ValueType_ * __restrict__ alpha,
+                       ValueType_ * __restrict__ beta,
+                       ValueType_ * __restrict__ lanczosVecs,
+                       std::mt19937_64 & rng,
+                       std::vector<ValueType_> & h,
+                       std::vector<ValueType_> & partial) {
+
+      // Apply shifts to tridiagonal system
+      std::vector<ValueType_> Q(static_cast<size_t>(iter)*iter, 0);
+      for(IndexType_ i=0; i<iter; ++i)
+        Q[IDX(i,i,iter)] = 1;
+      for(IndexType_ i=0; i<iter-iter_new; ++i)
+        implicitQRStep(iter, alpha, beta, shifts[i], &Q[0]);
+
+      // Transform applied to [V_iter, f]: the iter_new first columns
+      // of Q, and the new residual
+      //   f_new = V_iter*Q(:,iter_new)*T(iter_new,iter_new-1)
+      //           + f*Q(iter-1,iter_new-1)
+      std::vector<ValueType_> C(static_cast<size_t>(iter+1)*(iter_new+1), 0);
+      for(IndexType_ j=0; j<iter_new; ++j)
+        memcpy(&C[IDX(0,j,iter+1)], &Q[IDX(0,j,iter)], iter*sizeof(ValueType_));
+      for(IndexType_ i=0; i<iter; ++i)
+        C[IDX(i,iter_new,iter+1)] = beta[iter_new-1]*Q[IDX(i,iter_new,iter)];
+      C[IDX(iter,iter_new,iter+1)] = beta[iter-1]*Q[IDX(iter-1,iter_new-1,iter)];
+      blockedGemm(n, iter+1, iter_new+1, lanczosVecs, n,
+                  &C[0], iter+1, lanczosVecs, n);
+
+      // Normalize residual to obtain new Lanczos vector
+      ValueType_ * r = lanczosVecs+IDX(0,iter_new,n);
+      orthogonalize(n, iter_new, lanczosVecs, r, h, partial);
+      ValueType_ b = nrm2(n, r, partial);
+      if(b <= std::numeric_limits<ValueType_>::epsilon()*anorm) {
+        beta[iter_new-1] = 0;
+        if(!randomVector(n, iter_new, lanczosVecs, r, rng, h, partial))
+          return 1;
+      }
+      else {
+        beta[iter_new-1] = b;
+        ValueType_ scale = 1/b;
+        #pragma omp parallel for schedule(static)
+        for(IndexType_ i=0; i<n; ++i)
+          r[i] *= scale;
+      }
+      return 0;
+    }
+
+    /// Eigenvalues and eigenvectors of a dense symmetric matrix
+    /** The matrix is reduced to tridiagonal form with Householder
+     *  reflections, then the tridiagonal eigenproblem is solved with
+     *  LAPACK (steqr) on the accumulated reflections.
+     *
+     *  @param m Dimension of the matrix.
+     *  @param H (Input, m*m entries) Symmetric matrix, leading
+     *    dimension ldh.
+     *  @param eigVals (Output, m entries) Eigenvalues in increasing
+     *    order.
+     *  @param eigVecs (Output, m*m entries) Orthonormal eigenvectors,
+     *    column-major m x m.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    void symmetricEigenvectors(IndexType_ m,
+                               const ValueType_ * H, IndexType_ ldh,
+                               ValueType_ * __restrict__ eigVals,
+                               ValueType_ * __restrict__ eigVecs) {
+      std::vector<ValueType_> T(static_cast<size_t>(m)*m);
+      std::vector<ValueType_> e(std::max(m, (IndexType_) 1));
+      std::vector<ValueType_> v(m), w(m), work(std::max(2*m, (IndexType_) 1));
+      for(IndexType_ j=0; j<m; ++j)
+        for(IndexType_ i=0; i<m; ++i) {
+          T[IDX(i,j,m)] = H[IDX(i,j,ldh)];
+          eigVecs[IDX(i,j,m)] = (i == j) ? 1 : 0;
+        }
+
+      // Householder reduction, T := P*T*P with P = I - 2*v*v' acting
+      // on rows and columns k+1..m-1
+      for(IndexType_ k=0; k+2<m; ++k) {
+        ValueType_ xnrm = 0;
+        for(IndexType_ i=k+1; i<m; ++i)
+          xnrm += T[IDX(i,k,m)]*T[IDX(i,k,m)];
+        xnrm = std::sqrt(xnrm);
+        if(xnrm == 0)
+          continue;
+        ValueType_ a = (T[IDX(k+1,k,m)] > 0) ? -xnrm : xnrm;
+        ValueType_ vnrm = 0;
+        for(IndexType_ i=k+1; i<m; ++i) {
+          v[i] = T[IDX(i,k,m)];
+          if(i == k+1)
+            v[i] -= a;
+          vnrm += v[i]*v[i];
+        }
+        vnrm = std::sqrt(vnrm);
+        for(IndexType_ i=k+1; i<m; ++i)
+          v[i] /= vnrm;
+
+        // w = 2*T*v - 2*(v'*T*v)*v, then T := T - v*w' - w*v'
+        ValueType_ vtv = 0;
+        for(IndexType_ i=k+1; i<m; ++i) {
+          ValueType_ s = 0;
+          for(IndexType_ l=k+1; l<m; ++l)
+            s += T[IDX(i,l,m)]*v[l];
+          w[i] = 2*s;
+          vtv += v[i]*s;
+        }
+        for(IndexType_ i=k+1; i<m; ++i)
+          w[i] -= 2*vtv*v[i];
+        for(IndexType_ j=k+1; j<m; ++j)
+          for(IndexType_ i=k+1; i<m; ++i)
+            T[IDX(i,j,m)] -= v[i]*w[j] + w[i]*v[j];
+        T[IDX(k+1,k,m)] = a;
+        T[IDX(k,k+1,m)] = a;
+        for(IndexType_ i=k+2; i<m; ++i) {
+          T[IDX(i,k,m)] = 0;
+          T[IDX(k,i,m)] = 0;
+        }
+
+        // Accumulate reflection, Q := Q*P
+        for(IndexType_ i=0; i<m; ++i) {
+          ValueType_ s = 0;
+          for(IndexType_ l=k+1; l<m; ++l)
+            s += eigVecs[IDX(i,l,m)]*v[l];
+          for(IndexType_ l=k+1; l<m; ++l)
+            eigVecs[IDX(i,l,m)] -= 2*s*v[l];
+        }
+      }
+
+      // Tridiagonal eigenproblem
+      for(IndexType_ i=0; i<m; ++i)
+        eigVals[i] = T[IDX(i,i,m)];
+      for(IndexType_ i=0; i+1<m; ++i)
+        e[i] = T[IDX(i+1,i,m)];
+      Lapack<ValueType_>::steqr('V', m, eigVals, &e[0], eigVecs, m, &work[0]);
+    }
+
+    /// Compute extreme eigenvectors of symmetric matrix
+    template <typename IndexType_, typename ValueType_> static
+    NVGRAPH_ERROR computeEigenvectors(const Matrix<IndexType_,ValueType_> & A,
+                                      IndexType_ nEigVecs,
+                                      IndexType_ maxIter,
+                                      IndexType_ restartIter,
+                                      ValueType_ tol,
+                                      bool reorthogonalize,
+                                      IndexType_ & iter,
+                                      ValueType_ * __restrict__ eigVals,
+                                      ValueType_ * __restrict__ eigVecs,
+                                      bool smallest_eig) {
+
+      // -------------------------------------------------------
+      // Check that parameters are valid
+      // -------------------------------------------------------
+      if(A.m != A.n) {
+        WARNING("invalid parameter (matrix is not square)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs < 1) {
+        WARNING("invalid parameter (nEigVecs<1)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(restartIter < 1) {
+        WARNING("invalid parameter (restartIter<4)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(tol < 0) {
+        WARNING("invalid parameter (tol<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs > A.n) {
+        WARNING("invalid parameters (nEigVecs>n)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(maxIter < nEigVecs) {
+        WARNING("invalid parameters (maxIter<nEigVecs)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(restartIter < nEigVecs) {
+        WARNING("invalid parameters (restartIter<nEigVecs)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+
+      // -------------------------------------------------------
+      // Variable initialization
+      // -------------------------------------------------------
+
+      IndexType_ n = A.n;
+
+      // Room for two unwanted Ritz values, no larger than the space
+      restartIter = std::min(std::max(restartIter, nEigVecs+2), n);
+
+      std::vector<ValueType_> lanczosVecs(static_cast<size_t>(n)*(restartIter+1));
+      std::vector<ValueType_> alpha(restartIter);
+      std::vector<ValueType_> beta(restartIter);
+      std::vector<ValueType_> ritzVals(restartIter);
+      std::vector<ValueType_> ritzVecs(static_cast<size_t>(restartIter)*restartIter);
+      std::vector<ValueType_> work(3*restartIter);
+      std::vector<ValueType_> h, partial;
+      LanczosOmega<ValueType_> omega;
+      omega.prev.resize(restartIter+2);
+      omega.cur.resize(restartIter+2);
+      omega.next.resize(restartIter+2);
+      omega.reset(0);
+      std::mt19937_64 rng(123456);
+      ValueType_ anorm = 0;
+
+      // Initial Lanczos vector
+      randomVector(n, (IndexType_) 0, &lanczosVecs[0], &lanczosVecs[0], rng, h, partial);
+
+      // -------------------------------------------------------
+      // Implicitly restarted Lanczos method
+      // -------------------------------------------------------
+
+      IndexType_ totalIter = 0;
+      IndexType_ effIter = 0;
+      bool exhausted = false;
+      IndexType_ first = 0;
+      IndexType_ locked = 0;
+      while(true) {
+
+        // Proceed with Lanczos method
+        IndexType_ target = std::min(restartIter, effIter + (maxIter-totalIter));
+        if(target > effIter) {
+          IndexType_ effIter_old = effIter;
+          exhausted = performLanczosIteration(&A, &effIter, target, locked,
+                                              reorthogonalize, anorm,
+                                              &alpha[0], &beta[0], &lanczosVecs[0],
+                                              omega, rng, h, partial) != 0;
+          totalIter += effIter-effIter_old;
+        }
+
+        // Ritz values and vectors of tridiagonal system
+        memcpy(&ritzVals[0], &alpha[0], effIter*sizeof(ValueType_));
+        memcpy(&work[0], &beta[0], (effIter-1)*sizeof(ValueType_));
+        Lapack<ValueType_>::steqr('I', effIter, &ritzVals[0], &work[0],
+                                  &ritzVecs[0], effIter, &work[effIter]);
+
+        // Check for convergence
+        first = smallest_eig ? 0 : effIter-nEigVecs;
+        ValueType_ ritzNorm = std::max(std::fabs(ritzVals[0]), std::fabs(ritzVals[effIter-1]));
+        bool converged = true;
+        for(IndexType_ j=first; j<first+nEigVecs; ++j) {
+          ValueType_ res = std::fabs(beta[effIter-1]*ritzVecs[IDX(effIter-1,j,effIter)]);
+          if(res > tol*ritzNorm)
+            converged = false;
+        }
+        if(converged || exhausted || totalIter >= maxIter)
+          break;
+
+        // Implicit restart, keeping half of the unwanted Ritz values
+        IndexType_ iter_new = nEigVecs + (effIter-nEigVecs)/2;
+        const ValueType_ * shifts = smallest_eig ? &ritzVals[iter_new] : &ritzVals[0];
+        exhausted = lanczosRestart(n, effIter, iter_new, shifts, anorm,
+                                   &alpha[0], &beta[0], &lanczosVecs[0],
+                                   rng, h, partial) != 0;
+        effIter = iter_new;
+        locked = iter_new;
+        if(!reorthogonalize)
+          omega.reset(effIter);
+        if(exhausted) {
+          // Restarted system is exact
+          memcpy(&ritzVals[0], &alpha[0], effIter*sizeof(ValueType_));
+          memcpy(&work[0], &beta[0], (effIter-1)*sizeof(ValueType_));
+          Lapack<ValueType_>::steqr('I', effIter, &ritzVals[0], &work[0],
+                                    &ritzVecs[0], effIter, &work[effIter]);
+          first = smallest_eig ? 0 : effIter-nEigVecs;
+          break;
+        }
+      }
+
+      // Warning if Lanczos has failed to converge
+      if(totalIter >= maxIter && !exhausted)
+        WARNING("implicitly restarted Lanczos may have failed to converge");
+
+      // Eigenvalues and eigenvectors in standard basis
+      memcpy(eigVals, &ritzVals[first], nEigVecs*sizeof(ValueType_));
+      blockedGemm(n, effIter, nEigVecs, &lanczosVecs[0], n,
+                  &ritzVecs[IDX(0,first,effIter)], effIter, eigVecs, n);
+
+      iter = totalIter;
+      return NVGRAPH_OK;
+    }
+
+
+    /// Perform block Lanczos iteration
+    /** Extends the block Krylov basis one block at a time: the newest
+     *  block is multiplied by the matrix with a single product (SpMM),
+     *  fully reorthogonalized against the basis with two passes of
+     *  block classical Gram-Schmidt, and factored (QR) into the next
+     *  block. The projection of the matrix on the basis is stored
+     *  explicitly.
+     *
+     *  @param A Matrix (host products).
+     *  @param blockSize Number of vectors per block.
+     *  @param m Pointer to current basis dimension. The block of
+     *    vectors m..m+blockSize-1 is orthonormal to the basis and has
+     *    not been multiplied yet. On exit, the variable is set equal to
+     *    the final basis dimension.
+     *  @param maxBasis Maximum basis dimension.
+     *  @param iter Pointer to number of matrix-vector products,
+     *    updated.
+     *  @param maxIter Products are no longer performed once iter
+     *    reaches maxIter.
+     *  @param anorm Estimate of the matrix norm, updated.
+     *  @param H (Input/output) Projected matrix, leading dimension
+     *    maxBasis+blockSize.
+     *  @param V (Input/output, n*(maxBasis+blockSize) entries) Basis
+     *    vectors.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    void performBlockLanczosIteration(const Matrix<IndexType_, ValueType_> * A,
+                                      IndexType_ blockSize,
+                                      IndexType_ * m,
+                                      IndexType_ maxBasis,
+                                      IndexType_ * iter,
+                                      IndexType_ maxIter,
+                                      ValueType_ & anorm,
+                                      ValueType_ * __restrict__ H,
+                                      ValueType_ * __restrict__ V,
+                                      std::mt19937_64 & rng,
+                                      std::vector<ValueType_> & C,
+                                      std::vector<ValueType_> & h,
+                                      std::vector<ValueType_> & partial) {
+
+      const ValueType_ eps = std::numeric_limits<ValueType_>::epsilon();
+      IndexType_ n = A->n;
+      IndexType_ b = blockSize;
+      IndexType_ ldh = maxBasis+b;
+
+      while(*m+b <= maxBasis && *iter < maxIter) {
+        IndexType_ k = *m;
+        IndexType_ p = k+b;
+        const ValueType_ * X = V+IDX(0,k,n);
+        ValueType_ * W = V+IDX(0,p,n);
+
+        // W = A*X
+        A->mm(b, 1, X, 0, W);
+        *iter += b;
+
+        // Block classical Gram-Schmidt against the basis, two passes.
+        // The coefficients are the new columns of the projection.
+        C.assign(static_cast<size_t>(p)*b, 0);
+        h.resize(static_cast<size_t>(p)*b);
+        for(int pass=0; pass<2; ++pass) {
+          blockedGemmT(n, p, b, V, n, W, n, &h[0], p, partial);
+          gemmMinus(n, p, b, V, n, &h[0], p, W, n);
+          for(size_t i=0; i<C.size(); ++i)
+            C[i] += h[i];
+        }
+        for(IndexType_ j=0; j<b; ++j) {
+          for(IndexType_ i=0; i<p; ++i) {
+            ValueType_ c = C[IDX(i,j,p)];
+            if(i >= k && i < p)
+              c = (c + C[IDX(j+k,i-k,p)])/2;
+            H[IDX(i,k+j,ldh)] = c;
+            H[IDX(k+j,i,ldh)] = c;
+          }
+        }
+
+        // QR factorization of W, column by column
+        for(IndexType_ j=0; j<b; ++j) {
+          ValueType_ * w = W+IDX(0,j,n);
+          ValueType_ nrmBefore = nrm2(n, w, partial);
+          std::vector<ValueType_> r(j, 0);
+          if(j > 0) {
+            for(int pass=0; pass<2; ++pass) {
+              blockedDots(n, j, W, n, w, &h[0], partial);
+              gemvMinus(n, j, W, n, &h[0], w);
+              for(IndexType_ i=0; i<j; ++i)
+                r[i] += h[i];
+            }
+          }
+          ValueType_ nrm = nrm2(n, w, partial);
+          if(nrm < nrmBefore/2) {
+            // Cancellation, the remaining rounding errors are removed
+            orthogonalize(n, p+j, V, w, h, partial);
+            nrm = nrm2(n, w, partial);
+          }
+
+          // |A*x_j| from the components of A*x_j in the new basis
+          ValueType_ axnrm = nrm*nrm;
+          for(IndexType_ i=0; i<p; ++i)
+            axnrm += C[IDX(i,j,p)]*C[IDX(i,j,p)];
+          for(IndexType_ i=0; i<j; ++i)
+            axnrm += r[i]*r[i];
+          anorm = std::max(anorm, std::sqrt(axnrm));
+          for(IndexType_ i=0; i<b; ++i) {
+            H[IDX(p+i,k+j,ldh)] = (i < j) ? r[i] : 0;
+            H[IDX(k+j,p+i,ldh)] = (i < j) ? r[i] : 0;
+          }
+          if(nrm <= eps*anorm) {
+            // Rank deficient block, continue with a random direction
+            randomVector(n, p+j, V, w, rng, h, partial);
+          }
+          else {
+            H[IDX(p+j,k+j,ldh)] = nrm;
+            H[IDX(k+j,p+j,ldh)] = nrm;
+            ValueType_ scale = 1/nrm;
+            #pragma omp parallel for schedule(static)
+            for(IndexType_ i=0; i<n; ++i)
+              w[i] *= scale;
+          }
+        }
+
+        *m = p;
+      }
+    }
+
+    /// Compute extreme eigenvectors of symmetric matrix with block
+    /// Lanczos method
+    /** Thick restart: the wanted Ritz vectors and the unconverged
+     *  ones closest to them are kept with the last block, which is
+     *  orthogonal to all of them.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    NVGRAPH_ERROR computeEigenvectorsBlock(const Matrix<IndexType_,ValueType_> & A,
+                                           IndexType_ nEigVecs,
+                                           IndexType_ blockSize,
+                                           IndexType_ maxIter,
+                                           IndexType_ restartIter,
+                                           ValueType_ tol,
+                                           IndexType_ & iter,
+                                           ValueType_ * __restrict__ eigVals,
+                                           ValueType_ * __restrict__ eigVecs,
+                                           bool smallest_eig) {
+
+      // -------------------------------------------------------
+      // Check that parameters are valid
+      // -------------------------------------------------------
+      if(A.m != A.n) {
+        WARNING("invalid parameter (matrix is not square)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs < 1) {
+        WARNING("invalid parameter (nEigVecs<1)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(blockSize < 1) {
+        WARNING("invalid parameter (blockSize<1)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(tol < 0) {
+        WARNING("invalid parameter (tol<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs > A.n) {
+        WARNING("invalid parameters (nEigVecs>n)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(maxIter < nEigVecs) {
+        WARNING("invalid parameters (maxIter<nEigVecs)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(restartIter < nEigVecs) {
+        WARNING("invalid parameters (restartIter<nEigVecs)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+
+      // -------------------------------------------------------
+      // Variable initialization
+      // -------------------------------------------------------
+
+      IndexType_ n = A.n;
+      IndexType_ b = blockSize;
+
+      // Room for the wanted Ritz vectors and two blocks
+      IndexType_ maxBasis = std::max(restartIter, nEigVecs+2*b);
+
+      // Small problem, the basis is the whole space
+      if(maxBasis+b >= n) {
+        std::vector<ValueType_> X(static_cast<size_t>(n)*n, 0);
+        std::vector<ValueType_> AX(static_cast<size_t>(n)*n);
+        std::vector<ValueType_> ritzVals(n), ritzVecs(static_cast<size_t>(n)*n);
+        for(IndexType_ i=0; i<n; ++i)
+          X[IDX(i,i,n)] = 1;
+        A.mm(n, 1, &X[0], 0, &AX[0]);
+        for(IndexType_ j=0; j<n; ++j)
+          for(IndexType_ i=0; i<j; ++i) {
+            ValueType_ c = (AX[IDX(i,j,n)]+AX[IDX(j,i,n)])/2;
+            AX[IDX(i,j,n)] = c;
+            AX[IDX(j,i,n)] = c;
+          }
+        symmetricEigenvectors(n, &AX[0], n, &ritzVals[0], &ritzVecs[0]);
+        IndexType_ first = smallest_eig ? 0 : n-nEigVecs;
+        memcpy(eigVals, &ritzVals[first], nEigVecs*sizeof(ValueType_));
+        memcpy(eigVecs, &ritzVecs[IDX(0,first,n)], static_cast<size_t>(n)*nEigVecs*sizeof(ValueType_));
+        iter = n;
+        return NVGRAPH_OK;
+      }
+
+      IndexType_ ldh = maxBasis+b;
+      std::vector<ValueType_> V(static_cast<size_t>(n)*ldh);
+      std::vector<ValueType_> H(static_cast<size_t>(ldh)*ldh, 0);
+      std::vector<ValueType_> ritzVals(maxBasis);
+      std::vector<ValueType_> ritzVecs(static_cast<size_t>(maxBasis)*maxBasis);
+      std::vector<ValueType_> C, h, partial;
+      std::mt19937_64 rng(123456);
+      ValueType_ anorm = 0;
+
+      // Initial block
+      for(IndexType_ j=0; j<b; ++j)
+        randomVector(n, j, &V[0], &V[IDX(0,j,n)], rng, h, partial);
+
+      // -------------------------------------------------------
+      // Thick restarted block Lanczos method
+      // -------------------------------------------------------
+
+      IndexType_ totalIter = 0;
+      IndexType_ m = 0;
+      IndexType_ first = 0;
+      while(true) {
+
+        // Proceed with block Lanczos method
+        performBlockLanczosIteration(&A, b, &m, maxBasis, &totalIter, maxIter,
+                                     anorm, &H[0], &V[0], rng, C, h, partial);
+
+        // Ritz values and vectors of projected matrix
+        symmetricEigenvectors(m, &H[0], ldh, &ritzVals[0], &ritzVecs[0]);
+
+        // Check for convergence, the residual of a Ritz pair is the
+        // coupling with the last block times the Ritz vector
+        first = smallest_eig ? 0 : m-nEigVecs;
+        ValueType_ ritzNorm = std::max(std::fabs(ritzVals[0]), std::fabs(ritzVals[m-1]));
+        bool converged = true;
+        for(IndexType_ j=first; j<first+nEigVecs && converged; ++j) {
+          ValueType_ res = 0;
+          for(IndexType_ i=0; i<b; ++i) {
+            ValueType_ s = 0;
+            for(IndexType_ l=0; l<m; ++l)
+              s += H[IDX(m+i,l,ldh)]*ritzVecs[IDX(l,j,m)];
+            res += s*s;
+          }
+          if(std::sqrt(res) > tol*ritzNorm)
+            converged = false;
+        }
+        if(converged || totalIter >= maxIter)
+          break;
+
+        // Thick restart, keeping half of the unwanted Ritz vectors
+        IndexType_ kept = std::min(nEigVecs + (m-nEigVecs)/2, maxBasis-b);
+        IndexType_ firstKept = smallest_eig ? 0 : m-kept;
+        blockedGemm(n, m, kept, &V[0], n,
+                    &ritzVecs[IDX(0,firstKept,m)], m, &V[0], n);
+        memmove(&V[IDX(0,kept,n)], &V[IDX(0,m,n)],
+                static_cast<size_t>(n)*b*sizeof(ValueType_));
+
+        // Projection on the kept Ritz vectors and last block
+        std::vector<ValueType_> S(static_cast<size_t>(b)*kept);
+        for(IndexType_ j=0; j<kept; ++j)
+          for(IndexType_ i=0; i<b; ++i) {
+            ValueType_ s = 0;
+            for(IndexType_ l=0; l<m; ++l)
+              s += H[IDX(m+i,l,ldh)]*ritzVecs[IDX(l,firstKept+j,m)];
+            S[IDX(i,j,b)] = s;
+          }
+        std::fill(H.begin(), H.end(), (ValueType_) 0);
+        for(IndexType_ j=0; j<kept; ++j) {
+          H[IDX(j,j,ldh)] = ritzVals[firstKept+j];
+          for(IndexType_ i=0; i<b; ++i) {
+            H[IDX(kept+i,j,ldh)] = S[IDX(i,j,b)];
+            H[IDX(j,kept+i,ldh)] = S[IDX(i,j,b)];
+          }
+        }
+        m = kept;
+      }
+
+      // Warning if Lanczos has failed to converge
+      if(totalIter >= maxIter)
+        WARNING("block Lanczos may have failed to converge");
+
+      // Eigenvalues and eigenvectors in standard basis
+      memcpy(eigVals, &ritzVals[first], nEigVecs*sizeof(ValueType_));
+      blockedGemm(n, m, nEigVecs, &V[0], n,
+                  &ritzVecs[IDX(0,first,m)], m, eigVecs, n);
+
+      iter = totalIter;
+      return NVGRAPH_OK;
+    }
+
+    /// Orthonormalize the columns of a dense matrix
+    /** Cholesky QR with two passes: G = X'*X = L*L' and X := X*inv(L').
+     *  The second pass removes the loss of orthogonality of the first
+     *  one. If G is numerically singular, it is shifted until the
+     *  factorization succeeds.
+     *
+     *  @param n Number of rows.
+     *  @param b Number of columns.
+     *  @param X (Input/output, n*b entries) Matrix, leading dimension n.
+     *  @param Y (Input/output, n*b entries) If not NULL, multiplied by
+     *    the same inv(L') as X (e.g. Y = A*X stays A*X).
+     */
+    template <typename IndexType_, typename ValueType_> static
+    void choleskyQR(IndexType_ n, IndexType_ b, ValueType_ * X,
+                    std::vector<ValueType_> & G,
+                    std::vector<ValueType_> & partial,
+                    ValueType_ * Y = NULL) {
+      const ValueType_ eps = std::numeric_limits<ValueType_>::epsilon();
+      std::vector<ValueType_> L(static_cast<size_t>(b)*b);
+      std::vector<ValueType_> Rinv(static_cast<size_t>(b)*b);
+      G.resize(static_cast<size_t>(b)*b);
+      for(int pass=0; pass<2; ++pass) {
+        blockedGemmT(n, b, b, X, n, X, n, &G[0], b, partial);
+        ValueType_ trace = 0;
+        for(IndexType_ i=0; i<b; ++i)
+          trace += G[IDX(i,i,b)];
+
+        // Cholesky factorization of G + shift*I
+        ValueType_ shift = 0;
+        bool factored = false;
+        while(!factored) {
+          factored = true;
+          for(IndexType_ j=0; j<b && factored; ++j) {
+            ValueType_ d = G[IDX(j,j,b)] + shift;
+            for(IndexType_ l=0; l<j; ++l)
+              d -= L[IDX(j,l,b)]*L[IDX(j,l,b)];
+            if(!(d > 0)) {
+              factored = false;
+              shift = (shift == 0) ? eps*trace : 10*shift;
+              break;
+            }
+            L[IDX(j,j,b)] = std::sqrt(d);
+            for(IndexType_ i=j+1; i<b; ++i) {
+              ValueType_ s = G[IDX(i,j,b)];
+              for(IndexType_ l=0; l<j; ++l)
+                s -= L[IDX(i,l,b)]*L[IDX(j,l,b)];
+              L[IDX(i,j,b)] = s/L[IDX(j,j,b)];
+            }
+          }
+        }
+
+        // inv(L') = inv(L)', columns of inv(L) by forward substitution
+        std::fill(Rinv.begin(), Rinv.end(), (ValueType_) 0);
+        for(IndexType_ j=0; j<b; ++j)
+          for(IndexType_ i=j; i<b; ++i) {
+            ValueType_ s = (i == j) ? 1 : 0;
+            for(IndexType_ l=j; l<i; ++l)
+              s -= L[IDX(i,l,b)]*Rinv[IDX(j,l,b)];
+            Rinv[IDX(j,i,b)] = s/L[IDX(i,i,b)];
+          }
+        blockedGemm(n, b, b, X, n, &Rinv[0], b, X, n);
+        if(Y != NULL)
+          blockedGemm(n, b, b, Y, n, &Rinv[0], b, Y, n);
+      }
+    }
+
+    /// Compute extreme eigenvectors of symmetric matrix with
+    /// randomized subspace iteration
+    /** A Gaussian block is multiplied maxIter times by sigma*I-A (or
+     *  sigma*I+A for the largest eigenvalues) and orthonormalized
+     *  after each product. sigma is the largest norm of the columns
+     *  of A*X seen so far, a lower bound of the spectral radius that
+     *  makes the wanted eigenvalues dominant. The eigenvectors are
+     *  then extracted from the projection of A on the block
+     *  (Rayleigh-Ritz).
+     */
+    template <typename IndexType_, typename ValueType_> static
+    NVGRAPH_ERROR computeEigenvectorsSubspace(const Matrix<IndexType_,ValueType_> & A,
+                                              IndexType_ nEigVecs,
+                                              IndexType_ maxIter,
+                                              IndexType_ & iter,
+                                              ValueType_ * __restrict__ eigVals,
+                                              ValueType_ * __restrict__ eigVecs,
+                                              bool smallest_eig) {
+
+      // -------------------------------------------------------
+      // Check that parameters are valid
+      // -------------------------------------------------------
+      if(A.m != A.n) {
+        WARNING("invalid parameter (matrix is not square)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs < 1) {
+        WARNING("invalid parameter (nEigVecs<1)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs > A.n) {
+        WARNING("invalid parameters (nEigVecs>n)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(maxIter < 0) {
+        WARNING("invalid parameter (maxIter<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+
+      // -------------------------------------------------------
+      // Variable initialization
+      // -------------------------------------------------------
+
+      IndexType_ n = A.n;
+      IndexType_ b = std::min(n, nEigVecs+SUBSPACE_HOST_OVERSAMPLE);
+      std::vector<ValueType_> X(static_cast<size_t>(n)*b);
+      std::vector<ValueType_> W(static_cast<size_t>(n)*b);
+      std::vector<ValueType_> H(static_cast<size_t>(b)*b);
+      std::vector<ValueType_> ritzVals(b), ritzVecs(static_cast<size_t>(b)*b);
+      std::vector<ValueType_> G, partial;
+
+      // Gaussian sketch
+      std::mt19937_64 rng(123456);
+      std::normal_distribution<double> normalDist(0,1);
+      for(size_t i=0; i<X.size(); ++i)
+        X[i] = static_cast<ValueType_>(normalDist(rng));
+      choleskyQR(n, b, &X[0], G, partial);
+
+      // -------------------------------------------------------
+      // Subspace iteration
+      // -------------------------------------------------------
+
+      ValueType_ sigma = 0;
+      ValueType_ sign = smallest_eig ? -1 : 1;
+      iter = 0;
+      for(IndexType_ it=0; ; ++it) {
+        A.mm(b, 1, &X[0], 0, &W[0]);
+        iter += b;
+        for(IndexType_ j=0; j<b; ++j)
+          sigma = std::max(sigma, nrm2(n, &W[IDX(0,j,n)], partial));
+        if(it == maxIter)
+          break;
+
+        // X = sigma*X -/+ A*X
+        #pragma omp parallel for schedule(static)
+        for(size_t i=0; i<X.size(); ++i)
+          X[i] = sigma*X[i] + sign*W[i];
+        choleskyQR(n, b, &X[0], G, partial);
+      }
+
+      // -------------------------------------------------------
+      // Rayleigh-Ritz
+      // -------------------------------------------------------
+
+      blockedGemmT(n, b, b, &X[0], n, &W[0], n, &H[0], b, partial);
+      for(IndexType_ j=0; j<b; ++j)
+        for(IndexType_ i=0; i<j; ++i) {
+          ValueType_ c = (H[IDX(i,j,b)]+H[IDX(j,i,b)])/2;
+          H[IDX(i,j,b)] = c;
+          H[IDX(j,i,b)] = c;
+        }
+      symmetricEigenvectors(b, &H[0], b, &ritzVals[0], &ritzVecs[0]);
+      IndexType_ first = smallest_eig ? 0 : b-nEigVecs;
+      memcpy(eigVals, &ritzVals[first], nEigVecs*sizeof(ValueType_));
+      blockedGemm(n, b, nEigVecs, &X[0], n,
+                  &ritzVecs[IDX(0,first,b)], b, eigVecs, n);
+      return NVGRAPH_OK;
+    }
+
+    /// Compute smallest eigenvectors of symmetric matrix with LOBPCG
+    /** The block S = [X, P, W] holds the current Ritz vectors X, the
+     *  previous search directions P and the preconditioned residuals
+     *  W = M\(A*X-X*E), with M applied by A.prec_solve. P and W are
+     *  orthonormalized against X and among themselves (Cholesky QR)
+     *  and the Rayleigh-Ritz step on S gives the next X and P. A*S is
+     *  updated with the same linear combinations as S, so there is one
+     *  block product (with W) per iteration.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    NVGRAPH_ERROR computeEigenvectorsLobpcg(const Matrix<IndexType_,ValueType_> & A,
+                                            IndexType_ nEigVecs,
+                                            IndexType_ maxIter,
+                                            ValueType_ tol,
+                                            IndexType_ & iter,
+                                            ValueType_ * __restrict__ eigVals,
+                                            ValueType_ * __restrict__ eigVecs) {
+
+      // -------------------------------------------------------
+      // Check that parameters are valid
+      // -------------------------------------------------------
+      if(A.m != A.n) {
+        WARNING("invalid parameter (matrix is not square)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs < 1) {
+        WARNING("invalid parameter (nEigVecs<1)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(maxIter < 0) {
+        WARNING("invalid parameter (maxIter<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(tol < 0) {
+        WARNING("invalid parameter (tol<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(3*nEigVecs > A.n) {
+        WARNING("invalid parameters (3*nEigVecs>n)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+
+      // -------------------------------------------------------
+      // Variable initialization
+      // -------------------------------------------------------
+
+      IndexType_ n = A.n;
+      IndexType_ k = nEigVecs;
+      std::vector<ValueType_> S(static_cast<size_t>(n)*3*k);
+      std::vector<ValueType_> AS(static_cast<size_t>(n)*3*k);
+      std::vector<ValueType_> work(static_cast<size_t>(n)*k);
+      std::vector<ValueType_> H(static_cast<size_t>(9)*k*k);
+      std::vector<ValueType_> C(static_cast<size_t>(6)*k*k);
+      std::vector<ValueType_> ritzVals(3*k), ritzVecs(static_cast<size_t>(9)*k*k);
+      std::vector<ValueType_> G, partial;
+      ValueType_ * X = &S[0];
+      ValueType_ * AX = &AS[0];
+
+      // Random orthonormal block and its Ritz vectors
+      std::mt19937_64 rng(123456);
+      std::normal_distribution<double> normalDist(0,1);
+      for(size_t i=0; i<static_cast<size_t>(n)*k; ++i)
+        X[i] = static_cast<ValueType_>(normalDist(rng));
+      choleskyQR(n, k, X, G, partial);
+      A.mm(k, 1, X, 0, AX);
+      blockedGemmT(n, k, k, X, n, AX, n, &H[0], k, partial);
+      for(IndexType_ j=0; j<k; ++j)
+        for(IndexType_ i=0; i<j; ++i) {
+          ValueType_ c = (H[IDX(i,j,k)]+H[IDX(j,i,k)])/2;
+          H[IDX(i,j,k)] = c;
+          H[IDX(j,i,k)] = c;
+        }
+      symmetricEigenvectors(k, &H[0], k, &ritzVals[0], &ritzVecs[0]);
+      blockedGemm(n, k, k, X, n, &ritzVecs[0], k, X, n);
+      blockedGemm(n, k, k, AX, n, &ritzVecs[0], k, AX, n);
+      memcpy(eigVals, &ritzVals[0], k*sizeof(ValueType_));
+      ValueType_ anorm = std::max(std::fabs(ritzVals[0]), std::fabs(ritzVals[k-1]));
+
+      // -------------------------------------------------------
+      // LOBPCG iteration
+      // -------------------------------------------------------
+
+      // Number of columns of P (none before the first step)
+      IndexType_ nP = 0;
+      for(iter=0; ; ++iter) {
+        ValueType_ * P = &S[IDX(0,k,n)];
+        ValueType_ * AP = &AS[IDX(0,k,n)];
+        ValueType_ * W = &S[IDX(0,k+nP,n)];
+        ValueType_ * AW = &AS[IDX(0,k+nP,n)];
+
+        // Residuals W = A*X - X*E
+        #pragma omp parallel for schedule(static)
+        for(IndexType_ i=0; i<n; ++i)
+          for(IndexType_ j=0; j<k; ++j)
+            W[IDX(i,j,n)] = AX[IDX(i,j,n)] - eigVals[j]*X[IDX(i,j,n)];
+        bool converged = true;
+        for(IndexType_ j=0; j<k; ++j)
+          if(nrm2(n, &W[IDX(0,j,n)], partial) > tol*anorm)
+            converged = false;
+        if(converged || iter >= maxIter)
+          break;
+
+        // Preconditioning W = M\W
+        A.prec_solve(k, 1, W, &work[0]);
+
+        // Orthonormalize P against X, then W against [X, P]
+        if(nP > 0) {
+          blockedGemmT(n, k, nP, X, n, P, n, &C[0], k, partial);
+          gemmMinus(n, k, nP, X, n, &C[0], k, P, n);
+          gemmMinus(n, k, nP, AX, n, &C[0], k, AP, n);
+          choleskyQR(n, nP, P, G, partial, AP);
+        }
+        for(int pass=0; pass<2; ++pass) {
+          blockedGemmT(n, k+nP, k, X, n, W, n, &C[0], k+nP, partial);
+          gemmMinus(n, k+nP, k, X, n, &C[0], k+nP, W, n);
+        }
+        choleskyQR(n, k, W, G, partial);
+        A.mm(k, 1, W, 0, AW);
+
+        // Rayleigh-Ritz on S = [X, P, W]
+        IndexType_ m = 2*k+nP;
+        blockedGemmT(n, m, m, &S[0], n, &AS[0], n, &H[0], m, partial);
+        for(IndexType_ j=0; j<m; ++j)
+          for(IndexType_ i=0; i<j; ++i) {
+            ValueType_ c = (H[IDX(i,j,m)]+H[IDX(j,i,m)])/2;
+            H[IDX(i,j,m)] = c;
+            H[IDX(j,i,m)] = c;
+          }
+        symmetricEigenvectors(m, &H[0], m, &ritzVals[0], &ritzVecs[0]);
+        memcpy(eigVals, &ritzVals[0], k*sizeof(ValueType_));
+        anorm = std::max(anorm, std::max(std::fabs(ritzVals[0]), std::fabs(ritzVals[m-1])));
+
+        // [X, P] = S*[C, C_PW], where C_PW is C without its X rows
+        for(IndexType_ j=0; j<k; ++j)
+          for(IndexType_ i=0; i<m; ++i) {
+            C[IDX(i,j,m)] = ritzVecs[IDX(i,j,m)];
+            C[IDX(i,k+j,m)] = (i < k) ? 0 : ritzVecs[IDX(i,j,m)];
+          }
+        blockedGemm(n, m, 2*k, &S[0], n, &C[0], m, &S[0], n);
+        blockedGemm(n, m, 2*k, &AS[0], n, &C[0], m, &AS[0], n);
+        nP = k;
+      }
+
+      memcpy(eigVecs, X, static_cast<size_t>(n)*k*sizeof(ValueType_));
+      return NVGRAPH_OK;
+    }
+  }
+
+  // =========================================================
+  // Eigensolver
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_host(const Matrix<IndexType_,ValueType_> & A,
+                                                 IndexType_ nEigVecs,
+                                                 IndexType_ maxIter,
+                                                 IndexType_ restartIter,
+                                                 ValueType_ tol,
+                                                 bool reorthogonalize,
+                                                 IndexType_ & iter,
+                                                 ValueType_ * __restrict__ eigVals,
+                                                 ValueType_ * __restrict__ eigVecs) {
+    return computeEigenvectors(A, nEigVecs, maxIter, restartIter, tol,
+                               reorthogonalize, iter, eigVals, eigVecs, true);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeLargestEigenvectors_host(const Matrix<IndexType_,ValueType_> & A,
+                                                IndexType_ nEigVecs,
+                                                IndexType_ maxIter,
+                                                IndexType_ restartIter,
+                                                ValueType_ tol,
+                                                bool reorthogonalize,
+                                                IndexType_ & iter,
+                                                ValueType_ * __restrict__ eigVals,
+                                                ValueType_ * __restrict__ eigVecs) {
+    return computeEigenvectors(A, nEigVecs, maxIter, restartIter, tol,
+                               reorthogonalize, iter, eigVals, eigVecs, false);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_block_host(const Matrix<IndexType_,ValueType_> & A,
+                                                       IndexType_ nEigVecs,
+                                                       IndexType_ blockSize,
+                                                       IndexType_ maxIter,
+                                                       IndexType_ restartIter,
+                                                       ValueType_ tol,
+                                                       IndexType_ & iter,
+                                                       ValueType_ * __restrict__ eigVals,
+                                                       ValueType_ * __restrict__ eigVecs) {
+    return computeEigenvectorsBlock(A, nEigVecs, blockSize, maxIter, restartIter, tol,
+                                    iter, eigVals, eigVecs, true);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeLargestEigenvectors_block_host(const Matrix<IndexType_,ValueType_> & A,
+                                                      IndexType_ nEigVecs,
+                                                      IndexType_ blockSize,
+                                                      IndexType_ maxIter,
+                                                      IndexType_ restartIter,
+                                                      ValueType_ tol,
+                                                      IndexType_ & iter,
+                                                      ValueType_ * __restrict__ eigVals,
+                                                      ValueType_ * __restrict__ eigVecs) {
+    return computeEigenvectorsBlock(A, nEigVecs, blockSize, maxIter, restartIter, tol,
+                                    iter, eigVals, eigVecs, false);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void symmetricEigenvectors_host(IndexType_ m,
+                                  const ValueType_ * H, IndexType_ ldh,
+                                  ValueType_ * __restrict__ eigVals,
+                                  ValueType_ * __restrict__ eigVecs) {
+    symmetricEigenvectors(m, H, ldh, eigVals, eigVecs);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_lobpcg_host(const Matrix<IndexType_,ValueType_> & A,
+                                                        IndexType_ nEigVecs,
+                                                        IndexType_ maxIter,
+                                                        ValueType_ tol,
+                                                        IndexType_ & iter,
+                                                        ValueType_ * __restrict__ eigVals,
+                                                        ValueType_ * __restrict__ eigVecs) {
+    return computeEigenvectorsLobpcg(A, nEigVecs, maxIter, tol, iter, eigVals, eigVecs);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_subspace_host(const Matrix<IndexType_,ValueType_> & A,
+                                                          IndexType_ nEigVecs,
+                                                          IndexType_ maxIter,
+                                                          IndexType_ & iter,
+                                                          ValueType_ * __restrict__ eigVals,
+                                                          ValueType_ * __restrict__ eigVecs) {
+    return computeEigenvectorsSubspace(A, nEigVecs, maxIter, iter, eigVals, eigVecs, true);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeLargestEigenvectors_subspace_host(const Matrix<IndexType_,ValueType_> & A,
+                                                         IndexType_ nEigVecs,
+                                                         IndexType_ maxIter,
+                                                         IndexType_ & iter,
+                                                         ValueType_ * __restrict__ eigVals,
+                                                         ValueType_ * __restrict__ eigVecs) {
+    return computeEigenvectorsSubspace(A, nEigVecs, maxIter, iter, eigVals, eigVecs, false);
+  }
+
+  // =========================================================
+  // Explicit instantiation
+  // =========================================================
+
+  template NVGRAPH_ERROR computeSmallestEigenvectors_host<int,float>
+  (const Matrix<int,float> & A,
+   int nEigVecs, int maxIter, int restartIter, float tol,
+   bool reorthogonalize, int & iter,
+   float * __restrict__ eigVals,
+   float * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeSmallestEigenvectors_host<int,double>
+  (const Matrix<int,double> & A,
+   int nEigVecs, int maxIter, int restartIter, double tol,
+   bool reorthogonalize, int & iter,
+   double * __restrict__ eigVals,
+   double * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeLargestEigenvectors_host<int,float>
+  (const Matrix<int,float> & A,
+   int nEigVecs, int maxIter, int restartIter, float tol,
+   bool reorthogonalize, int & iter,
+   float * __restrict__ eigVals,
+   float * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeLargestEigenvectors_host<int,double>
+  (const Matrix<int,double> & A,
+   int nEigVecs, int maxIter, int restartIter, double tol,
+   bool reorthogonalize, int & iter,
+   double * __restrict__ eigVals,
+   double * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeSmallestEigenvectors_block_host<int,float>
+  (const Matrix<int,float> & A,
+   int nEigVecs, int blockSize, int maxIter, int restartIter, float tol,
+   int & iter,
+   float * __restrict__ eigVals,
+   float * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeSmallestEigenvectors_block_host<int,double>
+  (const Matrix<int,double> & A,
+   int nEigVecs, int blockSize, int maxIter, int restartIter, double tol,
+   int & iter,
+   double * __restrict__ eigVals,
+   double * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeLargestEigenvectors_block_host<int,float>
+  (const Matrix<int,float> & A,
+   int nEigVecs, int blockSize, int maxIter, int restartIter, float tol,
+   int & iter,
+   float * __restrict__ eigVals,
+   float * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeLargestEigenvectors_block_host<int,double>
+  (const Matrix<int,double> & A,
+   int nEigVecs, int blockSize, int maxIter, int restartIter, double tol,
+   int & iter,
+   double * __restrict__ eigVals,
+   double * __restrict__ eigVecs);
+
+  template void symmetricEigenvectors_host<int,float>
+  (int m, const float * H, int ldh,
+   float * __restrict__ eigVals, float * __restrict__ eigVecs);
+  template void symmetricEigenvectors_host<int,double>
+  (int m, const double * H, int ldh,
+   double * __restrict__ eigVals, double * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeSmallestEigenvectors_lobpcg_host<int,float>
+  (const Matrix<int,float> & A, int nEigVecs, int maxIter, float tol, int & iter,
+   float * __restrict__ eigVals, float * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeSmallestEigenvectors_lobpcg_host<int,double>
+  (const Matrix<int,double> & A, int nEigVecs, int maxIter, double tol, int & iter,
+   double * __restrict__ eigVals, double * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeSmallestEigenvectors_subspace_host<int,float>
+  (const Matrix<int,float> & A, int nEigVecs, int maxIter, int & iter,
+   float * __restrict__ eigVals, float * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeSmallestEigenvectors_subspace_host<int,double>
+  (const Matrix<int,double> & A, int nEigVecs, int maxIter, int & iter,
+   double * __restrict__ eigVals, double * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeLargestEigenvectors_subspace_host<int,float>
+  (const Matrix<int,float> & A, int nEigVecs, int maxIter, int & iter,
+   float * __restrict__ eigVals, float * __restrict__ eigVecs);
+  template NVGRAPH_ERROR computeLargestEigenvectors_subspace_host<int,double>
+  (const Matrix<int,double> & A, int nEigVecs, int maxIter, int & iter,
+   double * __restrict__ eigVals, double * __restrict__ eigVecs);
+
+}
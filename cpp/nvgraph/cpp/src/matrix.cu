@@ -25,6 +25,8 @@
 #include "nvgraph_vector.hxx"
 #include "nvgraph_cublas.hxx"
 #include "nvgraph_cusparse.hxx"
+#include "matrix_fused.hxx"
+#include "sm_utils.h"
 #include "debug_macros.h"
 
 // =========================================================
@@ -34,6 +36,9 @@
 // CUDA block size
 #define BLOCK_SIZE 1024
 
+// Threads per warp
+#define WARP_SIZE 32
+
 // Get index of matrix entry
 #define IDX(i,j,lda) ((i)+(j)*(lda))
 
@@ -75,6 +80,56 @@ namespace nvgraph {
             }
         }
     }
+
+    /// Fused Laplacian product for a set of dense vectors
+    /** y = alpha*(D*x-A*x)+beta*y with one warp per row of A.
+     */
+    template <typename IndexType_, typename ValueType_> static __global__
+    void laplacianmm(IndexType_ n, IndexType_ k, ValueType_ alpha,
+                     const IndexType_ * __restrict__ csrRowPtr,
+                     const IndexType_ * __restrict__ csrColInd,
+                     const ValueType_ * __restrict__ csrVal,
+                     const ValueType_ * __restrict__ D,
+                     const ValueType_ * __restrict__ x,
+                     ValueType_ beta, ValueType_ * __restrict__ y) {
+      IndexType_ lane = threadIdx.x % WARP_SIZE;
+      IndexType_ warp = (threadIdx.x + blockIdx.x*blockDim.x)/WARP_SIZE;
+      IndexType_ nWarps = (blockDim.x*gridDim.x)/WARP_SIZE;
+      for(IndexType_ j=blockIdx.y; j<k; j+=gridDim.y) {
+        const ValueType_ * xj = x+IDX(0,j,n);
+        for(IndexType_ i=warp; i<n; i+=nWarps) {
+          ValueType_ ax = utils::warp_sum(csrRowDot(csrRowPtr[i]+lane, csrRowPtr[i+1],
+                                                    (IndexType_) WARP_SIZE,
+                                                    csrColInd, csrVal, xj));
+          if(lane == 0)
+            laplacianUpdate(alpha, D[i], xj[i], ax, beta, y[IDX(i,j,n)]);
+        }
+      }
+    }
+
+    /// Fused modularity product
+    /** y = alpha*(A*x-gamma*d)+beta*y with one warp per row of A.
+     */
+    template <typename IndexType_, typename ValueType_> static __global__
+    void modularitymv(IndexType_ n, ValueType_ alpha,
+                      const IndexType_ * __restrict__ csrRowPtr,
+                      const IndexType_ * __restrict__ csrColInd,
+                      const ValueType_ * __restrict__ csrVal,
+                      const ValueType_ * __restrict__ D, ValueType_ gamma,
+                      const ValueType_ * __restrict__ x,
+                      ValueType_ beta, ValueType_ * __restrict__ y) {
+      IndexType_ lane = threadIdx.x % WARP_SIZE;
+      IndexType_ warp = (threadIdx.x + blockIdx.x*blockDim.x)/WARP_SIZE;
+      IndexType_ nWarps = (blockDim.x*gridDim.x)/WARP_SIZE;
+      for(IndexType_ i=warp; i<n; i+=nWarps) {
+        ValueType_ ax = utils::warp_sum(csrRowDot(csrRowPtr[i]+lane, csrRowPtr[i+1],
+                                                  (IndexType_) WARP_SIZE,
+                                                  csrColInd, csrVal, x));
+        if(lane == 0)
+          modularityUpdate(alpha, ax, gamma, D[i], beta, y[i]);
+      }
+    }
+
   }
 
   // =============================================
@@ -397,6 +452,15 @@ namespace nvgraph {
   ::mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
        ValueType_ beta, ValueType_ * __restrict__ y) const {
 
+    // Fused product if the adjacency matrix is a plain CSR matrix
+    const CsrMatrix<IndexType_,ValueType_> * csr
+      = dynamic_cast<const CsrMatrix<IndexType_,ValueType_>*>(A);
+    if(csr != NULL && !csr->trans && !csr->sym
+       && (csr->descrA == 0 || cusparseGetMatIndexBase(csr->descrA) == CUSPARSE_INDEX_BASE_ZERO)) {
+      this->mm(1, alpha, x, beta, y);
+      return;
+    }
+
     // Scale result vector
     if(beta==0)
       CHECK_CUDA(cudaMemset(y, 0, (this->n)*sizeof(ValueType_)))
@@ -434,6 +498,26 @@ namespace nvgraph {
   void LaplacianMatrix<IndexType_, ValueType_>
   ::mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x,
        ValueType_ beta, ValueType_ * __restrict__ y) const {
+
+      // Fused product, one warp per row of the adjacency matrix
+      const CsrMatrix<IndexType_,ValueType_> * csr
+        = dynamic_cast<const CsrMatrix<IndexType_,ValueType_>*>(A);
+      if(csr != NULL && !csr->trans && !csr->sym
+         && (csr->descrA == 0 || cusparseGetMatIndexBase(csr->descrA) == CUSPARSE_INDEX_BASE_ZERO)) {
+          dim3 gridDim, blockDim;
+          gridDim.x  = min(((this->n)+BLOCK_SIZE/WARP_SIZE-1)/(BLOCK_SIZE/WARP_SIZE), 65535);
+          gridDim.y  = min(k,65535);
+          gridDim.z  = 1;
+          blockDim.x = BLOCK_SIZE;
+          blockDim.y = 1;
+          blockDim.z = 1;
+          laplacianmm <<< gridDim, blockDim, 0, A->s >>>
+            (this->n, k, alpha, csr->csrRowPtrA, csr->csrColIndA, csr->csrValA,
+             D.raw(), x, beta, y);
+          cudaCheckError();
+          return;
+      }
+
       // Apply diagonal matrix
       ValueType_ one = (ValueType_)1.0;
       this->dm(k,alpha,x,beta,y);     
@@ -573,6 +657,28 @@ namespace nvgraph {
   ::mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
        ValueType_ beta, ValueType_ * __restrict__ y) const {
 
+    // Fused product if the adjacency matrix is a plain CSR matrix:
+    // gamma = d'*x/edge_sum, then one warp per row of A
+    const CsrMatrix<IndexType_,ValueType_> * csr
+      = dynamic_cast<const CsrMatrix<IndexType_,ValueType_>*>(A);
+    if(csr != NULL && !csr->trans && !csr->sym
+       && (csr->descrA == 0 || cusparseGetMatIndexBase(csr->descrA) == CUSPARSE_INDEX_BASE_ZERO)) {
+      ValueType_ dot_res;
+      Cublas::dot(this->n, D.raw(), 1, x, 1, &dot_res);
+      dim3 gridDim, blockDim;
+      gridDim.x  = min(((this->n)+BLOCK_SIZE/WARP_SIZE-1)/(BLOCK_SIZE/WARP_SIZE), 65535);
+      gridDim.y  = 1;
+      gridDim.z  = 1;
+      blockDim.x = BLOCK_SIZE;
+      blockDim.y = 1;
+      blockDim.z = 1;
+      modularitymv <<< gridDim, blockDim, 0, A->s >>>
+        (this->n, alpha, csr->csrRowPtrA, csr->csrColIndA, csr->csrValA,
+         D.raw(), dot_res/this->edge_sum, x, beta, y);
+      cudaCheckError();
+      return;
+    }
+
     // Scale result vector
     if(alpha!=1 || beta!=0)
       FatalError("This isn't implemented for Modularity Matrix currently", NVGRAPH_ERR_NOT_IMPLEMENTED);
@@ -598,7 +704,15 @@ namespace nvgraph {
   void ModularityMatrix<IndexType_, ValueType_>
   ::mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x,
        ValueType_ beta, ValueType_ * __restrict__ y) const {
-       FatalError("This isn't implemented for Modularity Matrix currently", NVGRAPH_ERR_NOT_IMPLEMENTED);
+       const CsrMatrix<IndexType_,ValueType_> * csr
+         = dynamic_cast<const CsrMatrix<IndexType_,ValueType_>*>(A);
+       if(csr == NULL || csr->trans || csr->sym
+          || (csr->descrA != 0 && cusparseGetMatIndexBase(csr->descrA) != CUSPARSE_INDEX_BASE_ZERO))
+         FatalError("This isn't implemented for Modularity Matrix currently", NVGRAPH_ERR_NOT_IMPLEMENTED);
+
+       // Fused product for each vector
+       for(IndexType_ j=0; j<k; ++j)
+         this->mv(alpha, x+IDX(0,j,this->n), beta, y+IDX(0,j,this->n));
   }
 
   template <typename IndexType_, typename ValueType_>
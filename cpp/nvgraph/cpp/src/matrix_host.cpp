@@ -0,0 +1,837 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "matrix_host.hxx"
+
+#include <string.h>
+#include <limits>
+#include <vector>
+
+#include "nvgraph_error.hxx"
+#include "matrix_fused.hxx"
+
+// Get index of matrix entry
+#define IDX(i,j,lda) ((i)+(j)*(lda))
+
+// Aggregation preconditioner: Jacobi damping factor, sweeps on the
+// coarsest graph and maximum number of levels
+#define AGGREGATION_JACOBI_OMEGA 0.6666666666666666
+#define AGGREGATION_COARSEST_SWEEPS 10
+#define AGGREGATION_MAX_LEVELS 40
+
+namespace nvgraph {
+
+  namespace {
+
+    /// y = alpha*x + beta*y for a set of k vectors
+    /** y is set (not scaled) when beta is zero so that NaNs in y
+     *  are not propagated.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    void axpby(IndexType_ t, ValueType_ alpha, const ValueType_ * __restrict__ x,
+               ValueType_ beta, ValueType_ * __restrict__ y) {
+      if(beta == 0) {
+        #pragma omp parallel for schedule(static)
+        for(IndexType_ i=0; i<t; ++i)
+          y[i] = alpha*x[i];
+      }
+      else {
+        #pragma omp parallel for schedule(static)
+        for(IndexType_ i=0; i<t; ++i)
+          y[i] = alpha*x[i] + beta*y[i];
+      }
+    }
+
+    /// Diagonal of the Laplacian of a graph (degrees without self
+    /// loops)
+    template <typename IndexType_, typename ValueType_> static
+    void laplacianDiagonal(const GraphLevelHost<IndexType_,ValueType_> & G,
+                           std::vector<ValueType_> & d) {
+      d.resize(G.n);
+      #pragma omp parallel for schedule(dynamic, 1024)
+      for(IndexType_ i=0; i<G.n; ++i) {
+        ValueType_ s = 0;
+        for(IndexType_ j=G.rowPtr[i]; j<G.rowPtr[i+1]; ++j)
+          if(G.colInd[j] != i)
+            s += G.edge(j);
+        d[i] = s;
+      }
+    }
+
+    /// r = b - L*x for the Laplacian L of a graph with diagonal d
+    template <typename IndexType_, typename ValueType_> static
+    void laplacianResidual(const GraphLevelHost<IndexType_,ValueType_> & G,
+                           const std::vector<ValueType_> & d,
+                           const ValueType_ * b, const ValueType_ * x,
+                           ValueType_ * r) {
+      #pragma omp parallel for schedule(dynamic, 1024)
+      for(IndexType_ i=0; i<G.n; ++i) {
+        ValueType_ s = b[i] - d[i]*x[i];
+        for(IndexType_ j=G.rowPtr[i]; j<G.rowPtr[i+1]; ++j)
+          if(G.colInd[j] != i)
+            s += G.edge(j)*x[G.colInd[j]];
+        r[i] = s;
+      }
+    }
+
+    /// x = x + omega*D\r (damped Jacobi update), isolated vertices
+    /// are left unscaled
+    template <typename IndexType_, typename ValueType_> static
+    void jacobiUpdate(IndexType_ n, const std::vector<ValueType_> & d,
+                      const ValueType_ * r, ValueType_ * x) {
+      const ValueType_ omega = AGGREGATION_JACOBI_OMEGA;
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ i=0; i<n; ++i)
+        x[i] += (d[i] > 0) ? omega*r[i]/d[i] : omega*r[i];
+    }
+
+  }
+
+  // =============================================
+  // CSR matrix class (host memory)
+  // =============================================
+
+  /// Constructor for host CSR matrix class
+  /** @param m Number of rows.
+   *  @param n Number of columns.
+   *  @param nnz Number of non-zero entries.
+   *  @param csrValA (Input, host memory, nnz entries) Matrix
+   *    entries. If NULL, every entry is 1.
+   *  @param csrRowPtrA (Input, host memory, m+1 entries) Pointer to
+   *    first entry in each row.
+   *  @param csrColIndA (Input, host memory, nnz entries) Column
+   *    index of each matrix entry.
+   */
+  template <typename IndexType_, typename ValueType_>
+  CsrMatrixHost<IndexType_,ValueType_>
+  ::CsrMatrixHost(IndexType_ _m, IndexType_ _n, IndexType_ _nnz,
+                  const ValueType_ * _csrValA,
+                  const IndexType_ * _csrRowPtrA,
+                  const IndexType_ * _csrColIndA)
+    : Matrix<IndexType_,ValueType_>(_m,_n),
+      nnz(_nnz), csrValA(_csrValA),
+      csrRowPtrA(_csrRowPtrA), csrColIndA(_csrColIndA) {
+  }
+
+  /// Destructor for host CSR matrix class
+  template <typename IndexType_, typename ValueType_>
+  CsrMatrixHost<IndexType_,ValueType_>::~CsrMatrixHost() {}
+
+  /// Get and Set CUDA stream
+  template <typename IndexType_, typename ValueType_>
+  void CsrMatrixHost<IndexType_,ValueType_>::setCUDAStream(cudaStream_t _s) {
+      this->s = _s;
+  }
+  template <typename IndexType_, typename ValueType_>
+  void CsrMatrixHost<IndexType_,ValueType_>::getCUDAStream(cudaStream_t *_s) {
+      *_s = this->s;
+  }
+
+  /// Matrix-vector product for host CSR matrix class
+  /** y is overwritten with alpha*A*x+beta*y.
+   *
+   *  @param alpha Scalar.
+   *  @param x (Input, host memory, n entries) Vector.
+   *  @param beta Scalar.
+   *  @param y (Input/output, host memory, m entries) Output vector.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void CsrMatrixHost<IndexType_,ValueType_>
+  ::mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+       ValueType_ beta, ValueType_ * __restrict__ y) const {
+    #pragma omp parallel for schedule(dynamic, 256)
+    for(IndexType_ i=0; i<this->m; ++i) {
+      ValueType_ sum = csrRowDot(csrRowPtrA[i], csrRowPtrA[i+1], (IndexType_) 1,
+                                 csrColIndA, csrValA, x);
+      y[i] = (beta == 0) ? alpha*sum : alpha*sum + beta*y[i];
+    }
+  }
+
+  /// Matrix-set of k vectors product for host CSR matrix class
+  /** y is overwritten with alpha*A*x+beta*y.
+   *
+   *  @param k Number of vectors.
+   *  @param alpha Scalar.
+   *  @param x (Input, host memory, n*k entries) nxk dense matrix.
+   *  @param beta Scalar.
+   *  @param y (Input/output, host memory, m*k entries) Output mxk
+   *    dense matrix.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void CsrMatrixHost<IndexType_,ValueType_>
+  ::mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const {
+    #pragma omp parallel
+    {
+      // Row of the result, each matrix entry is read once for the
+      // k vectors
+      std::vector<ValueType_> sum(k);
+      #pragma omp for schedule(dynamic, 256)
+      for(IndexType_ i=0; i<this->m; ++i) {
+        memset(&sum[0], 0, k*sizeof(ValueType_));
+        for(IndexType_ j=csrRowPtrA[i]; j<csrRowPtrA[i+1]; ++j) {
+          ValueType_ a = (csrValA != NULL) ? csrValA[j] : 1;
+          IndexType_ col = csrColIndA[j];
+          for(IndexType_ l=0; l<k; ++l)
+            sum[l] += a*x[IDX(col,l,this->n)];
+        }
+        for(IndexType_ l=0; l<k; ++l) {
+          ValueType_ & yil = y[IDX(i,l,this->m)];
+          yil = (beta == 0) ? alpha*sum[l] : alpha*sum[l] + beta*yil;
+        }
+      }
+    }
+  }
+
+  /// Color and Reorder
+  template <typename IndexType_, typename ValueType_>
+  void CsrMatrixHost<IndexType_,ValueType_>
+  ::color(IndexType_ *c, IndexType_ *p) const {
+
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void CsrMatrixHost<IndexType_,ValueType_>
+  ::reorder(IndexType_ *p) const {
+
+  }
+
+  /// Incomplete Cholesky (setup, factor and solve)
+  template <typename IndexType_, typename ValueType_>
+  void CsrMatrixHost<IndexType_,ValueType_>
+  ::prec_setup(Matrix<IndexType_,ValueType_> * _M) {
+    FatalError("This isn't implemented for host CSR Matrix currently", NVGRAPH_ERR_NOT_IMPLEMENTED);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void CsrMatrixHost<IndexType_,ValueType_>
+  ::prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const {
+    FatalError("This isn't implemented for host CSR Matrix currently", NVGRAPH_ERR_NOT_IMPLEMENTED);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  ValueType_ CsrMatrixHost<IndexType_,ValueType_>
+  ::getEdgeSum() const {
+    return 0.0;
+  }
+
+  // =============================================
+  // Laplacian matrix class (host memory)
+  // =============================================
+
+  /// Constructor for host Laplacian matrix class
+  /** @param A Adjacency matrix (host products)
+   */
+  template <typename IndexType_, typename ValueType_>
+  LaplacianMatrixHost<IndexType_,ValueType_>
+  ::LaplacianMatrixHost(const Matrix<IndexType_,ValueType_> & _A)
+    : Matrix<IndexType_,ValueType_>(_A.m,_A.n), A(&_A) {
+
+    // Check that adjacency matrix is square
+    if(_A.m != _A.n)
+      FatalError("cannot construct Laplacian matrix from non-square adjacency matrix",
+                 NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // Construct degree matrix
+    D.resize(_A.m);
+    std::vector<ValueType_> ones(this->n, 1);
+    _A.mv(1, &ones[0], 0, &D[0]);
+
+    // Set preconditioning matrix pointer to NULL
+    M = NULL;
+  }
+
+  /// Destructor for host Laplacian matrix class
+  template <typename IndexType_, typename ValueType_>
+  LaplacianMatrixHost<IndexType_,ValueType_>::~LaplacianMatrixHost() {}
+
+  /// Get and Set CUDA stream
+  template <typename IndexType_, typename ValueType_>
+  void LaplacianMatrixHost<IndexType_,ValueType_>::setCUDAStream(cudaStream_t _s) {
+      this->s = _s;
+      if (M != NULL) {
+          M->setCUDAStream(_s);
+      }
+  }
+  template <typename IndexType_, typename ValueType_>
+  void LaplacianMatrixHost<IndexType_,ValueType_>::getCUDAStream(cudaStream_t * _s) {
+      *_s = this->s;
+  }
+
+  /// Matrix-vector product for host Laplacian matrix class
+  /** y is overwritten with alpha*A*x+beta*y.
+   *
+   *  @param alpha Scalar.
+   *  @param x (Input, host memory, n entries) Vector.
+   *  @param beta Scalar.
+   *  @param y (Input/output, host memory, m entries) Output vector.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void LaplacianMatrixHost<IndexType_,ValueType_>
+  ::mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+       ValueType_ beta, ValueType_ * __restrict__ y) const {
+    this->mm(1, alpha, x, beta, y);
+  }
+
+  /// Matrix-set of k vectors product for host Laplacian matrix class
+  /** y is overwritten with alpha*A*x+beta*y. With a CSR adjacency
+   *  matrix, each entry of D*x-A*x is computed in one pass over its
+   *  row (see matrix_fused.hxx).
+   *
+   *  @param alpha Scalar.
+   *  @param x (Input, host memory, n*k entries) nxk dense matrix.
+   *  @param beta Scalar.
+   *  @param y (Input/output, host memory, m*k entries) Output mxk
+   *    dense matrix.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void LaplacianMatrixHost<IndexType_,ValueType_>
+  ::mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x,
+       ValueType_ beta, ValueType_ * __restrict__ y) const {
+    IndexType_ n = this->n;
+
+    const CsrMatrixHost<IndexType_,ValueType_> * csr
+      = dynamic_cast<const CsrMatrixHost<IndexType_,ValueType_>*>(A);
+    if(csr == NULL) {
+      this->dm(k, alpha, x, beta, y);
+      if(k == 1)
+        A->mv(-alpha, x, 1, y);
+      else
+        A->mm(k, -alpha, x, 1, y);
+      return;
+    }
+
+    const IndexType_ * rowPtr = csr->csrRowPtrA;
+    #pragma omp parallel for schedule(dynamic, 256)
+    for(IndexType_ i=0; i<n; ++i) {
+      for(IndexType_ l=0; l<k; ++l) {
+        const ValueType_ * xl = x+IDX(0,l,n);
+        ValueType_ ax = csrRowDot(rowPtr[i], rowPtr[i+1], (IndexType_) 1,
+                                  csr->csrColIndA, csr->csrValA, xl);
+        laplacianUpdate(alpha, D[i], xl[i], ax, beta, y[IDX(i,l,n)]);
+      }
+    }
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void LaplacianMatrixHost<IndexType_,ValueType_>
+  ::dm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const {
+    IndexType_ n = this->n;
+    #pragma omp parallel for schedule(static)
+    for(IndexType_ i=0; i<n; ++i) {
+      for(IndexType_ l=0; l<k; ++l) {
+        ValueType_ & yil = y[IDX(i,l,n)];
+        yil = (beta == 0) ? alpha*D[i]*x[IDX(i,l,n)]
+                          : alpha*D[i]*x[IDX(i,l,n)] + beta*yil;
+      }
+    }
+  }
+
+  /// Color and Reorder
+  template <typename IndexType_, typename ValueType_>
+  void LaplacianMatrixHost<IndexType_,ValueType_>
+  ::color(IndexType_ *c, IndexType_ *p) const {
+
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void LaplacianMatrixHost<IndexType_,ValueType_>
+  ::reorder(IndexType_ *p) const {
+
+  }
+
+  /// Solve preconditioned system M x = f for a set of k vectors
+  template <typename IndexType_, typename ValueType_>
+  void LaplacianMatrixHost<IndexType_,ValueType_>
+  ::prec_setup(Matrix<IndexType_,ValueType_> * _M) {
+      //save the pointer to preconditioner M
+      M = _M;
+      if (M != NULL) {
+          //setup the preconditioning matrix M
+          M->prec_setup(NULL);
+      }
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void LaplacianMatrixHost<IndexType_,ValueType_>
+  ::prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const {
+      if (M != NULL) {
+          //preconditioning
+          M->prec_solve(k,alpha,fx,t);
+      }
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  ValueType_ LaplacianMatrixHost<IndexType_,ValueType_>
+  ::getEdgeSum() const {
+    return 0.0;
+  }
+
+  // =============================================
+  // Modularity matrix class (host memory)
+  // =============================================
+
+  /// Constructor for host Modularity matrix class
+  /** @param A Adjacency matrix (host products)
+   */
+  template <typename IndexType_, typename ValueType_>
+  ModularityMatrixHost<IndexType_,ValueType_>
+  ::ModularityMatrixHost(const Matrix<IndexType_,ValueType_> & _A, IndexType_ _nnz)
+    : Matrix<IndexType_,ValueType_>(_A.m,_A.n), A(&_A), nnz(_nnz) {
+
+    // Check that adjacency matrix is square
+    if(_A.m != _A.n)
+      FatalError("cannot construct Modularity matrix from non-square adjacency matrix",
+                 NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // Construct degree matrix
+    D.resize(_A.m);
+    std::vector<ValueType_> ones(this->n, 1);
+    _A.mv(1, &ones[0], 0, &D[0]);
+    edge_sum = 0;
+    for(IndexType_ i=0; i<this->n; ++i)
+      edge_sum += (D[i] < 0) ? -D[i] : D[i];
+
+    // Set preconditioning matrix pointer to NULL
+    M = NULL;
+  }
+
+  /// Destructor for host Modularity matrix class
+  template <typename IndexType_, typename ValueType_>
+  ModularityMatrixHost<IndexType_,ValueType_>::~ModularityMatrixHost() {}
+
+  /// Get and Set CUDA stream
+  template <typename IndexType_, typename ValueType_>
+  void ModularityMatrixHost<IndexType_,ValueType_>::setCUDAStream(cudaStream_t _s) {
+      this->s = _s;
+      if (M != NULL) {
+          M->setCUDAStream(_s);
+      }
+  }
+  template <typename IndexType_, typename ValueType_>
+  void ModularityMatrixHost<IndexType_,ValueType_>::getCUDAStream(cudaStream_t * _s) {
+      *_s = this->s;
+  }
+
+  /// Matrix-vector product for host Modularity matrix class
+  /** y is overwritten with alpha*B*x+beta*y, where
+   *  B = A - d*d'/edge_sum.
+   *
+   *  @param alpha Scalar.
+   *  @param x (Input, host memory, n entries) Vector.
+   *  @param beta Scalar.
+   *  @param y (Input/output, host memory, m entries) Output vector.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void ModularityMatrixHost<IndexType_,ValueType_>
+  ::mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+       ValueType_ beta, ValueType_ * __restrict__ y) const {
+    this->mm(1, alpha, x, beta, y);
+  }
+
+  /// Matrix-set of k vectors product for host Modularity matrix class
+  /** y is overwritten with alpha*B*x+beta*y. With a CSR adjacency
+   *  matrix, d'*x is computed first and each entry of
+   *  A*x-(d'*x/edge_sum)*d is then computed in one pass over its row
+   *  (see matrix_fused.hxx).
+   *
+   *  @param alpha Scalar.
+   *  @param x (Input, host memory, n*k entries) nxk dense matrix.
+   *  @param beta Scalar.
+   *  @param y (Input/output, host memory, m*k entries) Output mxk
+   *    dense matrix.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void ModularityMatrixHost<IndexType_,ValueType_>
+  ::mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x,
+       ValueType_ beta, ValueType_ * __restrict__ y) const {
+    IndexType_ n = this->n;
+
+    const CsrMatrixHost<IndexType_,ValueType_> * csr
+      = dynamic_cast<const CsrMatrixHost<IndexType_,ValueType_>*>(A);
+    if(csr != NULL) {
+      // gamma = d'*x/edge_sum for each vector
+      std::vector<ValueType_> gamma(k);
+      for(IndexType_ l=0; l<k; ++l) {
+        const ValueType_ * xl = x+IDX(0,l,n);
+        ValueType_ dot = 0;
+        #pragma omp parallel for schedule(static) reduction(+:dot)
+        for(IndexType_ i=0; i<n; ++i)
+          dot += D[i]*xl[i];
+        gamma[l] = dot/edge_sum;
+      }
+
+      const IndexType_ * rowPtr = csr->csrRowPtrA;
+      #pragma omp parallel for schedule(dynamic, 256)
+      for(IndexType_ i=0; i<n; ++i) {
+        for(IndexType_ l=0; l<k; ++l) {
+          ValueType_ ax = csrRowDot(rowPtr[i], rowPtr[i+1], (IndexType_) 1,
+                                    csr->csrColIndA, csr->csrValA, x+IDX(0,l,n));
+          modularityUpdate(alpha, ax, gamma[l], D[i], beta, y[IDX(i,l,n)]);
+        }
+      }
+      return;
+    }
+
+    // y = alpha*A*x + beta*y
+    if(k == 1)
+      A->mv(alpha, x, beta, y);
+    else
+      A->mm(k, alpha, x, beta, y);
+
+    // y = y - alpha*(d'*x/edge_sum)*d
+    for(IndexType_ l=0; l<k; ++l) {
+      const ValueType_ * xl = x+IDX(0,l,n);
+      ValueType_ * yl = y+IDX(0,l,n);
+      ValueType_ gamma = 0;
+      #pragma omp parallel for schedule(static) reduction(+:gamma)
+      for(IndexType_ i=0; i<n; ++i)
+        gamma += D[i]*xl[i];
+      gamma = -alpha*gamma/edge_sum;
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ i=0; i<n; ++i)
+        yl[i] += gamma*D[i];
+    }
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void ModularityMatrixHost<IndexType_,ValueType_>
+  ::dm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const {
+    axpby(k*this->n, alpha, x, beta, y);
+  }
+
+  /// Color and Reorder
+  template <typename IndexType_, typename ValueType_>
+  void ModularityMatrixHost<IndexType_,ValueType_>
+  ::color(IndexType_ *c, IndexType_ *p) const {
+    FatalError("This isn't implemented for Modularity Matrix currently", NVGRAPH_ERR_NOT_IMPLEMENTED);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void ModularityMatrixHost<IndexType_,ValueType_>
+  ::reorder(IndexType_ *p) const {
+    FatalError("This isn't implemented for Modularity Matrix currently", NVGRAPH_ERR_NOT_IMPLEMENTED);
+  }
+
+  /// Solve preconditioned system M x = f for a set of k vectors
+  template <typename IndexType_, typename ValueType_>
+  void ModularityMatrixHost<IndexType_,ValueType_>
+  ::prec_setup(Matrix<IndexType_,ValueType_> * _M) {
+      //save the pointer to preconditioner M
+      M = _M;
+      if (M != NULL) {
+          //setup the preconditioning matrix M
+          M->prec_setup(NULL);
+      }
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void ModularityMatrixHost<IndexType_,ValueType_>
+  ::prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const {
+      if (M != NULL) {
+          //preconditioning
+          M->prec_solve(k,alpha,fx,t);
+      }
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  ValueType_ ModularityMatrixHost<IndexType_,ValueType_>
+  ::getEdgeSum() const {
+    return edge_sum;
+  }
+
+  // =============================================
+  // Jacobi preconditioner class (host memory)
+  // =============================================
+
+  /// Constructor for host Jacobi preconditioner class
+  /** @param A Adjacency matrix
+   */
+  template <typename IndexType_, typename ValueType_>
+  JacobiPreconditionerHost<IndexType_,ValueType_>
+  ::JacobiPreconditionerHost(const CsrMatrixHost<IndexType_,ValueType_> & _A)
+    : Matrix<IndexType_,ValueType_>(_A.m,_A.n) {
+
+    // Check that adjacency matrix is square
+    if(_A.m != _A.n)
+      FatalError("cannot construct Jacobi preconditioner from non-square adjacency matrix",
+                 NVGRAPH_ERR_BAD_PARAMETERS);
+
+    GraphLevelHost<IndexType_,ValueType_> G;
+    G.n = _A.m;
+    G.rowPtr = _A.csrRowPtrA;
+    G.colInd = _A.csrColIndA;
+    G.val = _A.csrValA;
+    laplacianDiagonal(G, D);
+  }
+
+  /// Destructor for host Jacobi preconditioner class
+  template <typename IndexType_, typename ValueType_>
+  JacobiPreconditionerHost<IndexType_,ValueType_>::~JacobiPreconditionerHost() {}
+
+  /// Get and Set CUDA stream
+  template <typename IndexType_, typename ValueType_>
+  void JacobiPreconditionerHost<IndexType_,ValueType_>::setCUDAStream(cudaStream_t _s) {
+      this->s = _s;
+  }
+  template <typename IndexType_, typename ValueType_>
+  void JacobiPreconditionerHost<IndexType_,ValueType_>::getCUDAStream(cudaStream_t * _s) {
+      *_s = this->s;
+  }
+
+  /// Matrix-vector product for host Jacobi preconditioner class
+  /** y is overwritten with alpha*D*x+beta*y.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void JacobiPreconditionerHost<IndexType_,ValueType_>
+  ::mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+       ValueType_ beta, ValueType_ * __restrict__ y) const {
+    this->mm(1, alpha, x, beta, y);
+  }
+
+  /// Matrix-set of k vectors product for host Jacobi preconditioner
+  /// class
+  /** y is overwritten with alpha*D*x+beta*y.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void JacobiPreconditionerHost<IndexType_,ValueType_>
+  ::mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const {
+    IndexType_ n = this->n;
+    #pragma omp parallel for schedule(static)
+    for(IndexType_ i=0; i<n; ++i) {
+      for(IndexType_ l=0; l<k; ++l) {
+        ValueType_ & yil = y[IDX(i,l,n)];
+        yil = (beta == 0) ? alpha*D[i]*x[IDX(i,l,n)]
+                          : alpha*D[i]*x[IDX(i,l,n)] + beta*yil;
+      }
+    }
+  }
+
+  /// Color and Reorder
+  template <typename IndexType_, typename ValueType_>
+  void JacobiPreconditionerHost<IndexType_,ValueType_>
+  ::color(IndexType_ *c, IndexType_ *p) const {
+
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void JacobiPreconditionerHost<IndexType_,ValueType_>
+  ::reorder(IndexType_ *p) const {
+
+  }
+
+  /// Solve preconditioned system D x = f for a set of k vectors
+  /** The diagonal is computed by the constructor, there is nothing
+   *  to set up. fx is overwritten with alpha*D\fx, isolated vertices
+   *  are only scaled by alpha.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void JacobiPreconditionerHost<IndexType_,ValueType_>
+  ::prec_setup(Matrix<IndexType_,ValueType_> * _M) {
+
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void JacobiPreconditionerHost<IndexType_,ValueType_>
+  ::prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const {
+    IndexType_ n = this->n;
+    #pragma omp parallel for schedule(static)
+    for(IndexType_ i=0; i<n; ++i) {
+      ValueType_ scale = (D[i] > 0) ? alpha/D[i] : alpha;
+      for(IndexType_ l=0; l<k; ++l)
+        fx[IDX(i,l,n)] *= scale;
+    }
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  ValueType_ JacobiPreconditionerHost<IndexType_,ValueType_>
+  ::getEdgeSum() const {
+    return 0.0;
+  }
+
+  // =============================================
+  // Aggregation preconditioner class (host memory)
+  // =============================================
+
+  /// Constructor for host aggregation preconditioner class
+  /** The hierarchy is built by prec_setup.
+   *
+   *  @param A Adjacency matrix
+   *  @param coarsestSize Number of vertices below which coarsening
+   *    stops.
+   */
+  template <typename IndexType_, typename ValueType_>
+  AggregationPreconditionerHost<IndexType_,ValueType_>
+  ::AggregationPreconditionerHost(const CsrMatrixHost<IndexType_,ValueType_> & _A,
+                                  IndexType_ _coarsestSize)
+    : Matrix<IndexType_,ValueType_>(_A.m,_A.n), A(&_A), coarsestSize(_coarsestSize) {
+
+    // Check that adjacency matrix is square
+    if(_A.m != _A.n)
+      FatalError("cannot construct aggregation preconditioner from non-square adjacency matrix",
+                 NVGRAPH_ERR_BAD_PARAMETERS);
+  }
+
+  /// Destructor for host aggregation preconditioner class
+  template <typename IndexType_, typename ValueType_>
+  AggregationPreconditionerHost<IndexType_,ValueType_>::~AggregationPreconditionerHost() {}
+
+  /// Get and Set CUDA stream
+  template <typename IndexType_, typename ValueType_>
+  void AggregationPreconditionerHost<IndexType_,ValueType_>::setCUDAStream(cudaStream_t _s) {
+      this->s = _s;
+  }
+  template <typename IndexType_, typename ValueType_>
+  void AggregationPreconditionerHost<IndexType_,ValueType_>::getCUDAStream(cudaStream_t * _s) {
+      *_s = this->s;
+  }
+
+  /// Matrix-vector product for host aggregation preconditioner class
+  template <typename IndexType_, typename ValueType_>
+  void AggregationPreconditionerHost<IndexType_,ValueType_>
+  ::mv(ValueType_ alpha, const ValueType_ * __restrict__ x,
+       ValueType_ beta, ValueType_ * __restrict__ y) const {
+    FatalError("This isn't implemented for host aggregation preconditioner", NVGRAPH_ERR_NOT_IMPLEMENTED);
+  }
+
+  /// Matrix-set of k vectors product for host aggregation
+  /// preconditioner class
+  template <typename IndexType_, typename ValueType_>
+  void AggregationPreconditionerHost<IndexType_,ValueType_>
+  ::mm(IndexType_ k, ValueType_ alpha, const ValueType_ * __restrict__ x, ValueType_ beta, ValueType_ * __restrict__ y) const {
+    FatalError("This isn't implemented for host aggregation preconditioner", NVGRAPH_ERR_NOT_IMPLEMENTED);
+  }
+
+  /// Color and Reorder
+  template <typename IndexType_, typename ValueType_>
+  void AggregationPreconditionerHost<IndexType_,ValueType_>
+  ::color(IndexType_ *c, IndexType_ *p) const {
+
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  void AggregationPreconditionerHost<IndexType_,ValueType_>
+  ::reorder(IndexType_ *p) const {
+
+  }
+
+  /// Build the graph hierarchy
+  /** Pairs are contracted until the graph has at most coarsestSize
+   *  vertices or a matching removes less than 5% of the vertices.
+   *  Only the first call builds the hierarchy.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void AggregationPreconditionerHost<IndexType_,ValueType_>
+  ::prec_setup(Matrix<IndexType_,ValueType_> * _M) {
+    if(!levels.empty())
+      return;
+
+    // Levels are never reallocated, coarse levels point to their
+    // own storage
+    levels.reserve(AGGREGATION_MAX_LEVELS+1);
+    levels.resize(1);
+    levels[0].n = A->m;
+    levels[0].rowPtr = A->csrRowPtrA;
+    levels[0].colInd = A->csrColIndA;
+    levels[0].val = A->csrValA;
+
+    std::vector<IndexType_> match;
+    while(levels.size() <= AGGREGATION_MAX_LEVELS
+          && levels.back().n > coarsestSize) {
+      IndexType_ nPairs
+        = heavyEdgeMatching_host(levels.back(), std::numeric_limits<IndexType_>::max(), match);
+      if(nPairs < 0.05*levels.back().n)
+        break;
+      levels.resize(levels.size()+1);
+      contractGraph_host(levels[levels.size()-2], match, levels.back());
+    }
+
+    D.resize(levels.size());
+    for(size_t l=0; l<levels.size(); ++l)
+      laplacianDiagonal(levels[l], D[l]);
+  }
+
+  /// Apply one V-cycle from level l
+  /** Damped Jacobi from x = 0, coarse correction with the sum of the
+   *  residual over each pair, then damped Jacobi again. The coarsest
+   *  level does AGGREGATION_COARSEST_SWEEPS Jacobi sweeps.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void AggregationPreconditionerHost<IndexType_,ValueType_>
+  ::vcycle(size_t l, const ValueType_ * b, ValueType_ * x) const {
+    const GraphLevelHost<IndexType_,ValueType_> & G = levels[l];
+    IndexType_ n = G.n;
+    std::vector<ValueType_> r(b, b+n);
+    std::fill(x, x+n, (ValueType_) 0);
+    jacobiUpdate(n, D[l], &r[0], x);
+
+    if(l+1 == levels.size()) {
+      for(int sweep=1; sweep<AGGREGATION_COARSEST_SWEEPS; ++sweep) {
+        laplacianResidual(G, D[l], b, x, &r[0]);
+        jacobiUpdate(n, D[l], &r[0], x);
+      }
+      return;
+    }
+
+    // Coarse correction
+    laplacianResidual(G, D[l], b, x, &r[0]);
+    IndexType_ nc = levels[l+1].n;
+    std::vector<ValueType_> bc(nc, 0), xc(nc);
+    for(IndexType_ i=0; i<n; ++i)
+      bc[G.coarse[i]] += r[i];
+    vcycle(l+1, &bc[0], &xc[0]);
+    #pragma omp parallel for schedule(static)
+    for(IndexType_ i=0; i<n; ++i)
+      x[i] += xc[G.coarse[i]];
+
+    // Post-smoothing
+    laplacianResidual(G, D[l], b, x, &r[0]);
+    jacobiUpdate(n, D[l], &r[0], x);
+  }
+
+  /// Apply one V-cycle to a set of k vectors
+  /** fx is overwritten with alpha*M\fx, t (n*k entries) is
+   *  workspace.
+   */
+  template <typename IndexType_, typename ValueType_>
+  void AggregationPreconditionerHost<IndexType_,ValueType_>
+  ::prec_solve(IndexType_ k, ValueType_ alpha, ValueType_ * __restrict__ fx, ValueType_ * __restrict__ t) const {
+    if(levels.empty())
+      FatalError("aggregation preconditioner is not set up", NVGRAPH_ERR_BAD_PARAMETERS);
+    IndexType_ n = this->n;
+    for(IndexType_ l=0; l<k; ++l)
+      vcycle(0, fx+IDX(0,l,n), t+IDX(0,l,n));
+    axpby(k*n, alpha, t, (ValueType_) 0, fx);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  ValueType_ AggregationPreconditionerHost<IndexType_,ValueType_>
+  ::getEdgeSum() const {
+    return 0.0;
+  }
+
+  // Explicit instantiation
+  template class CsrMatrixHost<int,float>;
+  template class CsrMatrixHost<int,double>;
+  template class LaplacianMatrixHost<int,float>;
+  template class LaplacianMatrixHost<int,double>;
+  template class ModularityMatrixHost<int,float>;
+  template class ModularityMatrixHost<int,double>;
+  template class JacobiPreconditionerHost<int,float>;
+  template class JacobiPreconditionerHost<int,double>;
+  template class AggregationPreconditionerHost<int,float>;
+  template class AggregationPreconditionerHost<int,double>;
+
+}
+
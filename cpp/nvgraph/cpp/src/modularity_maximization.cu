@@ -31,6 +31,7 @@
 #include "nvgraph_cublas.hxx"
 #include "matrix.hxx"
 #include "lanczos.hxx"
+#include "subspace.hxx"
 #include "kmeans.hxx"
 #include "debug_macros.h"
 #include "lobpcg.hxx"
@@ -223,6 +224,11 @@ namespace nvgraph {
    *  @param maxIter_lanczos Maximum number of Lanczos iterations.
    *  @param restartIter_lanczos Maximum size of Lanczos system before
    *    implicit restart.
+   *  @param randomized_subspace Whether to compute approximate
+   *    eigenvectors with maxIter_lanczos steps of randomized subspace
+   *    iteration (computeLargestEigenvectors_subspace) instead of the
+   *    Lanczos method. The work is fixed and restartIter_lanczos and
+   *    tol_lanczos are ignored.
    *  @param tol_lanczos Convergence tolerance for Lanczos method.
    *  @param maxIter_kmeans Maximum number of k-means iterations.
    *  @param tol_kmeans Convergence tolerance for k-means algorithm.
@@ -240,6 +246,7 @@ namespace nvgraph {
            IndexType_ nEigVecs,
            IndexType_ maxIter_lanczos,
            IndexType_ restartIter_lanczos,
+           bool randomized_subspace,
            ValueType_ tol_lanczos,
            IndexType_ maxIter_kmeans,
            ValueType_ tol_kmeans,
@@ -261,11 +268,18 @@ namespace nvgraph {
       WARNING("invalid parameter (nEigVecs<1)");
       return NVGRAPH_ERR_BAD_PARAMETERS;
     }
-    if(maxIter_lanczos < nEigVecs) {
+    if(randomized_subspace) {
+      // maxIter_lanczos is the number of subspace iterations
+      if(maxIter_lanczos < 0) {
+        WARNING("invalid parameter (maxIter_lanczos<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+    }
+    else if(maxIter_lanczos < nEigVecs) {
       WARNING("invalid parameter (maxIter_lanczos<nEigVecs)");
       return NVGRAPH_ERR_BAD_PARAMETERS;
     }
-    if(restartIter_lanczos < nEigVecs) {
+    if(!randomized_subspace && restartIter_lanczos < nEigVecs) {
       WARNING("invalid parameter (restartIter_lanczos<nEigVecs)");
       return NVGRAPH_ERR_BAD_PARAMETERS;
     }
@@ -337,10 +351,14 @@ namespace nvgraph {
     cudaProfilerStart();
 #endif        
 
-    CHECK_NVGRAPH(computeLargestEigenvectors(*B, nEigVecs, maxIter_lanczos,
-             restartIter_lanczos, tol_lanczos,
-             reorthogonalize_lanczos, iters_lanczos,
-             eigVals.raw(), eigVecs.raw()));   
+    if(randomized_subspace)
+      CHECK_NVGRAPH(computeLargestEigenvectors_subspace(*B, nEigVecs, maxIter_lanczos,
+               iters_lanczos, eigVals.raw(), eigVecs.raw()));
+    else
+      CHECK_NVGRAPH(computeLargestEigenvectors(*B, nEigVecs, maxIter_lanczos,
+               restartIter_lanczos, tol_lanczos,
+               reorthogonalize_lanczos, iters_lanczos,
+               eigVals.raw(), eigVecs.raw()));   
 
  #ifdef COLLECT_TIME_STATISTICS
     cudaProfilerStop();
@@ -556,6 +574,7 @@ namespace nvgraph {
 				  int nEigVecs,
 				  int maxIter_lanczos,
 				  int restartIter_lanczos,
+				  bool randomized_subspace,
 				  float tol_lanczos,
 				  int maxIter_kmeans,
 				  float tol_kmeans,
@@ -570,6 +589,7 @@ namespace nvgraph {
 				   int nEigVecs,
 				   int maxIter_lanczos,
 				   int restartIter_lanczos,
+				   bool randomized_subspace,
 				   double tol_lanczos,
 				   int maxIter_kmeans,
 				   double tol_kmeans,
@@ -19,6 +19,7 @@
 #include <climits>
 #include <cfloat>
 #include <vector>
+#include <memory>
 #include <nvlouvain.cuh>
 #include <jaccard_gpu.cuh>
 #include <cusolverDn.h>
@@ -33,14 +34,26 @@
 #include <nvgraph_csrmv.hxx>
 #include <pagerank.hxx>
 #include <arnoldi.hxx>
+#include <arnoldi_host.hxx>
 #include <sssp.hxx>
 #include <widest_path.hxx>
+#include <widest_path_host.hxx>
 #include <partition.hxx>
 #include <nvgraph_convert.hxx>
 #include <size2_selector.hxx>
 #include <modularity_maximization.hxx>
 #include <bfs.hxx>
 #include <triangles_counting.hxx>
+#include <triangles_counting_host.hxx>
+#include <matrix_host.hxx>
+#include <partition_host.hxx>
+#include <kmeans_host.hxx>
+#include <partition_multilevel_host.hxx>
+#include <graph_contracting_host.hxx>
+#include <graph_contracting_dispatch.hxx>
+#include <subgraph_view.hxx>
+#include <subgraph_view_host.hxx>
+#include <convert_host.hxx>
 
 #include <csrmv_cub.h>
 
@@ -149,124 +162,6 @@ namespace nvgraph
 																								size_t n,
 																								cudaStream_t stream);
 
-#ifndef NVGRAPH_LIGHT
-
-	extern CsrGraph<int>* contract_graph_csr_mul(CsrGraph<int>& graph,
-																int* pV,
-																size_t n,
-																cudaStream_t stream,
-																const int& VCombine,
-																const int& VReduce,
-																const int& ECombine,
-																const int& EReduce);
-
-	extern CsrGraph<int>* contract_graph_csr_sum(CsrGraph<int>& graph,
-																int* pV,
-																size_t n,
-																cudaStream_t stream,
-																const int& VCombine,
-																const int& VReduce,
-																const int& ECombine,
-																const int& EReduce);
-
-	extern CsrGraph<int>* contract_graph_csr_min(CsrGraph<int>& graph,
-																int* pV,
-																size_t n,
-																cudaStream_t stream,
-																const int& VCombine,
-																const int& VReduce,
-																const int& ECombine,
-																const int& EReduce);
-
-	extern CsrGraph<int>* contract_graph_csr_max(CsrGraph<int>& graph,
-																int* pV,
-																size_t n,
-																cudaStream_t stream,
-																const int& VCombine,
-																const int& VReduce,
-																const int& ECombine,
-																const int& EReduce);
-
-	extern MultiValuedCsrGraph<int, float>* contract_graph_mv_float_mul(MultiValuedCsrGraph<int,
-																										float>& graph,
-																								int* pV,
-																								size_t n,
-																								cudaStream_t stream,
-																								const int& VCombine,
-																								const int& VReduce,
-																								const int& ECombine,
-																								const int& EReduce);
-
-	extern MultiValuedCsrGraph<int, float>* contract_graph_mv_float_sum(MultiValuedCsrGraph<int,
-																										float>& graph,
-																								int* pV,
-																								size_t n,
-																								cudaStream_t stream,
-																								const int& VCombine,
-																								const int& VReduce,
-																								const int& ECombine,
-																								const int& EReduce);
-
-	extern MultiValuedCsrGraph<int, float>* contract_graph_mv_float_min(MultiValuedCsrGraph<int,
-																										float>& graph,
-																								int* pV,
-																								size_t n,
-																								cudaStream_t stream,
-																								const int& VCombine,
-																								const int& VReduce,
-																								const int& ECombine,
-																								const int& EReduce);
-
-	extern MultiValuedCsrGraph<int, float>* contract_graph_mv_float_max(MultiValuedCsrGraph<int,
-																										float>& graph,
-																								int* pV,
-																								size_t n,
-																								cudaStream_t stream,
-																								const int& VCombine,
-																								const int& VReduce,
-																								const int& ECombine,
-																								const int& EReduce);
-
-	extern MultiValuedCsrGraph<int, double>* contract_graph_mv_double_mul(MultiValuedCsrGraph<int,
-																											double>& graph,
-																									int* pV,
-																									size_t n,
-																									cudaStream_t stream,
-																									const int& VCombine,
-																									const int& VReduce,
-																									const int& ECombine,
-																									const int& EReduce);
-
-	extern MultiValuedCsrGraph<int, double>* contract_graph_mv_double_sum(MultiValuedCsrGraph<int,
-																											double>& graph,
-																									int* pV,
-																									size_t n,
-																									cudaStream_t stream,
-																									const int& VCombine,
-																									const int& VReduce,
-																									const int& ECombine,
-																									const int& EReduce);
-
-	extern MultiValuedCsrGraph<int, double>* contract_graph_mv_double_min(MultiValuedCsrGraph<int,
-																											double>& graph,
-																									int* pV,
-																									size_t n,
-																									cudaStream_t stream,
-																									const int& VCombine,
-																									const int& VReduce,
-																									const int& ECombine,
-																									const int& EReduce);
-
-	extern MultiValuedCsrGraph<int, double>* contract_graph_mv_double_max(MultiValuedCsrGraph<int,
-																											double>& graph,
-																									int* pV,
-																									size_t n,
-																									cudaStream_t stream,
-																									const int& VCombine,
-																									const int& VReduce,
-																									const int& ECombine,
-																									const int& EReduce);
-#endif
 
 	nvgraphStatus_t getCAPIStatusForError(NVGRAPH_ERROR err)
 														{
@@ -1602,6 +1497,38 @@ namespace nvgraph
 		return getCAPIStatusForError(rc);
 	}
 
+	nvgraphStatus_t NVGRAPH_API nvgraphConvertTopologyHost_impl(nvgraphTopologyType_t srcTType,
+																				void *srcTopology,
+																				void *srcEdgeData,
+																				cudaDataType_t *dataType,
+																				nvgraphTopologyType_t dstTType,
+																				void *dstTopology,
+																				void *dstEdgeData)
+																				{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_ptr(srcTopology) || check_ptr(dstTopology)
+					|| ((srcEdgeData == NULL) != (dstEdgeData == NULL)))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (srcEdgeData == NULL)
+				rc = convert_topology_host<float>(srcTType, srcTopology, NULL, dstTType, dstTopology, NULL);
+			else if (check_ptr(dataType))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+			else if (*dataType == CUDA_R_32F)
+				rc = convert_topology_host<float>(srcTType, srcTopology, static_cast<const float*>(srcEdgeData),
+															 dstTType, dstTopology, static_cast<float*>(dstEdgeData));
+			else if (*dataType == CUDA_R_64F)
+				rc = convert_topology_host<double>(srcTType, srcTopology, static_cast<const double*>(srcEdgeData),
+															  dstTType, dstTopology, static_cast<double*>(dstEdgeData));
+			else
+				return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
 	nvgraphStatus_t NVGRAPH_API nvgraphConvertGraph_impl(nvgraphHandle_t handle,
 																			nvgraphGraphDescr_t srcDescrG,
 																			nvgraphGraphDescr_t dstDescrG,
@@ -1993,6 +1920,93 @@ namespace nvgraph
 		return getCAPIStatusForError(rc);
 	}
 
+	nvgraphStatus_t NVGRAPH_API nvgraphSsspMulti_impl(nvgraphHandle_t handle,
+																	const nvgraphGraphDescr_t descrG,
+																	const size_t weight_index,
+																	const int *source_verts,
+																	const size_t num_sources,
+																	const int *destination_verts,
+																	const size_t num_destinations,
+																	void *distances)
+																	{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_context(handle) || check_graph(descrG) || check_int_size(weight_index)
+					|| check_int_ptr(source_verts) || check_int_size(num_sources)
+					|| check_int_size(num_destinations) || check_ptr(distances))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (descrG->TT != NVGRAPH_CSC_32) // supported topologies
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (descrG->graphStatus != HAS_VALUES)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (num_sources == 0)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			int n = static_cast<int>(static_cast<nvgraph::CsrGraph<int>*>(descrG->graph_handle)->get_num_vertices());
+			int n_dst = destination_verts ? static_cast<int>(num_destinations) : n;
+			if (n_dst == 0)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+			for (size_t i = 0; i < num_sources; i++)
+				if (source_verts[i] < 0 || source_verts[i] >= n)
+					return NVGRAPH_STATUS_INVALID_VALUE;
+			if (destination_verts)
+				for (size_t i = 0; i < num_destinations; i++)
+					if (destination_verts[i] < 0 || destination_verts[i] >= n)
+						return NVGRAPH_STATUS_INVALID_VALUE;
+
+			// sources and destinations are host arrays, like source_vert in nvgraphSssp
+			Vector<int> src(num_sources, handle->stream);
+			CHECK_CUDA(cudaMemcpy(src.raw(), source_verts, num_sources * sizeof(int), cudaMemcpyHostToDevice));
+			Vector<int> dst;
+			if (destination_verts)
+			{
+				dst.allocate(num_destinations, handle->stream);
+				CHECK_CUDA(cudaMemcpy(dst.raw(), destination_verts, num_destinations * sizeof(int), cudaMemcpyHostToDevice));
+			}
+
+			switch (descrG->T)
+			{
+				case CUDA_R_32F:
+					{
+					nvgraph::MultiValuedCsrGraph<int, float> *MCSRG =
+							static_cast<nvgraph::MultiValuedCsrGraph<int, float>*>(descrG->graph_handle);
+					if (weight_index >= MCSRG->get_num_edge_dim()) // base index is 0
+						return NVGRAPH_STATUS_INVALID_VALUE;
+
+					Vector<float> dist(static_cast<size_t>(n_dst) * num_sources, handle->stream);
+					nvgraph::SsspMulti<int, float> sssp_solver(*MCSRG->get_valued_csr_graph(weight_index), 32, handle->stream);
+					rc = sssp_solver.solve(static_cast<int>(num_sources), src.raw(), n_dst,
+												  destination_verts ? dst.raw() : NULL, dist.raw());
+					CHECK_CUDA(cudaMemcpy(distances, dist.raw(), dist.bytes(), cudaMemcpyDefault));
+					break;
+				}
+				case CUDA_R_64F:
+					{
+					nvgraph::MultiValuedCsrGraph<int, double> *MCSRG =
+							static_cast<nvgraph::MultiValuedCsrGraph<int, double>*>(descrG->graph_handle);
+					if (weight_index >= MCSRG->get_num_edge_dim()) // base index is 0
+						return NVGRAPH_STATUS_INVALID_VALUE;
+
+					Vector<double> dist(static_cast<size_t>(n_dst) * num_sources, handle->stream);
+					nvgraph::SsspMulti<int, double> sssp_solver(*MCSRG->get_valued_csr_graph(weight_index), 32, handle->stream);
+					rc = sssp_solver.solve(static_cast<int>(num_sources), src.raw(), n_dst,
+												  destination_verts ? dst.raw() : NULL, dist.raw());
+					CHECK_CUDA(cudaMemcpy(distances, dist.raw(), dist.bytes(), cudaMemcpyDefault));
+					break;
+				}
+				default:
+					return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+			}
+		}
+		NVGRAPH_CATCHES(rc)
+
+		return getCAPIStatusForError(rc);
+	}
+
 	nvgraphStatus_t NVGRAPH_API nvgraphTraversal_impl(nvgraphHandle_t handle,
 																		const nvgraphGraphDescr_t descrG,
 																		const nvgraphTraversal_t traversalT,
@@ -2191,6 +2205,56 @@ namespace nvgraph
 		return getCAPIStatusForError(rc);
 	}
 
+	nvgraphStatus_t NVGRAPH_API nvgraphWidestPathHost_impl(const nvgraphCSCTopology32I_t topology,
+																			const cudaDataType_t weight_type,
+																			const void *weights,
+																			const int *source_verts,
+																			const size_t num_sources,
+																			void *widest_path)
+																			{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_ptr(topology) || check_ptr(weights) || check_int_ptr(source_verts)
+					|| check_int_size(num_sources) || check_ptr(widest_path))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (topology->nvertices < 0 || topology->nedges < 0
+					|| check_int_ptr(topology->destination_offsets)
+					|| check_int_ptr(topology->source_indices))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			switch (weight_type)
+			{
+				case CUDA_R_32F:
+					{
+					nvgraph::WidestPathHost<int, float> widest_path_solver(topology->nvertices,
+																							 topology->nedges,
+																							 topology->destination_offsets,
+																							 topology->source_indices,
+																							 static_cast<const float*>(weights));
+					rc = widest_path_solver.solve(static_cast<int>(num_sources), source_verts, static_cast<float*>(widest_path));
+					break;
+				}
+				case CUDA_R_64F:
+					{
+					nvgraph::WidestPathHost<int, double> widest_path_solver(topology->nvertices,
+																							  topology->nedges,
+																							  topology->destination_offsets,
+																							  topology->source_indices,
+																							  static_cast<const double*>(weights));
+					rc = widest_path_solver.solve(static_cast<int>(num_sources), source_verts, static_cast<double*>(widest_path));
+					break;
+				}
+				default:
+					return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+			}
+		}
+		NVGRAPH_CATCHES(rc)
+
+		return getCAPIStatusForError(rc);
+	}
+
 	nvgraphStatus_t NVGRAPH_API nvgraphPagerank_impl(nvgraphHandle_t handle,
 																		const nvgraphGraphDescr_t descrG,
 																		const size_t weight_index,
@@ -2405,6 +2469,104 @@ namespace nvgraph
 		return getCAPIStatusForError(rc);
 	}
 
+	nvgraphStatus_t NVGRAPH_API nvgraphKrylovPagerankHost_impl(const nvgraphCSCTopology32I_t topology,
+																					const cudaDataType_t weight_type,
+																					const void *weights,
+																					const void *alpha,
+																					const void *bookmark,
+																					const float tolerance,
+																					const int max_iter,
+																					const int subspace_size,
+																					const int has_guess,
+																					void *rank)
+																					{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_ptr(topology) || check_ptr(weights) || check_ptr(alpha)
+					|| check_ptr(bookmark) || check_ptr(rank))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (topology->nvertices <= 0 || topology->nedges < 0
+					|| check_int_ptr(topology->destination_offsets)
+					|| check_int_ptr(topology->source_indices))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			int max_it;
+			int ss_sz;
+			float tol;
+
+			if (max_iter > 0)
+				max_it = max_iter;
+			else
+				max_it = 500;
+
+			if (subspace_size > 0)
+				ss_sz = subspace_size;
+			else
+				ss_sz = 8;
+
+			if (tolerance == 0.0f)
+				tol = 1.0E-6f;
+			else if (tolerance < 1.0f && tolerance > 0.0f)
+				tol = tolerance;
+			else
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			int n = topology->nvertices;
+			switch (weight_type)
+			{
+				case CUDA_R_32F:
+					{
+					float alphaT = *static_cast<const float*>(alpha);
+					if (alphaT <= 0.0f || alphaT >= 1.0f)
+						return NVGRAPH_STATUS_INVALID_VALUE;
+					std::vector<float> guess(n, static_cast<float>(1.0 / n));
+					if (has_guess)
+						std::copy(static_cast<const float*>(rank), static_cast<const float*>(rank) + n, guess.begin());
+					float eigVal;
+					nvgraph::ImplicitArnoldiHost<int, float> iram_solver(n,
+																						  topology->nedges,
+																						  topology->destination_offsets,
+																						  topology->source_indices,
+																						  static_cast<const float*>(weights),
+																						  static_cast<const float*>(bookmark),
+																						  tol,
+																						  max_it,
+																						  alphaT);
+					rc = iram_solver.solve(ss_sz, 1, &guess[0], &eigVal, static_cast<float*>(rank));
+					break;
+				}
+				case CUDA_R_64F:
+					{
+					double alphaT = *static_cast<const double*>(alpha);
+					if (alphaT <= 0.0 || alphaT >= 1.0)
+						return NVGRAPH_STATUS_INVALID_VALUE;
+					std::vector<double> guess(n, 1.0 / n);
+					if (has_guess)
+						std::copy(static_cast<const double*>(rank), static_cast<const double*>(rank) + n, guess.begin());
+					double eigVal;
+					nvgraph::ImplicitArnoldiHost<int, double> iram_solver(n,
+																							topology->nedges,
+																							topology->destination_offsets,
+																							topology->source_indices,
+																							static_cast<const double*>(weights),
+																							static_cast<const double*>(bookmark),
+																							tol,
+																							max_it,
+																							alphaT);
+					rc = iram_solver.solve(ss_sz, 1, &guess[0], &eigVal, static_cast<double*>(rank));
+					break;
+				}
+				default:
+					return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+			}
+		}
+		NVGRAPH_CATCHES(rc)
+
+		return getCAPIStatusForError(rc);
+	}
+
 	nvgraphStatus_t NVGRAPH_API nvgraphExtractSubgraphByVertex_impl(nvgraphHandle_t handle,
 																							nvgraphGraphDescr_t descrG,
 																							nvgraphGraphDescr_t subdescrG,
@@ -2565,73 +2727,410 @@ namespace nvgraph
 		return getCAPIStatusForError(rc);
 	}
 
-	nvgraphStatus_t NVGRAPH_API nvgraphBalancedCutClustering_impl(nvgraphHandle_t handle,
-																						const nvgraphGraphDescr_t descrG,
-																						const size_t weight_index,
-																						const int n_clusters,
-																						const int n_eig_vects,
-																						const int evs_type,
-																						const float evs_tolerance,
-																						const int evs_max_iter,
-																						const float kmean_tolerance,
-																						const int kmean_max_iter,
-																						int* clustering,
-																						void* eig_vals,
-																						void* eig_vects)
-																						{
+	// View of the subgraph of subvertices or subedges (exactly one of them) over a host topology
+	nvgraph::SubgraphViewHost<int>* create_subgraph_view_host(int nvertices, int nedges,
+																				 const int *offsets,
+																				 const int *indices,
+																				 const int *subvertices,
+																				 size_t numvertices,
+																				 const int *subedges,
+																				 size_t numedges)
+	{
+		if ((subvertices == NULL) == (subedges == NULL))
+			FatalError("Exactly one of the vertex and edge subsets must be set.", NVGRAPH_ERR_BAD_PARAMETERS);
+		if (subvertices != NULL)
+			return new nvgraph::SubgraphViewHost<int>(nvertices, nedges, offsets, indices, subvertices, numvertices);
+		return new nvgraph::SubgraphViewHost<int>(nvertices, nedges, offsets, indices, subedges, numedges, true);
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewTraversalHost_impl(const nvgraphCSRTopology32I_t topology,
+																							const int *subvertices,
+																							size_t numvertices,
+																							const int *subedges,
+																							size_t numedges,
+																							const int source_vert,
+																							int *distances,
+																							int *predecessors)
+																							{
 		NVGRAPH_ERROR rc = NVGRAPH_OK;
 		try
 		{
-			if (check_context(handle) || check_graph(descrG) || check_int_size(weight_index))
+			if (check_ptr(topology) || check_int_size(numvertices) || check_int_size(numedges)
+					|| (distances == NULL && predecessors == NULL))
 				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
 
-			if (descrG->graphStatus != HAS_VALUES) // need a MultiValuedCsrGraph
+			if (topology->nvertices <= 0 || topology->nedges < 0
+					|| check_int_ptr(topology->source_offsets)
+					|| (topology->nedges > 0 && check_int_ptr(topology->destination_indices)))
 				return NVGRAPH_STATUS_INVALID_VALUE;
 
-			if (descrG->TT != NVGRAPH_CSR_32) // supported topologies
+			std::unique_ptr<nvgraph::SubgraphViewHost<int> > view(create_subgraph_view_host(topology->nvertices,
+																												  topology->nedges,
+																												  topology->source_offsets,
+																												  topology->destination_indices,
+																												  subvertices,
+																												  numvertices,
+																												  subedges,
+																												  numedges));
+			if (source_vert < 0 || source_vert >= view->get_num_vertices())
 				return NVGRAPH_STATUS_INVALID_VALUE;
 
-			int evs_max_it, kmean_max_it;
-			int iters_lanczos, iters_kmeans;
-			float evs_tol, kmean_tol;
-
-			if (evs_max_iter > 0)
-				evs_max_it = evs_max_iter;
-			else
-				evs_max_it = 4000;
-
-			if (evs_tolerance == 0.0f)
-				evs_tol = 1.0E-3f;
-			else if (evs_tolerance < 1.0f && evs_tolerance > 0.0f)
-				evs_tol = evs_tolerance;
-			else
-				return NVGRAPH_STATUS_INVALID_VALUE;
+			rc = view->traverse(source_vert, distances, predecessors);
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
 
-			if (kmean_max_iter > 0)
-				kmean_max_it = kmean_max_iter;
-			else
-				kmean_max_it = 200;
+	nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewPagerankHost_impl(const nvgraphCSCTopology32I_t topology,
+																						  const cudaDataType_t weight_type,
+																						  const void *weights,
+																						  const int *subvertices,
+																						  size_t numvertices,
+																						  const int *subedges,
+																						  size_t numedges,
+																						  const void *alpha,
+																						  const void *bookmark,
+																						  const float tolerance,
+																						  const int max_iter,
+																						  const int has_guess,
+																						  void *rank)
+																						  {
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_ptr(topology) || check_ptr(weights) || check_ptr(alpha)
+					|| check_ptr(bookmark) || check_ptr(rank)
+					|| check_int_size(numvertices) || check_int_size(numedges))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
 
-			if (kmean_tolerance == 0.0f)
-				kmean_tol = 1.0E-2f;
-			else if (kmean_tolerance < 1.0f && kmean_tolerance > 0.0f)
-				kmean_tol = kmean_tolerance;
-			else
+			if (topology->nvertices <= 0 || topology->nedges < 0
+					|| check_int_ptr(topology->destination_offsets)
+					|| (topology->nedges > 0 && check_int_ptr(topology->source_indices)))
 				return NVGRAPH_STATUS_INVALID_VALUE;
 
-			if (n_clusters < 2)
+			if (!(has_guess == 0 || has_guess == 1))
 				return NVGRAPH_STATUS_INVALID_VALUE;
 
-			if (n_eig_vects > n_clusters)
-				return NVGRAPH_STATUS_INVALID_VALUE;
+			int max_it;
+			float tol;
 
-			if (!(evs_type == 0 || evs_type == 1))
-				return NVGRAPH_STATUS_INVALID_VALUE;
+			if (max_iter > 0)
+				max_it = max_iter;
+			else
+				max_it = 500;
 
-			if (clustering == NULL || eig_vals == NULL || eig_vects == NULL)
+			if (tolerance == 0.0f)
+				tol = 1.0E-6f;
+			else if (tolerance < 1.0f && tolerance > 0.0f)
+				tol = tolerance;
+			else
 				return NVGRAPH_STATUS_INVALID_VALUE;
 
-			switch (descrG->T)
+			std::unique_ptr<nvgraph::SubgraphViewHost<int> > view(create_subgraph_view_host(topology->nvertices,
+																												  topology->nedges,
+																												  topology->destination_offsets,
+																												  topology->source_indices,
+																												  subvertices,
+																												  numvertices,
+																												  subedges,
+																												  numedges));
+			switch (weight_type)
+			{
+				case CUDA_R_32F:
+				{
+					float alphaT = *static_cast<const float*>(alpha);
+					if (alphaT <= 0.0f || alphaT >= 1.0f)
+						return NVGRAPH_STATUS_INVALID_VALUE;
+					rc = view->pagerank(static_cast<const float*>(weights),
+											  alphaT,
+											  static_cast<const float*>(bookmark),
+											  has_guess ? static_cast<const float*>(rank) : NULL,
+											  tol,
+											  max_it,
+											  static_cast<float*>(rank));
+					break;
+				}
+				case CUDA_R_64F:
+				{
+					double alphaT = *static_cast<const double*>(alpha);
+					if (alphaT <= 0.0 || alphaT >= 1.0)
+						return NVGRAPH_STATUS_INVALID_VALUE;
+					rc = view->pagerank(static_cast<const double*>(weights),
+											  alphaT,
+											  static_cast<const double*>(bookmark),
+											  has_guess ? static_cast<const double*>(rank) : NULL,
+											  tol,
+											  max_it,
+											  static_cast<double*>(rank));
+					break;
+				}
+				default:
+					return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+			}
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
+	// View of the subgraph of subvertices or subedges (exactly one of them, host or device memory)
+	// over the topology of a graph in device memory
+	nvgraph::SubgraphView<int>* create_subgraph_view(const nvgraph::CsrGraph<int>* graph,
+																	 const int *subvertices,
+																	 size_t numvertices,
+																	 const int *subedges,
+																	 size_t numedges,
+																	 cudaStream_t stream)
+	{
+		if ((subvertices == NULL) == (subedges == NULL))
+			FatalError("Exactly one of the vertex and edge subsets must be set.", NVGRAPH_ERR_BAD_PARAMETERS);
+		int n = static_cast<int>(graph->get_num_vertices());
+		int nnz = static_cast<int>(graph->get_num_edges());
+		if (subvertices != NULL)
+			return new nvgraph::SubgraphView<int>(n, nnz, graph->get_raw_row_offsets(), graph->get_raw_column_indices(),
+															  subvertices, numvertices, false, stream);
+		return new nvgraph::SubgraphView<int>(n, nnz, graph->get_raw_row_offsets(), graph->get_raw_column_indices(),
+														  subedges, numedges, true, stream);
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewTraversal_impl(nvgraphHandle_t handle,
+																					  const nvgraphGraphDescr_t descrG,
+																					  const int *subvertices,
+																					  size_t numvertices,
+																					  const int *subedges,
+																					  size_t numedges,
+																					  const int source_vert,
+																					  int *distances,
+																					  int *predecessors)
+																					  {
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_context(handle) || check_graph(descrG) || check_int_size(numvertices)
+					|| check_int_size(numedges) || (distances == NULL && predecessors == NULL))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (descrG->graphStatus != HAS_TOPOLOGY && descrG->graphStatus != HAS_VALUES)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (descrG->TT != NVGRAPH_CSR_32) // supported topologies
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			std::unique_ptr<nvgraph::SubgraphView<int> > view(create_subgraph_view(static_cast<nvgraph::CsrGraph<int>*>(descrG->graph_handle),
+																									 subvertices,
+																									 numvertices,
+																									 subedges,
+																									 numedges,
+																									 handle->stream));
+			int ns = view->get_num_vertices();
+			if (source_vert < 0 || source_vert >= ns)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			// distances and predecessors are host or device arrays
+			Vector<int> dist(ns, handle->stream), pred;
+			if (predecessors)
+				pred.allocate(ns, handle->stream);
+			rc = view->traverse(source_vert, dist.raw(), predecessors ? pred.raw() : NULL);
+			if (distances)
+				CHECK_CUDA(cudaMemcpy(distances, dist.raw(), dist.bytes(), cudaMemcpyDefault));
+			if (predecessors)
+				CHECK_CUDA(cudaMemcpy(predecessors, pred.raw(), pred.bytes(), cudaMemcpyDefault));
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
+	template <typename ValueType>
+	NVGRAPH_ERROR subgraph_view_pagerank(nvgraphHandle_t handle,
+													 const nvgraphGraphDescr_t descrG,
+													 const size_t weight_index,
+													 const int *subvertices,
+													 size_t numvertices,
+													 const int *subedges,
+													 size_t numedges,
+													 ValueType alpha,
+													 const void *bookmark,
+													 float tolerance,
+													 int max_it,
+													 int has_guess,
+													 void *rank)
+	{
+		nvgraph::MultiValuedCsrGraph<int, ValueType> *MCSRG =
+				static_cast<nvgraph::MultiValuedCsrGraph<int, ValueType>*>(descrG->graph_handle);
+		if (weight_index >= MCSRG->get_num_edge_dim()) // base index is 0
+			FatalError("Incorrect weight index.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+		std::unique_ptr<nvgraph::SubgraphView<int> > view(create_subgraph_view(MCSRG,
+																								 subvertices,
+																								 numvertices,
+																								 subedges,
+																								 numedges,
+																								 handle->stream));
+		// bookmark and rank are host or device arrays
+		int ns = view->get_num_vertices();
+		Vector<ValueType> bm(ns, handle->stream), pr(ns, handle->stream);
+		CHECK_CUDA(cudaMemcpy(bm.raw(), bookmark, bm.bytes(), cudaMemcpyDefault));
+		if (has_guess)
+			CHECK_CUDA(cudaMemcpy(pr.raw(), rank, pr.bytes(), cudaMemcpyDefault));
+		NVGRAPH_ERROR rc = view->pagerank(MCSRG->get_raw_edge_dim(weight_index),
+													 alpha,
+													 bm.raw(),
+													 has_guess ? pr.raw() : NULL,
+													 tolerance,
+													 max_it,
+													 pr.raw());
+		CHECK_CUDA(cudaMemcpy(rank, pr.raw(), pr.bytes(), cudaMemcpyDefault));
+		return rc;
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewPagerank_impl(nvgraphHandle_t handle,
+																					 const nvgraphGraphDescr_t descrG,
+																					 const size_t weight_index,
+																					 const int *subvertices,
+																					 size_t numvertices,
+																					 const int *subedges,
+																					 size_t numedges,
+																					 const void *alpha,
+																					 const void *bookmark,
+																					 const float tolerance,
+																					 const int max_iter,
+																					 const int has_guess,
+																					 void *rank)
+																					 {
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_context(handle) || check_graph(descrG) || check_int_size(weight_index)
+					|| check_ptr(alpha) || check_ptr(bookmark) || check_ptr(rank)
+					|| check_int_size(numvertices) || check_int_size(numedges))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (descrG->graphStatus != HAS_VALUES) // need a MultiValuedCsrGraph
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (descrG->TT != NVGRAPH_CSC_32) // supported topologies
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (!(has_guess == 0 || has_guess == 1))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			int max_it;
+			float tol;
+
+			if (max_iter > 0)
+				max_it = max_iter;
+			else
+				max_it = 500;
+
+			if (tolerance == 0.0f)
+				tol = 1.0E-6f;
+			else if (tolerance < 1.0f && tolerance > 0.0f)
+				tol = tolerance;
+			else
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			switch (descrG->T)
+			{
+				case CUDA_R_32F:
+				{
+					float alphaT = *static_cast<const float*>(alpha);
+					if (alphaT <= 0.0f || alphaT >= 1.0f)
+						return NVGRAPH_STATUS_INVALID_VALUE;
+					rc = subgraph_view_pagerank(handle, descrG, weight_index, subvertices, numvertices, subedges, numedges,
+														 alphaT, bookmark, tol, max_it, has_guess, rank);
+					break;
+				}
+				case CUDA_R_64F:
+				{
+					double alphaT = *static_cast<const double*>(alpha);
+					if (alphaT <= 0.0 || alphaT >= 1.0)
+						return NVGRAPH_STATUS_INVALID_VALUE;
+					rc = subgraph_view_pagerank(handle, descrG, weight_index, subvertices, numvertices, subedges, numedges,
+														 alphaT, bookmark, tol, max_it, has_guess, rank);
+					break;
+				}
+				default:
+					return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+			}
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphBalancedCutClustering_impl(nvgraphHandle_t handle,
+																						const nvgraphGraphDescr_t descrG,
+																						const size_t weight_index,
+																						const int n_clusters,
+																						const int n_eig_vects,
+																						const int evs_type,
+																						const float evs_tolerance,
+																						const int evs_max_iter,
+																						const float kmean_tolerance,
+																						const int kmean_max_iter,
+																						const int kmean_batch_size,
+																						int* clustering,
+																						void* eig_vals,
+																						void* eig_vects)
+																						{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_context(handle) || check_graph(descrG) || check_int_size(weight_index))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (descrG->graphStatus != HAS_VALUES) // need a MultiValuedCsrGraph
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (descrG->TT != NVGRAPH_CSR_32) // supported topologies
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			int evs_max_it, kmean_max_it;
+			int iters_lanczos, iters_kmeans;
+			float evs_tol, kmean_tol;
+
+			// evs_type 2 is randomized subspace iteration, a fixed budget
+			// of evs_max_iter iterations
+			if (evs_max_iter > 0)
+				evs_max_it = evs_max_iter;
+			else
+				evs_max_it = (evs_type == 2) ? 20 : 4000;
+
+			if (evs_tolerance == 0.0f)
+				evs_tol = 1.0E-3f;
+			else if (evs_tolerance < 1.0f && evs_tolerance > 0.0f)
+				evs_tol = evs_tolerance;
+			else
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (kmean_max_iter > 0)
+				kmean_max_it = kmean_max_iter;
+			else
+				kmean_max_it = 200;
+
+			if (kmean_tolerance == 0.0f)
+				kmean_tol = 1.0E-2f;
+			else if (kmean_tolerance < 1.0f && kmean_tolerance > 0.0f)
+				kmean_tol = kmean_tolerance;
+			else
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (n_clusters < 2)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (n_eig_vects > n_clusters)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (!(evs_type == 0 || evs_type == 1 || evs_type == 2))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			// Mini-batch k-means (kmean_batch_size > 0) only after the
+			// Lanczos and subspace eigensolvers
+			if (kmean_batch_size < 0 || (kmean_batch_size > 0 && evs_type == 1))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (clustering == NULL || eig_vals == NULL || eig_vects == NULL)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			switch (descrG->T)
 			{
 				case CUDA_R_32F:
 					{
@@ -2646,7 +3145,7 @@ namespace nvgraph
 					Vector<float> eigVals(n_eig_vects, handle->stream);
 					Vector<float> eigVecs(MCSRG->get_num_vertices() * n_eig_vects, handle->stream);
 
-					if (evs_type == 0)
+					if (evs_type == 0 || evs_type == 2)
 							{
 						int restartIter_lanczos = 15 + n_eig_vects;
 						rc = partition<int, float>(network,
@@ -2654,9 +3153,11 @@ namespace nvgraph
 															n_eig_vects,
 															evs_max_it,
 															restartIter_lanczos,
+															evs_type == 2,
 															evs_tol,
 															kmean_max_it,
 															kmean_tol,
+															kmean_batch_size,
 															clust.raw(),
 															eigVals,
 															eigVecs,
@@ -2714,7 +3215,7 @@ namespace nvgraph
 					Vector<int> clust(MCSRG->get_num_vertices(), handle->stream);
 					Vector<double> eigVals(n_eig_vects, handle->stream);
 					Vector<double> eigVecs(MCSRG->get_num_vertices() * n_eig_vects, handle->stream);
-					if (evs_type == 0)
+					if (evs_type == 0 || evs_type == 2)
 							{
 						int restartIter_lanczos = 15 + n_eig_vects;
 						rc = partition<int, double>(network,
@@ -2722,9 +3223,11 @@ namespace nvgraph
 																n_eig_vects,
 																evs_max_it,
 																restartIter_lanczos,
+																evs_type == 2,
 																evs_tol,
 																kmean_max_it,
 																kmean_tol,
+																kmean_batch_size,
 																clust.raw(),
 																eigVals,
 																eigVecs,
@@ -2962,6 +3465,7 @@ namespace nvgraph
 																									const int evs_max_iter,
 																									const float kmean_tolerance,
 																									const int kmean_max_iter,
+																									const bool randomized_subspace,
 																									int* clustering,
 																									void* eig_vals,
 																									void* eig_vects)
@@ -2985,7 +3489,7 @@ namespace nvgraph
 			if (evs_max_iter > 0)
 				evs_max_it = evs_max_iter;
 			else
-				evs_max_it = 4000;
+				evs_max_it = randomized_subspace ? 20 : 4000;
 
 			if (evs_tolerance == 0.0f)
 				evs_tol = 1.0E-3f;
@@ -3035,6 +3539,7 @@ namespace nvgraph
 																			n_eig_vects,
 																			evs_max_it,
 																			restartIter_lanczos,
+																			randomized_subspace,
 																			evs_tol,
 																			kmean_max_it,
 																			kmean_tol,
@@ -3082,6 +3587,7 @@ namespace nvgraph
 																			n_eig_vects,
 																			evs_max_it,
 																			restartIter_lanczos,
+																			randomized_subspace,
 																			evs_tol,
 																			kmean_max_it,
 																			kmean_tol,
@@ -3226,194 +3732,239 @@ namespace nvgraph
 			{
 				case HAS_TOPOLOGY: //CsrGraph
 				{
-					nvgraph::CsrGraph<int> *CSRG =
+					nvgraph::CsrGraph<IndexType> *CSRG =
 							static_cast<nvgraph::CsrGraph<IndexType>*>(descrG->graph_handle);
 
-					Graph<IndexType>* contracted_graph = NULL;
-
-					switch (VertexCombineOp)
-					{
-						case NVGRAPH_MULTIPLY:
-							contracted_graph = contract_graph_csr_mul(*CSRG,
-																					aggregates,
-																					numaggregates,
-																					handle->stream,
-																					VertexCombineOp,
-																					VertexReduceOp,
-																					EdgeCombineOp,
-																					EdgeReduceOp);
-							break;
-						case NVGRAPH_SUM:
-							contracted_graph = contract_graph_csr_sum(*CSRG,
-																					aggregates,
-																					numaggregates,
-																					handle->stream,
-																					VertexCombineOp,
-																					VertexReduceOp,
-																					EdgeCombineOp,
-																					EdgeReduceOp);
-							break;
-						case NVGRAPH_MIN:
-							contracted_graph = contract_graph_csr_min(*CSRG,
-																					aggregates,
-																					numaggregates,
-																					handle->stream,
-																					VertexCombineOp,
-																					VertexReduceOp,
-																					EdgeCombineOp,
-																					EdgeReduceOp);
-							break;
-						case NVGRAPH_MAX:
-							contracted_graph = contract_graph_csr_max(*CSRG,
-																					aggregates,
-																					numaggregates,
-																					handle->stream,
-																					VertexCombineOp,
-																					VertexReduceOp,
-																					EdgeCombineOp,
-																					EdgeReduceOp);
-							break;
-					}
-
-					contrdescrG->graph_handle = contracted_graph;
+					//the semiring operators only act on vertex and edge data
+					contrdescrG->graph_handle = nvgraph::contract_graph(*CSRG,
+																						 aggregates,
+																						 numaggregates,
+																						 handle->stream);
 					contrdescrG->graphStatus = HAS_TOPOLOGY;
 				}
 					break;
 
 				case HAS_VALUES: //MultiValuedCsrGraph
 					if (descrG->T == CUDA_R_32F)
-							{
-						nvgraph::MultiValuedCsrGraph<int, float> *MCSRG =
-								static_cast<nvgraph::MultiValuedCsrGraph<int, float>*>(descrG->graph_handle);
-						nvgraph::MultiValuedCsrGraph<int, float>* contracted_graph = NULL;
-
-						switch (VertexCombineOp)
-						{
-							case NVGRAPH_MULTIPLY:
-								contracted_graph = contract_graph_mv_float_mul(*MCSRG,
-																								aggregates,
-																								numaggregates,
-																								handle->stream,
-																								VertexCombineOp,
-																								VertexReduceOp,
-																								EdgeCombineOp,
-																								EdgeReduceOp);
-								break;
-							case NVGRAPH_SUM:
-								contracted_graph = contract_graph_mv_float_sum(*MCSRG,
-																								aggregates,
-																								numaggregates,
-																								handle->stream,
-																								VertexCombineOp,
-																								VertexReduceOp,
-																								EdgeCombineOp,
-																								EdgeReduceOp);
-								break;
-							case NVGRAPH_MIN:
-								contracted_graph = contract_graph_mv_float_min(*MCSRG,
-																								aggregates,
-																								numaggregates,
-																								handle->stream,
-																								VertexCombineOp,
-																								VertexReduceOp,
-																								EdgeCombineOp,
-																								EdgeReduceOp);
-								break;
-							case NVGRAPH_MAX:
-								contracted_graph = contract_graph_mv_float_max(*MCSRG,
-																								aggregates,
-																								numaggregates,
-																								handle->stream,
-																								VertexCombineOp,
-																								VertexReduceOp,
-																								EdgeCombineOp,
-																								EdgeReduceOp);
-								break;
-						}
-
-						contrdescrG->graph_handle = contracted_graph;
+					{
+						nvgraph::MultiValuedCsrGraph<IndexType, float> *MCSRG =
+								static_cast<nvgraph::MultiValuedCsrGraph<IndexType, float>*>(descrG->graph_handle);
+						contrdescrG->graph_handle = nvgraph::contract_graph(*MCSRG,
+																							 aggregates,
+																							 numaggregates,
+																							 handle->stream,
+																							 static_cast<nvgraph::SemiRingFunctorTypes>(VertexCombineOp),
+																							 static_cast<nvgraph::SemiRingFunctorTypes>(VertexReduceOp),
+																							 static_cast<nvgraph::SemiRingFunctorTypes>(EdgeCombineOp),
+																							 static_cast<nvgraph::SemiRingFunctorTypes>(EdgeReduceOp));
 						contrdescrG->graphStatus = HAS_VALUES;
 					}
 					else if (descrG->T == CUDA_R_64F)
-							{
-						nvgraph::MultiValuedCsrGraph<int, double> *MCSRG =
-								static_cast<nvgraph::MultiValuedCsrGraph<int, double>*>(descrG->graph_handle);
+					{
+						nvgraph::MultiValuedCsrGraph<IndexType, double> *MCSRG =
+								static_cast<nvgraph::MultiValuedCsrGraph<IndexType, double>*>(descrG->graph_handle);
+						contrdescrG->graph_handle = nvgraph::contract_graph(*MCSRG,
+																							 aggregates,
+																							 numaggregates,
+																							 handle->stream,
+																							 static_cast<nvgraph::SemiRingFunctorTypes>(VertexCombineOp),
+																							 static_cast<nvgraph::SemiRingFunctorTypes>(VertexReduceOp),
+																							 static_cast<nvgraph::SemiRingFunctorTypes>(EdgeCombineOp),
+																							 static_cast<nvgraph::SemiRingFunctorTypes>(EdgeReduceOp));
+						contrdescrG->graphStatus = HAS_VALUES;
+					}
+					else
+						return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+					break;
+
+				default:
+					return NVGRAPH_STATUS_INVALID_VALUE;
+			}
 
-						nvgraph::MultiValuedCsrGraph<int, double>* contracted_graph = NULL;
+		}
+		NVGRAPH_CATCHES(rc)
 
-						switch (VertexCombineOp)
-						{
-							case NVGRAPH_MULTIPLY:
-								contracted_graph = contract_graph_mv_double_mul(*MCSRG,
-																								aggregates,
-																								numaggregates,
-																								handle->stream,
-																								VertexCombineOp,
-																								VertexReduceOp,
-																								EdgeCombineOp,
-																								EdgeReduceOp);
-								break;
-							case NVGRAPH_SUM:
-								contracted_graph = contract_graph_mv_double_sum(*MCSRG,
-																								aggregates,
-																								numaggregates,
-																								handle->stream,
-																								VertexCombineOp,
-																								VertexReduceOp,
-																								EdgeCombineOp,
-																								EdgeReduceOp);
-								break;
-							case NVGRAPH_MIN:
-								contracted_graph = contract_graph_mv_double_min(*MCSRG,
-																								aggregates,
-																								numaggregates,
-																								handle->stream,
-																								VertexCombineOp,
-																								VertexReduceOp,
-																								EdgeCombineOp,
-																								EdgeReduceOp);
-								break;
-							case NVGRAPH_MAX:
-								contracted_graph = contract_graph_mv_double_max(*MCSRG,
-																								aggregates,
-																								numaggregates,
-																								handle->stream,
-																								VertexCombineOp,
-																								VertexReduceOp,
-																								EdgeCombineOp,
-																								EdgeReduceOp);
-								break;
-						}
+		return getCAPIStatusForError(rc);
+	}
+#endif
 
-						contrdescrG->graph_handle = contracted_graph;
-						contrdescrG->graphStatus = HAS_VALUES;
+	// Contract graph (MCSRG NULL for a topology only graph) on the host, see GraphContractionHost
+	template<typename ValueType>
+	nvgraph::CsrGraph<int>* contract_graph_host(nvgraph::CsrGraph<int>& graph,
+															  nvgraph::MultiValuedCsrGraph<int, ValueType>* MCSRG,
+															  int *aggregates,
+															  size_t numaggregates,
+															  cudaStream_t stream,
+															  nvgraphSemiringOps_t VertexCombineOp,
+															  nvgraphSemiringOps_t VertexReduceOp,
+															  nvgraphSemiringOps_t EdgeCombineOp,
+															  nvgraphSemiringOps_t EdgeReduceOp)
+	{
+		int n = static_cast<int>(graph.get_num_vertices());
+		int nnz = static_cast<int>(graph.get_num_edges());
+		std::vector<int> row_offsets(n + 1), col_indices(nnz);
+		CHECK_CUDA(cudaMemcpy(&row_offsets[0], graph.get_raw_row_offsets(), (n + 1) * sizeof(int), cudaMemcpyDefault));
+		if (nnz > 0)
+			CHECK_CUDA(cudaMemcpy(&col_indices[0], graph.get_raw_column_indices(), nnz * sizeof(int), cudaMemcpyDefault));
+
+		size_t n_vertex_dims = MCSRG ? MCSRG->get_num_vertex_dim() : 0;
+		size_t n_edge_dims = MCSRG ? MCSRG->get_num_edge_dim() : 0;
+		std::vector<std::vector<ValueType> > edge_data(n_edge_dims, std::vector<ValueType>(nnz));
+		std::vector<const ValueType*> edge_ptr(n_edge_dims, (const ValueType*) NULL);
+		for (size_t d = 0; d < n_edge_dims && nnz > 0; ++d)
+		{
+			CHECK_CUDA(cudaMemcpy(&edge_data[d][0], MCSRG->get_raw_edge_dim(d), nnz * sizeof(ValueType), cudaMemcpyDefault));
+			edge_ptr[d] = &edge_data[d][0];
+		}
+
+		nvgraph::GraphContractionHost<int, ValueType> contraction(n, nnz,
+																					 &row_offsets[0],
+																					 nnz > 0 ? &col_indices[0] : NULL,
+																					 aggregates,
+																					 numaggregates,
+																					 VertexCombineOp,
+																					 VertexReduceOp,
+																					 EdgeCombineOp,
+																					 EdgeReduceOp);
+		std::vector<std::vector<ValueType> > cg_edge_data;
+		contraction.contract(n_edge_dims, n_edge_dims > 0 ? &edge_ptr[0] : NULL, cg_edge_data);
+
+		size_t cg_n = contraction.get_num_aggregates();
+		size_t cg_nnz = contraction.get_col_ind().size();
+		nvgraph::CsrGraph<int>* contracted_graph = NULL;
+		if (MCSRG)
+		{
+			if (cg_nnz == 0)
+				WARNING("Contracted graph is disjointed (no edges)");
+			nvgraph::MultiValuedCsrGraph<int, ValueType>* mv_contracted_graph =
+					new nvgraph::MultiValuedCsrGraph<int, ValueType>(cg_n, cg_nnz, stream);
+			contracted_graph = mv_contracted_graph;
+
+			mv_contracted_graph->allocateVertexData(n_vertex_dims, stream);
+			std::vector<ValueType> vertex_data(n), cg_vertex_data(cg_n);
+			for (size_t d = 0; d < n_vertex_dims; ++d)
+			{
+				CHECK_CUDA(cudaMemcpy(&vertex_data[0], MCSRG->get_raw_vertex_dim(d), n * sizeof(ValueType), cudaMemcpyDefault));
+				contraction.contract_vertex_data(&vertex_data[0], &cg_vertex_data[0]);
+				CHECK_CUDA(cudaMemcpy(mv_contracted_graph->get_raw_vertex_dim(d), &cg_vertex_data[0], cg_n * sizeof(ValueType), cudaMemcpyDefault));
+			}
+			mv_contracted_graph->allocateEdgeData(n_edge_dims, stream);
+			for (size_t d = 0; d < n_edge_dims && cg_nnz > 0; ++d)
+				CHECK_CUDA(cudaMemcpy(mv_contracted_graph->get_raw_edge_dim(d), &cg_edge_data[d][0], cg_nnz * sizeof(ValueType), cudaMemcpyDefault));
+		}
+		else
+			contracted_graph = new nvgraph::CsrGraph<int>(cg_n, cg_nnz, stream);
+
+		CHECK_CUDA(cudaMemcpy(contracted_graph->get_raw_row_offsets(), &contraction.get_row_ptr()[0], (cg_n + 1) * sizeof(int), cudaMemcpyDefault));
+		if (cg_nnz > 0)
+			CHECK_CUDA(cudaMemcpy(contracted_graph->get_raw_column_indices(), &contraction.get_col_ind()[0], cg_nnz * sizeof(int), cudaMemcpyDefault));
+		return contracted_graph;
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphContractGraphHost_impl(nvgraphHandle_t handle,
+																				 nvgraphGraphDescr_t descrG,
+																				 nvgraphGraphDescr_t contrdescrG,
+																				 int *aggregates,
+																				 size_t numaggregates,
+																				 nvgraphSemiringOps_t VertexCombineOp,
+																				 nvgraphSemiringOps_t VertexReduceOp,
+																				 nvgraphSemiringOps_t EdgeCombineOp,
+																				 nvgraphSemiringOps_t EdgeReduceOp,
+																				 int flag) //unused, for now
+																				 {
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		typedef int IndexType;
+
+		try {
+			if (check_context(handle) ||
+					check_graph(descrG) ||
+					!contrdescrG ||
+					check_int_size(numaggregates) ||
+					check_ptr(aggregates))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			switch (descrG->graphStatus)
+			{
+				case HAS_TOPOLOGY: //CsrGraph
+				{
+					nvgraph::CsrGraph<IndexType> *CSRG =
+							static_cast<nvgraph::CsrGraph<IndexType>*>(descrG->graph_handle);
+					contrdescrG->graph_handle = contract_graph_host<float>(*CSRG,
+																							 NULL,
+																							 aggregates,
+																							 numaggregates,
+																							 handle->stream,
+																							 VertexCombineOp,
+																							 VertexReduceOp,
+																							 EdgeCombineOp,
+																							 EdgeReduceOp);
+					contrdescrG->graphStatus = HAS_TOPOLOGY;
+				}
+					break;
+
+				case HAS_VALUES: //MultiValuedCsrGraph
+					if (descrG->T == CUDA_R_32F)
+					{
+						nvgraph::MultiValuedCsrGraph<IndexType, float> *MCSRG =
+								static_cast<nvgraph::MultiValuedCsrGraph<IndexType, float>*>(descrG->graph_handle);
+						contrdescrG->graph_handle = contract_graph_host<float>(*MCSRG,
+																								 MCSRG,
+																								 aggregates,
+																								 numaggregates,
+																								 handle->stream,
+																								 VertexCombineOp,
+																								 VertexReduceOp,
+																								 EdgeCombineOp,
+																								 EdgeReduceOp);
+					}
+					else if (descrG->T == CUDA_R_64F)
+					{
+						nvgraph::MultiValuedCsrGraph<IndexType, double> *MCSRG =
+								static_cast<nvgraph::MultiValuedCsrGraph<IndexType, double>*>(descrG->graph_handle);
+						contrdescrG->graph_handle = contract_graph_host<double>(*MCSRG,
+																								  MCSRG,
+																								  aggregates,
+																								  numaggregates,
+																								  handle->stream,
+																								  VertexCombineOp,
+																								  VertexReduceOp,
+																								  EdgeCombineOp,
+																								  EdgeReduceOp);
 					}
 					else
 						return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+					contrdescrG->graphStatus = HAS_VALUES;
 					break;
 
 				default:
 					return NVGRAPH_STATUS_INVALID_VALUE;
 			}
 
+			contrdescrG->TT = descrG->TT;
+			contrdescrG->T = descrG->T;
 		}
 		NVGRAPH_CATCHES(rc)
 
 		return getCAPIStatusForError(rc);
 	}
-#endif
 	
 	nvgraphStatus_t NVGRAPH_API nvgraphSpectralClustering_impl(nvgraphHandle_t handle, // nvGRAPH library handle.
 																					const nvgraphGraphDescr_t descrG, // nvGRAPH graph descriptor, should contain the connectivity information in NVGRAPH_CSR_32 or NVGRAPH_CSR_32 at least 1 edge set (weights)
 																					const size_t weight_index, // Index of the edge set for the weights.
 																					const struct SpectralClusteringParameter *params, //parameters, see struct SpectralClusteringParameter
+																					const int kmean_batch_size, // mini-batch size of k-means, 0 for full batches
 																					int* clustering, // (output) clustering
 																					void* eig_vals, // (output) eigenvalues
 																					void* eig_vects) // (output) eigenvectors
 																					{
 		if (check_ptr(params) || check_ptr(clustering) || check_ptr(eig_vals) || check_ptr(eig_vects))
 			FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
-		if (params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION)
+		if ((params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION
+				|| params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION_SUBSPACE)
+				&& kmean_batch_size != 0)
+			return NVGRAPH_STATUS_INVALID_VALUE;
+		if (params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION
+				|| params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION_SUBSPACE)
 			return nvgraph::nvgraphSpectralModularityMaximization_impl(handle,
 																							descrG,
 																							weight_index,
@@ -3423,6 +3974,7 @@ namespace nvgraph
 																							params->evs_max_iter,
 																							params->kmean_tolerance,
 																							params->kmean_max_iter,
+																							params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION_SUBSPACE,
 																							clustering,
 																							eig_vals,
 																							eig_vects);
@@ -3437,6 +3989,7 @@ namespace nvgraph
 																				params->evs_max_iter,
 																				params->kmean_tolerance,
 																				params->kmean_max_iter,
+																				kmean_batch_size,
 																				clustering,
 																				eig_vals,
 																				eig_vects);
@@ -3451,6 +4004,22 @@ namespace nvgraph
 																				params->evs_max_iter,
 																				params->kmean_tolerance,
 																				params->kmean_max_iter,
+																				kmean_batch_size,
+																				clustering,
+																				eig_vals,
+																				eig_vects);
+		else if (params->algorithm == NVGRAPH_BALANCED_CUT_SUBSPACE)
+			return nvgraph::nvgraphBalancedCutClustering_impl(handle,
+																				descrG,
+																				weight_index,
+																				params->n_clusters,
+																				params->n_eig_vects,
+																				2,
+																				params->evs_tolerance,
+																				params->evs_max_iter,
+																				params->kmean_tolerance,
+																				params->kmean_max_iter,
+																				kmean_batch_size,
 																				clustering,
 																				eig_vals,
 																				eig_vects);
@@ -3458,6 +4027,136 @@ namespace nvgraph
 			return NVGRAPH_STATUS_INVALID_VALUE;
 	}
 
+	template<typename ValueType>
+	nvgraphStatus_t nvgraphAnalyzeClusteringAll_dispatch(nvgraphHandle_t handle,
+																		  const nvgraphGraphDescr_t descrG,
+																		  const size_t weight_index,
+																		  const int n_clusters,
+																		  const int* clustering,
+																		  struct nvgraphClusteringScores * scores,
+																		  int * cluster_sizes,
+																		  float * cluster_volumes,
+																		  float * cluster_cuts,
+																		  float * cluster_conductances)
+																		  {
+		nvgraph::MultiValuedCsrGraph<int, ValueType> *MCSRG =
+				static_cast<nvgraph::MultiValuedCsrGraph<int, ValueType>*>(descrG->graph_handle);
+		if (weight_index >= MCSRG->get_num_edge_dim()
+				|| n_clusters > static_cast<int>(MCSRG->get_num_vertices())) // base index is 0
+			return NVGRAPH_STATUS_INVALID_VALUE;
+		nvgraph::ValuedCsrGraph<int, ValueType> network =
+				*MCSRG->get_valued_csr_graph(weight_index);
+		Vector<int> clust(MCSRG->get_num_vertices(), handle->stream);
+		CHECK_CUDA(cudaMemcpy(clust.raw(),
+										(int* )clustering,
+										(size_t )(MCSRG->get_num_vertices() * sizeof(int)),
+										cudaMemcpyDefault));
+		std::vector<int> sizes(n_clusters);
+		std::vector<ValueType> volumes(n_clusters), cuts(n_clusters), conductances(n_clusters);
+		ValueType modularity, edge_cut, ratio_cut, normalized_cut;
+		NVGRAPH_ERROR rc = analyzeClustering<int, ValueType>(network,
+																			  n_clusters,
+																			  clust.raw(),
+																			  &sizes[0],
+																			  &volumes[0],
+																			  &cuts[0],
+																			  &conductances[0],
+																			  modularity,
+																			  edge_cut,
+																			  ratio_cut,
+																			  normalized_cut);
+		if (rc != NVGRAPH_OK)
+			return getCAPIStatusForError(rc);
+		scores->modularity = static_cast<float>(modularity);
+		scores->edge_cut = static_cast<float>(edge_cut);
+		scores->ratio_cut = static_cast<float>(ratio_cut);
+		scores->normalized_cut = static_cast<float>(normalized_cut);
+		for (int c = 0; c < n_clusters; c++)
+		{
+			if (cluster_sizes)
+				cluster_sizes[c] = sizes[c];
+			if (cluster_volumes)
+				cluster_volumes[c] = static_cast<float>(volumes[c]);
+			if (cluster_cuts)
+				cluster_cuts[c] = static_cast<float>(cuts[c]);
+			if (cluster_conductances)
+				cluster_conductances[c] = static_cast<float>(conductances[c]);
+		}
+		return NVGRAPH_STATUS_SUCCESS;
+	}
+
+	// topology_status is returned for a topology other than CSR_32, it keeps the status of the
+	// entry points that used to compute a single metric
+	nvgraphStatus_t nvgraphAnalyzeClusteringScores_impl(nvgraphHandle_t handle,
+																		 const nvgraphGraphDescr_t descrG,
+																		 const size_t weight_index,
+																		 const int n_clusters,
+																		 const int* clustering,
+																		 struct nvgraphClusteringScores * scores,
+																		 int * cluster_sizes,
+																		 float * cluster_volumes,
+																		 float * cluster_cuts,
+																		 float * cluster_conductances,
+																		 nvgraphStatus_t topology_status)
+																		 {
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_context(handle) || check_graph(descrG) || check_int_size(weight_index))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (descrG->graphStatus != HAS_VALUES) // need a MultiValuedCsrGraph
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (descrG->TT != NVGRAPH_CSR_32) // supported topologies
+				return topology_status;
+
+			if (n_clusters < 1)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (clustering == NULL || scores == NULL)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			switch (descrG->T)
+			{
+				case CUDA_R_32F:
+					return nvgraphAnalyzeClusteringAll_dispatch<float>(handle, descrG, weight_index, n_clusters, clustering,
+																						scores, cluster_sizes, cluster_volumes, cluster_cuts, cluster_conductances);
+				case CUDA_R_64F:
+					return nvgraphAnalyzeClusteringAll_dispatch<double>(handle, descrG, weight_index, n_clusters, clustering,
+																						 scores, cluster_sizes, cluster_volumes, cluster_cuts, cluster_conductances);
+				default:
+					return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+			}
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphAnalyzeClusteringAll_impl(nvgraphHandle_t handle,
+																					const nvgraphGraphDescr_t descrG,
+																					const size_t weight_index,
+																					const int n_clusters,
+																					const int* clustering,
+																					struct nvgraphClusteringScores * scores,
+																					int * cluster_sizes,
+																					float * cluster_volumes,
+																					float * cluster_cuts,
+																					float * cluster_conductances)
+																					{
+		return nvgraphAnalyzeClusteringScores_impl(handle,
+																 descrG,
+																 weight_index,
+																 n_clusters,
+																 clustering,
+																 scores,
+																 cluster_sizes,
+																 cluster_volumes,
+																 cluster_cuts,
+																 cluster_conductances,
+																 NVGRAPH_STATUS_INVALID_VALUE);
+	}
+
 	nvgraphStatus_t NVGRAPH_API nvgraphAnalyzeClustering_impl(nvgraphHandle_t handle, // nvGRAPH library handle.
 																					const nvgraphGraphDescr_t descrG, // nvGRAPH graph descriptor, should contain the connectivity information in NVGRAPH_CSR_32 at least 1 edge set (weights)
 																					const size_t weight_index, // Index of the edge set for the weights.
@@ -3468,37 +4167,35 @@ namespace nvgraph
 																					{
 		if (check_ptr(clustering) || check_ptr(score))
 			FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+		if (metric != NVGRAPH_MODULARITY && metric != NVGRAPH_EDGE_CUT && metric != NVGRAPH_RATIO_CUT)
+			return NVGRAPH_STATUS_INVALID_VALUE;
+		if (n_clusters < 2)
+			return NVGRAPH_STATUS_INVALID_VALUE;
+
+		// one pass over the graph for any metric, with the statuses of the former per metric paths
+		struct nvgraphClusteringScores scores;
+		nvgraphStatus_t status = nvgraphAnalyzeClusteringScores_impl(handle,
+																						 descrG,
+																						 weight_index,
+																						 n_clusters,
+																						 clustering,
+																						 &scores,
+																						 NULL,
+																						 NULL,
+																						 NULL,
+																						 NULL,
+																						 metric == NVGRAPH_MODULARITY ?
+																								 NVGRAPH_STATUS_GRAPH_TYPE_NOT_SUPPORTED :
+																								 NVGRAPH_STATUS_INVALID_VALUE);
+		if (status != NVGRAPH_STATUS_SUCCESS)
+			return status;
 		if (metric == NVGRAPH_MODULARITY)
-			return nvgraphAnalyzeModularityClustering_impl(handle,
-																			descrG,
-																			weight_index,
-																			n_clusters,
-																			clustering,
-																			score);
+			*score = scores.modularity;
 		else if (metric == NVGRAPH_EDGE_CUT)
-				{
-			float dummy = 0;
-			return nvgraph::nvgraphAnalyzeBalancedCut_impl(handle,
-																			descrG,
-																			weight_index,
-																			n_clusters,
-																			clustering,
-																			score,
-																			&dummy);
-		}
-		else if (metric == NVGRAPH_RATIO_CUT)
-				{
-			float dummy = 0;
-			return nvgraph::nvgraphAnalyzeBalancedCut_impl(handle,
-																			descrG,
-																			weight_index,
-																			n_clusters,
-																			clustering,
-																			&dummy,
-																			score);
-		}
+			*score = scores.edge_cut;
 		else
-			return NVGRAPH_STATUS_INVALID_VALUE;
+			*score = scores.ratio_cut;
+		return NVGRAPH_STATUS_SUCCESS;
 	}
 
 	nvgraphStatus_t NVGRAPH_API nvgraphTriangleCount_impl(nvgraphHandle_t handle,
@@ -3532,6 +4229,376 @@ namespace nvgraph
 		return getCAPIStatusForError(rc);
 	}
 
+	nvgraphStatus_t NVGRAPH_API nvgraphTriangleCountHost_impl(const nvgraphCSRTopology32I_t topology,
+																			uint64_t* result)
+																			{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_ptr(topology) || check_ptr(result))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (topology->nvertices < 0 || topology->nedges < 0
+					|| check_int_ptr(topology->source_offsets)
+					|| (topology->nedges > 0 && check_int_ptr(topology->destination_indices)))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			nvgraph::triangles_counting::TrianglesCountHost<int> counter(topology->nvertices,
+																				  topology->nedges,
+																				  topology->source_offsets,
+																				  topology->destination_indices);
+			rc = counter.count();
+			*result = counter.get_triangles_count();
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphTriangleCountApproxHost_impl(const nvgraphCSRTopology32I_t topology,
+																			const float error,
+																			const float confidence,
+																			const unsigned long long seed,
+																			double* estimate,
+																			double* lower,
+																			double* upper)
+																			{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_ptr(topology) || check_ptr(estimate))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (topology->nvertices < 0 || topology->nedges < 0
+					|| check_int_ptr(topology->source_offsets)
+					|| (topology->nedges > 0 && check_int_ptr(topology->destination_indices)))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (!(error > 0.f && error < 1.f) || !(confidence > 0.f && confidence < 1.f))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			nvgraph::triangles_counting::TrianglesCountSampling<int> counter(topology->nvertices,
+																					  topology->nedges,
+																					  topology->source_offsets,
+																					  topology->destination_indices);
+			rc = counter.count(error, confidence, seed);
+			*estimate = counter.get_estimate();
+			if (lower != NULL)
+				*lower = counter.get_lower_bound();
+			if (upper != NULL)
+				*upper = counter.get_upper_bound();
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphTriangleCountVertexHost_impl(const nvgraphCSRTopology32I_t topology,
+																			const cudaDataType_t clustering_type,
+																			uint64_t* vertex_triangles,
+																			void* clustering)
+																			{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_ptr(topology) || (vertex_triangles == NULL && clustering == NULL))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (topology->nvertices < 0 || topology->nedges < 0
+					|| check_int_ptr(topology->source_offsets)
+					|| (topology->nedges > 0 && check_int_ptr(topology->destination_indices)))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (clustering != NULL && clustering_type != CUDA_R_32F && clustering_type != CUDA_R_64F)
+				return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+
+			nvgraph::triangles_counting::TrianglesCountHost<int> counter(topology->nvertices,
+																				  topology->nedges,
+																				  topology->source_offsets,
+																				  topology->destination_indices);
+			if (clustering == NULL)
+				rc = counter.count_per_vertex(vertex_triangles);
+			else if (clustering_type == CUDA_R_32F)
+				rc = counter.clustering_coefficient(vertex_triangles, static_cast<float*>(clustering));
+			else
+				rc = counter.clustering_coefficient(vertex_triangles, static_cast<double*>(clustering));
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphKTrussHost_impl(const nvgraphCSRTopology32I_t topology,
+																			int* edge_support,
+																			int* truss)
+																			{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_ptr(topology) || (edge_support == NULL && truss == NULL))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (topology->nvertices < 0 || topology->nedges < 0
+					|| check_int_ptr(topology->source_offsets)
+					|| (topology->nedges > 0 && check_int_ptr(topology->destination_indices)))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			nvgraph::triangles_counting::TrianglesCountHost<int> counter(topology->nvertices,
+																				  topology->nedges,
+																				  topology->source_offsets,
+																				  topology->destination_indices);
+			if (edge_support != NULL)
+				rc = counter.edge_support(edge_support);
+			if (rc == NVGRAPH_OK && truss != NULL)
+				rc = counter.ktruss(truss);
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
+	// Host LOBPCG partition, preconditioned as selected by prec
+	template<typename ValueType>
+	NVGRAPH_ERROR partition_lobpcg_host_prec(const nvgraphCSRTopology32I_t topology,
+															const ValueType *edge_weights,
+															nvgraphPreconditionerType_t prec,
+															const struct SpectralClusteringParameter *params,
+															int evs_max_it, ValueType evs_tol,
+															int kmean_max_it, ValueType kmean_tol,
+															int kmean_batch_size,
+															int* clustering,
+															ValueType* eig_vals,
+															ValueType* eig_vects,
+															int &iters_lanczos, int &iters_kmeans)
+	{
+		CsrMatrixHost<int, ValueType> A(topology->nvertices, topology->nvertices, topology->nedges,
+												  edge_weights,
+												  topology->source_offsets,
+												  topology->destination_indices);
+		std::unique_ptr<Matrix<int, ValueType> > M;
+		if (prec == NVGRAPH_PRECONDITIONER_JACOBI)
+			M.reset(new JacobiPreconditionerHost<int, ValueType>(A));
+		else if (prec == NVGRAPH_PRECONDITIONER_AGGREGATION)
+			M.reset(new AggregationPreconditionerHost<int, ValueType>(A));
+		return partition_lobpcg_host<int, ValueType>(topology->nvertices, topology->nedges,
+																	topology->source_offsets,
+																	topology->destination_indices,
+																	edge_weights, M.get(),
+																	params->n_clusters, params->n_eig_vects,
+																	evs_max_it, evs_tol,
+																	kmean_max_it, kmean_tol, kmean_batch_size,
+																	clustering, eig_vals, eig_vects,
+																	iters_lanczos, iters_kmeans);
+	}
+
+	nvgraphStatus_t NVGRAPH_API nvgraphSpectralClusteringHost_impl(const nvgraphCSRTopology32I_t topology,
+																						const cudaDataType_t weight_type,
+																						const void *edge_weights,
+																						const struct SpectralClusteringParameter *params,
+																						const int kmean_batch_size,
+																						int* clustering,
+																						void* eig_vals,
+																						void* eig_vects)
+																						{
+		NVGRAPH_ERROR rc = NVGRAPH_OK;
+		try
+		{
+			if (check_ptr(topology) || check_ptr(params) || check_ptr(clustering)
+					|| check_ptr(eig_vals) || check_ptr(eig_vects))
+				FatalError("Incorrect parameters.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+			if (topology->nvertices < 0 || topology->nedges < 0
+					|| check_int_ptr(topology->source_offsets)
+					|| (topology->nedges > 0 && check_int_ptr(topology->destination_indices)))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			int evs_max_it, kmean_max_it;
+			int iters_lanczos, iters_kmeans;
+			float evs_tol, kmean_tol;
+
+			// Only the Lanczos and subspace eigensolvers are available on
+			// the host
+			bool modularity = params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION
+					|| params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION_BLOCK_LANCZOS
+					|| params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION_SUBSPACE;
+			bool block = params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION_BLOCK_LANCZOS
+					|| params->algorithm == NVGRAPH_BALANCED_CUT_BLOCK_LANCZOS;
+			bool subspace = params->algorithm == NVGRAPH_MODULARITY_MAXIMIZATION_SUBSPACE
+					|| params->algorithm == NVGRAPH_BALANCED_CUT_SUBSPACE;
+			bool multilevel = params->algorithm == NVGRAPH_BALANCED_CUT_MULTILEVEL;
+			bool lobpcg = params->algorithm == NVGRAPH_BALANCED_CUT_LOBPCG;
+			if (!(modularity || block || subspace || multilevel || lobpcg
+					|| params->algorithm == NVGRAPH_BALANCED_CUT_LANCZOS))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			// LOBPCG: aggregation preconditioner unless params->opt
+			// points to another nvgraphPreconditionerType_t
+			nvgraphPreconditionerType_t prec = NVGRAPH_PRECONDITIONER_AGGREGATION;
+			if (lobpcg && params->opt != NULL)
+				prec = *static_cast<const nvgraphPreconditionerType_t*>(params->opt);
+			if (prec != NVGRAPH_PRECONDITIONER_NONE
+					&& prec != NVGRAPH_PRECONDITIONER_JACOBI
+					&& prec != NVGRAPH_PRECONDITIONER_AGGREGATION)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+			if (lobpcg && 3 * params->n_eig_vects > topology->nvertices)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (params->evs_max_iter > 0)
+				evs_max_it = params->evs_max_iter;
+			else
+				evs_max_it = subspace ? 20 : 4000;
+
+			if (params->evs_tolerance == 0.0f)
+				evs_tol = 1.0E-3f;
+			else if (params->evs_tolerance < 1.0f && params->evs_tolerance > 0.0f)
+				evs_tol = params->evs_tolerance;
+			else
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (params->kmean_max_iter > 0)
+				kmean_max_it = params->kmean_max_iter;
+			else
+				kmean_max_it = 200;
+
+			if (params->kmean_tolerance == 0.0f)
+				kmean_tol = 1.0E-2f;
+			else if (params->kmean_tolerance < 1.0f && params->kmean_tolerance > 0.0f)
+				kmean_tol = params->kmean_tolerance;
+			else
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (params->n_clusters < 2 || params->n_clusters > topology->nvertices)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			if (params->n_eig_vects > params->n_clusters)
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			// Mini-batch k-means (kmean_batch_size > 0), multilevel does
+			// not run k-means
+			if (kmean_batch_size < 0 || (kmean_batch_size > 0 && multilevel))
+				return NVGRAPH_STATUS_INVALID_VALUE;
+
+			// Blocks of up to 4 vectors, 15 steps between restarts
+			int blockSize_lanczos = block ? (params->n_eig_vects < 4 ? params->n_eig_vects : 4) : 1;
+			int restartIter_lanczos = 15 * blockSize_lanczos + params->n_eig_vects;
+
+			// Multilevel: coarsen to 20 vertices per part (at least 100),
+			// 10 refinement passes per level, 3% imbalance
+			int coarsestSize = 20 * params->n_clusters > 100 ? 20 * params->n_clusters : 100;
+			int levels;
+
+			switch (weight_type)
+			{
+				case CUDA_R_32F:
+					{
+					if (modularity)
+						rc = modularity_maximization_host<int, float>(topology->nvertices, topology->nedges,
+																					 topology->source_offsets,
+																					 topology->destination_indices,
+																					 static_cast<const float*>(edge_weights),
+																					 params->n_clusters, params->n_eig_vects,
+																					 evs_max_it, restartIter_lanczos, blockSize_lanczos, subspace, evs_tol,
+																					 kmean_max_it, kmean_tol, kmean_batch_size,
+																					 clustering,
+																					 static_cast<float*>(eig_vals),
+																					 static_cast<float*>(eig_vects),
+																					 iters_lanczos, iters_kmeans);
+					else if (lobpcg)
+						rc = partition_lobpcg_host_prec<float>(topology,
+																		 static_cast<const float*>(edge_weights),
+																		 prec, params,
+																		 evs_max_it, evs_tol,
+																		 kmean_max_it, kmean_tol, kmean_batch_size,
+																		 clustering,
+																		 static_cast<float*>(eig_vals),
+																		 static_cast<float*>(eig_vects),
+																		 iters_lanczos, iters_kmeans);
+					else if (multilevel)
+						{
+						float edgeCut, imbalance;
+						rc = partition_multilevel_host<int, float>(topology->nvertices, topology->nedges,
+																				topology->source_offsets,
+																				topology->destination_indices,
+																				static_cast<const float*>(edge_weights),
+																				params->n_clusters, params->n_eig_vects,
+																				evs_max_it, restartIter_lanczos, evs_tol,
+																				coarsestSize, 10, float(0.03),
+																				clustering,
+																				static_cast<float*>(eig_vals),
+																				static_cast<float*>(eig_vects),
+																				levels, edgeCut, imbalance);
+						}
+					else
+						rc = partition_host<int, float>(topology->nvertices, topology->nedges,
+																  topology->source_offsets,
+																  topology->destination_indices,
+																  static_cast<const float*>(edge_weights),
+																  params->n_clusters, params->n_eig_vects,
+																  evs_max_it, restartIter_lanczos, blockSize_lanczos, subspace, evs_tol,
+																  kmean_max_it, kmean_tol, kmean_batch_size,
+																  clustering,
+																  static_cast<float*>(eig_vals),
+																  static_cast<float*>(eig_vects),
+																  iters_lanczos, iters_kmeans);
+					break;
+				}
+				case CUDA_R_64F:
+					{
+					if (modularity)
+						rc = modularity_maximization_host<int, double>(topology->nvertices, topology->nedges,
+																					  topology->source_offsets,
+																					  topology->destination_indices,
+																					  static_cast<const double*>(edge_weights),
+																					  params->n_clusters, params->n_eig_vects,
+																					  evs_max_it, restartIter_lanczos, blockSize_lanczos, subspace, evs_tol,
+																					  kmean_max_it, kmean_tol, kmean_batch_size,
+																					  clustering,
+																					  static_cast<double*>(eig_vals),
+																					  static_cast<double*>(eig_vects),
+																					  iters_lanczos, iters_kmeans);
+					else if (lobpcg)
+						rc = partition_lobpcg_host_prec<double>(topology,
+																		 static_cast<const double*>(edge_weights),
+																		 prec, params,
+																		 evs_max_it, evs_tol,
+																		 kmean_max_it, kmean_tol, kmean_batch_size,
+																		 clustering,
+																		 static_cast<double*>(eig_vals),
+																		 static_cast<double*>(eig_vects),
+																		 iters_lanczos, iters_kmeans);
+					else if (multilevel)
+						{
+						double edgeCut, imbalance;
+						rc = partition_multilevel_host<int, double>(topology->nvertices, topology->nedges,
+																				topology->source_offsets,
+																				topology->destination_indices,
+																				static_cast<const double*>(edge_weights),
+																				params->n_clusters, params->n_eig_vects,
+																				evs_max_it, restartIter_lanczos, evs_tol,
+																				coarsestSize, 10, double(0.03),
+																				clustering,
+																				static_cast<double*>(eig_vals),
+																				static_cast<double*>(eig_vects),
+																				levels, edgeCut, imbalance);
+						}
+					else
+						rc = partition_host<int, double>(topology->nvertices, topology->nedges,
+																	topology->source_offsets,
+																	topology->destination_indices,
+																	static_cast<const double*>(edge_weights),
+																	params->n_clusters, params->n_eig_vects,
+																	evs_max_it, restartIter_lanczos, blockSize_lanczos, subspace, evs_tol,
+																	kmean_max_it, kmean_tol, kmean_batch_size,
+																	clustering,
+																	static_cast<double*>(eig_vals),
+																	static_cast<double*>(eig_vects),
+																	iters_lanczos, iters_kmeans);
+					break;
+				}
+				default:
+					return NVGRAPH_STATUS_TYPE_NOT_SUPPORTED;
+			}
+		}
+		NVGRAPH_CATCHES(rc)
+		return getCAPIStatusForError(rc);
+	}
+
 } /*namespace nvgraph*/
 
 /*************************
@@ -3641,6 +4708,104 @@ nvgraphStatus_t NVGRAPH_API nvgraphExtractSubgraphByEdge(nvgraphHandle_t handle,
 	return nvgraph::nvgraphExtractSubgraphByEdge_impl(handle, descrG, subdescrG, subedges, numedges);
 }
 
+nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewTraversalHost(const nvgraphCSRTopology32I_t topology,
+																				const int *subvertices,
+																				size_t numvertices,
+																				const int *subedges,
+																				size_t numedges,
+																				const int source_vert,
+																				int *distances,
+																				int *predecessors)
+																				{
+	return nvgraph::nvgraphSubgraphViewTraversalHost_impl(topology,
+																			subvertices,
+																			numvertices,
+																			subedges,
+																			numedges,
+																			source_vert,
+																			distances,
+																			predecessors);
+}
+
+nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewPagerankHost(const nvgraphCSCTopology32I_t topology,
+																			  const cudaDataType_t weight_type,
+																			  const void *weights,
+																			  const int *subvertices,
+																			  size_t numvertices,
+																			  const int *subedges,
+																			  size_t numedges,
+																			  const void *alpha,
+																			  const void *bookmark,
+																			  const float tolerance,
+																			  const int max_iter,
+																			  const int has_guess,
+																			  void *rank)
+																			  {
+	return nvgraph::nvgraphSubgraphViewPagerankHost_impl(topology,
+																		  weight_type,
+																		  weights,
+																		  subvertices,
+																		  numvertices,
+																		  subedges,
+																		  numedges,
+																		  alpha,
+																		  bookmark,
+																		  tolerance,
+																		  max_iter,
+																		  has_guess,
+																		  rank);
+}
+
+nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewTraversal(nvgraphHandle_t handle,
+																		  const nvgraphGraphDescr_t descrG,
+																		  const int *subvertices,
+																		  size_t numvertices,
+																		  const int *subedges,
+																		  size_t numedges,
+																		  const int source_vert,
+																		  int *distances,
+																		  int *predecessors)
+																		  {
+	return nvgraph::nvgraphSubgraphViewTraversal_impl(handle,
+																	  descrG,
+																	  subvertices,
+																	  numvertices,
+																	  subedges,
+																	  numedges,
+																	  source_vert,
+																	  distances,
+																	  predecessors);
+}
+
+nvgraphStatus_t NVGRAPH_API nvgraphSubgraphViewPagerank(nvgraphHandle_t handle,
+																		 const nvgraphGraphDescr_t descrG,
+																		 const size_t weight_index,
+																		 const int *subvertices,
+																		 size_t numvertices,
+																		 const int *subedges,
+																		 size_t numedges,
+																		 const void *alpha,
+																		 const void *bookmark,
+																		 const float tolerance,
+																		 const int max_iter,
+																		 const int has_guess,
+																		 void *rank)
+																		 {
+	return nvgraph::nvgraphSubgraphViewPagerank_impl(handle,
+																	 descrG,
+																	 weight_index,
+																	 subvertices,
+																	 numvertices,
+																	 subedges,
+																	 numedges,
+																	 alpha,
+																	 bookmark,
+																	 tolerance,
+																	 max_iter,
+																	 has_guess,
+																	 rank);
+}
+
 nvgraphStatus_t NVGRAPH_API nvgraphSetVertexData(nvgraphHandle_t handle,
 																	nvgraphGraphDescr_t descrG,
 																	void *vertexData,
@@ -3675,6 +4840,22 @@ nvgraphStatus_t NVGRAPH_API nvgraphConvertTopology(nvgraphHandle_t handle,
 																dstEdgeData);
 }
 
+nvgraphStatus_t NVGRAPH_API nvgraphConvertTopologyHost(nvgraphTopologyType_t srcTType,
+																	void *srcTopology,
+																	void *srcEdgeData,
+																	cudaDataType_t *dataType,
+																	nvgraphTopologyType_t dstTType,
+																	void *dstTopology,
+																	void *dstEdgeData) {
+	return nvgraph::nvgraphConvertTopologyHost_impl(srcTType,
+																	srcTopology,
+																	srcEdgeData,
+																	dataType,
+																	dstTType,
+																	dstTopology,
+																	dstEdgeData);
+}
+
 nvgraphStatus_t NVGRAPH_API nvgraphConvertGraph(nvgraphHandle_t handle,
 																nvgraphGraphDescr_t srcDescrG,
 																nvgraphGraphDescr_t dstDescrG,
@@ -3715,6 +4896,18 @@ nvgraphStatus_t NVGRAPH_API nvgraphSssp(nvgraphHandle_t handle,
 	return nvgraph::nvgraphSssp_impl(handle, descrG, weight_index, source_vert, sssp);
 }
 
+nvgraphStatus_t NVGRAPH_API nvgraphSsspMulti(nvgraphHandle_t handle,
+															const nvgraphGraphDescr_t descrG,
+															const size_t weight_index,
+															const int *source_verts,
+															const size_t num_sources,
+															const int *destination_verts,
+															const size_t num_destinations,
+															void *distances) {
+	return nvgraph::nvgraphSsspMulti_impl(handle, descrG, weight_index, source_verts, num_sources,
+														destination_verts, num_destinations, distances);
+}
+
 //nvgraphTraversal
 
 typedef enum {
@@ -3899,6 +5092,15 @@ nvgraphStatus_t NVGRAPH_API nvgraphWidestPath(nvgraphHandle_t handle,
 	return nvgraph::nvgraphWidestPath_impl(handle, descrG, weight_index, source_vert, widest_path);
 }
 
+nvgraphStatus_t NVGRAPH_API nvgraphWidestPathHost(const nvgraphCSCTopology32I_t topology,
+																	const cudaDataType_t weight_type,
+																	const void *weights,
+																	const int *source_verts,
+																	const size_t num_sources,
+																	void *widest_path) {
+	return nvgraph::nvgraphWidestPathHost_impl(topology, weight_type, weights, source_verts, num_sources, widest_path);
+}
+
 nvgraphStatus_t NVGRAPH_API nvgraphPagerank(nvgraphHandle_t handle,
 															const nvgraphGraphDescr_t descrG,
 															const size_t weight_index,
@@ -3943,6 +5145,29 @@ nvgraphStatus_t NVGRAPH_API nvgraphKrylovPagerank(nvgraphHandle_t handle,
 																rank);
 }
 
+nvgraphStatus_t NVGRAPH_API nvgraphKrylovPagerankHost(const nvgraphCSCTopology32I_t topology,
+																		const cudaDataType_t weight_type,
+																		const void *weights,
+																		const void *alpha,
+																		const void *bookmark,
+																		const float tolerance,
+																		const int max_iter,
+																		const int subspace_size,
+																		const int has_guess,
+																		void *rank)
+																		{
+	return nvgraph::nvgraphKrylovPagerankHost_impl(topology,
+																	weight_type,
+																	weights,
+																	alpha,
+																	bookmark,
+																	tolerance,
+																	max_iter,
+																	subspace_size,
+																	has_guess,
+																	rank);
+}
+
 nvgraphStatus_t NVGRAPH_API nvgraphBalancedCutClustering(nvgraphHandle_t handle,
 																			const nvgraphGraphDescr_t descrG,
 																			const size_t weight_index,
@@ -3967,6 +5192,7 @@ nvgraphStatus_t NVGRAPH_API nvgraphBalancedCutClustering(nvgraphHandle_t handle,
 																		evs_max_iter,
 																		kmean_tolerance,
 																		kmean_max_iter,
+																		0,
 																		clustering,
 																		eig_vals,
 																		eig_vects);
@@ -4026,6 +5252,7 @@ nvgraphStatus_t NVGRAPH_API nvgraphSpectralModularityMaximization(nvgraphHandle_
 																					evs_max_iter,
 																					kmean_tolerance,
 																					kmean_max_iter,
+																					false,
 																					clustering,
 																					eig_vals,
 																					eig_vects);
@@ -4070,6 +5297,29 @@ nvgraphStatus_t NVGRAPH_API nvgraphContractGraph(nvgraphHandle_t handle,
 }
 #endif 
 
+nvgraphStatus_t NVGRAPH_API nvgraphContractGraphHost(nvgraphHandle_t handle,
+																		nvgraphGraphDescr_t descrG,
+																		nvgraphGraphDescr_t contrdescrG,
+																		int *aggregates,
+																		size_t numaggregates,
+																		nvgraphSemiringOps_t VertexCombineOp,
+																		nvgraphSemiringOps_t VertexReduceOp,
+																		nvgraphSemiringOps_t EdgeCombineOp,
+																		nvgraphSemiringOps_t EdgeReduceOp,
+																		int flag)
+																		{
+	return nvgraph::nvgraphContractGraphHost_impl(handle,
+																descrG,
+																contrdescrG,
+																aggregates,
+																numaggregates,
+																VertexCombineOp,
+																VertexReduceOp,
+																EdgeCombineOp,
+																EdgeReduceOp,
+																flag);
+}
+
 nvgraphStatus_t NVGRAPH_API nvgraphSpectralClustering(nvgraphHandle_t handle, // nvGRAPH library handle.
 																		const nvgraphGraphDescr_t descrG, // nvGRAPH graph descriptor, should contain the connectivity information in NVGRAPH_CSR_32 or NVGRAPH_CSR_32 at least 1 edge set (weights)
 																		const size_t weight_index, // Index of the edge set for the weights.
@@ -4082,6 +5332,26 @@ nvgraphStatus_t NVGRAPH_API nvgraphSpectralClustering(nvgraphHandle_t handle, //
 																	descrG,
 																	weight_index,
 																	params,
+																	0,
+																	clustering,
+																	eig_vals,
+																	eig_vects);
+}
+
+nvgraphStatus_t NVGRAPH_API nvgraphSpectralClusteringMiniBatch(nvgraphHandle_t handle,
+																				const nvgraphGraphDescr_t descrG,
+																				const size_t weight_index,
+																				const struct SpectralClusteringParameter *params,
+																				const int kmean_batch_size,
+																				int* clustering,
+																				void* eig_vals,
+																				void* eig_vects)
+																				{
+	return nvgraph::nvgraphSpectralClustering_impl(handle,
+																	descrG,
+																	weight_index,
+																	params,
+																	kmean_batch_size == 0 ? KMEANS_HOST_BATCH : kmean_batch_size,
 																	clustering,
 																	eig_vals,
 																	eig_vects);
@@ -4104,6 +5374,29 @@ nvgraphStatus_t NVGRAPH_API nvgraphAnalyzeClustering(nvgraphHandle_t handle, //
 																	score);
 }
 
+nvgraphStatus_t NVGRAPH_API nvgraphAnalyzeClusteringAll(nvgraphHandle_t handle,
+																			const nvgraphGraphDescr_t descrG,
+																			const size_t weight_index,
+																			const int n_clusters,
+																			const int* clustering,
+																			struct nvgraphClusteringScores * scores,
+																			int * cluster_sizes,
+																			float * cluster_volumes,
+																			float * cluster_cuts,
+																			float * cluster_conductances)
+																			{
+	return nvgraph::nvgraphAnalyzeClusteringAll_impl(handle,
+																		descrG,
+																		weight_index,
+																		n_clusters,
+																		clustering,
+																		scores,
+																		cluster_sizes,
+																		cluster_volumes,
+																		cluster_cuts,
+																		cluster_conductances);
+}
+
 nvgraphStatus_t NVGRAPH_API nvgraphTriangleCount(nvgraphHandle_t handle,
 																	const nvgraphGraphDescr_t descrG,
 																	uint64_t* result)
@@ -4111,6 +5404,63 @@ nvgraphStatus_t NVGRAPH_API nvgraphTriangleCount(nvgraphHandle_t handle,
 	return nvgraph::nvgraphTriangleCount_impl(handle, descrG, result);
 }
 
+nvgraphStatus_t NVGRAPH_API nvgraphTriangleCountHost(const nvgraphCSRTopology32I_t topology,
+																		uint64_t* result)
+																		{
+	return nvgraph::nvgraphTriangleCountHost_impl(topology, result);
+}
+
+nvgraphStatus_t NVGRAPH_API nvgraphTriangleCountApproxHost(const nvgraphCSRTopology32I_t topology,
+																			const float error,
+																			const float confidence,
+																			const unsigned long long seed,
+																			double* estimate,
+																			double* lower,
+																			double* upper)
+																			{
+	return nvgraph::nvgraphTriangleCountApproxHost_impl(topology, error, confidence, seed, estimate, lower, upper);
+}
+
+nvgraphStatus_t NVGRAPH_API nvgraphTriangleCountVertexHost(const nvgraphCSRTopology32I_t topology,
+																			const cudaDataType_t clustering_type,
+																			uint64_t* vertex_triangles,
+																			void* clustering)
+																			{
+	return nvgraph::nvgraphTriangleCountVertexHost_impl(topology, clustering_type, vertex_triangles, clustering);
+}
+
+nvgraphStatus_t NVGRAPH_API nvgraphKTrussHost(const nvgraphCSRTopology32I_t topology,
+															int* edge_support,
+															int* truss)
+															{
+	return nvgraph::nvgraphKTrussHost_impl(topology, edge_support, truss);
+}
+
+nvgraphStatus_t NVGRAPH_API nvgraphSpectralClusteringHost(const nvgraphCSRTopology32I_t topology,
+																			const cudaDataType_t weight_type,
+																			const void *edge_weights,
+																			const struct SpectralClusteringParameter *params,
+																			int* clustering,
+																			void* eig_vals,
+																			void* eig_vects)
+																			{
+	return nvgraph::nvgraphSpectralClusteringHost_impl(topology, weight_type, edge_weights, params, 0, clustering, eig_vals, eig_vects);
+}
+
+nvgraphStatus_t NVGRAPH_API nvgraphSpectralClusteringMiniBatchHost(const nvgraphCSRTopology32I_t topology,
+																						const cudaDataType_t weight_type,
+																						const void *edge_weights,
+																						const struct SpectralClusteringParameter *params,
+																						const int kmean_batch_size,
+																						int* clustering,
+																						void* eig_vals,
+																						void* eig_vects)
+																						{
+	return nvgraph::nvgraphSpectralClusteringHost_impl(topology, weight_type, edge_weights, params,
+																		kmean_batch_size == 0 ? KMEANS_HOST_BATCH : kmean_batch_size,
+																		clustering, eig_vals, eig_vects);
+}
+
 
 nvgraphStatus_t NVGRAPH_API nvgraphLouvain (cudaDataType_t index_type, cudaDataType_t val_type, const size_t num_vertex, const size_t num_edges, 
                             void* csr_ptr, void* csr_ind, void* csr_val, int weighted, int has_init_cluster, void* init_cluster, 
@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <math.h>
+#include <vector>
 
 #include <cuda.h>
 #include <thrust/device_vector.h>
@@ -32,7 +33,9 @@
 #include "nvgraph_cublas.hxx"
 #include "matrix.hxx"
 #include "lanczos.hxx"
+#include "subspace.hxx"
 #include "kmeans.hxx"
+#include "kmeans_host.hxx"
 #include "debug_macros.h"
 #include "lobpcg.hxx"
 #include "sm_utils.h"
@@ -68,6 +71,9 @@ namespace nvgraph {
   // Get index of matrix entry
 #define IDX(i,j,lda) ((i)+(j)*(lda))
 
+  // Threads per warp
+#define WARP_SIZE 32
+
 //    namespace {
 //      /// Get string associated with NVGRAPH error flag
 //      static
@@ -227,9 +233,16 @@ namespace nvgraph {
    *  @param maxIter_lanczos Maximum number of Lanczos iterations.
    *  @param restartIter_lanczos Maximum size of Lanczos system before
    *    implicit restart.
+   *  @param randomized_subspace Whether to compute approximate
+   *    eigenvectors with maxIter_lanczos steps of randomized subspace
+   *    iteration (computeSmallestEigenvectors_subspace) instead of the
+   *    Lanczos method. The work is fixed and restartIter_lanczos and
+   *    tol_lanczos are ignored.
    *  @param tol_lanczos Convergence tolerance for Lanczos method.
    *  @param maxIter_kmeans Maximum number of k-means iterations.
    *  @param tol_kmeans Convergence tolerance for k-means algorithm.
+   *  @param batchSize_kmeans Number of rows per mini-batch of
+   *    kmeans_minibatch_host, 0 for kmeans (full batch).
    *  @param parts (Output, device memory, n entries) Partition
    *    assignments.
    *  @param iters_lanczos On exit, number of Lanczos iterations
@@ -244,9 +257,11 @@ namespace nvgraph {
            IndexType_ nEigVecs,
            IndexType_ maxIter_lanczos,
            IndexType_ restartIter_lanczos,
+           bool randomized_subspace,
            ValueType_ tol_lanczos,
            IndexType_ maxIter_kmeans,
            ValueType_ tol_kmeans,
+           IndexType_ batchSize_kmeans,
            IndexType_ * __restrict__ parts,
            Vector<ValueType_> &eigVals,
            Vector<ValueType_> &eigVecs,
@@ -265,11 +280,18 @@ namespace nvgraph {
       WARNING("invalid parameter (nEigVecs<1)");
       return NVGRAPH_ERR_BAD_PARAMETERS;
     }
-    if(maxIter_lanczos < nEigVecs) {
+    if(randomized_subspace) {
+      // maxIter_lanczos is the number of subspace iterations
+      if(maxIter_lanczos < 0) {
+        WARNING("invalid parameter (maxIter_lanczos<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+    }
+    else if(maxIter_lanczos < nEigVecs) {
       WARNING("invalid parameter (maxIter_lanczos<nEigVecs)");
       return NVGRAPH_ERR_BAD_PARAMETERS;
     }
-    if(restartIter_lanczos < nEigVecs) {
+    if(!randomized_subspace && restartIter_lanczos < nEigVecs) {
       WARNING("invalid parameter (restartIter_lanczos<nEigVecs)");
       return NVGRAPH_ERR_BAD_PARAMETERS;
     }
@@ -285,6 +307,10 @@ namespace nvgraph {
       WARNING("invalid parameter (tol_kmeans<0)");
       return NVGRAPH_ERR_BAD_PARAMETERS;
     }
+    if(batchSize_kmeans < 0) {
+      WARNING("invalid parameter (batchSize_kmeans<0)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
 
     // -------------------------------------------------------
     // Variable declaration
@@ -329,10 +355,14 @@ namespace nvgraph {
     L = new LaplacianMatrix<IndexType_,ValueType_>(*A);
 
     // Compute smallest eigenvalues and eigenvectors
-    CHECK_NVGRAPH(computeSmallestEigenvectors(*L, nEigVecs, maxIter_lanczos,
-             restartIter_lanczos, tol_lanczos,
-             reorthogonalize_lanczos, iters_lanczos,
-             eigVals.raw(), eigVecs.raw()));   
+    if(randomized_subspace)
+      CHECK_NVGRAPH(computeSmallestEigenvectors_subspace(*L, nEigVecs, maxIter_lanczos,
+               iters_lanczos, eigVals.raw(), eigVecs.raw()));
+    else
+      CHECK_NVGRAPH(computeSmallestEigenvectors(*L, nEigVecs, maxIter_lanczos,
+               restartIter_lanczos, tol_lanczos,
+               reorthogonalize_lanczos, iters_lanczos,
+               eigVals.raw(), eigVecs.raw()));   
     //eigVals.dump(0, nEigVecs);
     //eigVecs.dump(0, nEigVecs);
     //eigVecs.dump(n, nEigVecs);
@@ -390,10 +420,27 @@ namespace nvgraph {
 
     //eigVecs.dump(0, nEigVecs*n);
     // Find partition with k-means clustering
-    CHECK_NVGRAPH(kmeans(n, nEigVecs, nParts, 
-          tol_kmeans, maxIter_kmeans,
-          eigVecs.raw(), parts,
-          residual_kmeans, iters_kmeans));
+    if(batchSize_kmeans > 0) {
+      // Mini-batches run on the host: the rows are drawn at random,
+      // the observations and the codes go through host memory
+      std::vector<ValueType_> obs_h(static_cast<size_t>(nEigVecs)*n);
+      std::vector<IndexType_> parts_h(n);
+      CHECK_CUDA(cudaMemcpy(&obs_h[0], eigVecs.raw(),
+         obs_h.size()*sizeof(ValueType_),
+         cudaMemcpyDeviceToHost));
+      CHECK_NVGRAPH(kmeans_minibatch_host(n, nEigVecs, nParts,
+            tol_kmeans, maxIter_kmeans, batchSize_kmeans,
+            &obs_h[0], &parts_h[0],
+            residual_kmeans, iters_kmeans));
+      CHECK_CUDA(cudaMemcpy(parts, &parts_h[0],
+         n*sizeof(IndexType_),
+         cudaMemcpyHostToDevice));
+    }
+    else
+      CHECK_NVGRAPH(kmeans(n, nEigVecs, nParts, 
+            tol_kmeans, maxIter_kmeans,
+            eigVecs.raw(), parts,
+            residual_kmeans, iters_kmeans));
     t2=timer();
     t_kmeans+=t2-t1;
 #ifdef COLLECT_TIME_STATISTICS
@@ -625,6 +672,79 @@ namespace nvgraph {
     = (thrust::get<0>(t) == i) ? (ValueType_) 1.0 : (ValueType_) 0.0;
       }
     };
+
+    /// Per-cluster sums of a clustering
+    /** One warp per row: the lanes add the weights of the row and of
+     *  its edges leaving the cluster of the row, then lane 0 adds them
+     *  to the sums of the cluster. With useShared, each block keeps
+     *  its own sums in shared memory and adds them to the global ones
+     *  at the end. Rows assigned to an invalid cluster set *invalid.
+     */
+    template <typename IndexType_, typename ValueType_> static __global__
+    void clusterSums(IndexType_ n,
+                     const IndexType_ * __restrict__ csrRowPtr,
+                     const IndexType_ * __restrict__ csrColInd,
+                     const ValueType_ * __restrict__ csrVal,
+                     IndexType_ nClusters,
+                     const IndexType_ * __restrict__ clusters,
+                     bool useShared,
+                     ValueType_ * __restrict__ volume,
+                     ValueType_ * __restrict__ cut,
+                     IndexType_ * __restrict__ size,
+                     int * __restrict__ invalid) {
+      extern __shared__ char clusterSums_smem[];
+      ValueType_ * s_volume = volume;
+      ValueType_ * s_cut = cut;
+      IndexType_ * s_size = size;
+      if(useShared) {
+        s_volume = (ValueType_ *) clusterSums_smem;
+        s_cut    = s_volume + nClusters;
+        s_size   = (IndexType_ *) (s_cut + nClusters);
+        for(IndexType_ c=threadIdx.x; c<nClusters; c+=blockDim.x) {
+          s_volume[c] = 0;
+          s_cut[c]    = 0;
+          s_size[c]   = 0;
+        }
+        __syncthreads();
+      }
+
+      IndexType_ lane = threadIdx.x % WARP_SIZE;
+      IndexType_ warp = (threadIdx.x + blockIdx.x*blockDim.x)/WARP_SIZE;
+      IndexType_ nWarps = (blockDim.x*gridDim.x)/WARP_SIZE;
+      for(IndexType_ i=warp; i<n; i+=nWarps) {
+        IndexType_ c = clusters[i];
+        if(c < 0 || c >= nClusters) {
+          if(lane == 0)
+            *invalid = 1;
+          continue;
+        }
+        ValueType_ d = 0, x = 0;
+        for(IndexType_ j=csrRowPtr[i]+lane; j<csrRowPtr[i+1]; j+=WARP_SIZE) {
+          ValueType_ w = (csrVal != NULL) ? csrVal[j] : 1;
+          d += w;
+          if(clusters[csrColInd[j]] != c)
+            x += w;
+        }
+        d = utils::warp_sum(d);
+        x = utils::warp_sum(x);
+        if(lane == 0) {
+          atomicAdd(s_volume+c, d);
+          atomicAdd(s_cut+c, x);
+          atomicAdd(s_size+c, (IndexType_) 1);
+        }
+      }
+
+      if(useShared) {
+        __syncthreads();
+        for(IndexType_ c=threadIdx.x; c<nClusters; c+=blockDim.x) {
+          if(s_size[c] > 0) {
+            atomicAdd(volume+c, s_volume[c]);
+            atomicAdd(cut+c, s_cut[c]);
+            atomicAdd(size+c, s_size[c]);
+          }
+        }
+      }
+    }
   }
 
   /// Compute cost function for partition
@@ -731,6 +851,136 @@ namespace nvgraph {
 
   }
 
+  /// Analyze a clustering in one pass over the graph
+  /** The rows are scanned once to get the size, volume (sum of the
+   *  degrees) and cut (weight of the edges leaving the cluster) of
+   *  every cluster. All the scores follow from these sums, with W the
+   *  sum of the volumes:
+   *    modularity    = \sum_c ((volume_c-cut_c)/W - (volume_c/W)^2)
+   *    edgeCut       = \sum_c cut_c/2
+   *    ratioCut      = \sum_c cut_c/size_c (cost of analyzePartition)
+   *    normalizedCut = \sum_c cut_c/volume_c
+   *    conductance_c = cut_c/min(volume_c, W-volume_c)
+   *  Empty clusters do not contribute. Graph is assumed to be
+   *  weighted and undirected.
+   *
+   *  @param G Weighted graph in CSR format.
+   *  @param nClusters Number of clusters.
+   *  @param clusters (Input, device memory, n entries) Cluster
+   *    assignments.
+   *  @param clusterSize (Output, host memory, nClusters entries)
+   *    Number of vertices of each cluster.
+   *  @param clusterVolume (Output, host memory, nClusters entries)
+   *    Sum of the degrees of each cluster.
+   *  @param clusterCut (Output, host memory, nClusters entries)
+   *    Weight of the edges leaving each cluster.
+   *  @param clusterConductance (Output, host memory, nClusters
+   *    entries) Conductance of each cluster.
+   *  @param modularity On exit, modularity (as analyzeModularity).
+   *  @param edgeCut On exit, weight of edges cut by clustering.
+   *  @param ratioCut On exit, ratio cut.
+   *  @param normalizedCut On exit, normalized cut.
+   *  @return NVGRAPH error flag.
+   */
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR analyzeClustering(ValuedCsrGraph<IndexType_,ValueType_> & G,
+                                  IndexType_ nClusters,
+                                  const IndexType_ * __restrict__ clusters,
+                                  IndexType_ * __restrict__ clusterSize,
+                                  ValueType_ * __restrict__ clusterVolume,
+                                  ValueType_ * __restrict__ clusterCut,
+                                  ValueType_ * __restrict__ clusterConductance,
+                                  ValueType_ & modularity,
+                                  ValueType_ & edgeCut,
+                                  ValueType_ & ratioCut,
+                                  ValueType_ & normalizedCut) {
+
+    // Threads per block
+    const IndexType_ blockSize = 256;
+    // Largest shared memory for the per-block cluster sums
+    const size_t maxShared = 16384;
+
+    IndexType_ n = G.get_num_vertices();
+    IndexType_ c;
+
+    // CUDA stream
+    //   TODO: handle non-zero streams
+    cudaStream_t stream = 0;
+
+    // Check that parameters are valid
+    if(nClusters < 1) {
+      WARNING("invalid parameter (nClusters<1)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+
+    // Per-cluster sums
+    Vector<ValueType_> volume(nClusters, stream);
+    Vector<ValueType_> cut(nClusters, stream);
+    Vector<IndexType_> size(nClusters, stream);
+    Vector<int> invalid(1, stream);
+    volume.fill(0, stream);
+    cut.fill(0, stream);
+    size.fill(0, stream);
+    invalid.fill(0, stream);
+
+    // Few clusters: per-block sums in shared memory and fewer blocks,
+    // each warp taking several rows
+    size_t sharedBytes = nClusters*(2*sizeof(ValueType_)+sizeof(IndexType_));
+    bool useShared = sharedBytes <= maxShared;
+    IndexType_ nBlocks = (n+blockSize/WARP_SIZE-1)/(blockSize/WARP_SIZE);
+    nBlocks = min(nBlocks, useShared ? 1024 : 65535);
+    nBlocks = max(nBlocks, 1);
+    clusterSums<IndexType_,ValueType_>
+      <<< nBlocks, blockSize, useShared ? sharedBytes : 0, stream >>>
+      (n, G.get_raw_row_offsets(), G.get_raw_column_indices(),
+       G.get_raw_values(), nClusters, clusters, useShared,
+       volume.raw(), cut.raw(), size.raw(), invalid.raw());
+    cudaCheckError();
+
+    int invalid_h;
+    CHECK_CUDA(cudaMemcpy(&invalid_h, invalid.raw(), sizeof(int),
+                          cudaMemcpyDeviceToHost));
+    if(invalid_h) {
+      WARNING("invalid cluster assignment");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    CHECK_CUDA(cudaMemcpy(clusterVolume, volume.raw(),
+                          nClusters*sizeof(ValueType_),
+                          cudaMemcpyDeviceToHost));
+    CHECK_CUDA(cudaMemcpy(clusterCut, cut.raw(),
+                          nClusters*sizeof(ValueType_),
+                          cudaMemcpyDeviceToHost));
+    CHECK_CUDA(cudaMemcpy(clusterSize, size.raw(),
+                          nClusters*sizeof(IndexType_),
+                          cudaMemcpyDeviceToHost));
+
+    // Scores
+    ValueType_ W = 0;
+    for(c=0; c<nClusters; ++c)
+      W += clusterVolume[c];
+    modularity    = 0;
+    edgeCut       = 0;
+    ratioCut      = 0;
+    normalizedCut = 0;
+    for(c=0; c<nClusters; ++c) {
+      clusterConductance[c] = 0;
+      if(clusterSize[c] == 0)
+        continue;
+      if(W > 0)
+        modularity += (clusterVolume[c]-clusterCut[c])/W
+          - (clusterVolume[c]/W)*(clusterVolume[c]/W);
+      edgeCut  += clusterCut[c]/2;
+      ratioCut += clusterCut[c]/clusterSize[c];
+      if(clusterVolume[c] > 0)
+        normalizedCut += clusterCut[c]/clusterVolume[c];
+      ValueType_ denom = (2*clusterVolume[c] < W) ? clusterVolume[c] : W-clusterVolume[c];
+      if(denom > 0)
+        clusterConductance[c] = clusterCut[c]/denom;
+    }
+    return NVGRAPH_OK;
+
+  }
+
   // =========================================================
   // Explicit instantiation
   // =========================================================
@@ -740,9 +990,11 @@ namespace nvgraph {
           int nEigVecs,
           int maxIter_lanczos,
           int restartIter_lanczos,
+          bool randomized_subspace,
           float tol_lanczos,
           int maxIter_kmeans,
           float tol_kmeans,
+          int batchSize_kmeans,
           int * __restrict__ parts,
           Vector<float> &eigVals,
           Vector<float> &eigVecs,
@@ -754,9 +1006,11 @@ namespace nvgraph {
            int nEigVecs,
            int maxIter_lanczos,
            int restartIter_lanczos,
+           bool randomized_subspace,
            double tol_lanczos,
            int maxIter_kmeans,
            double tol_kmeans,
+           int batchSize_kmeans,
            int * __restrict__ parts,
            Vector<double> &eigVals,
            Vector<double> &eigVecs,
@@ -806,6 +1060,26 @@ namespace nvgraph {
             int nParts,
             const int * __restrict__ parts,
             double & edgeCut, double & cost);
+  template
+  NVGRAPH_ERROR analyzeClustering<int,float>(ValuedCsrGraph<int,float> & G,
+            int nClusters,
+            const int * __restrict__ clusters,
+            int * __restrict__ clusterSize,
+            float * __restrict__ clusterVolume,
+            float * __restrict__ clusterCut,
+            float * __restrict__ clusterConductance,
+            float & modularity, float & edgeCut,
+            float & ratioCut, float & normalizedCut);
+  template
+  NVGRAPH_ERROR analyzeClustering<int,double>(ValuedCsrGraph<int,double> & G,
+            int nClusters,
+            const int * __restrict__ clusters,
+            int * __restrict__ clusterSize,
+            double * __restrict__ clusterVolume,
+            double * __restrict__ clusterCut,
+            double * __restrict__ clusterConductance,
+            double & modularity, double & edgeCut,
+            double & ratioCut, double & normalizedCut);
 
 }
 //#endif //NVGRAPH_PARTITION
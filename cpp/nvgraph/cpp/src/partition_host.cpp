@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "partition_host.hxx"
+
+#include <math.h>
+#include <vector>
+
+#include "matrix_host.hxx"
+#include "lanczos_host.hxx"
+#include "kmeans_host.hxx"
+#include "debug_macros.h"
+
+// Get index of matrix entry
+#define IDX(i,j,lda) ((i)+(j)*(lda))
+
+namespace nvgraph {
+
+  namespace {
+
+    /// Check parameters shared by the host spectral clusterings
+    template <typename IndexType_, typename ValueType_> static
+    NVGRAPH_ERROR checkParameters(IndexType_ nParts,
+                                  IndexType_ nEigVecs,
+                                  IndexType_ maxIter_lanczos,
+                                  IndexType_ restartIter_lanczos,
+                                  IndexType_ blockSize_lanczos,
+                                  bool randomized_subspace,
+                                  ValueType_ tol_lanczos,
+                                  IndexType_ maxIter_kmeans,
+                                  ValueType_ tol_kmeans,
+                                  IndexType_ batchSize_kmeans) {
+      if(nParts < 1) {
+        WARNING("invalid parameter (nParts<1)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs < 1) {
+        WARNING("invalid parameter (nEigVecs<1)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(randomized_subspace) {
+        // maxIter_lanczos is the number of subspace iterations
+        if(maxIter_lanczos < 0) {
+          WARNING("invalid parameter (maxIter_lanczos<0)");
+          return NVGRAPH_ERR_BAD_PARAMETERS;
+        }
+      }
+      else if(maxIter_lanczos < nEigVecs) {
+        WARNING("invalid parameter (maxIter_lanczos<nEigVecs)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(!randomized_subspace && restartIter_lanczos < nEigVecs) {
+        WARNING("invalid parameter (restartIter_lanczos<nEigVecs)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(blockSize_lanczos < 1) {
+        WARNING("invalid parameter (blockSize_lanczos<1)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(tol_lanczos < 0) {
+        WARNING("invalid parameter (tol_lanczos<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(maxIter_kmeans < 0) {
+        WARNING("invalid parameter (maxIter_kmeans<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(tol_kmeans < 0) {
+        WARNING("invalid parameter (tol_kmeans<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(batchSize_kmeans < 0) {
+        WARNING("invalid parameter (batchSize_kmeans<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      return NVGRAPH_OK;
+    }
+
+    /// Whiten eigenvectors and cluster them with k-means
+    /** Each eigenvector is shifted to zero mean and scaled to unit
+     *  standard deviation in place, then the rows are clustered,
+     *  with mini-batches of batchSize_kmeans rows if it is not 0.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    NVGRAPH_ERROR clusterEigenvectors(IndexType_ n,
+                                      IndexType_ nEigVecs,
+                                      IndexType_ nParts,
+                                      IndexType_ maxIter_kmeans,
+                                      ValueType_ tol_kmeans,
+                                      IndexType_ batchSize_kmeans,
+                                      ValueType_ * __restrict__ eigVecs,
+                                      IndexType_ * __restrict__ parts,
+                                      IndexType_ & iters_kmeans) {
+
+      // Whiten eigenvector matrix
+      for(IndexType_ i=0; i<nEigVecs; ++i) {
+        ValueType_ * v = eigVecs+IDX(0,i,n);
+        ValueType_ mean = 0;
+        #pragma omp parallel for schedule(static) reduction(+:mean)
+        for(IndexType_ j=0; j<n; ++j)
+          mean += v[j];
+        mean /= n;
+        ValueType_ var = 0;
+        #pragma omp parallel for schedule(static) reduction(+:var)
+        for(IndexType_ j=0; j<n; ++j)
+          var += (v[j]-mean)*(v[j]-mean);
+        ValueType_ stddev = sqrt(var/n);
+        if(stddev == 0)
+          stddev = 1;
+        #pragma omp parallel for schedule(static)
+        for(IndexType_ j=0; j<n; ++j)
+          v[j] = (v[j]-mean)/stddev;
+      }
+
+      // Transpose eigenvector matrix, k-means observations are
+      // columns
+      std::vector<ValueType_> obs(static_cast<size_t>(n)*nEigVecs);
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ j=0; j<n; ++j)
+        for(IndexType_ i=0; i<nEigVecs; ++i)
+          obs[IDX(i,j,nEigVecs)] = eigVecs[IDX(j,i,n)];
+
+      // Find partition with k-means clustering
+      ValueType_ residual_kmeans;
+      if(batchSize_kmeans > 0)
+        return kmeans_minibatch_host(n, nEigVecs, nParts,
+                                     tol_kmeans, maxIter_kmeans, batchSize_kmeans,
+                                     &obs[0], parts,
+                                     residual_kmeans, iters_kmeans);
+      return kmeans_host(n, nEigVecs, nParts,
+                         tol_kmeans, maxIter_kmeans,
+                         &obs[0], parts,
+                         residual_kmeans, iters_kmeans);
+    }
+
+  }
+
+  // =========================================================
+  // Spectral partitioner
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR partition_host(IndexType_ n, IndexType_ nnz,
+                               const IndexType_ * csrRowPtr,
+                               const IndexType_ * csrColInd,
+                               const ValueType_ * csrVal,
+                               IndexType_ nParts,
+                               IndexType_ nEigVecs,
+                               IndexType_ maxIter_lanczos,
+                               IndexType_ restartIter_lanczos,
+                               IndexType_ blockSize_lanczos,
+                               bool randomized_subspace,
+                               ValueType_ tol_lanczos,
+                               IndexType_ maxIter_kmeans,
+                               ValueType_ tol_kmeans,
+                               IndexType_ batchSize_kmeans,
+                               IndexType_ * __restrict__ parts,
+                               ValueType_ * __restrict__ eigVals,
+                               ValueType_ * __restrict__ eigVecs,
+                               IndexType_ & iters_lanczos,
+                               IndexType_ & iters_kmeans) {
+
+    NVGRAPH_ERROR status = checkParameters(nParts, nEigVecs,
+                                           maxIter_lanczos, restartIter_lanczos, blockSize_lanczos,
+                                           randomized_subspace,
+                                           tol_lanczos,
+                                           maxIter_kmeans, tol_kmeans, batchSize_kmeans);
+    if(status != NVGRAPH_OK)
+      return status;
+
+    // Whether to perform full reorthogonalization in Lanczos
+    bool reorthogonalize_lanczos = false;
+
+    // Compute smallest eigenvalues and eigenvectors of Laplacian
+    CsrMatrixHost<IndexType_,ValueType_> A(n, n, nnz, csrVal, csrRowPtr, csrColInd);
+    LaplacianMatrixHost<IndexType_,ValueType_> L(A);
+    if(randomized_subspace)
+      status = computeSmallestEigenvectors_subspace_host(L, nEigVecs, maxIter_lanczos,
+                                                         iters_lanczos, eigVals, eigVecs);
+    else if(blockSize_lanczos > 1)
+      status = computeSmallestEigenvectors_block_host(L, nEigVecs, blockSize_lanczos,
+                                                      maxIter_lanczos, restartIter_lanczos,
+                                                      tol_lanczos, iters_lanczos,
+                                                      eigVals, eigVecs);
+    else
+      status = computeSmallestEigenvectors_host(L, nEigVecs, maxIter_lanczos,
+                                                restartIter_lanczos, tol_lanczos,
+                                                reorthogonalize_lanczos, iters_lanczos,
+                                                eigVals, eigVecs);
+    if(status != NVGRAPH_OK)
+      return status;
+
+    return clusterEigenvectors(n, nEigVecs, nParts, maxIter_kmeans, tol_kmeans, batchSize_kmeans,
+                               eigVecs, parts, iters_kmeans);
+  }
+
+  // =========================================================
+  // Spectral partitioner with LOBPCG
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR partition_lobpcg_host(IndexType_ n, IndexType_ nnz,
+                                      const IndexType_ * csrRowPtr,
+                                      const IndexType_ * csrColInd,
+                                      const ValueType_ * csrVal,
+                                      Matrix<IndexType_,ValueType_> * M,
+                                      IndexType_ nParts,
+                                      IndexType_ nEigVecs,
+                                      IndexType_ maxIter_lanczos,
+                                      ValueType_ tol_lanczos,
+                                      IndexType_ maxIter_kmeans,
+                                      ValueType_ tol_kmeans,
+                                      IndexType_ batchSize_kmeans,
+                                      IndexType_ * __restrict__ parts,
+                                      ValueType_ * __restrict__ eigVals,
+                                      ValueType_ * __restrict__ eigVecs,
+                                      IndexType_ & iters_lanczos,
+                                      IndexType_ & iters_kmeans) {
+
+    NVGRAPH_ERROR status = checkParameters(nParts, nEigVecs,
+                                           maxIter_lanczos, nEigVecs, (IndexType_) 1,
+                                           false,
+                                           tol_lanczos,
+                                           maxIter_kmeans, tol_kmeans, batchSize_kmeans);
+    if(status != NVGRAPH_OK)
+      return status;
+
+    // Compute smallest eigenvalues and eigenvectors of Laplacian,
+    // preconditioned with M
+    CsrMatrixHost<IndexType_,ValueType_> A(n, n, nnz, csrVal, csrRowPtr, csrColInd);
+    LaplacianMatrixHost<IndexType_,ValueType_> L(A);
+    L.prec_setup(M);
+    status = computeSmallestEigenvectors_lobpcg_host(L, nEigVecs, maxIter_lanczos,
+                                                     tol_lanczos, iters_lanczos,
+                                                     eigVals, eigVecs);
+    if(status != NVGRAPH_OK)
+      return status;
+
+    return clusterEigenvectors(n, nEigVecs, nParts, maxIter_kmeans, tol_kmeans, batchSize_kmeans,
+                               eigVecs, parts, iters_kmeans);
+  }
+
+  // =========================================================
+  // Spectral modularity maximization
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR modularity_maximization_host(IndexType_ n, IndexType_ nnz,
+                                             const IndexType_ * csrRowPtr,
+                                             const IndexType_ * csrColInd,
+                                             const ValueType_ * csrVal,
+                                             IndexType_ nClusters,
+                                             IndexType_ nEigVecs,
+                                             IndexType_ maxIter_lanczos,
+                                             IndexType_ restartIter_lanczos,
+                                             IndexType_ blockSize_lanczos,
+                                             bool randomized_subspace,
+                                             ValueType_ tol_lanczos,
+                                             IndexType_ maxIter_kmeans,
+                                             ValueType_ tol_kmeans,
+                                             IndexType_ batchSize_kmeans,
+                                             IndexType_ * __restrict__ clusters,
+                                             ValueType_ * __restrict__ eigVals,
+                                             ValueType_ * __restrict__ eigVecs,
+                                             IndexType_ & iters_lanczos,
+                                             IndexType_ & iters_kmeans) {
+
+    NVGRAPH_ERROR status = checkParameters(nClusters, nEigVecs,
+                                           maxIter_lanczos, restartIter_lanczos, blockSize_lanczos,
+                                           randomized_subspace,
+                                           tol_lanczos,
+                                           maxIter_kmeans, tol_kmeans, batchSize_kmeans);
+    if(status != NVGRAPH_OK)
+      return status;
+
+    // Whether to perform full reorthogonalization in Lanczos
+    bool reorthogonalize_lanczos = false;
+
+    // Compute largest eigenvalues and eigenvectors of modularity
+    // matrix
+    CsrMatrixHost<IndexType_,ValueType_> A(n, n, nnz, csrVal, csrRowPtr, csrColInd);
+    ModularityMatrixHost<IndexType_,ValueType_> B(A, nnz);
+    if(randomized_subspace)
+      status = computeLargestEigenvectors_subspace_host(B, nEigVecs, maxIter_lanczos,
+                                                        iters_lanczos, eigVals, eigVecs);
+    else if(blockSize_lanczos > 1)
+      status = computeLargestEigenvectors_block_host(B, nEigVecs, blockSize_lanczos,
+                                                     maxIter_lanczos, restartIter_lanczos,
+                                                     tol_lanczos, iters_lanczos,
+                                                     eigVals, eigVecs);
+    else
+      status = computeLargestEigenvectors_host(B, nEigVecs, maxIter_lanczos,
+                                               restartIter_lanczos, tol_lanczos,
+                                               reorthogonalize_lanczos, iters_lanczos,
+                                               eigVals, eigVecs);
+    if(status != NVGRAPH_OK)
+      return status;
+
+    return clusterEigenvectors(n, nEigVecs, nClusters, maxIter_kmeans, tol_kmeans, batchSize_kmeans,
+                               eigVecs, clusters, iters_kmeans);
+  }
+
+  // =========================================================
+  // Partition analysis
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR analyzePartition_host(IndexType_ n, IndexType_ nnz,
+                                      const IndexType_ * csrRowPtr,
+                                      const IndexType_ * csrColInd,
+                                      const ValueType_ * csrVal,
+                                      IndexType_ nParts,
+                                      const IndexType_ * __restrict__ parts,
+                                      ValueType_ & edgeCut,
+                                      ValueType_ & cost,
+                                      ValueType_ & imbalance) {
+    if(nParts < 1) {
+      WARNING("invalid parameter (nParts<1)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+
+    // Weight of the edges leaving each vertex's partition
+    std::vector<ValueType_> vertexCut(n);
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for(IndexType_ v=0; v<n; ++v) {
+      ValueType_ cut = 0;
+      for(IndexType_ j=csrRowPtr[v]; j<csrRowPtr[v+1]; ++j)
+        if(parts[csrColInd[j]] != parts[v])
+          cut += (csrVal != NULL) ? csrVal[j] : 1;
+      vertexCut[v] = cut;
+    }
+
+    // Accumulate by partition
+    std::vector<ValueType_> partEdgesCut(nParts, 0);
+    std::vector<IndexType_> partSize(nParts, 0);
+    for(IndexType_ v=0; v<n; ++v) {
+      if(parts[v] < 0 || parts[v] >= nParts) {
+        WARNING("invalid partition assignment");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      partEdgesCut[parts[v]] += vertexCut[v];
+      ++partSize[parts[v]];
+    }
+    cost = 0;
+    edgeCut = 0;
+    IndexType_ maxSize = 0;
+    for(IndexType_ i=0; i<nParts; ++i) {
+      maxSize = (partSize[i] > maxSize) ? partSize[i] : maxSize;
+      if(partSize[i] == 0) {
+        WARNING("empty partition");
+        continue;
+      }
+      cost    += partEdgesCut[i]/partSize[i];
+      edgeCut += partEdgesCut[i]/2;
+    }
+    imbalance = (n > 0) ? static_cast<ValueType_>(maxSize)*nParts/n : 1;
+    return NVGRAPH_OK;
+  }
+
+  // =========================================================
+  // Explicit instantiation
+  // =========================================================
+
+  template
+  NVGRAPH_ERROR partition_host<int,float>(int n, int nnz,
+                                          const int * csrRowPtr, const int * csrColInd,
+                                          const float * csrVal,
+                                          int nParts, int nEigVecs,
+                                          int maxIter_lanczos, int restartIter_lanczos, int blockSize_lanczos,
+                                          bool randomized_subspace,
+                                          float tol_lanczos,
+                                          int maxIter_kmeans, float tol_kmeans, int batchSize_kmeans,
+                                          int * __restrict__ parts,
+                                          float * __restrict__ eigVals,
+                                          float * __restrict__ eigVecs,
+                                          int & iters_lanczos, int & iters_kmeans);
+  template
+  NVGRAPH_ERROR partition_host<int,double>(int n, int nnz,
+                                           const int * csrRowPtr, const int * csrColInd,
+                                           const double * csrVal,
+                                           int nParts, int nEigVecs,
+                                           int maxIter_lanczos, int restartIter_lanczos, int blockSize_lanczos,
+                                           bool randomized_subspace,
+                                           double tol_lanczos,
+                                           int maxIter_kmeans, double tol_kmeans, int batchSize_kmeans,
+                                           int * __restrict__ parts,
+                                           double * __restrict__ eigVals,
+                                           double * __restrict__ eigVecs,
+                                           int & iters_lanczos, int & iters_kmeans);
+  template
+  NVGRAPH_ERROR partition_lobpcg_host<int,float>(int n, int nnz,
+                                                 const int * csrRowPtr, const int * csrColInd,
+                                                 const float * csrVal,
+                                                 Matrix<int,float> * M,
+                                                 int nParts, int nEigVecs,
+                                                 int maxIter_lanczos, float tol_lanczos,
+                                                 int maxIter_kmeans, float tol_kmeans, int batchSize_kmeans,
+                                                 int * __restrict__ parts,
+                                                 float * __restrict__ eigVals,
+                                                 float * __restrict__ eigVecs,
+                                                 int & iters_lanczos, int & iters_kmeans);
+  template
+  NVGRAPH_ERROR partition_lobpcg_host<int,double>(int n, int nnz,
+                                                  const int * csrRowPtr, const int * csrColInd,
+                                                  const double * csrVal,
+                                                  Matrix<int,double> * M,
+                                                  int nParts, int nEigVecs,
+                                                  int maxIter_lanczos, double tol_lanczos,
+                                                  int maxIter_kmeans, double tol_kmeans, int batchSize_kmeans,
+                                                  int * __restrict__ parts,
+                                                  double * __restrict__ eigVals,
+                                                  double * __restrict__ eigVecs,
+                                                  int & iters_lanczos, int & iters_kmeans);
+  template
+  NVGRAPH_ERROR modularity_maximization_host<int,float>(int n, int nnz,
+                                                        const int * csrRowPtr, const int * csrColInd,
+                                                        const float * csrVal,
+                                                        int nClusters, int nEigVecs,
+                                                        int maxIter_lanczos, int restartIter_lanczos, int blockSize_lanczos,
+                                                        bool randomized_subspace,
+                                                        float tol_lanczos,
+                                                        int maxIter_kmeans, float tol_kmeans, int batchSize_kmeans,
+                                                        int * __restrict__ clusters,
+                                                        float * __restrict__ eigVals,
+                                                        float * __restrict__ eigVecs,
+                                                        int & iters_lanczos, int & iters_kmeans);
+  template
+  NVGRAPH_ERROR modularity_maximization_host<int,double>(int n, int nnz,
+                                                         const int * csrRowPtr, const int * csrColInd,
+                                                         const double * csrVal,
+                                                         int nClusters, int nEigVecs,
+                                                         int maxIter_lanczos, int restartIter_lanczos, int blockSize_lanczos,
+                                                         bool randomized_subspace,
+                                                         double tol_lanczos,
+                                                         int maxIter_kmeans, double tol_kmeans, int batchSize_kmeans,
+                                                         int * __restrict__ clusters,
+                                                         double * __restrict__ eigVals,
+                                                         double * __restrict__ eigVecs,
+                                                         int & iters_lanczos, int & iters_kmeans);
+  template
+  NVGRAPH_ERROR analyzePartition_host<int,float>(int n, int nnz,
+                                                 const int * csrRowPtr,
+                                                 const int * csrColInd,
+                                                 const float * csrVal,
+                                                 int nParts,
+                                                 const int * __restrict__ parts,
+                                                 float & edgeCut, float & cost,
+                                                 float & imbalance);
+  template
+  NVGRAPH_ERROR analyzePartition_host<int,double>(int n, int nnz,
+                                                  const int * csrRowPtr,
+                                                  const int * csrColInd,
+                                                  const double * csrVal,
+                                                  int nParts,
+                                                  const int * __restrict__ parts,
+                                                  double & edgeCut, double & cost,
+                                                  double & imbalance);
+
+}
@@ -0,0 +1,582 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "partition_multilevel_host.hxx"
+
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#include "partition_host.hxx"
+#include "graph_coarsening_host.hxx"
+#include "matrix_host.hxx"
+#include "lanczos_host.hxx"
+#include "debug_macros.h"
+
+// Get index of matrix entry
+#define IDX(i,j,lda) ((i)+(j)*(lda))
+
+// Coarsening stops when a level removes less than 5% of the vertices
+#define MULTILEVEL_MIN_REDUCTION 0.95
+#define MULTILEVEL_MAX_LEVELS 40
+
+namespace nvgraph {
+
+  namespace {
+
+    /// Candidate move of a vertex to another partition
+    template <typename IndexType_, typename ValueType_>
+    struct Move {
+      ValueType_ gain;
+      IndexType_ v;
+      IndexType_ to;
+      bool operator<(const Move & m) const {
+        return (gain != m.gain) ? gain > m.gain : v < m.v;
+      }
+    };
+
+    /// Order of vertices by Fiedler vector entry
+    template <typename IndexType_, typename ValueType_>
+    struct FiedlerOrder {
+      const ValueType_ * f;
+      FiedlerOrder(const ValueType_ * _f) : f(_f) {}
+      bool operator()(IndexType_ i, IndexType_ j) const {
+        return (f[i] != f[j]) ? f[i] < f[j] : i < j;
+      }
+    };
+
+    /// Weight of the edges from a vertex to each partition
+    /** conn must be zero on entry for every partition, touched lists
+     *  the partitions set on exit.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    void connectivity(const GraphLevelHost<IndexType_,ValueType_> & G,
+                      const IndexType_ * parts, IndexType_ v,
+                      std::vector<ValueType_> & conn,
+                      std::vector<IndexType_> & touched) {
+      touched.clear();
+      for(IndexType_ j=G.rowPtr[v]; j<G.rowPtr[v+1]; ++j) {
+        IndexType_ u = G.colInd[j];
+        if(u == v)
+          continue;
+        IndexType_ p = parts[u];
+        if(conn[p] == 0)
+          touched.push_back(p);
+        conn[p] += G.edge(j);
+      }
+    }
+
+    /// Outcome of commitMove
+    enum { MOVE_DONE, MOVE_BLOCKED, MOVE_NO_GAIN };
+
+    /// Move a vertex if the target part has room and the gain is
+    /// still positive
+    template <typename IndexType_, typename ValueType_> static
+    int commitMove(const GraphLevelHost<IndexType_,ValueType_> & G,
+                   const Move<IndexType_,ValueType_> & m,
+                   IndexType_ maxWeight,
+                   IndexType_ * parts, IndexType_ * partWeight,
+                   std::vector<ValueType_> & conn,
+                   std::vector<IndexType_> & touched) {
+      IndexType_ own = parts[m.v];
+      IndexType_ w = G.weight(m.v);
+      if(partWeight[m.to]+w > maxWeight)
+        return MOVE_BLOCKED;
+      connectivity(G, parts, m.v, conn, touched);
+      ValueType_ gain = conn[m.to]-conn[own];
+      for(size_t t=0; t<touched.size(); ++t)
+        conn[touched[t]] = 0;
+      if(gain <= 0)
+        return MOVE_NO_GAIN;
+      parts[m.v] = m.to;
+      partWeight[own] -= w;
+      partWeight[m.to] += w;
+      return MOVE_DONE;
+    }
+
+    /// Refine a partition of one level
+    /** Overweight parts are first emptied into the best adjacent part
+     *  that fits (or the lightest part). Then each pass computes in
+     *  parallel the best positive-gain move of every vertex and commits
+     *  them sequentially in decreasing order of gain, checking again
+     *  the gain and the weight limit against the moves already made
+     *  (see commitMove).
+     */
+    template <typename IndexType_, typename ValueType_> static
+    void refinePartition(const GraphLevelHost<IndexType_,ValueType_> & G,
+                         IndexType_ nParts, IndexType_ maxWeight,
+                         IndexType_ maxIter,
+                         IndexType_ * parts) {
+      typedef Move<IndexType_,ValueType_> MoveType;
+      IndexType_ n = G.n;
+      std::vector<IndexType_> partWeight(nParts, 0);
+      for(IndexType_ v=0; v<n; ++v)
+        partWeight[parts[v]] += G.weight(v);
+      std::vector<ValueType_> conn(nParts, 0);
+      std::vector<IndexType_> touched;
+      std::vector<MoveType> moves;
+      std::vector<std::vector<size_t> > pending(nParts);
+      std::vector<size_t> pendingHead(nParts);
+      std::vector<IndexType_> freed;
+
+      // -------------------------------------------------------
+      // Rebalance
+      // -------------------------------------------------------
+      for(IndexType_ pass=0; pass<nParts; ++pass) {
+        bool balanced = true;
+        IndexType_ lightest = 0;
+        for(IndexType_ p=0; p<nParts; ++p) {
+          balanced = balanced && partWeight[p] <= maxWeight;
+          if(partWeight[p] < partWeight[lightest])
+            lightest = p;
+        }
+        if(balanced)
+          break;
+
+        moves.clear();
+        #pragma omp parallel
+        {
+          std::vector<ValueType_> conn_t(nParts, 0);
+          std::vector<IndexType_> touched_t;
+          std::vector<MoveType> moves_t;
+          #pragma omp for schedule(dynamic, 1024)
+          for(IndexType_ v=0; v<n; ++v) {
+            IndexType_ own = parts[v];
+            if(partWeight[own] <= maxWeight)
+              continue;
+            connectivity(G, parts, v, conn_t, touched_t);
+            MoveType m = {-conn_t[own], v, lightest};
+            bool found = false;
+            for(size_t t=0; t<touched_t.size(); ++t) {
+              IndexType_ p = touched_t[t];
+              if(p != own && partWeight[p]+G.weight(v) <= maxWeight
+                 && (!found || conn_t[p]-conn_t[own] > m.gain)) {
+                m.gain = conn_t[p]-conn_t[own];
+                m.to = p;
+                found = true;
+              }
+            }
+            for(size_t t=0; t<touched_t.size(); ++t)
+              conn_t[touched_t[t]] = 0;
+            if(m.to != own)
+              moves_t.push_back(m);
+          }
+          #pragma omp critical
+          moves.insert(moves.end(), moves_t.begin(), moves_t.end());
+        }
+        std::sort(moves.begin(), moves.end());
+        for(size_t i=0; i<moves.size(); ++i) {
+          IndexType_ v = moves[i].v;
+          IndexType_ own = parts[v];
+          IndexType_ to = moves[i].to;
+          IndexType_ w = G.weight(v);
+          if(partWeight[own] <= maxWeight || partWeight[to]+w > maxWeight)
+            continue;
+          parts[v] = to;
+          partWeight[own] -= w;
+          partWeight[to] += w;
+        }
+      }
+
+      // -------------------------------------------------------
+      // Size-constrained label propagation
+      // -------------------------------------------------------
+      for(IndexType_ it=0; it<maxIter; ++it) {
+        moves.clear();
+        #pragma omp parallel
+        {
+          std::vector<ValueType_> conn_t(nParts, 0);
+          std::vector<IndexType_> touched_t;
+          std::vector<MoveType> moves_t;
+          #pragma omp for schedule(dynamic, 1024)
+          for(IndexType_ v=0; v<n; ++v) {
+            IndexType_ own = parts[v];
+            connectivity(G, parts, v, conn_t, touched_t);
+            MoveType m = {0, v, own};
+            for(size_t t=0; t<touched_t.size(); ++t) {
+              IndexType_ p = touched_t[t];
+              ValueType_ gain = conn_t[p]-conn_t[own];
+              if(p != own && gain > m.gain
+                 && partWeight[p]+G.weight(v) <= maxWeight) {
+                m.gain = gain;
+                m.to = p;
+              }
+            }
+            for(size_t t=0; t<touched_t.size(); ++t)
+              conn_t[touched_t[t]] = 0;
+            if(m.to != own)
+              moves_t.push_back(m);
+          }
+          #pragma omp critical
+          moves.insert(moves.end(), moves_t.begin(), moves_t.end());
+        }
+        if(moves.empty())
+          break;
+
+        // Commit moves whose gain is still positive. A move into a
+        // full part waits until a vertex leaves that part, so that
+        // vertices can be exchanged between parts at the size limit
+        std::sort(moves.begin(), moves.end());
+        IndexType_ nMoves = 0;
+        for(IndexType_ p=0; p<nParts; ++p) {
+          pending[p].clear();
+          pendingHead[p] = 0;
+        }
+        for(size_t i=0; i<moves.size(); ++i) {
+          IndexType_ from = parts[moves[i].v];
+          int status = commitMove(G, moves[i], maxWeight, parts, &partWeight[0], conn, touched);
+          if(status == MOVE_BLOCKED)
+            pending[moves[i].to].push_back(i);
+          if(status != MOVE_DONE)
+            continue;
+          ++nMoves;
+          freed.push_back(from);
+          while(!freed.empty()) {
+            IndexType_ p = freed.back();
+            freed.pop_back();
+            while(pendingHead[p] < pending[p].size()) {
+              const MoveType & m = moves[pending[p][pendingHead[p]]];
+              IndexType_ mFrom = parts[m.v];
+              status = commitMove(G, m, maxWeight, parts, &partWeight[0], conn, touched);
+              if(status == MOVE_BLOCKED)
+                break;
+              ++pendingHead[p];
+              if(status == MOVE_DONE) {
+                ++nMoves;
+                freed.push_back(mFrom);
+              }
+            }
+          }
+        }
+        if(nMoves == 0)
+          break;
+      }
+    }
+
+
+    /// Recursive spectral bisection
+    /** Splits a set of vertices of the coarsest graph at the weighted
+     *  quantile of the Fiedler vector of its induced subgraph (the
+     *  median for an even number of parts), then splits each side
+     *  again until there is one set per partition.
+     *
+     *  @param verts Vertices to split.
+     *  @param fiedler Fiedler vector of verts, computed if NULL.
+     *  @param firstPart Label of the first partition of verts.
+     */
+    template <typename IndexType_, typename ValueType_> static
+    NVGRAPH_ERROR recursiveBisection(const GraphLevelHost<IndexType_,ValueType_> & C,
+                                     const std::vector<IndexType_> & verts,
+                                     const ValueType_ * fiedler,
+                                     IndexType_ nParts, IndexType_ firstPart,
+                                     IndexType_ maxIter_lanczos,
+                                     IndexType_ restartIter_lanczos,
+                                     ValueType_ tol_lanczos,
+                                     IndexType_ * parts) {
+      IndexType_ m = verts.size();
+      if(nParts == 1) {
+        for(IndexType_ i=0; i<m; ++i)
+          parts[verts[i]] = firstPart;
+        return NVGRAPH_OK;
+      }
+
+      // Fiedler vector of the induced subgraph (vertex order if the
+      // subgraph has no edges)
+      std::vector<ValueType_> f(m);
+      if(fiedler != NULL) {
+        std::copy(fiedler, fiedler+m, f.begin());
+      }
+      else {
+        std::vector<IndexType_> local(C.n, -1);
+        for(IndexType_ i=0; i<m; ++i)
+          local[verts[i]] = i;
+        std::vector<IndexType_> rowPtr(1, 0), colInd;
+        std::vector<ValueType_> val;
+        for(IndexType_ i=0; i<m; ++i) {
+          IndexType_ v = verts[i];
+          for(IndexType_ j=C.rowPtr[v]; j<C.rowPtr[v+1]; ++j) {
+            IndexType_ u = local[C.colInd[j]];
+            if(u >= 0 && u != i) {
+              colInd.push_back(u);
+              val.push_back(C.edge(j));
+            }
+          }
+          rowPtr.push_back(colInd.size());
+        }
+        for(IndexType_ i=0; i<m; ++i)
+          f[i] = i;
+        if(m > 2 && !colInd.empty()) {
+          CsrMatrixHost<IndexType_,ValueType_> A(m, m, colInd.size(), &val[0],
+                                                 &rowPtr[0], &colInd[0]);
+          LaplacianMatrixHost<IndexType_,ValueType_> L(A);
+          ValueType_ eigVals[2];
+          std::vector<ValueType_> eigVecs(2*static_cast<size_t>(m));
+          IndexType_ iter;
+          NVGRAPH_ERROR status
+            = computeSmallestEigenvectors_host(L, (IndexType_) 2, maxIter_lanczos,
+                                               restartIter_lanczos, tol_lanczos,
+                                               false, iter, eigVals, &eigVecs[0]);
+          if(status != NVGRAPH_OK)
+            return status;
+          std::copy(eigVecs.begin()+m, eigVecs.end(), f.begin());
+        }
+      }
+
+      // Split at the weighted quantile, each side keeps at least one
+      // vertex per partition
+      std::vector<IndexType_> order(m);
+      for(IndexType_ i=0; i<m; ++i)
+        order[i] = i;
+      std::sort(order.begin(), order.end(), FiedlerOrder<IndexType_,ValueType_>(&f[0]));
+      IndexType_ nParts1 = nParts/2;
+      ValueType_ totalWeight = 0;
+      for(IndexType_ i=0; i<m; ++i)
+        totalWeight += C.weight(verts[i]);
+      ValueType_ target = totalWeight*nParts1/nParts;
+      ValueType_ weight = 0;
+      IndexType_ split = 0;
+      while(split < m-(nParts-nParts1)
+            && (split < nParts1
+                || fabs(weight+C.weight(verts[order[split]])-target) < fabs(weight-target))) {
+        weight += C.weight(verts[order[split]]);
+        ++split;
+      }
+      std::vector<IndexType_> verts1(split), verts2(m-split);
+      for(IndexType_ i=0; i<split; ++i)
+        verts1[i] = verts[order[i]];
+      for(IndexType_ i=split; i<m; ++i)
+        verts2[i-split] = verts[order[i]];
+      NVGRAPH_ERROR status
+        = recursiveBisection(C, verts1, (const ValueType_ *) NULL, nParts1, firstPart,
+                             maxIter_lanczos, restartIter_lanczos, tol_lanczos, parts);
+      if(status != NVGRAPH_OK)
+        return status;
+      return recursiveBisection(C, verts2, (const ValueType_ *) NULL, nParts-nParts1,
+                                firstPart+nParts1,
+                                maxIter_lanczos, restartIter_lanczos, tol_lanczos, parts);
+    }
+  }
+
+  // =========================================================
+  // Multilevel partitioner
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR partition_multilevel_host(IndexType_ n, IndexType_ nnz,
+                                          const IndexType_ * csrRowPtr,
+                                          const IndexType_ * csrColInd,
+                                          const ValueType_ * csrVal,
+                                          IndexType_ nParts,
+                                          IndexType_ nEigVecs,
+                                          IndexType_ maxIter_lanczos,
+                                          IndexType_ restartIter_lanczos,
+                                          ValueType_ tol_lanczos,
+                                          IndexType_ coarsestSize,
+                                          IndexType_ maxIter_refine,
+                                          ValueType_ imbalance_tol,
+                                          IndexType_ * __restrict__ parts,
+                                          ValueType_ * __restrict__ eigVals,
+                                          ValueType_ * __restrict__ eigVecs,
+                                          IndexType_ & levels,
+                                          ValueType_ & edgeCut,
+                                          ValueType_ & imbalance) {
+
+    // -------------------------------------------------------
+    // Check that parameters are valid
+    // -------------------------------------------------------
+    if(nParts < 1 || nParts > n) {
+      WARNING("invalid parameter (nParts<1 or nParts>n)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    if(coarsestSize < nParts) {
+      WARNING("invalid parameter (coarsestSize<nParts)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    if(maxIter_refine < 0) {
+      WARNING("invalid parameter (maxIter_refine<0)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+    if(imbalance_tol < 0) {
+      WARNING("invalid parameter (imbalance_tol<0)");
+      return NVGRAPH_ERR_BAD_PARAMETERS;
+    }
+
+    // -------------------------------------------------------
+    // Coarsening
+    // -------------------------------------------------------
+
+    // Levels are never reallocated, coarse levels point to their
+    // own storage
+    std::vector< GraphLevelHost<IndexType_,ValueType_> > hierarchy;
+    hierarchy.reserve(MULTILEVEL_MAX_LEVELS+1);
+    hierarchy.resize(1);
+    hierarchy[0].n = n;
+    hierarchy[0].rowPtr = csrRowPtr;
+    hierarchy[0].colInd = csrColInd;
+    hierarchy[0].val = csrVal;
+
+    // Coarse vertices stay below 1.5 times the average weight of the
+    // coarsest graph
+    IndexType_ maxVwgt = static_cast<IndexType_>(ceil(1.5*n/coarsestSize));
+    maxVwgt = std::max(maxVwgt, (IndexType_) 2);
+
+    std::vector<IndexType_> match;
+    while(hierarchy.size() <= MULTILEVEL_MAX_LEVELS
+          && hierarchy.back().n > coarsestSize) {
+      GraphLevelHost<IndexType_,ValueType_> & G = hierarchy.back();
+      IndexType_ nPairs = heavyEdgeMatching_host(G, maxVwgt, match);
+      if(G.n-nPairs > MULTILEVEL_MIN_REDUCTION*G.n)
+        break;
+      hierarchy.resize(hierarchy.size()+1);
+      contractGraph_host(hierarchy[hierarchy.size()-2], match, hierarchy.back());
+    }
+    levels = hierarchy.size()-1;
+
+    // -------------------------------------------------------
+    // Spectral partition of the coarsest graph
+    // -------------------------------------------------------
+
+    // Smallest eigenvectors of the Laplacian, the second one starts
+    // the recursive bisection
+    const GraphLevelHost<IndexType_,ValueType_> & C = hierarchy.back();
+    IndexType_ nEigVecs_C = std::min(std::max(nEigVecs, (IndexType_) 2), C.n);
+    std::vector<ValueType_> coarseEigVals(nEigVecs_C);
+    std::vector<ValueType_> coarseEigVecs(static_cast<size_t>(C.n)*nEigVecs_C, 0);
+    IndexType_ iters_lanczos;
+    if(C.rowPtr[C.n] > 0) {
+      CsrMatrixHost<IndexType_,ValueType_> A(C.n, C.n, C.rowPtr[C.n], C.val,
+                                             C.rowPtr, C.colInd);
+      LaplacianMatrixHost<IndexType_,ValueType_> L(A);
+      NVGRAPH_ERROR status
+        = computeSmallestEigenvectors_host(L, nEigVecs_C, maxIter_lanczos,
+                                           restartIter_lanczos, tol_lanczos,
+                                           false, iters_lanczos,
+                                           &coarseEigVals[0], &coarseEigVecs[0]);
+      if(status != NVGRAPH_OK)
+        return status;
+    }
+    // A coarsest graph smaller than nEigVecs has fewer eigenpairs, the
+    // others are zero
+    IndexType_ nEigVecs_out = std::min(nEigVecs, nEigVecs_C);
+    std::copy(coarseEigVals.begin(), coarseEigVals.begin()+nEigVecs_out, eigVals);
+    std::fill(eigVals+nEigVecs_out, eigVals+nEigVecs, (ValueType_) 0);
+
+    std::vector<IndexType_> coarseParts(C.n);
+    std::vector<IndexType_> coarseVerts(C.n);
+    for(IndexType_ v=0; v<C.n; ++v)
+      coarseVerts[v] = v;
+    NVGRAPH_ERROR status
+      = recursiveBisection(C, coarseVerts,
+                           (C.n > 1 && C.rowPtr[C.n] > 0) ? &coarseEigVecs[IDX(0,1,C.n)] : NULL,
+                           nParts, (IndexType_) 0,
+                           maxIter_lanczos, restartIter_lanczos, tol_lanczos,
+                           &coarseParts[0]);
+    if(status != NVGRAPH_OK)
+      return status;
+
+    // -------------------------------------------------------
+    // Uncoarsening and refinement
+    // -------------------------------------------------------
+
+    // Largest part allowed, plus the heaviest vertex of each level so
+    // that vertices can be exchanged between full parts
+    IndexType_ avgWeight = (n+nParts-1)/nParts;
+    IndexType_ maxWeight = static_cast<IndexType_>(floor((1+imbalance_tol)*avgWeight));
+    maxWeight = std::max(maxWeight, avgWeight);
+
+    std::vector<IndexType_> levelParts;
+    for(IndexType_ l=levels; l>=0; --l) {
+      const GraphLevelHost<IndexType_,ValueType_> & G = hierarchy[l];
+      IndexType_ * p = (l == 0) ? parts : NULL;
+      if(l == levels) {
+        levelParts.swap(coarseParts);
+      }
+      else {
+        std::vector<IndexType_> fineParts(G.n);
+        #pragma omp parallel for schedule(static)
+        for(IndexType_ v=0; v<G.n; ++v)
+          fineParts[v] = levelParts[G.coarse[v]];
+        levelParts.swap(fineParts);
+      }
+      if(p != NULL)
+        std::copy(levelParts.begin(), levelParts.end(), p);
+      else
+        p = &levelParts[0];
+
+      IndexType_ slack = 1;
+      for(size_t v=0; v<G.vwgt.size(); ++v)
+        slack = std::max(slack, G.vwgt[v]);
+      refinePartition(G, nParts, maxWeight+slack, maxIter_refine, p);
+    }
+
+    // Interpolate eigenvectors of the coarsest graph
+    std::vector<IndexType_> toCoarsest(n);
+    #pragma omp parallel for schedule(static)
+    for(IndexType_ v=0; v<n; ++v) {
+      IndexType_ c = v;
+      for(IndexType_ l=0; l<levels; ++l)
+        c = hierarchy[l].coarse[c];
+      toCoarsest[v] = c;
+    }
+    for(IndexType_ i=0; i<nEigVecs_out; ++i) {
+      #pragma omp parallel for schedule(static)
+      for(IndexType_ v=0; v<n; ++v)
+        eigVecs[IDX(v,i,n)] = coarseEigVecs[IDX(toCoarsest[v],i,C.n)];
+    }
+    std::fill(eigVecs+static_cast<size_t>(n)*nEigVecs_out,
+              eigVecs+static_cast<size_t>(n)*nEigVecs, (ValueType_) 0);
+
+    // Report quality
+    ValueType_ cost;
+    return analyzePartition_host(n, nnz, csrRowPtr, csrColInd, csrVal,
+                                 nParts, parts, edgeCut, cost, imbalance);
+  }
+
+  // =========================================================
+  // Explicit instantiation
+  // =========================================================
+
+  template
+  NVGRAPH_ERROR partition_multilevel_host<int,float>(int n, int nnz,
+                                                     const int * csrRowPtr,
+                                                     const int * csrColInd,
+                                                     const float * csrVal,
+                                                     int nParts, int nEigVecs,
+                                                     int maxIter_lanczos, int restartIter_lanczos,
+                                                     float tol_lanczos,
+                                                     int coarsestSize, int maxIter_refine,
+                                                     float imbalance_tol,
+                                                     int * __restrict__ parts,
+                                                     float * __restrict__ eigVals,
+                                                     float * __restrict__ eigVecs,
+                                                     int & levels, float & edgeCut,
+                                                     float & imbalance);
+  template
+  NVGRAPH_ERROR partition_multilevel_host<int,double>(int n, int nnz,
+                                                      const int * csrRowPtr,
+                                                      const int * csrColInd,
+                                                      const double * csrVal,
+                                                      int nParts, int nEigVecs,
+                                                      int maxIter_lanczos, int restartIter_lanczos,
+                                                      double tol_lanczos,
+                                                      int coarsestSize, int maxIter_refine,
+                                                      double imbalance_tol,
+                                                      int * __restrict__ parts,
+                                                      double * __restrict__ eigVals,
+                                                      double * __restrict__ eigVecs,
+                                                      int & levels, double & edgeCut,
+                                                      double & imbalance);
+
+}
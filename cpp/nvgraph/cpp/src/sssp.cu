@@ -17,7 +17,9 @@
 #define NEW_CSRMV
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
+#include <limits>
 #include "valued_csr_graph.hxx"
 #include "nvgraph_vector.hxx"
 #include "nvgraph_cusparse.hxx"
@@ -173,7 +175,120 @@ NVGRAPH_ERROR Sssp<IndexType_, ValueType_>::solve(IndexType source_index, Vector
     #endif
     return converged ? NVGRAPH_OK : NVGRAPH_ERR_NOT_CONVERGED;
 }
+template <typename IndexType_, typename ValueType_>
+__global__ void init_distance_block_kernel(IndexType_ n, IndexType_ num_cols, const IndexType_* __restrict__ sources, ValueType_ unreachable_val, ValueType_* __restrict__ dist)
+{
+    size_t len = static_cast<size_t>(n) * num_cols;
+    for (size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < len; i += blockDim.x * gridDim.x)
+    {
+        IndexType_ v = static_cast<IndexType_>(i / num_cols);
+        IndexType_ j = static_cast<IndexType_>(i % num_cols);
+        dist[i] = (sources[j] == v) ? ValueType_(0) : unreachable_val;
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+__global__ void gather_distance_block_kernel(IndexType_ num_destinations, IndexType_ num_cols, const IndexType_* __restrict__ destinations, const ValueType_* __restrict__ dist, IndexType_ ld, ValueType_* __restrict__ distances)
+{
+    size_t len = static_cast<size_t>(num_destinations) * num_cols;
+    for (size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < len; i += blockDim.x * gridDim.x)
+    {
+        IndexType_ d = static_cast<IndexType_>(i / num_cols);
+        IndexType_ j = static_cast<IndexType_>(i % num_cols);
+        IndexType_ v = destinations ? destinations[d] : d;
+        distances[static_cast<size_t>(d) * ld + j] = dist[static_cast<size_t>(v) * num_cols + j];
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+SsspMulti<IndexType_, ValueType_>::SsspMulti(const ValuedCsrGraph <IndexType, ValueType>& network, IndexType batch_size, cudaStream_t stream)
+    : m_network(network), m_batch_size(batch_size), m_iterations(0), m_stream(stream)
+{
+    if (m_batch_size <= 0)
+        FatalError("Wrong batch size in SSSP multi solver.", NVGRAPH_ERR_BAD_PARAMETERS);
+    size_t len = static_cast<size_t>(m_network.get_num_vertices()) * m_batch_size;
+    m_dist.allocate(len, m_stream);
+    m_tmp.allocate(len, m_stream);
+}
+
+template <typename IndexType_, typename ValueType_>
+bool SsspMulti<IndexType_, ValueType_>::solve_it(IndexType num_cols)
+{
+    int n = static_cast<int>(m_network.get_num_vertices()), nnz = static_cast<int>(m_network.get_num_edges());
+    size_t len = static_cast<size_t>(n) * num_cols;
+    ValueType_ tolerance = static_cast<float>( 1.0E-6);
+    ValueType_ alpha = 0.0, beta = 0.0; //times_ident = 0 for MinPlus semiring
+    // tmp = dist plus Network^T op dist
+    CHECK_CUDA(cudaMemcpyAsync(m_tmp.raw(), m_dist.raw(), len * sizeof(ValueType_), cudaMemcpyDeviceToDevice, m_stream));
+    CHECK_CUDA(csrmm_mp<int, ValueType_>(n, n, nnz, num_cols,
+                                         alpha,
+                                         m_network.get_raw_values(),
+                                         m_network.get_raw_row_offsets(),
+                                         m_network.get_raw_column_indices(),
+                                         m_dist.raw(),
+                                         beta,
+                                         m_tmp.raw(),
+                                         MinPlus,
+                                         m_stream));
+    // CVG check : ||dist - tmp|| over the whole block, the previous distances are not needed anymore
+    // (cublas lengths are int, the block is reduced in chunks)
+    const size_t chunk = static_cast<size_t>(std::numeric_limits<int>::max());
+    ValueType_ squares = 0;
+    for (size_t first = 0; first < len; first += chunk)
+    {
+        int count = static_cast<int>(std::min(chunk, len - first));
+        Cublas::axpy(count, (ValueType_)-1.0, m_tmp.raw() + first, 1, m_dist.raw() + first, 1);
+        ValueType_ nrm = Cublas::nrm2(count, m_dist.raw() + first, 1);
+        squares += nrm * nrm;
+    }
+    m_residual = std::sqrt(squares);
+    std::swap(m_dist, m_tmp);
+    return m_residual < tolerance;
+}
+
+template <typename IndexType_, typename ValueType_>
+NVGRAPH_ERROR SsspMulti<IndexType_, ValueType_>::solve(IndexType num_sources, const IndexType* sources,
+                                                       IndexType num_destinations, const IndexType* destinations,
+                                                       ValueType* distances)
+{
+    IndexType n = static_cast<IndexType>(m_network.get_num_vertices());
+    if (num_sources <= 0 || sources == NULL || distances == NULL || num_destinations <= 0 || (destinations == NULL && num_destinations != n))
+        FatalError("Wrong input in SSSP multi solver.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    ValueType_ unreachable_val = (sizeof(ValueType_) == sizeof(float)) ? static_cast<ValueType_>(FLT_MAX) : static_cast<ValueType_>(DBL_MAX);
+    const int threads = 256;
+    bool converged = true;
+    m_iterations = 0;
+    for (IndexType first = 0; first < num_sources; first += m_batch_size)
+    {
+        IndexType num_cols = std::min(m_batch_size, num_sources - first);
+        size_t len = static_cast<size_t>(n) * num_cols;
+        int blocks = static_cast<int>(std::min<size_t>((len + threads - 1) / threads, 65535));
+        init_distance_block_kernel<<<blocks, threads, 0, m_stream>>>(n, num_cols, sources + first, unreachable_val, m_dist.raw());
+        cudaCheckError();
+
+        // Bellman-Ford bound on the number of relaxations
+        bool batch_converged = false;
+        int max_it = static_cast<int>(n), i = 0;
+        while (!batch_converged && i < max_it)
+        {
+            batch_converged = solve_it(num_cols);
+            i++;
+        }
+        m_iterations += i;
+        converged = converged && batch_converged;
+
+        len = static_cast<size_t>(num_destinations) * num_cols;
+        blocks = static_cast<int>(std::min<size_t>((len + threads - 1) / threads, 65535));
+        gather_distance_block_kernel<<<blocks, threads, 0, m_stream>>>(num_destinations, num_cols, destinations, m_dist.raw(), num_sources, distances + first);
+        cudaCheckError();
+    }
+    return converged ? NVGRAPH_OK : NVGRAPH_ERR_NOT_CONVERGED;
+}
+
 template class Sssp<int, double>;
 template class Sssp<int, float>;
+template class SsspMulti<int, double>;
+template class SsspMulti<int, float>;
 } // end namespace nvgraph
 
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/device_ptr.h>
+#include <thrust/extrema.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include "nvgraph_error.hxx"
+#include "nvgraph_vector.hxx"
+#include "nvgraph_vector_kernels.hxx"
+#include "nvgraph_cublas.hxx"
+#include "pagerank_kernels.hxx"
+#include "subgraph_view.hxx"
+
+namespace nvgraph
+{
+namespace
+{
+const int num_threads = 256;
+const int max_grid_size = 4096;
+
+inline int num_blocks(int n)
+{
+    return std::min(max_grid_size, (n / num_threads) + 1);
+}
+
+// device arrays of a view, passed by value to the kernels
+template <typename IndexType>
+struct SubgraphViewArrays
+{
+    IndexType ns;
+    const IndexType* vertices;
+    const IndexType* edges;        // NULL for a vertex subset
+    const IndexType* edge_offsets;
+    const IndexType* row_offsets;
+    const IndexType* col_indices;
+
+    // entries [begin, end) of subgraph vertex i, in edges or in the parent arrays
+    __device__ __forceinline__ void get_range(IndexType i, IndexType& begin, IndexType& end) const
+    {
+        if (edges)
+        {
+            begin = edge_offsets[i];
+            end = edge_offsets[i + 1];
+        }
+        else
+        {
+            begin = row_offsets[vertices[i]];
+            end = row_offsets[vertices[i] + 1];
+        }
+    }
+
+    __device__ __forceinline__ IndexType get_edge(IndexType k) const
+    {
+        return edges ? edges[k] : k;
+    }
+
+    // subgraph vertex of parent vertex v, -1 outside of the view
+    __device__ __forceinline__ IndexType get_local(IndexType v) const
+    {
+        IndexType lo = 0, hi = ns;
+        while (lo < hi)
+        {
+            IndexType mid = lo + (hi - lo) / 2;
+            if (vertices[mid] < v)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return (lo < ns && vertices[lo] == v) ? lo : -1;
+    }
+};
+
+template <typename IndexType>
+__global__ void subgraph_degree_kernel(SubgraphViewArrays<IndexType> view, IndexType* degrees)
+{
+    for (IndexType i = blockDim.x * blockIdx.x + threadIdx.x; i < view.ns; i += blockDim.x * gridDim.x)
+    {
+        IndexType begin, end, d = 0;
+        view.get_range(i, begin, end);
+        for (IndexType k = begin; k < end; k++)
+            if (view.get_local(view.col_indices[view.get_edge(k)]) >= 0)
+                d++;
+        degrees[i] = d;
+    }
+}
+
+template <typename IndexType, typename ValueType>
+__global__ void subgraph_csrmv_kernel(SubgraphViewArrays<IndexType> view, ValueType alpha, const ValueType* values,
+                                      const ValueType* x, ValueType beta, ValueType* y)
+{
+    for (IndexType i = blockDim.x * blockIdx.x + threadIdx.x; i < view.ns; i += blockDim.x * gridDim.x)
+    {
+        IndexType begin, end;
+        view.get_range(i, begin, end);
+        ValueType sum = 0;
+        for (IndexType k = begin; k < end; k++)
+        {
+            IndexType e = view.get_edge(k);
+            IndexType j = view.get_local(view.col_indices[e]);
+            if (j >= 0)
+                sum += (values ? values[e] : static_cast<ValueType>(1)) * x[j];
+        }
+        // y is not read when beta is 0, it can be uninitialized
+        y[i] = (beta == static_cast<ValueType>(0)) ? alpha * sum : alpha * sum + beta * y[i];
+    }
+}
+
+// expands the frontier of level, the vertices reached first are appended to next
+template <typename IndexType>
+__global__ void subgraph_bfs_kernel(SubgraphViewArrays<IndexType> view, const IndexType* frontier, IndexType frontier_size,
+                                    IndexType level, IndexType* distances, IndexType* predecessors,
+                                    IndexType* next, IndexType* next_size)
+{
+    for (IndexType t = blockDim.x * blockIdx.x + threadIdx.x; t < frontier_size; t += blockDim.x * gridDim.x)
+    {
+        IndexType u = frontier[t], begin, end;
+        view.get_range(u, begin, end);
+        for (IndexType k = begin; k < end; k++)
+        {
+            IndexType v = view.get_local(view.col_indices[view.get_edge(k)]);
+            if (v >= 0 && atomicCAS(&distances[v], INT_MAX, level + 1) == INT_MAX)
+            {
+                if (predecessors)
+                    predecessors[v] = u;
+                next[atomicAdd(next_size, 1)] = v;
+            }
+        }
+    }
+}
+
+template <typename IndexType>
+inline SubgraphViewArrays<IndexType> make_arrays(IndexType ns, const Vector<IndexType>& vertices,
+                                                 const Vector<IndexType>& edges, const Vector<IndexType>& edge_offsets,
+                                                 bool use_edges, const IndexType* row_offsets, const IndexType* col_indices)
+{
+    SubgraphViewArrays<IndexType> view;
+    view.ns = ns;
+    view.vertices = vertices.raw();
+    view.edges = use_edges ? edges.raw() : NULL;
+    view.edge_offsets = use_edges ? edge_offsets.raw() : NULL;
+    view.row_offsets = row_offsets;
+    view.col_indices = col_indices;
+    return view;
+}
+} // end anonymous namespace
+
+template <typename IndexType_>
+SubgraphView<IndexType_>::SubgraphView(IndexType n, IndexType nnz,
+                                       const IndexType* row_offsets,
+                                       const IndexType* col_indices,
+                                       const IndexType* subset,
+                                       size_t subset_size,
+                                       bool use_edges,
+                                       cudaStream_t stream)
+    : m_n(n), m_nnz(nnz), m_row_offsets(row_offsets), m_col_indices(col_indices), m_stream(stream),
+      m_num_vertices(0), m_num_edges(0), m_use_edges(use_edges)
+{
+    if (n <= 0 || nnz < 0 || row_offsets == NULL || (nnz > 0 && col_indices == NULL))
+        FatalError("Wrong input in subgraph view.", NVGRAPH_ERR_BAD_PARAMETERS);
+    if (subset == NULL || subset_size == 0)
+        FatalError("0-sized subset in subgraph view.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // the subset, then for an edge subset the rows and columns of its edges
+    IndexType size = static_cast<IndexType>(subset_size);
+    Vector<IndexType> ids(use_edges ? 2 * subset_size : subset_size, m_stream);
+    CHECK_CUDA(cudaMemcpy(ids.raw(), subset, subset_size * sizeof(IndexType), cudaMemcpyDefault));
+    thrust::device_ptr<IndexType> first = thrust::device_pointer_cast(ids.raw());
+
+    thrust::pair<thrust::device_ptr<IndexType>, thrust::device_ptr<IndexType> > bounds = thrust::minmax_element(first, first + size);
+    cudaCheckError();
+    IndexType lowest = *bounds.first, highest = *bounds.second;
+    if (lowest < 0 || highest >= (use_edges ? nnz : n))
+    {
+        if (use_edges)
+            FatalError("Edge subset values must be less than number of edges of original graph.", NVGRAPH_ERR_BAD_PARAMETERS);
+        FatalError("Vertex subset values must be less than number of vertices of original graph.", NVGRAPH_ERR_BAD_PARAMETERS);
+    }
+    thrust::sort(first, first + size);
+    size = static_cast<IndexType>(thrust::unique(first, first + size) - first);
+    cudaCheckError();
+
+    Vector<IndexType> rows;
+    if (use_edges)
+    {
+        m_num_edges = size;
+        m_edges.allocate(size, m_stream);
+        thrust::device_ptr<IndexType> edges = thrust::device_pointer_cast(m_edges.raw());
+        thrust::copy(first, first + size, edges);
+
+        // rows do not decrease with the edge ids, see SubgraphViewHost
+        rows.allocate(size, m_stream);
+        thrust::device_ptr<IndexType> r = thrust::device_pointer_cast(rows.raw());
+        thrust::device_ptr<const IndexType> offsets = thrust::device_pointer_cast(row_offsets);
+        thrust::upper_bound(offsets, offsets + n + 1, edges, edges + size, r);
+        thrust::transform(r, r + size, thrust::make_constant_iterator<IndexType>(1), r, thrust::minus<IndexType>());
+        thrust::copy(r, r + size, first);
+        thrust::gather(edges, edges + size, thrust::device_pointer_cast(col_indices), first + size);
+        cudaCheckError();
+        size *= 2;
+        thrust::sort(first, first + size);
+        size = static_cast<IndexType>(thrust::unique(first, first + size) - first);
+        cudaCheckError();
+    }
+
+    // subgraph numbering: the vertices in increasing order
+    m_num_vertices = size;
+    m_vertices.allocate(size, m_stream);
+    thrust::device_ptr<IndexType> vertices = thrust::device_pointer_cast(m_vertices.raw());
+    thrust::copy(first, first + size, vertices);
+    cudaCheckError();
+
+    if (use_edges)
+    {
+        // local rows, then the first edge of every subgraph vertex
+        thrust::device_ptr<IndexType> r = thrust::device_pointer_cast(rows.raw());
+        thrust::lower_bound(vertices, vertices + m_num_vertices, r, r + m_num_edges, first);
+        m_edge_offsets.allocate(m_num_vertices + 1, m_stream);
+        thrust::lower_bound(first, first + m_num_edges,
+                            thrust::counting_iterator<IndexType>(0),
+                            thrust::counting_iterator<IndexType>(m_num_vertices + 1),
+                            thrust::device_pointer_cast(m_edge_offsets.raw()));
+        cudaCheckError();
+    }
+    else
+    {
+        subgraph_degree_kernel<<<num_blocks(m_num_vertices), num_threads, 0, m_stream>>>(
+            make_arrays(m_num_vertices, m_vertices, m_edges, m_edge_offsets, m_use_edges, m_row_offsets, m_col_indices),
+            ids.raw());
+        cudaCheckError();
+        CHECK_CUDA(cudaStreamSynchronize(m_stream));
+        m_num_edges = thrust::reduce(first, first + m_num_vertices);
+        cudaCheckError();
+    }
+}
+
+template <typename IndexType_>
+NVGRAPH_ERROR SubgraphView<IndexType_>::traverse(IndexType source, IndexType* distances, IndexType* predecessors) const
+{
+    const IndexType ns = m_num_vertices;
+    if (source < 0 || source >= ns)
+        FatalError("Wrong source vertex in subgraph view traversal.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    SubgraphViewArrays<IndexType> view = make_arrays(ns, m_vertices, m_edges, m_edge_offsets, m_use_edges, m_row_offsets, m_col_indices);
+    Vector<IndexType> dist, frontier(ns, m_stream), next(ns, m_stream), next_size(1, m_stream);
+    if (distances == NULL)
+    {
+        dist.allocate(ns, m_stream);
+        distances = dist.raw();
+    }
+    fill_raw_vec(distances, ns, static_cast<IndexType>(INT_MAX), m_stream);
+    if (predecessors)
+        fill_raw_vec(predecessors, ns, static_cast<IndexType>(-1), m_stream);
+    const IndexType zero = 0;
+    CHECK_CUDA(cudaMemcpyAsync(distances + source, &zero, sizeof(IndexType), cudaMemcpyHostToDevice, m_stream));
+    CHECK_CUDA(cudaMemcpyAsync(frontier.raw(), &source, sizeof(IndexType), cudaMemcpyHostToDevice, m_stream));
+
+    IndexType frontier_size = 1;
+    for (IndexType level = 0; frontier_size > 0; level++)
+    {
+        CHECK_CUDA(cudaMemsetAsync(next_size.raw(), 0, sizeof(IndexType), m_stream));
+        subgraph_bfs_kernel<<<num_blocks(frontier_size), num_threads, 0, m_stream>>>(
+            view, frontier.raw(), frontier_size, level, distances, predecessors, next.raw(), next_size.raw());
+        cudaCheckError();
+        CHECK_CUDA(cudaMemcpyAsync(&frontier_size, next_size.raw(), sizeof(IndexType), cudaMemcpyDeviceToHost, m_stream));
+        CHECK_CUDA(cudaStreamSynchronize(m_stream));
+        std::swap(frontier, next);
+    }
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType_>
+template <typename ValueType>
+void SubgraphView<IndexType_>::csrmv(ValueType alpha, const ValueType* values, const ValueType* x, ValueType beta, ValueType* y) const
+{
+    subgraph_csrmv_kernel<<<num_blocks(m_num_vertices), num_threads, 0, m_stream>>>(
+        make_arrays(m_num_vertices, m_vertices, m_edges, m_edge_offsets, m_use_edges, m_row_offsets, m_col_indices),
+        alpha, values, x, beta, y);
+    cudaCheckError();
+}
+
+template <typename IndexType_>
+template <typename ValueType>
+NVGRAPH_ERROR SubgraphView<IndexType_>::pagerank(const ValueType* weights, ValueType damping_factor,
+                                                 const ValueType* bookmark, const ValueType* guess,
+                                                 float tolerance, int max_it, ValueType* pagerank) const
+{
+    if ((weights == NULL && m_nnz > 0) || bookmark == NULL || pagerank == NULL)
+        FatalError("Wrong input in subgraph view Pagerank.", NVGRAPH_ERR_BAD_PARAMETERS);
+    if (damping_factor > 0.999 || damping_factor < 0.0001)
+        FatalError("Wrong damping factor value in Pagerank solver.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    const int ns = static_cast<int>(m_num_vertices);
+    const ValueType tol = static_cast<ValueType>(tolerance);
+    const int inc = 1;
+
+    // a = alpha*a + (1-alpha)e on the dangling nodes, b = 1/n (see Pagerank::setup)
+    Vector<ValueType> a(ns, m_stream), b(ns, m_stream), tmp(ns, m_stream), pr(ns, m_stream);
+    CHECK_CUDA(cudaMemcpyAsync(a.raw(), bookmark, ns * sizeof(ValueType), cudaMemcpyDeviceToDevice, m_stream));
+    update_dangling_nodes(ns, a.raw(), damping_factor, m_stream);
+    b.fill(static_cast<ValueType>(1.0 / ns), m_stream);
+    if (guess)
+    {
+        CHECK_CUDA(cudaMemcpyAsync(tmp.raw(), guess, ns * sizeof(ValueType), cudaMemcpyDeviceToDevice, m_stream));
+    }
+    else
+        tmp.fill(static_cast<ValueType>(1.0 / ns), m_stream);
+
+    Cublas::set_pointer_mode_host();
+    Cublas::setStream(m_stream);
+    bool converged = false;
+    for (int it = 0; it < max_it && !converged; it++)
+    {
+        if (it == 0)
+            Cublas::scal(ns, static_cast<ValueType>(1.0 / Cublas::nrm2(ns, tmp.raw(), inc)), tmp.raw(), inc);
+
+        csrmv(static_cast<ValueType>(1.0), weights, tmp.raw(), static_cast<ValueType>(0.0), pr.raw());
+
+        ValueType gamma;
+        Cublas::dot(ns, a.raw(), inc, tmp.raw(), inc, &gamma);
+        Cublas::scal(ns, damping_factor, pr.raw(), inc);
+        Cublas::axpy(ns, gamma, b.raw(), inc, pr.raw(), inc);
+
+        Cublas::scal(ns, static_cast<ValueType>(1.0 / Cublas::nrm2(ns, pr.raw(), inc)), pr.raw(), inc);
+        Cublas::axpy(ns, static_cast<ValueType>(-1.0), pr.raw(), inc, tmp.raw(), inc);
+
+        if (Cublas::nrm2(ns, tmp.raw(), inc) < tol)
+            converged = true;
+        std::swap(pr, tmp);
+    }
+
+    // tmp holds the last iterate
+    Cublas::scal(ns, static_cast<ValueType>(1.0 / tmp.nrm1(m_stream)), tmp.raw(), inc);
+    CHECK_CUDA(cudaMemcpyAsync(pagerank, tmp.raw(), ns * sizeof(ValueType), cudaMemcpyDeviceToDevice, m_stream));
+    CHECK_CUDA(cudaStreamSynchronize(m_stream));
+    return converged ? NVGRAPH_OK : NVGRAPH_ERR_NOT_CONVERGED;
+}
+
+template class SubgraphView<int>;
+template void SubgraphView<int>::csrmv<float>(float, const float*, const float*, float, float*) const;
+template void SubgraphView<int>::csrmv<double>(double, const double*, const double*, double, double*) const;
+template NVGRAPH_ERROR SubgraphView<int>::pagerank<float>(const float*, float, const float*, const float*, float, int, float*) const;
+template NVGRAPH_ERROR SubgraphView<int>::pagerank<double>(const double*, double, const double*, const double*, float, int, double*) const;
+
+} // end namespace nvgraph
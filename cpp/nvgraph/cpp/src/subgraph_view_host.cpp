@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <vector>
+#include "nvgraph_error.hxx"
+#include "subgraph_view_host.hxx"
+
+namespace nvgraph
+{
+namespace
+{
+template <typename ValueType>
+inline ValueType nrm2(const std::vector<ValueType>& x)
+{
+    ValueType s = 0;
+    #pragma omp parallel for reduction(+:s) schedule(static)
+    for (long i = 0; i < static_cast<long>(x.size()); i++)
+        s += x[i] * x[i];
+    return std::sqrt(s);
+}
+
+template <typename ValueType>
+inline ValueType nrm1(const std::vector<ValueType>& x)
+{
+    ValueType s = 0;
+    #pragma omp parallel for reduction(+:s) schedule(static)
+    for (long i = 0; i < static_cast<long>(x.size()); i++)
+        s += std::fabs(x[i]);
+    return s;
+}
+
+template <typename ValueType>
+inline void scal(std::vector<ValueType>& x, ValueType alpha)
+{
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < static_cast<long>(x.size()); i++)
+        x[i] *= alpha;
+}
+} // end anonymous namespace
+
+template <typename IndexType_>
+SubgraphViewHost<IndexType_>::SubgraphViewHost(IndexType n, IndexType nnz,
+                                               const IndexType* row_offsets,
+                                               const IndexType* col_indices,
+                                               const IndexType* subset,
+                                               size_t subset_size,
+                                               bool use_edges)
+    : m_n(n), m_nnz(nnz), m_row_offsets(row_offsets), m_col_indices(col_indices), m_num_edges(0)
+{
+    if (n <= 0 || nnz < 0 || row_offsets == NULL || (nnz > 0 && col_indices == NULL))
+        FatalError("Wrong input in host subgraph view.", NVGRAPH_ERR_BAD_PARAMETERS);
+    if (subset == NULL || subset_size == 0)
+        FatalError("0-sized subset in host subgraph view.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // the row of every edge of an edge subset, without the nnz entries reverse map of the
+    // extraction; rows do not decrease with the edge ids
+    std::vector<IndexType> rows;
+    if (use_edges)
+    {
+        m_edges.assign(subset, subset + subset_size);
+        for (size_t k = 0; k < subset_size; k++)
+            if (m_edges[k] < 0 || m_edges[k] >= nnz)
+                FatalError("Edge subset values must be less than number of edges of original graph.", NVGRAPH_ERR_BAD_PARAMETERS);
+        std::sort(m_edges.begin(), m_edges.end());
+        m_edges.erase(std::unique(m_edges.begin(), m_edges.end()), m_edges.end());
+        m_num_edges = static_cast<IndexType>(m_edges.size());
+
+        rows.resize(m_edges.size());
+        for (size_t k = 0; k < m_edges.size(); k++)
+            rows[k] = static_cast<IndexType>(std::upper_bound(row_offsets, row_offsets + n + 1, m_edges[k]) - row_offsets) - 1;
+        m_vertices = rows;
+        for (size_t k = 0; k < m_edges.size(); k++)
+            m_vertices.push_back(col_indices[m_edges[k]]);
+    }
+    else
+    {
+        m_vertices.assign(subset, subset + subset_size);
+        for (size_t k = 0; k < subset_size; k++)
+            if (m_vertices[k] < 0 || m_vertices[k] >= n)
+                FatalError("Vertex subset values must be less than number of vertices of original graph.", NVGRAPH_ERR_BAD_PARAMETERS);
+    }
+
+    // subgraph numbering: the vertices in increasing order
+    std::sort(m_vertices.begin(), m_vertices.end());
+    m_vertices.erase(std::unique(m_vertices.begin(), m_vertices.end()), m_vertices.end());
+    const IndexType ns = get_num_vertices();
+
+    if (use_edges)
+    {
+        m_edge_offsets.assign(ns + 1, 0);
+        for (size_t k = 0; k < rows.size(); k++)
+            m_edge_offsets[get_local(rows[k]) + 1]++;
+        for (IndexType i = 0; i < ns; i++)
+            m_edge_offsets[i + 1] += m_edge_offsets[i];
+    }
+    else
+    {
+        IndexType num_edges = 0;
+        #pragma omp parallel for reduction(+:num_edges) schedule(dynamic, 256)
+        for (IndexType i = 0; i < ns; i++)
+        {
+            IndexType p = m_vertices[i];
+            for (IndexType e = row_offsets[p]; e < row_offsets[p + 1]; e++)
+                if (get_local(col_indices[e]) >= 0)
+                    num_edges++;
+        }
+        m_num_edges = num_edges;
+    }
+}
+
+template <typename IndexType_>
+NVGRAPH_ERROR SubgraphViewHost<IndexType_>::traverse(IndexType source, IndexType* distances, IndexType* predecessors) const
+{
+    const IndexType ns = get_num_vertices();
+    if (source < 0 || source >= ns)
+        FatalError("Wrong source vertex in host subgraph view traversal.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    std::vector<IndexType> dist(ns, INT_MAX);
+    std::vector<IndexType> queue;
+    queue.reserve(ns);
+    if (predecessors)
+        std::fill(predecessors, predecessors + ns, -1);
+
+    dist[source] = 0;
+    queue.push_back(source);
+    for (size_t head = 0; head < queue.size(); head++)
+    {
+        IndexType u = queue[head];
+        for_each_edge(u, [&](IndexType, IndexType v)
+        {
+            if (dist[v] == INT_MAX)
+            {
+                dist[v] = dist[u] + 1;
+                if (predecessors)
+                    predecessors[v] = u;
+                queue.push_back(v);
+            }
+        });
+    }
+    if (distances)
+        std::copy(dist.begin(), dist.end(), distances);
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType_>
+template <typename ValueType>
+void SubgraphViewHost<IndexType_>::spmv(const ValueType* values, const ValueType* x, ValueType* y) const
+{
+    const IndexType ns = get_num_vertices();
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (IndexType i = 0; i < ns; i++)
+    {
+        ValueType sum = 0;
+        for_each_edge(i, [&](IndexType e, IndexType j)
+        {
+            sum += values[e] * x[j];
+        });
+        y[i] = sum;
+    }
+}
+
+template <typename IndexType_>
+template <typename ValueType>
+NVGRAPH_ERROR SubgraphViewHost<IndexType_>::pagerank(const ValueType* weights, ValueType damping_factor,
+                                                     const ValueType* bookmark, const ValueType* guess,
+                                                     float tolerance, int max_it, ValueType* pagerank) const
+{
+    if ((weights == NULL && m_nnz > 0) || bookmark == NULL || pagerank == NULL)
+        FatalError("Wrong input in host subgraph view Pagerank.", NVGRAPH_ERR_BAD_PARAMETERS);
+    if (damping_factor > 0.999 || damping_factor < 0.0001)
+        FatalError("Wrong damping factor value in Pagerank solver.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    const IndexType ns = get_num_vertices();
+    const ValueType tol = static_cast<ValueType>(tolerance);
+
+    // a = alpha*a + (1-alpha)e on the dangling nodes, b = 1/n (see Pagerank::setup)
+    std::vector<ValueType> a(bookmark, bookmark + ns);
+    for (IndexType i = 0; i < ns; i++)
+        if (a[i] == 0.0)
+            a[i] = 1.0 - damping_factor;
+    const ValueType b = static_cast<ValueType>(1.0 / ns);
+
+    std::vector<ValueType> tmp(ns, b), pr(ns);
+    if (guess)
+        std::copy(guess, guess + ns, tmp.begin());
+
+    bool converged = false;
+    for (int it = 0; it < max_it && !converged; it++)
+    {
+        if (it == 0)
+            scal(tmp, static_cast<ValueType>(1.0 / nrm2(tmp)));
+
+        spmv(weights, &tmp[0], &pr[0]);
+
+        ValueType gamma = 0;
+        #pragma omp parallel for reduction(+:gamma) schedule(static)
+        for (IndexType i = 0; i < ns; i++)
+            gamma += a[i] * tmp[i];
+        #pragma omp parallel for schedule(static)
+        for (IndexType i = 0; i < ns; i++)
+            pr[i] = damping_factor * pr[i] + gamma * b;
+
+        scal(pr, static_cast<ValueType>(1.0 / nrm2(pr)));
+        #pragma omp parallel for schedule(static)
+        for (IndexType i = 0; i < ns; i++)
+            tmp[i] -= pr[i];
+
+        if (nrm2(tmp) < tol)
+            converged = true;
+        std::swap(pr, tmp);
+    }
+
+    // tmp holds the last iterate
+    scal(tmp, static_cast<ValueType>(1.0 / nrm1(tmp)));
+    std::copy(tmp.begin(), tmp.end(), pagerank);
+    return converged ? NVGRAPH_OK : NVGRAPH_ERR_NOT_CONVERGED;
+}
+
+template class SubgraphViewHost<int>;
+template void SubgraphViewHost<int>::spmv<float>(const float*, const float*, float*) const;
+template void SubgraphViewHost<int>::spmv<double>(const double*, const double*, double*) const;
+template NVGRAPH_ERROR SubgraphViewHost<int>::pagerank<float>(const float*, float, const float*, const float*, float, int, float*) const;
+template NVGRAPH_ERROR SubgraphViewHost<int>::pagerank<double>(const double*, double, const double*, const double*, float, int, double*) const;
+
+} // end namespace nvgraph
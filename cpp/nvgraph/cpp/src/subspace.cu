@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "subspace.hxx"
+
+#include <math.h>
+#include <limits>
+#include <vector>
+
+#include <cuda.h>
+#include <curand.h>
+
+#include "nvgraph_error.hxx"
+#include "nvgraph_vector.hxx"
+#include "nvgraph_cublas.hxx"
+#include "lanczos_host.hxx"
+
+// =========================================================
+// Useful macros
+// =========================================================
+
+// Get index of matrix entry
+#define IDX(i,j,lda) ((i)+(j)*(lda))
+
+// Number of vectors added to the block beyond the wanted eigenvectors
+#define SUBSPACE_OVERSAMPLE 10
+
+namespace nvgraph {
+
+  namespace {
+
+    // =========================================================
+    // Helper functions
+    // =========================================================
+
+    /// Orthonormalize the columns of a dense matrix
+    /** Cholesky QR with two passes: G = X'*X = L*L' and X := X*inv(L').
+     *  The Gram matrix is small (b x b) and factored on the host; if
+     *  it is numerically singular, it is shifted until the
+     *  factorization succeeds. The second pass removes the loss of
+     *  orthogonality of the first one.
+     *
+     *  @param n Number of rows.
+     *  @param b Number of columns.
+     *  @param X_dev (Input/output, device memory, n*b entries)
+     *    Matrix, leading dimension n.
+     *  @param work_dev (Output, device memory, b*b entries)
+     *    Workspace.
+     */
+    template <typename IndexType_, typename ValueType_>
+    void choleskyQR(IndexType_ n, IndexType_ b,
+                    ValueType_ * __restrict__ X_dev,
+                    ValueType_ * __restrict__ work_dev) {
+      const ValueType_ zero = 0;
+      const ValueType_ one = 1;
+      const ValueType_ eps = std::numeric_limits<ValueType_>::epsilon();
+      std::vector<ValueType_> G(b*b), L(b*b, 0);
+      for(int pass=0; pass<2; ++pass) {
+        Cublas::gemm(true, false, b, b, n,
+                     &one, X_dev, n, X_dev, n,
+                     &zero, work_dev, b);
+        CHECK_CUDA(cudaMemcpy(&G[0], work_dev, b*b*sizeof(ValueType_),
+                              cudaMemcpyDeviceToHost));
+        ValueType_ trace = 0;
+        for(IndexType_ i=0; i<b; ++i)
+          trace += G[IDX(i,i,b)];
+
+        // Cholesky factorization of G + shift*I
+        ValueType_ shift = 0;
+        bool factored = false;
+        while(!factored) {
+          factored = true;
+          for(IndexType_ j=0; j<b && factored; ++j) {
+            ValueType_ d = G[IDX(j,j,b)] + shift;
+            for(IndexType_ l=0; l<j; ++l)
+              d -= L[IDX(j,l,b)]*L[IDX(j,l,b)];
+            if(!(d > 0)) {
+              factored = false;
+              shift = (shift == 0) ? eps*trace : 10*shift;
+              break;
+            }
+            L[IDX(j,j,b)] = sqrt(d);
+            for(IndexType_ i=j+1; i<b; ++i) {
+              ValueType_ s = G[IDX(i,j,b)];
+              for(IndexType_ l=0; l<j; ++l)
+                s -= L[IDX(i,l,b)]*L[IDX(j,l,b)];
+              L[IDX(i,j,b)] = s/L[IDX(j,j,b)];
+            }
+          }
+        }
+
+        // X := X*inv(L')
+        CHECK_CUDA(cudaMemcpy(work_dev, &L[0], b*b*sizeof(ValueType_),
+                              cudaMemcpyHostToDevice));
+        CHECK_CUBLAS(cublasXtrsm(Cublas::get_handle(), CUBLAS_SIDE_RIGHT,
+                                 CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_T,
+                                 CUBLAS_DIAG_NON_UNIT, n, b, &one,
+                                 work_dev, b, X_dev, n));
+      }
+    }
+
+    /// Compute extreme eigenvectors of symmetric matrix with
+    /// randomized subspace iteration
+    /** A Gaussian block is multiplied maxIter times by sigma*I-A (or
+     *  sigma*I+A for the largest eigenvalues) and orthonormalized
+     *  after each product. sigma is the largest norm of the columns
+     *  of A*X seen so far, a lower bound of the spectral radius that
+     *  makes the wanted eigenvalues dominant. The eigenvectors are
+     *  then extracted from the projection of A on the block
+     *  (Rayleigh-Ritz).
+     */
+    template <typename IndexType_, typename ValueType_>
+    NVGRAPH_ERROR computeEigenvectorsSubspace(const Matrix<IndexType_,ValueType_> & A,
+                                              IndexType_ nEigVecs,
+                                              IndexType_ maxIter,
+                                              IndexType_ & iter,
+                                              ValueType_ * __restrict__ eigVals_dev,
+                                              ValueType_ * __restrict__ eigVecs_dev,
+                                              bool smallest_eig) {
+
+      // CUDA stream
+      //   TODO: handle non-zero streams
+      cudaStream_t stream = 0;
+
+      // Useful constants
+      const ValueType_ zero = 0;
+      const ValueType_ one  = 1;
+
+      // -------------------------------------------------------
+      // Check that parameters are valid
+      // -------------------------------------------------------
+      if(A.m != A.n) {
+        WARNING("invalid parameter (matrix is not square)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs < 1) {
+        WARNING("invalid parameter (nEigVecs<1)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(nEigVecs > A.n) {
+        WARNING("invalid parameters (nEigVecs>n)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+      if(maxIter < 0) {
+        WARNING("invalid parameter (maxIter<0)");
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+      }
+
+      // -------------------------------------------------------
+      // Variable initialization
+      // -------------------------------------------------------
+
+      IndexType_ n = A.n;
+      IndexType_ b = (nEigVecs+SUBSPACE_OVERSAMPLE < n) ? nEigVecs+SUBSPACE_OVERSAMPLE : n;
+
+      // cuRAND generates an even number of normal samples
+      Vector<ValueType_> X_dev(n*b+(n*b)%2, stream);
+      Vector<ValueType_> W_dev(n*b, stream);
+      Vector<ValueType_> work_dev(b*b, stream);
+      std::vector<ValueType_> H_host(b*b);
+      std::vector<ValueType_> ritzVals(b), ritzVecs(b*b);
+
+      // Initialize cuBLAS
+      Cublas::set_pointer_mode_host();
+
+      // Gaussian sketch
+      curandGenerator_t randGen;
+      CHECK_CURAND(curandCreateGenerator(&randGen,
+                                         CURAND_RNG_PSEUDO_PHILOX4_32_10));
+      CHECK_CURAND(curandSetPseudoRandomGeneratorSeed(randGen, 123456));
+      CHECK_CURAND(curandGenerateNormalX(randGen, X_dev.raw(),
+                                         n*b+(n*b)%2, zero, one));
+      CHECK_CURAND(curandDestroyGenerator(randGen));
+      choleskyQR(n, b, X_dev.raw(), work_dev.raw());
+
+      // -------------------------------------------------------
+      // Subspace iteration
+      // -------------------------------------------------------
+
+      ValueType_ sigma = 0;
+      ValueType_ sign = smallest_eig ? -1 : 1;
+      iter = 0;
+      for(IndexType_ it=0; ; ++it) {
+        A.mm(b, one, X_dev.raw(), zero, W_dev.raw());
+        iter += b;
+        for(IndexType_ j=0; j<b; ++j) {
+          ValueType_ nrm = Cublas::nrm2(n, W_dev.raw()+IDX(0,j,n), 1);
+          sigma = (nrm > sigma) ? nrm : sigma;
+        }
+        if(it == maxIter)
+          break;
+
+        // X = sigma*X -/+ A*X
+        Cublas::scal(n*b, sigma, X_dev.raw(), 1);
+        Cublas::axpy(n*b, sign, W_dev.raw(), 1, X_dev.raw(), 1);
+        choleskyQR(n, b, X_dev.raw(), work_dev.raw());
+      }
+
+      // -------------------------------------------------------
+      // Rayleigh-Ritz
+      // -------------------------------------------------------
+
+      // H = X'*A*X, solved on the host
+      Cublas::gemm(true, false, b, b, n,
+                   &one, X_dev.raw(), n, W_dev.raw(), n,
+                   &zero, work_dev.raw(), b);
+      CHECK_CUDA(cudaMemcpy(&H_host[0], work_dev.raw(), b*b*sizeof(ValueType_),
+                            cudaMemcpyDeviceToHost));
+      for(IndexType_ j=0; j<b; ++j)
+        for(IndexType_ i=0; i<j; ++i) {
+          ValueType_ c = (H_host[IDX(i,j,b)]+H_host[IDX(j,i,b)])/2;
+          H_host[IDX(i,j,b)] = c;
+          H_host[IDX(j,i,b)] = c;
+        }
+      symmetricEigenvectors_host(b, &H_host[0], b, &ritzVals[0], &ritzVecs[0]);
+      IndexType_ first = smallest_eig ? 0 : b-nEigVecs;
+
+      // Eigenvectors are X times the wanted Ritz vectors
+      CHECK_CUDA(cudaMemcpy(eigVals_dev, &ritzVals[first],
+                            nEigVecs*sizeof(ValueType_),
+                            cudaMemcpyHostToDevice));
+      CHECK_CUDA(cudaMemcpy(work_dev.raw(), &ritzVecs[IDX(0,first,b)],
+                            b*nEigVecs*sizeof(ValueType_),
+                            cudaMemcpyHostToDevice));
+      Cublas::gemm(false, false, n, nEigVecs, b,
+                   &one, X_dev.raw(), n, work_dev.raw(), b,
+                   &zero, eigVecs_dev, n);
+      return NVGRAPH_OK;
+    }
+
+  }
+
+  // =========================================================
+  // Eigensolver
+  // =========================================================
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeSmallestEigenvectors_subspace(const Matrix<IndexType_,ValueType_> & A,
+                                                     IndexType_ nEigVecs,
+                                                     IndexType_ maxIter,
+                                                     IndexType_ & iter,
+                                                     ValueType_ * __restrict__ eigVals_dev,
+                                                     ValueType_ * __restrict__ eigVecs_dev) {
+    return computeEigenvectorsSubspace(A, nEigVecs, maxIter, iter,
+                                       eigVals_dev, eigVecs_dev, true);
+  }
+
+  template <typename IndexType_, typename ValueType_>
+  NVGRAPH_ERROR computeLargestEigenvectors_subspace(const Matrix<IndexType_,ValueType_> & A,
+                                                    IndexType_ nEigVecs,
+                                                    IndexType_ maxIter,
+                                                    IndexType_ & iter,
+                                                    ValueType_ * __restrict__ eigVals_dev,
+                                                    ValueType_ * __restrict__ eigVecs_dev) {
+    return computeEigenvectorsSubspace(A, nEigVecs, maxIter, iter,
+                                       eigVals_dev, eigVecs_dev, false);
+  }
+
+  // =========================================================
+  // Explicit instantiation
+  // =========================================================
+
+  template NVGRAPH_ERROR computeSmallestEigenvectors_subspace<int,float>
+  (const Matrix<int,float> & A, int nEigVecs, int maxIter, int & iter,
+   float * __restrict__ eigVals_dev, float * __restrict__ eigVecs_dev);
+  template NVGRAPH_ERROR computeSmallestEigenvectors_subspace<int,double>
+  (const Matrix<int,double> & A, int nEigVecs, int maxIter, int & iter,
+   double * __restrict__ eigVals_dev, double * __restrict__ eigVecs_dev);
+  template NVGRAPH_ERROR computeLargestEigenvectors_subspace<int,float>
+  (const Matrix<int,float> & A, int nEigVecs, int maxIter, int & iter,
+   float * __restrict__ eigVals_dev, float * __restrict__ eigVecs_dev);
+  template NVGRAPH_ERROR computeLargestEigenvectors_subspace<int,double>
+  (const Matrix<int,double> & A, int nEigVecs, int maxIter, int & iter,
+   double * __restrict__ eigVals_dev, double * __restrict__ eigVecs_dev);
+
+}
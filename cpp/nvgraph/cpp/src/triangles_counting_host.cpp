@@ -0,0 +1,590 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <triangles_counting_host.hxx>
+
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace nvgraph
+{
+
+namespace triangles_counting
+{
+
+uint64_t intersect_count(const int* a, int na, const int* b, int nb)
+{
+    uint64_t cnt = 0;
+    int i = 0, j = 0;
+    // block compare: every entry of a block of a against every entry of a block of b
+    // (by rotating b), then move forward the block with the smaller last value
+#if defined(__AVX2__)
+    const __m256i rot = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    while (i + 8 <= na && j + 8 <= nb)
+    {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+        __m256i m = _mm256_cmpeq_epi32(va, vb);
+        for (int r = 1; r < 8; r++)
+        {
+            vb = _mm256_permutevar8x32_epi32(vb, rot);
+            m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, vb));
+        }
+        cnt += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+        int amax = a[i + 7], bmax = b[j + 7];
+        if (amax <= bmax) i += 8;
+        if (bmax <= amax) j += 8;
+    }
+#endif
+#if defined(__SSE2__)
+    while (i + 4 <= na && j + 4 <= nb)
+    {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        __m128i m = _mm_cmpeq_epi32(va, vb);
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+        m = _mm_or_si128(m, _mm_cmpeq_epi32(va, vb));
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+        m = _mm_or_si128(m, _mm_cmpeq_epi32(va, vb));
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+        m = _mm_or_si128(m, _mm_cmpeq_epi32(va, vb));
+        cnt += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(m)));
+        int amax = a[i + 3], bmax = b[j + 3];
+        if (amax <= bmax) i += 4;
+        if (bmax <= amax) j += 4;
+    }
+#endif
+    // scalar merge of the tails
+    while (i < na && j < nb)
+    {
+        if (a[i] < b[j])
+            i++;
+        else if (b[j] < a[i])
+            j++;
+        else
+        {
+            cnt++;
+            i++;
+            j++;
+        }
+    }
+    return cnt;
+}
+
+// calls op(i, j) for each a[i] == b[j] of two sorted lists of unique values
+template <typename IndexType, typename Op>
+static inline void intersect_apply(const IndexType* a, IndexType na, const IndexType* b, IndexType nb, Op& op)
+{
+    IndexType i = 0, j = 0;
+    while (i < na && j < nb)
+    {
+        if (a[i] < b[j])
+            i++;
+        else if (b[j] < a[i])
+            j++;
+        else
+            op(i++, j++);
+    }
+}
+
+template <typename IndexType>
+TrianglesCountHost<IndexType>::TrianglesCountHost(IndexType n, IndexType nnz, const IndexType* row_offsets, const IndexType* col_indices)
+    : m_n(n), m_nnz(nnz), m_triangles_number(0)
+{
+    if (n < 0 || nnz < 0 || row_offsets == NULL || (nnz > 0 && col_indices == NULL))
+        FatalError("Wrong input in host triangles counting.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // undirected degrees, each edge is stored once below the diagonal
+    m_degree.assign(n, 0);
+    for (IndexType i = 0; i < n; i++)
+    {
+        for (IndexType e = row_offsets[i]; e < row_offsets[i + 1]; e++)
+        {
+            IndexType j = col_indices[e];
+            if (j < 0 || j >= n)
+                FatalError("Vertex index out of range in host triangles counting.", NVGRAPH_ERR_BAD_PARAMETERS);
+            if (j < i)
+            {
+                m_degree[i]++;
+                m_degree[j]++;
+            }
+        }
+    }
+
+    // rank = position in the (degree, id) order, counting sort on the degree
+    IndexType max_deg = n > 0 ? *std::max_element(m_degree.begin(), m_degree.end()) : 0;
+    std::vector<IndexType> bucket(max_deg + 2, 0);
+    for (IndexType i = 0; i < n; i++)
+        bucket[m_degree[i] + 1]++;
+    for (IndexType d = 0; d <= max_deg; d++)
+        bucket[d + 1] += bucket[d];
+    std::vector<IndexType> rank(n);
+    m_vertices.resize(n);
+    for (IndexType i = 0; i < n; i++)
+    {
+        rank[i] = bucket[m_degree[i]]++;
+        m_vertices[rank[i]] = i;
+    }
+
+    // oriented graph, from the lower to the higher rank
+    m_offsets.assign(n + 1, 0);
+    for (IndexType i = 0; i < n; i++)
+        for (IndexType e = row_offsets[i]; e < row_offsets[i + 1]; e++)
+        {
+            IndexType j = col_indices[e];
+            if (j < i)
+                m_offsets[std::min(rank[i], rank[j]) + 1]++;
+        }
+    for (IndexType i = 0; i < n; i++)
+        m_offsets[i + 1] += m_offsets[i];
+    m_indices.resize(m_offsets[n]);
+    m_edges.resize(m_offsets[n]);
+    std::vector<IndexType> pos(m_offsets.begin(), m_offsets.end() - 1);
+    for (IndexType i = 0; i < n; i++)
+        for (IndexType e = row_offsets[i]; e < row_offsets[i + 1]; e++)
+        {
+            IndexType j = col_indices[e];
+            if (j < i)
+            {
+                IndexType ri = rank[i], rj = rank[j];
+                IndexType p = pos[std::min(ri, rj)]++;
+                m_indices[p] = std::max(ri, rj);
+                m_edges[p] = e;
+            }
+        }
+
+    #pragma omp parallel
+    {
+        std::vector<std::pair<IndexType, IndexType> > list;
+        #pragma omp for schedule(dynamic, 256)
+        for (IndexType i = 0; i < n; i++)
+        {
+            list.clear();
+            for (IndexType k = m_offsets[i]; k < m_offsets[i + 1]; k++)
+                list.push_back(std::make_pair(m_indices[k], m_edges[k]));
+            std::sort(list.begin(), list.end());
+            for (IndexType k = m_offsets[i]; k < m_offsets[i + 1]; k++)
+            {
+                m_indices[k] = list[k - m_offsets[i]].first;
+                m_edges[k] = list[k - m_offsets[i]].second;
+            }
+        }
+    }
+}
+
+template <typename IndexType>
+NVGRAPH_ERROR TrianglesCountHost<IndexType>::count(IndexType hub_threshold)
+{
+    const IndexType n = m_n;
+    const IndexType* off = m_n > 0 ? &m_offsets[0] : NULL;
+    const IndexType* ind = m_indices.empty() ? NULL : &m_indices[0];
+    uint64_t total = 0;
+
+    #pragma omp parallel reduction(+:total)
+    {
+        // allocated on the first hub met by the thread
+        std::vector<uint64_t> bitmap;
+        // dynamic scheduling so that a few hubs do not serialize a thread
+        #pragma omp for schedule(dynamic, 64)
+        for (IndexType u = 0; u < n; u++)
+        {
+            IndexType du = off[u + 1] - off[u];
+            if (du < 2)
+                continue;
+            const IndexType* nu = ind + off[u];
+            if (du >= hub_threshold)
+            {
+                if (bitmap.empty())
+                    bitmap.assign((static_cast<size_t>(n) + 63) / 64, 0);
+                for (IndexType k = 0; k < du; k++)
+                    bitmap[nu[k] >> 6] |= (1ull << (nu[k] & 63));
+                for (IndexType k = 0; k < du; k++)
+                {
+                    IndexType v = nu[k];
+                    for (IndexType e = off[v]; e < off[v + 1]; e++)
+                        total += (bitmap[ind[e] >> 6] >> (ind[e] & 63)) & 1ull;
+                }
+                for (IndexType k = 0; k < du; k++)
+                    bitmap[nu[k] >> 6] = 0;
+            }
+            else
+            {
+                for (IndexType k = 0; k < du; k++)
+                {
+                    IndexType v = nu[k];
+                    total += intersect_count(nu + k + 1, du - k - 1, ind + off[v], off[v + 1] - off[v]);
+                }
+            }
+        }
+    }
+    m_triangles_number = total;
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType>
+NVGRAPH_ERROR TrianglesCountHost<IndexType>::count_per_vertex(uint64_t* triangles) const
+{
+    if (triangles == NULL)
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+    const IndexType n = m_n;
+    const IndexType* ind = m_indices.empty() ? NULL : &m_indices[0];
+    std::fill(triangles, triangles + n, 0);
+
+    // triangle u < v < w (by rank) is found once, from u
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (IndexType u = 0; u < n; u++)
+    {
+        const IndexType* nu = ind + m_offsets[u];
+        IndexType du = m_offsets[u + 1] - m_offsets[u];
+        for (IndexType k = 0; k + 1 < du; k++)
+        {
+            IndexType v = nu[k];
+            const IndexType* nv = ind + m_offsets[v];
+            struct Op
+            {
+                const IndexType* nv;
+                const IndexType* vertices;
+                uint64_t* triangles;
+                uint64_t cnt;
+                void operator()(IndexType, IndexType j)
+                {
+                    IndexType w = vertices[nv[j]];
+                    #pragma omp atomic
+                    triangles[w]++;
+                    cnt++;
+                }
+            } op = {nv, &m_vertices[0], triangles, 0};
+            intersect_apply(nu + k + 1, du - k - 1, nv, m_offsets[v + 1] - m_offsets[v], op);
+            if (op.cnt)
+            {
+                #pragma omp atomic
+                triangles[m_vertices[u]] += op.cnt;
+                #pragma omp atomic
+                triangles[m_vertices[v]] += op.cnt;
+            }
+        }
+    }
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType>
+template <typename ValueType>
+NVGRAPH_ERROR TrianglesCountHost<IndexType>::clustering_coefficient(uint64_t* triangles, ValueType* coefficients) const
+{
+    if (coefficients == NULL)
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+    std::vector<uint64_t> tmp;
+    if (triangles == NULL)
+    {
+        tmp.resize(m_n);
+        triangles = m_n > 0 ? &tmp[0] : NULL;
+    }
+    NVGRAPH_ERROR rc = count_per_vertex(triangles);
+    if (rc != NVGRAPH_OK)
+        return rc;
+    #pragma omp parallel for
+    for (IndexType v = 0; v < m_n; v++)
+    {
+        double d = static_cast<double>(m_degree[v]);
+        coefficients[v] = m_degree[v] < 2 ? ValueType(0) : static_cast<ValueType>(2.0 * triangles[v] / (d * (d - 1.0)));
+    }
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType>
+void TrianglesCountHost<IndexType>::oriented_support(std::vector<IndexType>& support) const
+{
+    const IndexType n = m_n;
+    const IndexType* ind = m_indices.empty() ? NULL : &m_indices[0];
+    support.assign(m_indices.size(), 0);
+    IndexType* sup = support.empty() ? NULL : &support[0];
+
+    // triangle u < v < w is found once from u, each of its three edges gets +1
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (IndexType u = 0; u < n; u++)
+    {
+        IndexType du = m_offsets[u + 1] - m_offsets[u];
+        const IndexType* nu = ind + m_offsets[u];
+        for (IndexType k = 0; k + 1 < du; k++)
+        {
+            IndexType v = nu[k];
+            struct Op
+            {
+                IndexType uw;   // first oriented edge (u,w) of the intersected range
+                IndexType vw;   // first oriented edge (v,w)
+                IndexType* sup;
+                IndexType cnt;
+                void operator()(IndexType i, IndexType j)
+                {
+                    #pragma omp atomic
+                    sup[uw + i]++;
+                    #pragma omp atomic
+                    sup[vw + j]++;
+                    cnt++;
+                }
+            } op = {m_offsets[u] + k + 1, m_offsets[v], sup, 0};
+            intersect_apply(nu + k + 1, du - k - 1, ind + m_offsets[v], m_offsets[v + 1] - m_offsets[v], op);
+            if (op.cnt)
+            {
+                #pragma omp atomic
+                sup[m_offsets[u] + k] += op.cnt;
+            }
+        }
+    }
+}
+
+template <typename IndexType>
+NVGRAPH_ERROR TrianglesCountHost<IndexType>::edge_support(IndexType* support) const
+{
+    if (support == NULL)
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+    std::vector<IndexType> sup;
+    oriented_support(sup);
+    std::fill(support, support + m_nnz, 0);
+    for (size_t k = 0; k < sup.size(); k++)
+        support[m_edges[k]] = sup[k];
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType>
+NVGRAPH_ERROR TrianglesCountHost<IndexType>::ktruss(IndexType* truss) const
+{
+    if (truss == NULL)
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+    const IndexType n = m_n;
+    const IndexType m = static_cast<IndexType>(m_indices.size());
+    std::vector<IndexType> sup;
+    oriented_support(sup);
+
+    // undirected adjacency (rank ids) with the oriented edge of each entry,
+    // in-neighbors (lower ranks) first then out-neighbors so that every list is sorted
+    std::vector<IndexType> adj_off(n + 1, 0), adj(2 * static_cast<size_t>(m)), adj_edge(2 * static_cast<size_t>(m));
+    std::vector<IndexType> src(m);
+    for (IndexType u = 0; u < n; u++)
+        for (IndexType k = m_offsets[u]; k < m_offsets[u + 1]; k++)
+        {
+            src[k] = u;
+            adj_off[u + 1]++;
+            adj_off[m_indices[k] + 1]++;
+        }
+    for (IndexType u = 0; u < n; u++)
+        adj_off[u + 1] += adj_off[u];
+    std::vector<IndexType> pos(adj_off.begin(), adj_off.end() - 1);
+    for (IndexType u = 0; u < n; u++)
+        for (IndexType k = m_offsets[u]; k < m_offsets[u + 1]; k++)
+        {
+            IndexType v = m_indices[k];
+            adj[pos[v]] = u;
+            adj_edge[pos[v]++] = k;
+        }
+    for (IndexType u = 0; u < n; u++)
+        for (IndexType k = m_offsets[u]; k < m_offsets[u + 1]; k++)
+        {
+            adj[pos[u]] = m_indices[k];
+            adj_edge[pos[u]++] = k;
+        }
+
+    // edges sorted by support (bucket queue), position of each edge in the queue
+    IndexType max_sup = m > 0 ? *std::max_element(sup.begin(), sup.end()) : 0;
+    std::vector<IndexType> bin(max_sup + 2, 0), order(m), where(m);
+    for (IndexType e = 0; e < m; e++)
+        bin[sup[e] + 1]++;
+    for (IndexType s = 0; s <= max_sup; s++)
+        bin[s + 1] += bin[s];
+    {
+        std::vector<IndexType> next(bin.begin(), bin.end() - 1);
+        for (IndexType e = 0; e < m; e++)
+        {
+            where[e] = next[sup[e]]++;
+            order[where[e]] = e;
+        }
+    }
+
+    std::vector<char> removed(m, 0);
+    std::vector<IndexType> t(m);
+    for (IndexType i = 0; i < m; i++)
+    {
+        IndexType e = order[i];
+        IndexType level = sup[e];
+        t[e] = level + 2;
+        IndexType u = src[e], v = m_indices[e];
+        // every triangle (u,v,w) still alive loses its two other edges
+        struct Op
+        {
+            const IndexType* eu;
+            const IndexType* ev;
+            const char* removed;
+            IndexType level;
+            IndexType* sup;
+            IndexType* bin;
+            IndexType* order;
+            IndexType* where;
+            void decrement(IndexType f)
+            {
+                if (sup[f] <= level)
+                    return;
+                // swap f with the first edge of its bucket, then shrink the bucket
+                IndexType s = sup[f];
+                IndexType g = order[bin[s]];
+                std::swap(order[where[f]], order[bin[s]]);
+                std::swap(where[f], where[g]);
+                bin[s]++;
+                sup[f]--;
+            }
+            void operator()(IndexType i, IndexType j)
+            {
+                if (removed[eu[i]] || removed[ev[j]])
+                    return;
+                decrement(eu[i]);
+                decrement(ev[j]);
+            }
+        } op = {&adj_edge[0] + adj_off[u], &adj_edge[0] + adj_off[v], &removed[0], level,
+                &sup[0], &bin[0], &order[0], &where[0]};
+        intersect_apply(&adj[0] + adj_off[u], adj_off[u + 1] - adj_off[u],
+                        &adj[0] + adj_off[v], adj_off[v + 1] - adj_off[v], op);
+        removed[e] = 1;
+    }
+
+    std::fill(truss, truss + m_nnz, 0);
+    for (IndexType k = 0; k < m; k++)
+        truss[m_edges[k]] = t[k];
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType>
+TrianglesCountSampling<IndexType>::TrianglesCountSampling(IndexType n, IndexType nnz, const IndexType* row_offsets, const IndexType* col_indices)
+    : m_n(n), m_estimate(0), m_lower(0), m_upper(0), m_samples(0)
+{
+    if (n < 0 || nnz < 0 || row_offsets == NULL || (nnz > 0 && col_indices == NULL))
+        FatalError("Wrong input in sampled triangles counting.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // lower neighbors come from the row, upper neighbors from the transpose
+    // filled by increasing row, so each list is sorted once its lower part is
+    std::vector<IndexType> lower(n, 0);
+    m_offsets.assign(n + 1, 0);
+    for (IndexType i = 0; i < n; i++)
+        for (IndexType e = row_offsets[i]; e < row_offsets[i + 1]; e++)
+        {
+            IndexType j = col_indices[e];
+            if (j < 0 || j >= n)
+                FatalError("Vertex index out of range in sampled triangles counting.", NVGRAPH_ERR_BAD_PARAMETERS);
+            if (j < i)
+            {
+                lower[i]++;
+                m_offsets[i + 1]++;
+                m_offsets[j + 1]++;
+            }
+        }
+    for (IndexType i = 0; i < n; i++)
+        m_offsets[i + 1] += m_offsets[i];
+    m_indices.resize(m_offsets[n]);
+    std::vector<IndexType> pos(n);
+    for (IndexType i = 0; i < n; i++)
+        pos[i] = m_offsets[i] + lower[i];
+    for (IndexType i = 0; i < n; i++)
+    {
+        IndexType p = m_offsets[i];
+        for (IndexType e = row_offsets[i]; e < row_offsets[i + 1]; e++)
+        {
+            IndexType j = col_indices[e];
+            if (j < i)
+            {
+                m_indices[p++] = j;
+                m_indices[pos[j]++] = i;
+            }
+        }
+        std::sort(m_indices.begin() + m_offsets[i], m_indices.begin() + p);
+    }
+
+    m_wedges.resize(n);
+    double w = 0.0;
+    for (IndexType i = 0; i < n; i++)
+    {
+        double d = static_cast<double>(m_offsets[i + 1] - m_offsets[i]);
+        w += d * (d - 1.0) / 2.0;
+        m_wedges[i] = w;
+    }
+}
+
+template <typename IndexType>
+inline bool TrianglesCountSampling<IndexType>::is_edge(IndexType u, IndexType v) const
+{
+    if (m_offsets[u + 1] - m_offsets[u] > m_offsets[v + 1] - m_offsets[v])
+        std::swap(u, v);
+    return std::binary_search(m_indices.begin() + m_offsets[u], m_indices.begin() + m_offsets[u + 1], v);
+}
+
+template <typename IndexType>
+NVGRAPH_ERROR TrianglesCountSampling<IndexType>::count(double error, double confidence, uint64_t seed)
+{
+    if (!(error > 0.0 && error < 1.0) || !(confidence > 0.0 && confidence < 1.0))
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+
+    const double total_wedges = m_n > 0 ? m_wedges[m_n - 1] : 0.0;
+    if (total_wedges == 0.0)
+    {
+        m_estimate = m_lower = m_upper = 0.0;
+        m_samples = 0;
+        return NVGRAPH_OK;
+    }
+
+    const uint64_t samples = static_cast<uint64_t>(std::ceil(std::log(2.0 / (1.0 - confidence)) / (2.0 * error * error)));
+    // fixed chunks with their own generator, the result does not depend on the scheduling
+    const int chunks = 256;
+    uint64_t closed = 0;
+
+    #pragma omp parallel for schedule(dynamic, 1) reduction(+:closed)
+    for (int c = 0; c < chunks; c++)
+    {
+        std::mt19937_64 gen(seed * chunks + c);
+        std::uniform_real_distribution<double> draw(0.0, total_wedges);
+        uint64_t begin = samples * c / chunks, end = samples * (c + 1) / chunks;
+        for (uint64_t s = begin; s < end; s++)
+        {
+            IndexType v = static_cast<IndexType>(std::upper_bound(m_wedges.begin(), m_wedges.end(), draw(gen)) - m_wedges.begin());
+            if (v >= m_n)
+                v = m_n - 1;
+            // skip the vertices with no wedge the rounding could land on
+            while (m_offsets[v + 1] - m_offsets[v] < 2)
+                v--;
+            uint64_t d = m_offsets[v + 1] - m_offsets[v];
+            uint64_t a = gen() % d, b = gen() % (d - 1);
+            if (b >= a)
+                b++;
+            closed += is_edge(m_indices[m_offsets[v] + a], m_indices[m_offsets[v] + b]) ? 1 : 0;
+        }
+    }
+
+    double kappa = static_cast<double>(closed) / static_cast<double>(samples);
+    m_samples = samples;
+    m_estimate = kappa * total_wedges / 3.0;
+    m_lower = std::max(0.0, kappa - error) * total_wedges / 3.0;
+    m_upper = std::min(1.0, kappa + error) * total_wedges / 3.0;
+    return NVGRAPH_OK;
+}
+
+template class TrianglesCountHost<int>;
+template class TrianglesCountSampling<int>;
+template NVGRAPH_ERROR TrianglesCountHost<int>::clustering_coefficient<float>(uint64_t* triangles, float* coefficients) const;
+template NVGRAPH_ERROR TrianglesCountHost<int>::clustering_coefficient<double>(uint64_t* triangles, double* coefficients) const;
+
+} // end namespace triangles_counting
+
+} // end namespace nvgraph
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+#include "nvgraph_error.hxx"
+#include "widest_path_host.hxx"
+
+namespace nvgraph
+{
+template <typename IndexType_, typename ValueType_>
+WidestPathHost<IndexType_, ValueType_>::WidestPathHost(IndexType n, IndexType nnz,
+                                                       const IndexType* csc_offsets,
+                                                       const IndexType* csc_indices,
+                                                       const ValueType* csc_values)
+    : m_n(n), m_nnz(nnz)
+{
+    if (n < 0 || nnz < 0 || csc_offsets == NULL || (nnz > 0 && (csc_indices == NULL || csc_values == NULL)))
+        FatalError("Wrong input in host widest path solver.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // the offsets and indices are checked before they are used to scatter
+    if (csc_offsets[0] != 0 || csc_offsets[n] != nnz)
+        FatalError("Wrong offsets in host widest path solver.", NVGRAPH_ERR_BAD_PARAMETERS);
+    for (IndexType v = 0; v < n; v++)
+        if (csc_offsets[v + 1] < csc_offsets[v])
+            FatalError("Wrong offsets in host widest path solver.", NVGRAPH_ERR_BAD_PARAMETERS);
+
+    // transpose the CSC: Dijkstra walks the out-going edges of the settled vertex
+    m_row_offsets.assign(n + 1, 0);
+    m_col_indices.resize(nnz);
+    m_values.resize(nnz);
+    for (IndexType e = 0; e < nnz; e++)
+    {
+        IndexType u = csc_indices[e];
+        if (u < 0 || u >= n)
+            FatalError("Vertex index out of range in host widest path solver.", NVGRAPH_ERR_BAD_PARAMETERS);
+        m_row_offsets[u + 1]++;
+    }
+    for (IndexType i = 0; i < n; i++)
+        m_row_offsets[i + 1] += m_row_offsets[i];
+    std::vector<IndexType> pos(m_row_offsets.begin(), m_row_offsets.end() - 1);
+    for (IndexType v = 0; v < n; v++)
+    {
+        for (IndexType e = csc_offsets[v]; e < csc_offsets[v + 1]; e++)
+        {
+            IndexType p = pos[csc_indices[e]]++;
+            m_col_indices[p] = v;
+            m_values[p] = csc_values[e];
+        }
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+void WidestPathHost<IndexType_, ValueType_>::solve_one(IndexType source, ValueType* result, std::vector<char>& done) const
+{
+    const ValueType max_val = std::numeric_limits<ValueType>::max();
+    std::fill(result, result + m_n, -max_val);
+    std::fill(done.begin(), done.end(), 0);
+
+    // max-heap on the width, stale entries are skipped when popped (lazy deletion)
+    typedef std::pair<ValueType, IndexType> HeapEntry;
+    std::priority_queue<HeapEntry> heap;
+    result[source] = max_val;
+    heap.push(HeapEntry(max_val, source));
+    while (!heap.empty())
+    {
+        HeapEntry top = heap.top();
+        heap.pop();
+        IndexType u = top.second;
+        if (done[u])
+            continue;
+        done[u] = 1;
+        for (IndexType e = m_row_offsets[u]; e < m_row_offsets[u + 1]; e++)
+        {
+            IndexType v = m_col_indices[e];
+            ValueType width = std::min(top.first, m_values[e]);
+            if (!done[v] && width > result[v])
+            {
+                result[v] = width;
+                heap.push(HeapEntry(width, v));
+            }
+        }
+    }
+}
+
+template <typename IndexType_, typename ValueType_>
+NVGRAPH_ERROR WidestPathHost<IndexType_, ValueType_>::solve(IndexType source, ValueType* result) const
+{
+    if (source < 0 || source >= m_n || result == NULL)
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+    std::vector<char> done(m_n);
+    solve_one(source, result, done);
+    return NVGRAPH_OK;
+}
+
+template <typename IndexType_, typename ValueType_>
+NVGRAPH_ERROR WidestPathHost<IndexType_, ValueType_>::solve(IndexType num_sources, const IndexType* sources, ValueType* result) const
+{
+    if (num_sources < 0 || (num_sources > 0 && (sources == NULL || result == NULL)))
+        return NVGRAPH_ERR_BAD_PARAMETERS;
+    for (IndexType s = 0; s < num_sources; s++)
+        if (sources[s] < 0 || sources[s] >= m_n)
+            return NVGRAPH_ERR_BAD_PARAMETERS;
+
+    #pragma omp parallel
+    {
+        // per thread work buffer, reused for all the sources handled by the thread
+        std::vector<char> done(m_n);
+        #pragma omp for schedule(dynamic, 1)
+        for (IndexType s = 0; s < num_sources; s++)
+            solve_one(sources[s], result + static_cast<size_t>(s) * m_n, done);
+    }
+    return NVGRAPH_OK;
+}
+
+template class WidestPathHost<int, float>;
+template class WidestPathHost<int, double>;
+} // end namespace nvgraph
@@ -1,6 +1,10 @@
 #include "gtest/gtest.h"
 #include "nvgraph.h"
+#include "2d_partitioning_host.hxx"
+#include "2d_distributed_host.hxx"
 #include <iostream>
+#include <thread>
+#include <vector>
 
 TEST(SimpleBFS2D, DummyTest) {
 	nvgraphHandle_t handle;
@@ -47,6 +51,103 @@ TEST(SimpleBFS2D, DummyTest) {
 	std::cout << "Test run!\n";
 }
 
+TEST(SimpleBFS2D, HostTest) {
+	int rowIds[38] = { 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5,
+			5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 8, 8 };
+	int colIds[38] = { 1, 2, 7, 8, 0, 2, 4, 7, 8, 0, 1, 3, 6, 8, 2, 4, 5, 6, 8, 1, 3, 5, 8, 3, 4, 6,
+			7, 2, 3, 5, 0, 1, 5, 0, 1, 2, 3, 4 };
+	int exp_pred[9] = {-1,0,0,2,1,7,2,0,0};
+	int exp_dist[9] = {0,1,1,2,2,2,2,1,1};
+	float values[38], x[9], y_ref[9];
+	for (int e = 0; e < 38; e++)
+		values[e] = 1.0f + e % 5;
+	for (int i = 0; i < 9; i++) {
+		x[i] = 0.5f * i - 1.0f;
+		y_ref[i] = 0.0f;
+	}
+	for (int e = 0; e < 38; e++)
+		y_ref[rowIds[e]] += values[e] * x[colIds[e]];
+
+	// the decomposition does not change the results, including with empty padding rows
+	for (int blockN = 1; blockN <= 4; blockN++) {
+		nvgraph::MatrixDecompositionDescriptionHost<int, int> descr(9, blockN, 38);
+		nvgraph::Matrix2dHost<int, int, float> matrix(descr, rowIds, colIds, values);
+
+		int distances[9], predecessors[9];
+		ASSERT_EQ(nvgraph::NVGRAPH_OK, matrix.traverse(0, distances, predecessors));
+		for (int i = 0; i < 9; i++) {
+			ASSERT_EQ(exp_pred[i], predecessors[i]);
+			ASSERT_EQ(exp_dist[i], distances[i]);
+		}
+
+		nvgraph::VertexData2DHost<int, int, float> vx(&descr), vy(&descr);
+		vx.setElements(x);
+		matrix.spmv(vx, vy);
+		float y[9];
+		vy.getElements(y);
+		for (int i = 0; i < 9; i++)
+			ASSERT_NEAR(y_ref[i], y[i], 1e-5);
+	}
+}
+
+TEST(SimpleBFS2D, DistributedHostTest) {
+	int rowIds[38] = { 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5,
+			5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 8, 8 };
+	int colIds[38] = { 1, 2, 7, 8, 0, 2, 4, 7, 8, 0, 1, 3, 6, 8, 2, 4, 5, 6, 8, 1, 3, 5, 8, 3, 4, 6,
+			7, 2, 3, 5, 0, 1, 5, 0, 1, 2, 3, 4 };
+	int exp_pred[9] = {-1,0,0,2,1,7,2,0,0};
+	int exp_dist[9] = {0,1,1,2,2,2,2,1,1};
+	// transposed transition matrix: entry (colIds[e], rowIds[e]) = 1/outdegree(rowIds[e])
+	int degree[9] = {0};
+	double weights[38], bookmark[9] = {0}, pr_ref[9];
+	for (int e = 0; e < 38; e++)
+		degree[rowIds[e]]++;
+	for (int e = 0; e < 38; e++)
+		weights[e] = 1.0 / degree[rowIds[e]];
+
+	// a rank per block, every rank is a thread of the loopback transport
+	for (int blockN = 1; blockN <= 3; blockN++) {
+		int ranks = blockN * blockN;
+		nvgraph::MatrixDecompositionDescriptionHost<int, int> descr(9, blockN, 38, 1);
+		nvgraph::LoopbackContext2dHost context(ranks);
+		std::vector<std::vector<int> > distances(ranks, std::vector<int>(9)), predecessors(ranks, std::vector<int>(9));
+		std::vector<std::vector<double> > pr(ranks, std::vector<double>(9));
+		std::vector<nvgraph::NVGRAPH_ERROR> status(ranks);
+		std::vector<size_t> bytes(ranks, 0);
+		std::vector<std::thread> threads;
+		for (int r = 0; r < ranks; r++)
+			threads.push_back(std::thread([&, r]() {
+				nvgraph::LoopbackTransport2dHost transport(&context, r);
+				nvgraph::Matrix2dDistributedHost<int, int, double> topology(descr, &transport, 38, rowIds, colIds, NULL);
+				topology.traverse(0, &distances[r][0], &predecessors[r][0]);
+				for (size_t l = 0; l < topology.getIterationBytes().size(); l++)
+					bytes[r] += topology.getIterationBytes()[l];
+				nvgraph::Matrix2dDistributedHost<int, int, double> matrix(descr, &transport, 38, colIds, rowIds, weights);
+				status[r] = matrix.pagerank(0.85, bookmark, NULL, 1e-6f, 100, &pr[r][0]);
+			}));
+		for (int r = 0; r < ranks; r++)
+			threads[r].join();
+
+		size_t total = 0;
+		for (int r = 0; r < ranks; r++) {
+			ASSERT_EQ(nvgraph::NVGRAPH_OK, status[r]);
+			for (int i = 0; i < 9; i++) {
+				ASSERT_EQ(exp_pred[i], predecessors[r][i]);
+				ASSERT_EQ(exp_dist[i], distances[r][i]);
+				if (blockN == 1)
+					pr_ref[i] = pr[0][i];
+				ASSERT_NEAR(pr_ref[i], pr[r][i], 1e-9);
+			}
+			total += bytes[r];
+		}
+		// a single rank exchanges nothing
+		if (blockN == 1)
+			ASSERT_EQ(0u, total);
+		else
+			ASSERT_GT(total, 0u);
+	}
+}
+
 int main(int argc, char **argv) {
 	::testing::InitGoogleTest(&argc, argv);
 	return RUN_ALL_TESTS();
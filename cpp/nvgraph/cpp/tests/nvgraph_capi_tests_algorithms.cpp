@@ -1436,6 +1436,103 @@ TEST_F(NVGraphCAPITests_SSSP_Sanity, SanityTreeFloat)
 }
 
 
+class NVGraphCAPITests_SsspMulti_Sanity : public ::testing::Test {
+  public:
+    nvgraphStatus_t status;
+    nvgraphHandle_t handle;
+    nvgraphTopologyType_t topo;
+    nvgraphGraphDescr_t g1;
+
+    NVGraphCAPITests_SsspMulti_Sanity() : handle(NULL) {}
+
+    static void SetupTestCase() {}
+    static void TearDownTestCase() {}
+    virtual void SetUp() {
+        topo = NVGRAPH_CSC_32;
+        nvgraphStatus_t status;
+        if (handle == NULL) {
+            status = nvgraphCreate(&handle);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        }
+    }
+    virtual void TearDown() {
+        if (handle != NULL) {
+            status = nvgraphDestroy(handle);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+            handle = NULL;
+        }
+    }
+
+// cycle graph, all weights = 1, shortest path from s to v = (v - s) mod n
+// more sources than the batch size so that several batches are solved
+    template <typename T>
+    void run_cycle_test()
+    {
+        int n = 100;
+        std::vector<int> offsets(n+1), neighborhood(n);
+        for (int i = 0; i < n; i++)
+        {
+            offsets[i] = i;
+            neighborhood[i] = (n - 1 + i) % n;
+        }
+        offsets[n] = n;
+        std::vector<T> edge_data(n, (T)1.0);
+        nvgraphCSCTopology32I_st topology = {n, n, &offsets[0], &neighborhood[0]};
+
+        g1 = NULL;
+        status = nvgraphCreateGraphDescr(handle, &g1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetGraphStructure(handle, g1, (void*)&topology, topo);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        cudaDataType_t type_e[1] = {nvgraph_Const<T>::Type};
+        status = nvgraphAllocateEdgeData(handle, g1, 1, type_e);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetEdgeData(handle, g1, (void*)&edge_data[0], 0);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        std::vector<int> sources;
+        for (int s = 0; s < n; s += 3)
+            sources.push_back(s);
+        int ns = static_cast<int>(sources.size());
+
+        // all destinations
+        std::vector<T> distances(n * ns);
+        status = nvgraphSsspMulti(handle, g1, 0, &sources[0], ns, NULL, 0, (void*)&distances[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        for (int v = 0; v < n; v++)
+            for (int j = 0; j < ns; j++)
+                ASSERT_NEAR((double)((v - sources[j] + n) % n), (double)distances[v * ns + j], nvgraph_Const<T>::tol) << "v=" << v << ", source=" << sources[j] << std::endl;
+
+        // filtered destinations
+        std::vector<int> destinations(3);
+        destinations[0] = 99; destinations[1] = 0; destinations[2] = 42;
+        std::vector<T> filtered(destinations.size() * ns);
+        status = nvgraphSsspMulti(handle, g1, 0, &sources[0], ns, &destinations[0], destinations.size(), (void*)&filtered[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        for (size_t d = 0; d < destinations.size(); d++)
+            for (int j = 0; j < ns; j++)
+                ASSERT_NEAR((double)distances[destinations[d] * ns + j], (double)filtered[d * ns + j], nvgraph_Const<T>::tol);
+
+        // out of range source
+        sources[0] = n;
+        status = nvgraphSsspMulti(handle, g1, 0, &sources[0], ns, NULL, 0, (void*)&distances[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+
+        status = nvgraphDestroyGraphDescr(handle, g1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+    }
+};
+
+TEST_F(NVGraphCAPITests_SsspMulti_Sanity, SanityCycleDouble)
+{
+    run_cycle_test<double>();
+}
+
+TEST_F(NVGraphCAPITests_SsspMulti_Sanity, SanityCycleFloat)
+{
+    run_cycle_test<float>();
+}
+
 class NVGraphCAPITests_WidestPath_Sanity : public ::testing::Test {
   public:
     nvgraphStatus_t status;
@@ -1595,6 +1692,252 @@ TEST_F(NVGraphCAPITests_WidestPath_Sanity, SanityTreeFloat)
     run_tree_test<float>();
 }
 
+class NVGraphCAPITests_WidestPathHost_Sanity : public ::testing::Test {
+  public:
+    nvgraphStatus_t status;
+    nvgraphHandle_t handle;
+    nvgraphGraphDescr_t g1;
+
+    NVGraphCAPITests_WidestPathHost_Sanity() : handle(NULL) {}
+
+    static void SetupTestCase() {}
+    static void TearDownTestCase() {}
+    virtual void SetUp() {
+        if (handle == NULL) {
+            status = nvgraphCreate(&handle);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        }
+    }
+    virtual void TearDown() {
+        if (handle != NULL) {
+            status = nvgraphDestroy(handle);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+            handle = NULL;
+        }
+    }
+
+// random graph, the host solver must match nvgraphWidestPath for every source of the batch
+    template <typename T>
+    void run_random_test()
+    {
+        int n = 500, nnz = 4000;
+        srand(42);
+        std::vector<int> src(nnz), dst(nnz);
+        std::vector<T> w(nnz);
+        std::vector<int> offsets(n+1, 0), neighborhood(nnz);
+        std::vector<T> edge_data(nnz);
+        for (int e = 0; e < nnz; e++)
+        {
+            src[e] = rand() % n;
+            dst[e] = rand() % n;
+            w[e] = (T)(rand() % 1000) / 10;
+            offsets[dst[e] + 1]++;
+        }
+        for (int i = 0; i < n; i++)
+            offsets[i+1] += offsets[i];
+        std::vector<int> pos(offsets.begin(), offsets.end() - 1);
+        for (int e = 0; e < nnz; e++)
+        {
+            int p = pos[dst[e]]++;
+            neighborhood[p] = src[e];
+            edge_data[p] = w[e];
+        }
+        nvgraphCSCTopology32I_st topology = {n, nnz, &offsets[0], &neighborhood[0]};
+
+        std::vector<int> sources;
+        for (int s = 0; s < n; s += 37)
+            sources.push_back(s);
+        int ns = static_cast<int>(sources.size());
+        std::vector<T> host_res(static_cast<size_t>(ns) * n);
+        status = nvgraphWidestPathHost(&topology, nvgraph_Const<T>::Type, (void*)&edge_data[0], &sources[0], ns, (void*)&host_res[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        g1 = NULL;
+        status = nvgraphCreateGraphDescr(handle, &g1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetGraphStructure(handle, g1, (void*)&topology, NVGRAPH_CSC_32);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        cudaDataType_t type_v[1] = {nvgraph_Const<T>::Type};
+        cudaDataType_t type_e[1] = {nvgraph_Const<T>::Type};
+        status = nvgraphAllocateVertexData(handle, g1, 1, type_v);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphAllocateEdgeData(handle, g1, 1, type_e);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetEdgeData(handle, g1, (void*)&edge_data[0], 0);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        std::vector<T> device_res(n);
+        for (int j = 0; j < ns; j++)
+        {
+            status = nvgraphWidestPath(handle, g1, 0, &sources[j], 0);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+            status = nvgraphGetVertexData(handle, g1, (void *)&device_res[0], 0);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+            for (int v = 0; v < n; v++)
+                ASSERT_EQ(device_res[v], host_res[static_cast<size_t>(j) * n + v]) << "v=" << v << ", source=" << sources[j] << std::endl;
+        }
+
+        status = nvgraphDestroyGraphDescr(handle, g1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        // out of range source
+        sources[0] = n;
+        status = nvgraphWidestPathHost(&topology, nvgraph_Const<T>::Type, (void*)&edge_data[0], &sources[0], ns, (void*)&host_res[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+        sources[0] = 0;
+
+        // malformed topologies: decreasing offsets, offsets[n] != nnz, index out of range
+        std::swap(offsets[1], offsets[2]);
+        if (offsets[1] != offsets[2])
+        {
+            status = nvgraphWidestPathHost(&topology, nvgraph_Const<T>::Type, (void*)&edge_data[0], &sources[0], ns, (void*)&host_res[0]);
+            ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+        }
+        std::swap(offsets[1], offsets[2]);
+        offsets[n]--;
+        status = nvgraphWidestPathHost(&topology, nvgraph_Const<T>::Type, (void*)&edge_data[0], &sources[0], ns, (void*)&host_res[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+        offsets[n]++;
+        neighborhood[0] = n;
+        status = nvgraphWidestPathHost(&topology, nvgraph_Const<T>::Type, (void*)&edge_data[0], &sources[0], ns, (void*)&host_res[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+    }
+};
+
+TEST_F(NVGraphCAPITests_WidestPathHost_Sanity, SanityRandomDouble)
+{
+    run_random_test<double>();
+}
+
+TEST_F(NVGraphCAPITests_WidestPathHost_Sanity, SanityRandomFloat)
+{
+    run_random_test<float>();
+}
+
+class NVGraphCAPITests_KrylovPagerankHost_Sanity : public ::testing::Test {
+  public:
+    nvgraphStatus_t status;
+    nvgraphHandle_t handle;
+    nvgraphGraphDescr_t g1;
+
+    NVGraphCAPITests_KrylovPagerankHost_Sanity() : handle(NULL) {}
+
+    static void SetupTestCase() {}
+    static void TearDownTestCase() {}
+    virtual void SetUp() {
+        if (handle == NULL) {
+            status = nvgraphCreate(&handle);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        }
+    }
+    virtual void TearDown() {
+        if (handle != NULL) {
+            status = nvgraphDestroy(handle);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+            handle = NULL;
+        }
+    }
+
+// random graph, the host solver must match nvgraphKrylovPagerank
+    template <typename T>
+    void run_random_test()
+    {
+        int n = 2000, nnz = 16000;
+        srand(42);
+        std::vector<int> src(nnz), dst(nnz), outdeg(n, 0);
+        std::vector<int> offsets(n+1, 0), neighborhood(nnz);
+        std::vector<T> edge_data(nnz), dangling(n, 0);
+        for (int e = 0; e < nnz; e++)
+        {
+            src[e] = rand() % n;
+            dst[e] = rand() % n;
+            outdeg[src[e]]++;
+            offsets[dst[e] + 1]++;
+        }
+        for (int i = 0; i < n; i++)
+        {
+            offsets[i+1] += offsets[i];
+            if (outdeg[i] == 0)
+                dangling[i] = 1;
+        }
+        std::vector<int> pos(offsets.begin(), offsets.end() - 1);
+        for (int e = 0; e < nnz; e++)
+        {
+            int p = pos[dst[e]]++;
+            neighborhood[p] = src[e];
+            edge_data[p] = (T)1.0 / outdeg[src[e]];
+        }
+        nvgraphCSCTopology32I_st topology = {n, nnz, &offsets[0], &neighborhood[0]};
+
+        T alpha = 0.85;
+        float tolerance = sizeof(T) > 4 ? 1e-8f : 1e-6f;
+        int max_iter = 150, ss_sz = 7;
+        std::vector<T> host_res(n);
+        status = nvgraphKrylovPagerankHost(&topology, nvgraph_Const<T>::Type, (void*)&edge_data[0], (void*)&alpha, (void*)&dangling[0],
+                                           tolerance, max_iter, ss_sz, 0, (void*)&host_res[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        g1 = NULL;
+        status = nvgraphCreateGraphDescr(handle, &g1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetGraphStructure(handle, g1, (void*)&topology, NVGRAPH_CSC_32);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        std::vector<T> device_res(n, (T)1.0/n);
+        cudaDataType_t type_v[2] = {nvgraph_Const<T>::Type, nvgraph_Const<T>::Type};
+        cudaDataType_t type_e[1] = {nvgraph_Const<T>::Type};
+        status = nvgraphAllocateVertexData(handle, g1, 2, type_v);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetVertexData(handle, g1, (void*)&dangling[0], 0);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetVertexData(handle, g1, (void*)&device_res[0], 1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphAllocateEdgeData(handle, g1, 1, type_e);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetEdgeData(handle, g1, (void*)&edge_data[0], 0);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphKrylovPagerank(handle, g1, 0, (void*)&alpha, 0, tolerance, max_iter, ss_sz, 0, 1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphGetVertexData(handle, g1, (void *)&device_res[0], 1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphDestroyGraphDescr(handle, g1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        T sum = 0, err = 0;
+        for (int v = 0; v < n; v++)
+        {
+            sum += host_res[v];
+            err += fabs(host_res[v] - device_res[v]);
+        }
+        ASSERT_NEAR(1.0, sum, 1e-4);
+        ASSERT_LE(err, sizeof(T) > 4 ? 1e-6 : 1e-3);
+
+        // starting from the solution
+        status = nvgraphKrylovPagerankHost(&topology, nvgraph_Const<T>::Type, (void*)&edge_data[0], (void*)&alpha, (void*)&dangling[0],
+                                           tolerance, max_iter, ss_sz, 1, (void*)&host_res[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        err = 0;
+        for (int v = 0; v < n; v++)
+            err += fabs(host_res[v] - device_res[v]);
+        ASSERT_LE(err, sizeof(T) > 4 ? 1e-6 : 1e-3);
+
+        // damping factor out of (0,1)
+        alpha = 1;
+        status = nvgraphKrylovPagerankHost(&topology, nvgraph_Const<T>::Type, (void*)&edge_data[0], (void*)&alpha, (void*)&dangling[0],
+                                           tolerance, max_iter, ss_sz, 0, (void*)&host_res[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+    }
+};
+
+TEST_F(NVGraphCAPITests_KrylovPagerankHost_Sanity, SanityRandomDouble)
+{
+    run_random_test<double>();
+}
+
+TEST_F(NVGraphCAPITests_KrylovPagerankHost_Sanity, SanityRandomFloat)
+{
+    run_random_test<float>();
+}
+
 
 class NVGraphCAPITests_Pagerank_Sanity : public ::testing::Test {
   public:
@@ -6,6 +6,9 @@
 #include "nvgraphP.h"
 #include "nvgraph.h"
 #include "nvgraph_experimental.h"
+#include "kmeans_host.hxx"
+#include "matrix_host.hxx"
+#include "lanczos_host.hxx"
 #include "stdlib.h"
 #include <algorithm>
 extern "C" {
@@ -630,6 +633,546 @@ INSTANTIATE_TEST_CASE_P(SmallCorrectnessCheck,
                                          )
                        );
 
+/****************************
+* HOST K-MEANS
+*****************************/
+
+class NVGraphCAPITests_KmeansHost_Sanity : public ::testing::Test {
+  public:
+    // well separated blobs around k centers, each blob must be one cluster
+    template <typename T>
+    void run_blobs(int k, int d)
+    {
+        int n = 200*k;
+        std::vector<T> obs(n*d);
+        std::vector<int> blob(n), codes(n), sizes(k);
+        std::vector<T> centroids(d*k);
+        for (int i = 0; i < n; i++)
+        {
+            blob[i] = i % k;
+            for (int j = 0; j < d; j++)
+                obs[i*d+j] = (T)(100*((blob[i] >> (j % 5)) & 1) + 1000*(j == 0 ? blob[i] : 0)) + (T)rand()/RAND_MAX;
+        }
+        T residual = 0;
+        int iters = 0;
+        ASSERT_EQ(NVGRAPH_OK, nvgraph::kmeans_host<int,T>(n, d, k, (T)1e-6, 100, &obs[0], &codes[0], &sizes[0], &centroids[0], &residual, &iters));
+
+        // same blob <=> same cluster
+        std::vector<int> cluster_of_blob(k, -1);
+        for (int i = 0; i < n; i++)
+        {
+            if (cluster_of_blob[blob[i]] < 0)
+                cluster_of_blob[blob[i]] = codes[i];
+            ASSERT_EQ(cluster_of_blob[blob[i]], codes[i]);
+        }
+        std::sort(cluster_of_blob.begin(), cluster_of_blob.end());
+        for (int c = 0; c < k; c++)
+        {
+            ASSERT_EQ(c, cluster_of_blob[c]);
+            ASSERT_EQ(200, sizes[c]);
+        }
+
+        // residual is the sum of squares of the distances to the returned centroids
+        double ref = 0;
+        for (int i = 0; i < n; i++)
+            for (int j = 0; j < d; j++)
+                ref += (obs[i*d+j]-centroids[codes[i]*d+j])*(obs[i*d+j]-centroids[codes[i]*d+j]);
+        ASSERT_NEAR(ref, residual, 1e-3*ref);
+    }
+};
+
+TEST_F(NVGraphCAPITests_KmeansHost_Sanity, HamerlyDouble)
+{
+    run_blobs<double>(8, 4);
+}
+
+TEST_F(NVGraphCAPITests_KmeansHost_Sanity, ElkanFloat)
+{
+    run_blobs<float>(KMEANS_HOST_ELKAN_THR + 5, 6);
+}
+
+TEST_F(NVGraphCAPITests_KmeansHost_Sanity, MiniBatchQuality)
+{
+    // overlapping gaussian-like mixture, mini-batch residual within 10% of full k-means
+    int n = 100000, d = 4, k = 12;
+    std::vector<double> obs(n*d), centers(20*d);
+    for (size_t j = 0; j < centers.size(); j++)
+        centers[j] = 10.0*rand()/RAND_MAX;
+    for (int i = 0; i < n; i++)
+    {
+        int c = rand() % 20;
+        for (int j = 0; j < d; j++)
+            obs[i*d+j] = centers[c*d+j] + (double)rand()/RAND_MAX + (double)rand()/RAND_MAX - 1.0;
+    }
+    std::vector<int> codes_full(n), codes_mb(n);
+    double residual_full = 0, residual_mb = 0;
+    int iters_full = 0, iters_mb = 0;
+    double start = second();
+    ASSERT_EQ(NVGRAPH_OK, nvgraph::kmeans_host<int,double>(n, d, k, 1e-4, 100, &obs[0], &codes_full[0], residual_full, iters_full));
+    double mid = second();
+    ASSERT_EQ(NVGRAPH_OK, nvgraph::kmeans_minibatch_host<int,double>(n, d, k, 1e-4, 300, KMEANS_HOST_BATCH, &obs[0], &codes_mb[0], residual_mb, iters_mb));
+    double stop = second();
+    if (PERF)
+    {
+        printf("&&&& PERF Time_kmeans_host_full %10.8f -ms\n", 1000.0*(mid-start));
+        printf("&&&& PERF Time_kmeans_host_minibatch %10.8f -ms\n", 1000.0*(stop-mid));
+    }
+
+    // residual is the one of the final assignment of every point
+    for (int i = 0; i < n; i++)
+    {
+        ASSERT_GE(codes_mb[i], 0);
+        ASSERT_LT(codes_mb[i], k);
+    }
+    ASSERT_LT(residual_mb, 1.1*residual_full);
+}
+
+TEST_F(NVGraphCAPITests_KmeansHost_Sanity, BadParameters)
+{
+    std::vector<double> obs(10);
+    std::vector<int> codes(10);
+    double residual;
+    int iters;
+    ASSERT_EQ(NVGRAPH_ERR_BAD_PARAMETERS, nvgraph::kmeans_host<int,double>(10, 1, 0, 0., 10, &obs[0], &codes[0], residual, iters));
+    ASSERT_EQ(NVGRAPH_ERR_BAD_PARAMETERS, nvgraph::kmeans_host<int,double>(10, 1, 2, -1., 10, &obs[0], &codes[0], residual, iters));
+}
+
+/****************************
+* HOST SPECTRAL CLUSTERING
+*****************************/
+
+class NVGraphCAPITests_SpectralClusteringHost_Sanity : public ::testing::Test {
+  public:
+    // ring of k cliques of size s, consecutive cliques joined by one edge
+    void ring_of_cliques(int k, int s, std::vector<int>& offsets, std::vector<int>& indices)
+    {
+        int n = k*s;
+        offsets.assign(1, 0);
+        indices.clear();
+        for (int v = 0; v < n; v++)
+        {
+            int c = v / s;
+            if (v % s == 0)
+                indices.push_back(((c+k-1) % k)*s + s-1);
+            for (int u = c*s; u < (c+1)*s; u++)
+                if (u != v)
+                    indices.push_back(u);
+            if (v % s == s-1)
+                indices.push_back(((c+1) % k)*s);
+            offsets.push_back(indices.size());
+        }
+    }
+
+    // batch > 0 clusters the eigenvectors with mini-batches of batch vertices
+    template <typename T>
+    void run_ring(nvgraphSpectralClusteringType_t algorithm, cudaDataType_t type, int batch = 0)
+    {
+        int k = 6, s = 16, n = k*s;
+        std::vector<int> offsets, indices;
+        ring_of_cliques(k, s, offsets, indices);
+        nvgraphCSRTopology32I_st topology = {n, (int)indices.size(), &offsets[0], &indices[0]};
+
+        struct SpectralClusteringParameter params;
+        // the constant vector is an eigenvector of the modularity matrix for eigenvalue 0, it
+        // carries no clustering information
+        params.n_clusters = k;
+        params.n_eig_vects = (algorithm == NVGRAPH_MODULARITY_MAXIMIZATION
+                              || algorithm == NVGRAPH_MODULARITY_MAXIMIZATION_BLOCK_LANCZOS
+                              || algorithm == NVGRAPH_MODULARITY_MAXIMIZATION_SUBSPACE) ? k-1 : k;
+        params.algorithm = algorithm;
+        params.evs_tolerance = 0.0f;
+        params.evs_max_iter = 0;
+        params.kmean_tolerance = 0.0f;
+        params.kmean_max_iter = 0;
+        params.opt = NULL;
+
+        std::vector<int> clustering(n);
+        std::vector<T> eig_vals(k), eig_vects(n*k);
+        if (batch > 0)
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphSpectralClusteringMiniBatchHost(&topology, type, NULL, &params, batch, &clustering[0], &eig_vals[0], &eig_vects[0]));
+        else
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphSpectralClusteringHost(&topology, type, NULL, &params, &clustering[0], &eig_vals[0], &eig_vects[0]));
+
+        // same clique <=> same cluster
+        std::vector<int> cluster_of_clique(k, -1);
+        for (int v = 0; v < n; v++)
+        {
+            if (cluster_of_clique[v/s] < 0)
+                cluster_of_clique[v/s] = clustering[v];
+            ASSERT_EQ(cluster_of_clique[v/s], clustering[v]);
+        }
+        std::sort(cluster_of_clique.begin(), cluster_of_clique.end());
+        for (int c = 0; c < k; c++)
+            ASSERT_EQ(c, cluster_of_clique[c]);
+    }
+};
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, LanczosPathLaplacian)
+{
+    // Laplacian of the path with n vertices has eigenvalues 2-2cos(pi*j/n)
+    int n = 2000, nev = 4;
+    std::vector<int> offsets(1, 0), indices;
+    for (int v = 0; v < n; v++)
+    {
+        if (v > 0)
+            indices.push_back(v-1);
+        if (v < n-1)
+            indices.push_back(v+1);
+        offsets.push_back(indices.size());
+    }
+    nvgraph::CsrMatrixHost<int,double> A(n, n, indices.size(), NULL, &offsets[0], &indices[0]);
+    nvgraph::LaplacianMatrixHost<int,double> L(A);
+    std::vector<double> eig_vals(nev), eig_vects(n*nev), Lx(n);
+    int iters = 0;
+    ASSERT_EQ(NVGRAPH_OK, nvgraph::computeSmallestEigenvectors_host<int,double>(L, nev, 100000, 40, 1e-10, false, iters, &eig_vals[0], &eig_vects[0]));
+    for (int j = 0; j < nev; j++)
+    {
+        ASSERT_NEAR(2.0-2.0*cos(M_PI*j/n), eig_vals[j], 1e-9);
+
+        // unit norm and small residual
+        double nrm = 0, res = 0;
+        L.mv(1.0, &eig_vects[j*n], 0.0, &Lx[0]);
+        for (int i = 0; i < n; i++)
+        {
+            nrm += eig_vects[j*n+i]*eig_vects[j*n+i];
+            res += (Lx[i]-eig_vals[j]*eig_vects[j*n+i])*(Lx[i]-eig_vals[j]*eig_vects[j*n+i]);
+        }
+        ASSERT_NEAR(1.0, nrm, 1e-8);
+        ASSERT_LT(sqrt(res), 1e-7);
+    }
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, BlockLanczosPathLaplacian)
+{
+    // same spectrum with blocks of 4 vectors
+    int n = 2000, nev = 4;
+    std::vector<int> offsets(1, 0), indices;
+    for (int v = 0; v < n; v++)
+    {
+        if (v > 0)
+            indices.push_back(v-1);
+        if (v < n-1)
+            indices.push_back(v+1);
+        offsets.push_back(indices.size());
+    }
+    nvgraph::CsrMatrixHost<int,double> A(n, n, indices.size(), NULL, &offsets[0], &indices[0]);
+    nvgraph::LaplacianMatrixHost<int,double> L(A);
+    std::vector<double> eig_vals(nev), eig_vects(n*nev), Lx(n);
+    int iters = 0;
+    ASSERT_EQ(NVGRAPH_OK, nvgraph::computeSmallestEigenvectors_block_host<int,double>(L, nev, 4, 100000, 64, 1e-10, iters, &eig_vals[0], &eig_vects[0]));
+    for (int j = 0; j < nev; j++)
+    {
+        ASSERT_NEAR(2.0-2.0*cos(M_PI*j/n), eig_vals[j], 1e-9);
+        double res = 0;
+        L.mv(1.0, &eig_vects[j*n], 0.0, &Lx[0]);
+        for (int i = 0; i < n; i++)
+            res += (Lx[i]-eig_vals[j]*eig_vects[j*n+i])*(Lx[i]-eig_vals[j]*eig_vects[j*n+i]);
+        ASSERT_LT(sqrt(res), 1e-7);
+    }
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, LobpcgPathLaplacian)
+{
+    // same spectrum with LOBPCG and the aggregation preconditioner
+    int n = 2000, nev = 4;
+    std::vector<int> offsets(1, 0), indices;
+    for (int v = 0; v < n; v++)
+    {
+        if (v > 0)
+            indices.push_back(v-1);
+        if (v < n-1)
+            indices.push_back(v+1);
+        offsets.push_back(indices.size());
+    }
+    nvgraph::CsrMatrixHost<int,double> A(n, n, indices.size(), NULL, &offsets[0], &indices[0]);
+    nvgraph::LaplacianMatrixHost<int,double> L(A);
+    nvgraph::AggregationPreconditionerHost<int,double> M(A);
+    L.prec_setup(&M);
+    std::vector<double> eig_vals(nev), eig_vects(n*nev), Lx(n);
+    int iters = 0;
+    ASSERT_EQ(NVGRAPH_OK, nvgraph::computeSmallestEigenvectors_lobpcg_host<int,double>(L, nev, 1000, 1e-10, iters, &eig_vals[0], &eig_vects[0]));
+    ASSERT_LT(iters, 400);
+    for (int j = 0; j < nev; j++)
+    {
+        ASSERT_NEAR(2.0-2.0*cos(M_PI*j/n), eig_vals[j], 1e-9);
+        double res = 0;
+        L.mv(1.0, &eig_vects[j*n], 0.0, &Lx[0]);
+        for (int i = 0; i < n; i++)
+            res += (Lx[i]-eig_vals[j]*eig_vects[j*n+i])*(Lx[i]-eig_vals[j]*eig_vects[j*n+i]);
+        ASSERT_LT(sqrt(res), 1e-7);
+    }
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, BalancedCutDouble)
+{
+    run_ring<double>(NVGRAPH_BALANCED_CUT_LANCZOS, CUDA_R_64F);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, ModularityFloat)
+{
+    run_ring<float>(NVGRAPH_MODULARITY_MAXIMIZATION, CUDA_R_32F);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, BalancedCutBlockDouble)
+{
+    run_ring<double>(NVGRAPH_BALANCED_CUT_BLOCK_LANCZOS, CUDA_R_64F);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, ModularityBlockFloat)
+{
+    run_ring<float>(NVGRAPH_MODULARITY_MAXIMIZATION_BLOCK_LANCZOS, CUDA_R_32F);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, BalancedCutSubspaceDouble)
+{
+    run_ring<double>(NVGRAPH_BALANCED_CUT_SUBSPACE, CUDA_R_64F);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, ModularitySubspaceFloat)
+{
+    run_ring<float>(NVGRAPH_MODULARITY_MAXIMIZATION_SUBSPACE, CUDA_R_32F);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, BalancedCutMultilevelDouble)
+{
+    run_ring<double>(NVGRAPH_BALANCED_CUT_MULTILEVEL, CUDA_R_64F);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, BalancedCutLobpcgDouble)
+{
+    run_ring<double>(NVGRAPH_BALANCED_CUT_LOBPCG, CUDA_R_64F);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, BalancedCutMiniBatchDouble)
+{
+    run_ring<double>(NVGRAPH_BALANCED_CUT_LANCZOS, CUDA_R_64F, 32);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, ModularityMiniBatchFloat)
+{
+    run_ring<float>(NVGRAPH_MODULARITY_MAXIMIZATION, CUDA_R_32F, 32);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, BalancedCutMultilevelGrid)
+{
+    // 4 parts of a 64x64 grid: the quadrants cut 128 edges
+    int a = 64, n = a*a, k = 4;
+    std::vector<int> offsets(1, 0), indices;
+    for (int i = 0; i < a; i++)
+        for (int j = 0; j < a; j++)
+        {
+            if (i > 0)
+                indices.push_back((i-1)*a + j);
+            if (j > 0)
+                indices.push_back(i*a + j-1);
+            if (j < a-1)
+                indices.push_back(i*a + j+1);
+            if (i < a-1)
+                indices.push_back((i+1)*a + j);
+            offsets.push_back(indices.size());
+        }
+    nvgraphCSRTopology32I_st topology = {n, (int)indices.size(), &offsets[0], &indices[0]};
+
+    struct SpectralClusteringParameter params;
+    params.n_clusters = k;
+    params.n_eig_vects = k;
+    params.algorithm = NVGRAPH_BALANCED_CUT_MULTILEVEL;
+    params.evs_tolerance = 0.0f;
+    params.evs_max_iter = 0;
+    params.kmean_tolerance = 0.0f;
+    params.kmean_max_iter = 0;
+    params.opt = NULL;
+
+    std::vector<int> clustering(n);
+    std::vector<float> eig_vals(k), eig_vects(n*k);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphSpectralClusteringHost(&topology, CUDA_R_32F, NULL, &params, &clustering[0], &eig_vals[0], &eig_vects[0]));
+
+    // parts within 3% of n/k (plus one vertex), cut within twice the optimum
+    std::vector<int> sizes(k, 0);
+    int cut = 0;
+    for (int v = 0; v < n; v++)
+    {
+        ASSERT_GE(clustering[v], 0);
+        ASSERT_LT(clustering[v], k);
+        sizes[clustering[v]]++;
+        for (int e = offsets[v]; e < offsets[v+1]; e++)
+            if (clustering[indices[e]] != clustering[v])
+                cut++;
+    }
+    for (int c = 0; c < k; c++)
+        ASSERT_LE(sizes[c], (int)(1.03*n/k) + 1);
+    ASSERT_LE(cut/2, 256);
+}
+
+TEST_F(NVGraphCAPITests_SpectralClusteringHost_Sanity, BadParameters)
+{
+    std::vector<int> offsets, indices;
+    ring_of_cliques(2, 4, offsets, indices);
+    nvgraphCSRTopology32I_st topology = {8, (int)indices.size(), &offsets[0], &indices[0]};
+    struct SpectralClusteringParameter params = {2, 2, NVGRAPH_BALANCED_CUT_LANCZOS, 0.0f, 0, 0.0f, 0, NULL};
+    std::vector<int> clustering(8);
+    std::vector<double> eig_vals(2), eig_vects(16);
+    params.n_clusters = 1;
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphSpectralClusteringHost(&topology, CUDA_R_64F, NULL, &params, &clustering[0], &eig_vals[0], &eig_vects[0]));
+    params.n_clusters = 2;
+    params.algorithm = NVGRAPH_BALANCED_CUT_LOBPCG;
+    int prec = 3;
+    params.opt = &prec;
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphSpectralClusteringHost(&topology, CUDA_R_64F, NULL, &params, &clustering[0], &eig_vals[0], &eig_vects[0]));
+    params.opt = NULL;
+    params.n_clusters = 3;
+    params.n_eig_vects = 3;
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphSpectralClusteringHost(&topology, CUDA_R_64F, NULL, &params, &clustering[0], &eig_vals[0], &eig_vects[0]));
+    params.n_clusters = 2;
+    params.n_eig_vects = 2;
+    params.algorithm = NVGRAPH_BALANCED_CUT_LANCZOS;
+    ASSERT_EQ(NVGRAPH_STATUS_TYPE_NOT_SUPPORTED, nvgraphSpectralClusteringHost(&topology, CUDA_R_32I, NULL, &params, &clustering[0], &eig_vals[0], &eig_vects[0]));
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphSpectralClusteringMiniBatchHost(&topology, CUDA_R_64F, NULL, &params, -1, &clustering[0], &eig_vals[0], &eig_vects[0]));
+    params.algorithm = NVGRAPH_BALANCED_CUT_MULTILEVEL;
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphSpectralClusteringMiniBatchHost(&topology, CUDA_R_64F, NULL, &params, 4, &clustering[0], &eig_vals[0], &eig_vects[0]));
+}
+
+/****************************
+* CLUSTERING ANALYSIS
+*****************************/
+
+class NVGraphCAPITests_AnalyzeClusteringAll_Sanity : public ::testing::Test {
+  public:
+    nvgraphStatus_t status;
+    nvgraphHandle_t handle;
+
+    NVGraphCAPITests_AnalyzeClusteringAll_Sanity() : handle(NULL) {}
+
+    static void SetupTestCase() {}
+    static void TearDownTestCase() {}
+    virtual void SetUp() {
+        if (handle == NULL) {
+            status = nvgraphCreate(&handle);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        }
+    }
+    virtual void TearDown() {
+        if (handle != NULL) {
+            status = nvgraphDestroy(handle);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+            handle = NULL;
+        }
+    }
+
+// ring of 4 cliques of 5 vertices, one cluster per clique: each cluster has
+// volume 5*4+2 and cut 2, the total volume is 88
+    template <typename T>
+    void run_ring_test()
+    {
+        int k = 4, s = 5, n = k*s;
+        std::vector<int> offsets(1, 0), indices;
+        for (int v = 0; v < n; v++)
+        {
+            int c = v / s;
+            if (v % s == 0)
+                indices.push_back(((c+k-1) % k)*s + s-1);
+            for (int u = c*s; u < (c+1)*s; u++)
+                if (u != v)
+                    indices.push_back(u);
+            if (v % s == s-1)
+                indices.push_back(((c+1) % k)*s);
+            offsets.push_back(indices.size());
+        }
+        int nnz = indices.size();
+        std::vector<T> weights(nnz, (T)1.0);
+        std::vector<int> clustering(n);
+        for (int v = 0; v < n; v++)
+            clustering[v] = v / s;
+
+        nvgraphGraphDescr_t g1 = NULL;
+        status = nvgraphCreateGraphDescr(handle, &g1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        nvgraphCSRTopology32I_st topology = {n, nnz, &offsets[0], &indices[0]};
+        status = nvgraphSetGraphStructure(handle, g1, (void*)&topology, NVGRAPH_CSR_32);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        cudaDataType_t type_e[1] = {nvgraph_Const<T>::Type};
+        status = nvgraphAllocateEdgeData(handle, g1, 1, type_e);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetEdgeData(handle, g1, (void *)&weights[0], 0);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        // one extra empty cluster
+        struct nvgraphClusteringScores scores;
+        std::vector<int> sizes(k+1);
+        std::vector<float> volumes(k+1), cuts(k+1), conductances(k+1);
+        status = nvgraphAnalyzeClusteringAll(handle, g1, 0, k+1, &clustering[0], &scores, &sizes[0], &volumes[0], &cuts[0], &conductances[0]);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        for (int c = 0; c < k; c++)
+        {
+            EXPECT_EQ(s, sizes[c]);
+            EXPECT_FLOAT_EQ(22.0f, volumes[c]);
+            EXPECT_FLOAT_EQ(2.0f, cuts[c]);
+            EXPECT_FLOAT_EQ(2.0f/22, conductances[c]);
+        }
+        EXPECT_EQ(0, sizes[k]);
+        EXPECT_FLOAT_EQ(0.0f, conductances[k]);
+        EXPECT_NEAR(4*(20.0/88 - (22.0/88)*(22.0/88)), scores.modularity, 1e-6);
+        EXPECT_FLOAT_EQ(4.0f, scores.edge_cut);
+        EXPECT_FLOAT_EQ(4*2.0f/5, scores.ratio_cut);
+        EXPECT_FLOAT_EQ(4*2.0f/22, scores.normalized_cut);
+
+        // same scores as one metric at a time
+        float score;
+        status = nvgraphAnalyzeClustering(handle, g1, 0, k, &clustering[0], NVGRAPH_MODULARITY, &score);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        EXPECT_FLOAT_EQ(scores.modularity, score);
+        status = nvgraphAnalyzeClustering(handle, g1, 0, k, &clustering[0], NVGRAPH_EDGE_CUT, &score);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        EXPECT_FLOAT_EQ(scores.edge_cut, score);
+        status = nvgraphAnalyzeClustering(handle, g1, 0, k, &clustering[0], NVGRAPH_RATIO_CUT, &score);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        EXPECT_FLOAT_EQ(scores.ratio_cut, score);
+
+        // the table is optional
+        status = nvgraphAnalyzeClusteringAll(handle, g1, 0, k, &clustering[0], &scores, NULL, NULL, NULL, NULL);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        // assignment out of range
+        clustering[n-1] = k;
+        status = nvgraphAnalyzeClusteringAll(handle, g1, 0, k, &clustering[0], &scores, NULL, NULL, NULL, NULL);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+        clustering[n-1] = k-1;
+
+        status = nvgraphDestroyGraphDescr(handle, g1);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        // unsupported topology: the single metric entry point keeps its former statuses
+        nvgraphGraphDescr_t g2 = NULL;
+        status = nvgraphCreateGraphDescr(handle, &g2);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        nvgraphCSCTopology32I_st csc_topology = {n, nnz, &offsets[0], &indices[0]};
+        status = nvgraphSetGraphStructure(handle, g2, (void*)&csc_topology, NVGRAPH_CSC_32);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphAllocateEdgeData(handle, g2, 1, type_e);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphSetEdgeData(handle, g2, (void *)&weights[0], 0);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphAnalyzeClustering(handle, g2, 0, k, &clustering[0], NVGRAPH_MODULARITY, &score);
+        ASSERT_EQ(NVGRAPH_STATUS_GRAPH_TYPE_NOT_SUPPORTED, status);
+        status = nvgraphAnalyzeClustering(handle, g2, 0, k, &clustering[0], NVGRAPH_EDGE_CUT, &score);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+        status = nvgraphAnalyzeClusteringAll(handle, g2, 0, k, &clustering[0], &scores, NULL, NULL, NULL, NULL);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+        status = nvgraphDestroyGraphDescr(handle, g2);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+    }
+};
+
+TEST_F(NVGraphCAPITests_AnalyzeClusteringAll_Sanity, RingDouble)
+{
+    run_ring_test<double>();
+}
+
+TEST_F(NVGraphCAPITests_AnalyzeClusteringAll_Sanity, RingFloat)
+{
+    run_ring_test<float>();
+}
+
 int main(int argc, char **argv) 
 {
     srand(42);
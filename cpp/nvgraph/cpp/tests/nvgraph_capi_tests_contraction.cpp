@@ -8,11 +8,18 @@
 #include <sstream>
 #include <string>
 #include <cstdio>
+#include <cmath>
+#include <cstring>
 
 #include "gtest/gtest.h"
+#include "nvgraph_test_common.h"
 #include "valued_csr_graph.hxx"
 #include "nvgraphP.h"
 #include "nvgraph.h"
+#include "nvgraph_experimental.h"
+
+// Run with --perf to print the device and host contraction times
+static int PERF = 0;
 
 //annonymus:
 namespace{
@@ -210,6 +217,51 @@ bool check_delta_invariant(const Vector& r1, const Vector& r2)
 
   return (d1 == d2);
 }
+
+//read back a contracted graph with nsets float vertex and edge sets
+//
+void get_contracted_graph(nvgraphHandle_t handle,
+                          nvgraphGraphDescr_t descr,
+                          int nsets,
+                          std::vector<int>& row_offsets,
+                          std::vector<int>& col_indices,
+                          std::vector<std::vector<float> >& vvals,
+                          std::vector<std::vector<float> >& evals)
+{
+  nvgraphCSRTopology32I_st tData;
+  tData.source_offsets=NULL;
+  tData.destination_indices=NULL;
+  ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphGetGraphStructure(handle, descr, (void*) &tData, NULL));
+
+  row_offsets.assign(tData.nvertices+1, 0);
+  col_indices.assign(tData.nedges, 0);
+  tData.source_offsets = &row_offsets[0];
+  tData.destination_indices = col_indices.empty() ? NULL : &col_indices[0];
+  ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphGetGraphStructure(handle, descr, (void*) &tData, NULL));
+
+  vvals.assign(nsets, std::vector<float>(tData.nvertices));
+  evals.assign(nsets, std::vector<float>(tData.nedges));
+  for(int i=0;i<nsets;++i)
+    {
+      ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphGetVertexData(handle, descr, (void *)&vvals[i][0], i));
+      if( tData.nedges > 0 )
+        {
+          ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphGetEdgeData(handle, descr, (void *)&evals[i][0], i));
+        }
+    }
+}
+
+//host and device reductions may be done in different orders
+//
+bool check_close(const std::vector<float>& v1, const std::vector<float>& v2)
+{
+  if( v1.size() != v2.size() )
+    return false;
+  for(size_t i=0;i<v1.size();++i)
+    if( v1[i] != v2[i] && !(std::fabs(v1[i]-v2[i]) <= 1e-5f*std::max(std::fabs(v1[i]), std::fabs(v2[i]))) )
+      return false;
+  return true;
+}
 }
 
 
@@ -659,8 +711,193 @@ TEST_F(NvgraphCAPITests_ContractionCSR, CSRContractionNetworkX)
       }
 }
 
+TEST_F(NvgraphCAPITests_ContractionCSR, CSRContractionHostVsDevice)
+{
+    nvgraphStatus_t status;
+    int aggregates[] = {0, 1, 1, 0, 2};
+    size_t szaggregates = 5;
+
+    for(int op=0; op<4*4*4*4; ++op)
+    {
+        nvgraphSemiringOps_t vCombine = (nvgraphSemiringOps_t)(op & 3);
+        nvgraphSemiringOps_t vReduce  = (nvgraphSemiringOps_t)((op >> 2) & 3);
+        nvgraphSemiringOps_t eCombine = (nvgraphSemiringOps_t)((op >> 4) & 3);
+        nvgraphSemiringOps_t eReduce  = (nvgraphSemiringOps_t)((op >> 6) & 3);
+
+        nvgraphGraphDescr_t device_graph = NULL, host_graph = NULL;
+        status = nvgraphCreateGraphDescr(nvgraph_handle, &device_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphCreateGraphDescr(nvgraph_handle, &host_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        status = nvgraphContractGraph(nvgraph_handle, initial_graph, device_graph,
+                                      aggregates, szaggregates,
+                                      vCombine, vReduce, eCombine, eReduce, 0);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphContractGraphHost(nvgraph_handle, initial_graph, host_graph,
+                                          aggregates, szaggregates,
+                                          vCombine, vReduce, eCombine, eReduce, 0);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        std::vector<int> d_ro, d_ci, h_ro, h_ci;
+        std::vector<std::vector<float> > d_vv, d_ev, h_vv, h_ev;
+        get_contracted_graph(nvgraph_handle, device_graph, 2, d_ro, d_ci, d_vv, d_ev);
+        get_contracted_graph(nvgraph_handle, host_graph, 2, h_ro, h_ci, h_vv, h_ev);
+
+        ASSERT_EQ(d_ro, h_ro);
+        ASSERT_EQ(d_ci, h_ci);
+        for(int i=0;i<2;++i)
+        {
+            EXPECT_TRUE(check_close(d_vv[i], h_vv[i])) << "operators " << op << ", vertex set " << i;
+            EXPECT_TRUE(check_close(d_ev[i], h_ev[i])) << "operators " << op << ", edge set " << i;
+        }
+
+        status = nvgraphDestroyGraphDescr(nvgraph_handle, device_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphDestroyGraphDescr(nvgraph_handle, host_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+    }
+
+    //same validation of the aggregates as the device path
+    {
+        nvgraphGraphDescr_t temp_graph = NULL;
+        status = nvgraphCreateGraphDescr(nvgraph_handle, &temp_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        int bad_aggregates[] = {0, 0, 1, 1, 3};
+        status = nvgraphContractGraphHost(nvgraph_handle, initial_graph, temp_graph,
+                                          bad_aggregates, 5,
+                                          NVGRAPH_MULTIPLY, NVGRAPH_SUM, NVGRAPH_MULTIPLY, NVGRAPH_SUM, 0);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+        status = nvgraphContractGraphHost(nvgraph_handle, initial_graph, temp_graph,
+                                          bad_aggregates, 3,
+                                          NVGRAPH_MULTIPLY, NVGRAPH_SUM, NVGRAPH_MULTIPLY, NVGRAPH_SUM, 0);
+        ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+
+        status = nvgraphDestroyGraphDescr(nvgraph_handle, temp_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+    }
+}
+
+TEST_F(NvgraphCAPITests_ContractionCSR, CSRContractionHostNetworkX)
+{
+    nvgraphStatus_t status;
+
+    std::string fname("/mnt/nvgraph_test_data/graphs/networkx/ctr_test.dat");
+
+    std::vector<int> g_row_offsets;
+    std::vector<int> g_col_indices;
+    std::vector<int> aggregates;
+    std::vector<int> cg_row_offsets;
+    std::vector<int> cg_col_indices;
+
+    try{
+        fill_contraction_data(fname,
+                              g_row_offsets,
+                              g_col_indices,
+                              aggregates,
+                              cg_row_offsets,
+                              cg_col_indices);
+    }
+    catch( const std::exception& ex )
+      {
+        //same as CSRContractionNetworkX: no data set, nothing to compare
+        std::cerr<< "Exception:"<<ex.what()<<std::endl;
+        return;
+      }
+    ASSERT_EQ( g_row_offsets.empty(), false);
+    ASSERT_EQ(    aggregates.empty(), false);
+
+    nvgraphGraphDescr_t netx_graph = NULL;
+    status = nvgraphCreateGraphDescr(nvgraph_handle, &netx_graph);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+    nvgraphCSRTopology32I_st topoData;
+    topoData.nvertices = g_row_offsets.size()-1;
+    topoData.nedges = g_col_indices.size();
+    topoData.source_offsets      = &g_row_offsets[0];
+    topoData.destination_indices = &g_col_indices[0];
+    status = nvgraphSetGraphStructure(nvgraph_handle, netx_graph, (void*) &topoData, NVGRAPH_CSR_32);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+    std::vector<float> vdata(topoData.nvertices);
+    std::vector<float> edata(topoData.nedges);
+    for(int i=0;i<topoData.nvertices;++i)
+      vdata[i] = (float)(i % 7) + 0.5f;
+    for(int i=0;i<topoData.nedges;++i)
+      edata[i] = (float)(i % 13) + 0.25f;
+    cudaDataType_t type_v[] = {CUDA_R_32F};
+    cudaDataType_t type_e[] = {CUDA_R_32F};
+    status = nvgraphAllocateVertexData(nvgraph_handle, netx_graph, 1, type_v);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+    status = nvgraphSetVertexData(nvgraph_handle, netx_graph, (void *)&vdata[0], 0);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+    status = nvgraphAllocateEdgeData(nvgraph_handle, netx_graph, 1, type_e);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+    status = nvgraphSetEdgeData(nvgraph_handle, netx_graph, (void *)&edata[0], 0);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+    nvgraphSemiringOps_t ops[][4] = {{NVGRAPH_MULTIPLY, NVGRAPH_SUM, NVGRAPH_MULTIPLY, NVGRAPH_SUM},
+                                     {NVGRAPH_SUM, NVGRAPH_MAX, NVGRAPH_SUM, NVGRAPH_MIN}};
+    for(int k=0;k<2;++k)
+    {
+        nvgraphGraphDescr_t device_graph = NULL, host_graph = NULL;
+        status = nvgraphCreateGraphDescr(nvgraph_handle, &device_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphCreateGraphDescr(nvgraph_handle, &host_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        cudaDeviceSynchronize();
+        double start = second();
+        status = nvgraphContractGraph(nvgraph_handle, netx_graph, device_graph,
+                                      &aggregates[0], aggregates.size(),
+                                      ops[k][0], ops[k][1], ops[k][2], ops[k][3], 0);
+        cudaDeviceSynchronize();
+        double device_time = second() - start;
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        start = second();
+        status = nvgraphContractGraphHost(nvgraph_handle, netx_graph, host_graph,
+                                          &aggregates[0], aggregates.size(),
+                                          ops[k][0], ops[k][1], ops[k][2], ops[k][3], 0);
+        cudaDeviceSynchronize();
+        double host_time = second() - start;
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+        if (PERF)
+        {
+            printf("&&&& PERF Time_contraction_%d_device %10.8f -ms\n", k, 1000.0*device_time);
+            printf("&&&& PERF Time_contraction_%d_host %10.8f -ms\n", k, 1000.0*host_time);
+        }
+
+        std::vector<int> d_ro, d_ci, h_ro, h_ci;
+        std::vector<std::vector<float> > d_vv, d_ev, h_vv, h_ev;
+        get_contracted_graph(nvgraph_handle, device_graph, 1, d_ro, d_ci, d_vv, d_ev);
+        get_contracted_graph(nvgraph_handle, host_graph, 1, h_ro, h_ci, h_vv, h_ev);
+
+        ASSERT_EQ(d_ro, h_ro);
+        ASSERT_EQ(d_ci, h_ci);
+        ASSERT_EQ( check_delta_invariant( cg_row_offsets, h_ro ), true);
+        EXPECT_TRUE(check_close(d_vv[0], h_vv[0]));
+        EXPECT_TRUE(check_close(d_ev[0], h_ev[0]));
+
+        status = nvgraphDestroyGraphDescr(nvgraph_handle, device_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        status = nvgraphDestroyGraphDescr(nvgraph_handle, host_graph);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+    }
+
+    status = nvgraphDestroyGraphDescr(nvgraph_handle, netx_graph);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+}
+
 int main(int argc, char **argv) 
 {
+  for (int i = 0; i < argc; i++)
+  {
+    if (strcmp(argv[i], "--perf") == 0)
+      PERF = 1;
+  }
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
@@ -7,6 +7,7 @@
 
 #include "gtest/gtest.h"
 #include "nvgraph.h"
+#include "nvgraph_experimental.h"
 #include <valued_csr_graph.hxx>
 #include <multi_valued_csr_graph.hxx>
 #include <nvgraphP.h>  // private header, contains structures, and potentially other things, used in the public C API that should never be exposed.
@@ -1033,6 +1034,46 @@ class RandomTopology : public NVGraphAPIConvertTest,
         deAllocateTopo(srcTopologyDv, srcTestTopoType, DEVICE);
         deAllocateTopo(resultTopologyDv, dstTestTopoType, DEVICE);
     }
+
+    // nvgraph host conversion check
+    template <typename T>
+    void nvgraphTopologyConvertHostTest(testTopologyType_t srcTestTopoType, void *srcTopologyHst, const double *srcEdgeDataHst,
+                                        cudaDataType_t *dataType, testTopologyType_t dstTestTopoType){
+        int srcN=0, srcNNZ=0;
+        topoGetN(srcTestTopoType, srcTopologyHst, &srcN);
+        topoGetNNZ(srcTestTopoType, srcTopologyHst, &srcNNZ);
+
+        T *refResultEdgeDataT=(T*)malloc(sizeof(T)*srcNNZ);
+        T *resultEdgeDataT=(T*)malloc(sizeof(T)*srcNNZ);
+        T *srcEdgeDataHstT = (T*)malloc(sizeof(T)*srcNNZ);
+        for(int i=0; i<srcNNZ; ++i)
+            srcEdgeDataHstT[i]=(T)srcEdgeDataHst[i];
+        void *refResultTopologyHst=NULL, *resultTopologyHst=NULL;
+        allocateTopo(&refResultTopologyHst, dstTestTopoType, srcN, srcNNZ, HOST);
+        allocateTopo(&resultTopologyHst, dstTestTopoType, srcN, srcNNZ, HOST);
+
+        nvgraphTopologyType_t srcTType, dstTType;
+        srcTType = testType2nvGraphType(srcTestTopoType);
+        dstTType = testType2nvGraphType(dstTestTopoType);
+        refConvert(srcTType, srcTopologyHst, srcEdgeDataHstT, dstTType, refResultTopologyHst, refResultEdgeDataT);
+        status = nvgraphConvertTopologyHost(srcTType, srcTopologyHst, srcEdgeDataHstT, dataType,
+                                            dstTType, resultTopologyHst, resultEdgeDataT);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        cmpTopo(dstTType, refResultTopologyHst, HOST, resultTopologyHst, HOST);
+        cmpArray(refResultEdgeDataT, HOST, resultEdgeDataT, HOST, srcNNZ);
+
+        // topology only
+        status = nvgraphConvertTopologyHost(srcTType, srcTopologyHst, NULL, NULL,
+                                            dstTType, resultTopologyHst, NULL);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        cmpTopo(dstTType, refResultTopologyHst, HOST, resultTopologyHst, HOST);
+
+        free(refResultEdgeDataT);
+        free(resultEdgeDataT);
+        free(srcEdgeDataHstT);
+        deAllocateTopo(refResultTopologyHst, dstTestTopoType, HOST);
+        deAllocateTopo(resultTopologyHst, dstTestTopoType, HOST);
+    }
 };
 
 
@@ -1089,6 +1130,59 @@ TEST_P(RandomTopology, nvgraphConvertTopology) {
     free(srcEdgeData);
 }
 
+TEST_P(RandomTopology, nvgraphConvertTopologyHost) {
+
+    cudaDataType_t dataType = std::tr1::get<0>(GetParam());
+    testTopologyType_t srcTestTopoType = std::tr1::get<1>(GetParam());
+    testTopologyType_t dstTestTopoType = std::tr1::get<2>(GetParam());
+    int n = std::tr1::get<3>(GetParam());
+    int max_nnz = std::tr1::get<4>(GetParam());
+    int maxJump = (rand() % n)+1;
+    int maxPerRow = (rand() % max_nnz)+1;
+    int nnz;
+
+    void *srcTopology;
+    allocateTopo(&srcTopology, srcTestTopoType, n, max_nnz, HOST);
+    if(srcTestTopoType==CSR_32) {
+        nvgraphCSRTopology32I_t srcT = static_cast<nvgraphCSRTopology32I_t >(srcTopology);
+        randomCsrGenerator( srcT->source_offsets, srcT->destination_indices, &nnz, n,
+                            maxPerRow, maxJump, max_nnz);
+        srcT->nedges = nnz;
+    } else if(srcTestTopoType==CSC_32) {
+        nvgraphCSCTopology32I_t srcT = static_cast<nvgraphCSCTopology32I_t >(srcTopology);
+        randomCsrGenerator( srcT->destination_offsets, srcT->source_indices, &nnz, n,
+                            maxPerRow, maxJump, max_nnz);
+        srcT->nedges = nnz;
+    } else if(srcTestTopoType==COO_SOURCE_32) {
+        nvgraphCOOTopology32I_t srcT = static_cast<nvgraphCOOTopology32I_t >(srcTopology);
+        randomCOOGenerator( srcT->source_indices, srcT->destination_indices, &nnz, n,
+                            maxPerRow, maxJump, max_nnz);
+        srcT->nedges = nnz;
+    } else if(srcTestTopoType==COO_DESTINATION_32 || srcTestTopoType==COO_UNSORTED_32 || srcTestTopoType==COO_DEFAULT_32) {
+        // Unsorted and default to have COO_dest sorting. (sorted is a special case of unsorted array)
+        nvgraphCOOTopology32I_t srcT = static_cast<nvgraphCOOTopology32I_t >(srcTopology);
+        randomCOOGenerator( srcT->destination_indices, srcT->source_indices, &nnz, n,
+                            maxPerRow, maxJump, max_nnz);
+        srcT->nedges = nnz;
+    } else {
+        FAIL();
+    }
+
+    double *srcEdgeData = (double*)malloc(sizeof(double)*nnz);
+    for(int i=0; i<nnz; ++i)
+        srcEdgeData[i]=(double)rand()/(rand()+1); // don't divide by zero
+
+    if(dataType==CUDA_R_32F){
+        this->nvgraphTopologyConvertHostTest<float> (srcTestTopoType, srcTopology, srcEdgeData, &dataType, dstTestTopoType);
+    } else if (dataType==CUDA_R_64F) {
+        this->nvgraphTopologyConvertHostTest<double> (srcTestTopoType, srcTopology, srcEdgeData, &dataType, dstTestTopoType);
+    } else {
+        FAIL();
+    }
+    deAllocateTopo(srcTopology, srcTestTopoType, HOST);
+    free(srcEdgeData);
+}
+
 
 class RandomGraph : public NVGraphAPIConvertTest,
                     public ::testing::WithParamInterface<std::tr1::tuple< cudaDataType_t,             // dataType
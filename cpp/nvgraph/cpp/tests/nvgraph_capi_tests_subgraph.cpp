@@ -13,6 +13,7 @@
 #include "valued_csr_graph.hxx"
 #include "nvgraphP.h"
 #include "nvgraph.h"
+#include "nvgraph_experimental.h"
 
 static std::string ref_data_prefix = "";
 static std::string graph_data_prefix = "";
@@ -1109,6 +1110,219 @@ TEST_F(NvgraphCAPITests_SubgraphCSR, CSRContractionNetworkX)
 	}
 }
 
+TEST_F(NvgraphCAPITests_SubgraphCSR, CSRSubgraphView_Traversal)
+{
+	nvgraphCSRTopology32I_st topoData;
+	topoData.nvertices = static_cast<int>(graph_neigh.size()) - 1;
+	topoData.nedges = static_cast<int>(graph_edged.size());
+	topoData.source_offsets = &graph_neigh[0];
+	topoData.destination_indices = &graph_edged[0];
+
+	// vertices 0, 2, 3, 4 are numbered 0, 1, 2, 3 in the subgraph, edge 0->1 and 1->3 are not in the view
+	{
+		int vertices[] = { 4, 0, 3, 2 };
+		int distances[4], predecessors[4];
+		status = nvgraphSubgraphViewTraversalHost(&topoData, vertices, 4, NULL, 0, 0, distances, predecessors);
+		ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+		int expected_distances[] = { 0, 2, 1, 3 };
+		int expected_predecessors[] = { -1, 2, 0, 1 };
+		for (int i = 0; i < 4; i++)
+		{
+			ASSERT_EQ(expected_distances[i], distances[i]);
+			ASSERT_EQ(expected_predecessors[i], predecessors[i]);
+		}
+	}
+
+	// edges 0->1, 1->3 and 3->0: vertices 0, 1, 3
+	{
+		int edges[] = { 5, 0, 2, 0 };
+		int distances[3], predecessors[3];
+		status = nvgraphSubgraphViewTraversalHost(&topoData, NULL, 0, edges, 4, 2, distances, predecessors);
+		ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+		int expected_distances[] = { 1, 2, 0 };
+		int expected_predecessors[] = { 2, 0, -1 };
+		for (int i = 0; i < 3; i++)
+		{
+			ASSERT_EQ(expected_distances[i], distances[i]);
+			ASSERT_EQ(expected_predecessors[i], predecessors[i]);
+		}
+
+		int vertices[] = { 1 };
+		status = nvgraphSubgraphViewTraversalHost(&topoData, vertices, 1, edges, 4, 0, distances, NULL);
+		ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+		status = nvgraphSubgraphViewTraversalHost(&topoData, NULL, 0, edges, 4, 3, distances, NULL);
+		ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+		edges[0] = 9;
+		status = nvgraphSubgraphViewTraversalHost(&topoData, NULL, 0, edges, 4, 0, distances, NULL);
+		ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+	}
+}
+
+TEST_F(NvgraphCAPITests_SubgraphCSR, CSRSubgraphView_Pagerank)
+{
+	// the graph of the fixture seen as a CSC, against the subgraph of vertices 0, 2, 3, 4 built by hand
+	nvgraphCSCTopology32I_st topoData;
+	topoData.nvertices = static_cast<int>(graph_neigh.size()) - 1;
+	topoData.nedges = static_cast<int>(graph_edged.size());
+	topoData.destination_offsets = &graph_neigh[0];
+	topoData.source_indices = &graph_edged[0];
+
+	int sub_offsets[] = { 0, 1, 2, 4, 6 };
+	int sub_indices[] = { 2, 3, 0, 1, 1, 3 };
+	int sub_edges[] = { 1, 4, 5, 6, 7, 8 };
+	nvgraphCSCTopology32I_st subData;
+	subData.nvertices = 4;
+	subData.nedges = 6;
+	subData.destination_offsets = sub_offsets;
+	subData.source_indices = sub_indices;
+
+	std::vector<float> weights(topoData.nedges);
+	for (int e = 0; e < topoData.nedges; e++)
+		weights[e] = 0.1f * (e + 1);
+	std::vector<float> sub_weights(subData.nedges);
+	for (int e = 0; e < subData.nedges; e++)
+		sub_weights[e] = weights[sub_edges[e]];
+
+	float alpha = 0.85f;
+	float bookmark[] = { 0.f, 1.f, 0.f, 0.f };
+	float rank[4], sub_rank[4];
+	int vertices[] = { 0, 2, 3, 4 };
+	int all_vertices[] = { 0, 1, 2, 3 };
+
+	status = nvgraphSubgraphViewPagerankHost(&topoData, CUDA_R_32F, &weights[0], vertices, 4, NULL, 0,
+														  &alpha, bookmark, 1.0E-6f, 500, 0, rank);
+	ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+	status = nvgraphSubgraphViewPagerankHost(&subData, CUDA_R_32F, &sub_weights[0], all_vertices, 4, NULL, 0,
+														  &alpha, bookmark, 1.0E-6f, 500, 0, sub_rank);
+	ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+	float sum = 0.f;
+	for (int i = 0; i < 4; i++)
+	{
+		EXPECT_NEAR(sub_rank[i], rank[i], 1.0E-6f);
+		sum += rank[i];
+	}
+	EXPECT_NEAR(1.f, sum, 1.0E-5f);
+
+	alpha = 1.f;
+	status = nvgraphSubgraphViewPagerankHost(&topoData, CUDA_R_32F, &weights[0], vertices, 4, NULL, 0,
+														  &alpha, bookmark, 1.0E-6f, 500, 0, rank);
+	ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+}
+
+TEST_F(NvgraphCAPITests_SubgraphCSR, CSRSubgraphViewDevice_Traversal)
+{
+	// same views as CSRSubgraphView_Traversal over the graph of the fixture in device memory
+	{
+		int vertices[] = { 4, 0, 3, 2 };
+		int distances[4], predecessors[4];
+		status = nvgraphSubgraphViewTraversal(nvgraph_handle, initial_graph, vertices, 4, NULL, 0, 0, distances, predecessors);
+		ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+		int expected_distances[] = { 0, 2, 1, 3 };
+		int expected_predecessors[] = { -1, 2, 0, 1 };
+		for (int i = 0; i < 4; i++)
+		{
+			ASSERT_EQ(expected_distances[i], distances[i]);
+			ASSERT_EQ(expected_predecessors[i], predecessors[i]);
+		}
+	}
+
+	// edge subset and distances in device memory
+	{
+		int edges[] = { 5, 0, 2, 0 };
+		int *d_edges = NULL, *d_distances = NULL;
+		ASSERT_EQ(cudaSuccess, cudaMalloc((void**) &d_edges, 4 * sizeof(int)));
+		ASSERT_EQ(cudaSuccess, cudaMalloc((void**) &d_distances, 3 * sizeof(int)));
+		ASSERT_EQ(cudaSuccess, cudaMemcpy(d_edges, edges, 4 * sizeof(int), cudaMemcpyHostToDevice));
+		int distances[3], predecessors[3];
+		status = nvgraphSubgraphViewTraversal(nvgraph_handle, initial_graph, NULL, 0, d_edges, 4, 2, d_distances, predecessors);
+		ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+		ASSERT_EQ(cudaSuccess, cudaMemcpy(distances, d_distances, 3 * sizeof(int), cudaMemcpyDeviceToHost));
+		cudaFree(d_edges);
+		cudaFree(d_distances);
+		int expected_distances[] = { 1, 2, 0 };
+		int expected_predecessors[] = { 2, 0, -1 };
+		for (int i = 0; i < 3; i++)
+		{
+			ASSERT_EQ(expected_distances[i], distances[i]);
+			ASSERT_EQ(expected_predecessors[i], predecessors[i]);
+		}
+
+		int vertices[] = { 1 };
+		status = nvgraphSubgraphViewTraversal(nvgraph_handle, initial_graph, vertices, 1, edges, 4, 0, distances, NULL);
+		ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+		status = nvgraphSubgraphViewTraversal(nvgraph_handle, initial_graph, NULL, 0, edges, 4, 3, distances, NULL);
+		ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+		edges[0] = 9;
+		status = nvgraphSubgraphViewTraversal(nvgraph_handle, initial_graph, NULL, 0, edges, 4, 0, distances, NULL);
+		ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+	}
+}
+
+TEST_F(NvgraphCAPITests_SubgraphCSR, CSRSubgraphViewDevice_Pagerank)
+{
+	// the graph of the fixture as a CSC in device memory, against the host view
+	nvgraphCSCTopology32I_st topoData;
+	topoData.nvertices = static_cast<int>(graph_neigh.size()) - 1;
+	topoData.nedges = static_cast<int>(graph_edged.size());
+	topoData.destination_offsets = &graph_neigh[0];
+	topoData.source_indices = &graph_edged[0];
+
+	std::vector<float> weights(topoData.nedges);
+	for (int e = 0; e < topoData.nedges; e++)
+		weights[e] = 0.1f * (e + 1);
+
+	nvgraphGraphDescr_t csc_graph;
+	status = nvgraphCreateGraphDescr(nvgraph_handle, &csc_graph);
+	ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+	status = nvgraphSetGraphStructure(nvgraph_handle, csc_graph, (void*) &topoData, NVGRAPH_CSC_32);
+	ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+	cudaDataType_t type_e = CUDA_R_32F;
+	status = nvgraphAllocateEdgeData(nvgraph_handle, csc_graph, 1, &type_e);
+	ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+	status = nvgraphSetEdgeData(nvgraph_handle, csc_graph, (void*) &weights[0], 0);
+	ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+	float alpha = 0.85f;
+	float bookmark[] = { 0.f, 1.f, 0.f, 0.f };
+	float rank[4], host_rank[4];
+	int vertices[] = { 0, 2, 3, 4 };
+	int edges[] = { 1, 4, 5, 6, 7, 8 };
+
+	status = nvgraphSubgraphViewPagerankHost(&topoData, CUDA_R_32F, &weights[0], vertices, 4, NULL, 0,
+														  &alpha, bookmark, 1.0E-6f, 500, 0, host_rank);
+	ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+
+	// the edges of the vertex subset give the same subgraph
+	for (int k = 0; k < 2; k++)
+	{
+		status = nvgraphSubgraphViewPagerank(nvgraph_handle, csc_graph, 0,
+														 k ? NULL : vertices, k ? 0 : 4,
+														 k ? edges : NULL, k ? 6 : 0,
+														 &alpha, bookmark, 1.0E-6f, 500, 0, rank);
+		ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+		float sum = 0.f;
+		for (int i = 0; i < 4; i++)
+		{
+			EXPECT_NEAR(host_rank[i], rank[i], 1.0E-5f);
+			sum += rank[i];
+		}
+		EXPECT_NEAR(1.f, sum, 1.0E-5f);
+	}
+
+	alpha = 1.f;
+	status = nvgraphSubgraphViewPagerank(nvgraph_handle, csc_graph, 0, vertices, 4, NULL, 0,
+													 &alpha, bookmark, 1.0E-6f, 500, 0, rank);
+	ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+	alpha = 0.85f;
+	status = nvgraphSubgraphViewPagerank(nvgraph_handle, initial_graph, 0, vertices, 4, NULL, 0,
+													 &alpha, bookmark, 1.0E-6f, 500, 0, rank);
+	ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, status);
+
+	status = nvgraphDestroyGraphDescr(nvgraph_handle, csc_graph);
+	ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+}
+
 int main(int argc, char **argv)
 			{
 	::testing::InitGoogleTest(&argc, argv);
@@ -143,6 +143,15 @@ class NVGraphCAPITests_Triangles_Sanity : public ::testing::Test {
         // get result
         ASSERT_EQ(expected, res);
 
+        // host counting on the same topology
+        if (topo == NVGRAPH_CSR_32)
+        {
+            uint64_t host_res = 0;
+            status = nvgraphTriangleCountHost((nvgraphCSRTopology32I_t)topo_st, &host_res);
+            ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+            ASSERT_EQ(expected, host_res);
+        }
+
         status = nvgraphDestroyGraphDescr(handle, g1);
         ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
     }
@@ -312,6 +321,21 @@ class TriCountRefGraphCheck : public ::testing::TestWithParam<TriCount_Usecase_t
         //printf("Expected triangles: %" PRIu64 ", got triangles: %" PRIu64 "\n", expected, res);
         ASSERT_EQ(param.ref_tricount, res);
 
+        double estimate = 0, lower = 0, upper = 0;
+        status = nvgraphTriangleCountApproxHost(&topology, 0.01f, 0.99f, 42, &estimate, &lower, &upper);
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        ASSERT_LE(lower, (double)param.ref_tricount);
+        ASSERT_GE(upper, (double)param.ref_tricount);
+
+        uint64_t host_res = 0;
+        double host_start = second();
+        status = nvgraphTriangleCountHost(&topology, &host_res);
+        double host_stop = second();
+        ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
+        if (PERF && n > PERF_ROWS_LIMIT)
+            printf("&&&& PERF Time_%s_host %10.8f -ms\n", test_id.c_str(), 1000.0*(host_stop-host_start));
+        ASSERT_EQ(param.ref_tricount, host_res);
+
         status = nvgraphDestroyGraphDescr(handle, g1);
         ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, status);
     }
@@ -358,6 +382,74 @@ TEST_F(NVGraphCAPITests_Triangles_Sanity, SanitySeqCSR)
     run_seq_test_csr();
 }
 
+TEST_F(NVGraphCAPITests_Triangles_Sanity, SanityHostVertexAndTruss)
+{
+    // K4 on {0,1,2,3} and the pendant edge (4,0), lower triangular
+    int offsets[] = {0, 0, 1, 3, 6, 7};
+    int neighborhood[] = {0, 0, 1, 0, 1, 2, 0};
+    nvgraphCSRTopology32I_st topology = {5, 7, offsets, neighborhood};
+
+    std::vector<uint64_t> triangles(5);
+    std::vector<double> clustering(5);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphTriangleCountVertexHost(&topology, CUDA_R_64F, &triangles[0], &clustering[0]));
+    uint64_t expected_triangles[] = {3, 3, 3, 3, 0};
+    double expected_clustering[] = {0.5, 1.0, 1.0, 1.0, 0.0};
+    for (int i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(expected_triangles[i], triangles[i]);
+        ASSERT_NEAR(expected_clustering[i], clustering[i], 1e-12);
+    }
+
+    std::vector<int> support(7), truss(7);
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphKTrussHost(&topology, &support[0], &truss[0]));
+    for (int e = 0; e < 6; e++)
+    {
+        ASSERT_EQ(2, support[e]);
+        ASSERT_EQ(4, truss[e]);
+    }
+    ASSERT_EQ(0, support[6]);
+    ASSERT_EQ(2, truss[6]);
+
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphKTrussHost(&topology, NULL, NULL));
+    ASSERT_EQ(NVGRAPH_STATUS_TYPE_NOT_SUPPORTED, nvgraphTriangleCountVertexHost(&topology, CUDA_R_32I, NULL, &clustering[0]));
+}
+
+TEST_F(NVGraphCAPITests_Triangles_Sanity, SanityHostApprox)
+{
+    // complete graph: every wedge is closed, the estimate is exact
+    int N = 64;
+    std::vector<int> offsets(N+1), neighborhood;
+    offsets[0] = 0;
+    for (int i = 0; i < N; i++)
+    {
+        for (int j = 0; j < i; j++)
+            neighborhood.push_back(j);
+        offsets[i+1] = (int)neighborhood.size();
+    }
+    nvgraphCSRTopology32I_st topology = {N, (int)neighborhood.size(), &offsets[0], &neighborhood[0]};
+    double expected = (double)N*(N-1)*(N-2)/6;
+    double estimate = 0, lower = 0, upper = 0;
+    ASSERT_EQ(NVGRAPH_STATUS_SUCCESS, nvgraphTriangleCountApproxHost(&topology, 0.05f, 0.95f, 0, &estimate, &lower, &upper));
+    ASSERT_NEAR(expected, estimate, 1e-6*expected);
+    ASSERT_NEAR(expected, upper, 1e-6*expected);
+    ASSERT_LT(lower, expected);
+
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphTriangleCountApproxHost(&topology, 0.f, 0.95f, 0, &estimate, NULL, NULL));
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphTriangleCountApproxHost(&topology, 0.05f, 1.f, 0, &estimate, NULL, NULL));
+}
+
+TEST_F(NVGraphCAPITests_Triangles_Sanity, SanityHostBadInput)
+{
+    // out of range neighbor
+    std::vector<int> offsets(3), neighborhood(1);
+    offsets[0] = 0; offsets[1] = 0; offsets[2] = 1;
+    neighborhood[0] = 5;
+    nvgraphCSRTopology32I_st topology = {2, 1, &offsets[0], &neighborhood[0]};
+    uint64_t res = 0;
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphTriangleCountHost(&topology, &res));
+    ASSERT_EQ(NVGRAPH_STATUS_INVALID_VALUE, nvgraphTriangleCountHost(&topology, NULL));
+}
+
 int main(int argc, char **argv) 
 {
 
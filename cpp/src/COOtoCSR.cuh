@@ -22,36 +22,36 @@
 
 #pragma once
 
+#include <thrust/binary_search.h>
 #include <thrust/extrema.h>
 #include <thrust/scan.h>
 #include <thrust/sort.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/tuple.h>
 #include <thrust/execution_policy.h>
 
-#include <cub/device/device_radix_sort.cuh>
-#include <cub/device/device_run_length_encode.cuh>
-
 #include "utilities/error_utils.h"
 
 #include <rmm_utils.h>
 
-template <typename T>
+// T is the type of the vertex ids, O the type of the offsets (wide enough for nnz)
+template <typename T, typename O = T>
 struct CSR_Result {
 	std::int64_t size;
 	std::int64_t nnz;
-	T* rowOffsets;
+	O* rowOffsets;
 	T* colIndices;
 
 	CSR_Result() : size(0), nnz(0), rowOffsets(nullptr), colIndices(nullptr){}
 
 };
 
-template <typename T, typename W>
+template <typename T, typename W, typename O = T>
 struct CSR_Result_Weighted {
 	std::int64_t size;
 	std::int64_t nnz;
-	T* rowOffsets;
+	O* rowOffsets;
 	T* colIndices;
 	W* edgeWeights;
 
@@ -59,17 +59,30 @@ struct CSR_Result_Weighted {
 
 };
 
-// Define kernel for copying run length encoded values into offset slots.
-template <typename T>
-__global__ void offsetsKernel(T runCounts, T* unique, T* counts, T* offsets) {
-	uint64_t tid = threadIdx.x + blockIdx.x * blockDim.x;
-	if (tid < runCounts)
-		offsets[unique[tid]] = counts[tid];
+// Offsets of a list of ids sorted by id: offsets[v] is the position of the first id >= v.
+// A vectorized binary search, unlike a cub run length encoding it is not limited to 2^31 ids.
+template <typename T, typename O>
+void sortedIdsToOffsets(const T* sortedIds, int64_t nnz, T maxId, O* offsets) {
+    cudaStream_t stream{nullptr};
+    rmm_temp_allocator allocator(stream);
+    thrust::lower_bound(thrust::cuda::par(allocator).on(stream),
+                        sortedIds, sortedIds + nnz,
+                        thrust::make_counting_iterator<T>(0),
+                        thrust::make_counting_iterator<T>(maxId + 2),
+                        offsets);
+}
+
+__device__ inline int atomicIncrement(int* address) {
+	return atomicAdd(address, 1);
+}
+
+__device__ inline int64_t atomicIncrement(int64_t* address) {
+	return (int64_t)atomicAdd((unsigned long long*)address, 1ull);
 }
 
 // Method for constructing CSR from COO
-template <typename T>
-gdf_error ConvertCOOtoCSR(T* sources, T* destinations, int64_t nnz, CSR_Result<T>& result) {
+template <typename T, typename O>
+gdf_error ConvertCOOtoCSR(T* sources, T* destinations, int64_t nnz, CSR_Result<T, O>& result) {
     // Sort source and destination columns by source
     //   Allocate local memory for operating on
     T* srcs{nullptr}, *dests{nullptr};
@@ -84,10 +97,6 @@ gdf_error ConvertCOOtoCSR(T* sources, T* destinations, int64_t nnz, CSR_Result<T
     CUDA_TRY(cudaMemcpy(srcs, sources, sizeof(T) * nnz, cudaMemcpyDefault));
     CUDA_TRY(cudaMemcpy(dests, destinations, sizeof(T) * nnz, cudaMemcpyDefault));
 
-    //   Call CUB SortPairs to sort using srcs as the keys
-    void* tmpStorage = nullptr;
-    size_t tmpBytes = 0;
-
     thrust::stable_sort_by_key(thrust::cuda::par(allocator).on(stream), dests, dests + nnz, srcs);
     thrust::stable_sort_by_key(thrust::cuda::par(allocator).on(stream), srcs, srcs + nnz, dests);
 
@@ -102,47 +111,19 @@ gdf_error ConvertCOOtoCSR(T* sources, T* destinations, int64_t nnz, CSR_Result<T
     result.size = maxId + 1;
 
     // Allocate offsets array
-    ALLOC_MANAGED_TRY((void**)&result.rowOffsets, (maxId + 2) * sizeof(T), stream);
-
-    // Set all values in offsets array to zeros
-    CUDA_TRY(cudaMemset(result.rowOffsets, 0,(maxId + 2) * sizeof(int)));
-
-    // Allocate temporary arrays same size as sources array, and single value to get run counts
-    T* unique{nullptr}, *counts{nullptr}, *runCount{nullptr};
-    ALLOC_MANAGED_TRY((void**)&unique, (maxId + 1) * sizeof(T), stream);
-    ALLOC_MANAGED_TRY((void**)&counts, (maxId + 1) * sizeof(T), stream);
-    ALLOC_MANAGED_TRY((void**)&runCount, sizeof(T), stream);
-
-    // Use CUB run length encoding to get unique values and run lengths
-    tmpStorage = nullptr;
-    cub::DeviceRunLengthEncode::Encode(tmpStorage, tmpBytes, srcs, unique, counts, runCount, nnz);
-    ALLOC_MANAGED_TRY((void**)&tmpStorage, tmpBytes, stream);
-    cub::DeviceRunLengthEncode::Encode(tmpStorage, tmpBytes, srcs, unique, counts, runCount, nnz);
-    ALLOC_FREE_TRY(tmpStorage, stream);
-
-    // Set offsets to run sizes for each index
-    T runCount_h;
-    CUDA_TRY(cudaMemcpy(&runCount_h, runCount, sizeof(T), cudaMemcpyDefault));
-    int threadsPerBlock = 1024;
-    int numBlocks = (runCount_h + threadsPerBlock - 1) / threadsPerBlock;
-    offsetsKernel<<<numBlocks, threadsPerBlock>>>(runCount_h, unique, counts, result.rowOffsets);
-
-    // Scan offsets to get final offsets
-    thrust::exclusive_scan(thrust::cuda::par(allocator).on(stream), result.rowOffsets, result.rowOffsets + maxId + 2, result.rowOffsets);
+    ALLOC_MANAGED_TRY((void**)&result.rowOffsets, (maxId + 2) * sizeof(O), stream);
+    sortedIdsToOffsets(srcs, nnz, maxId, result.rowOffsets);
 
     // Clean up temporary allocations
     result.nnz = nnz;
     result.colIndices = dests;
     ALLOC_FREE_TRY(srcs, stream);
-    ALLOC_FREE_TRY(unique, stream);
-    ALLOC_FREE_TRY(counts, stream);
-    ALLOC_FREE_TRY(runCount, stream);
     return GDF_SUCCESS;
 }
 
 // Method for constructing CSR from COO
-template <typename T, typename W>
-gdf_error ConvertCOOtoCSR_weighted(T* sources, T* destinations, W* edgeWeights, int64_t nnz, CSR_Result_Weighted<T, W>& result) {
+template <typename T, typename W, typename O>
+gdf_error ConvertCOOtoCSR_weighted(T* sources, T* destinations, W* edgeWeights, int64_t nnz, CSR_Result_Weighted<T, W, O>& result) {
     // Sort source and destination columns by source
     //   Allocate local memory for operating on
     T* srcs{nullptr};
@@ -176,45 +157,136 @@ gdf_error ConvertCOOtoCSR_weighted(T* sources, T* destinations, W* edgeWeights,
     result.size = maxId + 1;
 
     // Allocate offsets array
-    ALLOC_MANAGED_TRY((void**)&result.rowOffsets, (maxId + 2) * sizeof(T), stream);
-
-    // Set all values in offsets array to zeros
-    // /CUDA_TRY(
-    //    cudaMemset(result.rowOffsets, 0, (maxId + 2) * sizeof(T));
-
-    CUDA_TRY(cudaMemset(result.rowOffsets, 0,(maxId + 2) * sizeof(int)));
-
-    // Allocate temporary arrays same size as sources array, and single value to get run counts
-    T* unique, *counts, *runCount;
-    ALLOC_MANAGED_TRY((void**)&unique, (maxId + 1) * sizeof(T), stream);
-    ALLOC_MANAGED_TRY((void**)&counts, (maxId + 1) * sizeof(T), stream);
-    ALLOC_MANAGED_TRY((void**)&runCount, sizeof(T), stream);
-
-    // Use CUB run length encoding to get unique values and run lengths
-    void *tmpStorage = nullptr;
-    size_t tmpBytes = 0;
-    cub::DeviceRunLengthEncode::Encode(tmpStorage, tmpBytes, srcs, unique, counts, runCount, nnz);
-    ALLOC_MANAGED_TRY(&tmpStorage, tmpBytes, stream);
-    cub::DeviceRunLengthEncode::Encode(tmpStorage, tmpBytes, srcs, unique, counts, runCount, nnz);
-    ALLOC_FREE_TRY(tmpStorage, stream);
-
-    // Set offsets to run sizes for each index
-    T runCount_h;
-    CUDA_TRY(cudaMemcpy(&runCount_h, runCount, sizeof(T), cudaMemcpyDefault));
-    int threadsPerBlock = 1024;
-    int numBlocks = (runCount_h + threadsPerBlock - 1) / threadsPerBlock;
-    offsetsKernel<<<numBlocks, threadsPerBlock>>>(runCount_h, unique, counts, result.rowOffsets);
-
-    // Scan offsets to get final offsets
-    thrust::exclusive_scan(thrust::cuda::par(allocator).on(stream), result.rowOffsets, result.rowOffsets + maxId + 2, result.rowOffsets);
+    ALLOC_MANAGED_TRY((void**)&result.rowOffsets, (maxId + 2) * sizeof(O), stream);
+    sortedIdsToOffsets(srcs, nnz, maxId, result.rowOffsets);
 
     // Clean up temporary allocations
     result.nnz = nnz;
     result.colIndices = dests;
     result.edgeWeights = weights;
     ALLOC_FREE_TRY(srcs, stream);
-    ALLOC_FREE_TRY(unique, stream);
-    ALLOC_FREE_TRY(counts, stream);
-    ALLOC_FREE_TRY(runCount, stream);
+    return GDF_SUCCESS;
+}
+
+// Define kernel for counting the out and in degrees in one read of the edge list.
+template <typename T, typename O>
+__global__ void degreesKernel(int64_t nnz, const T* sources, const T* destinations, O* outDegrees, O* inDegrees) {
+	for (int64_t tid = threadIdx.x + blockIdx.x * (int64_t)blockDim.x; tid < nnz; tid += gridDim.x * (int64_t)blockDim.x) {
+		atomicIncrement(&outDegrees[sources[tid]]);
+		atomicIncrement(&inDegrees[destinations[tid]]);
+	}
+}
+
+// Offsets of both directions: one degree histogram per direction over a single read
+// of the (sorted) edge list, then a scan of each.
+template <typename T, typename O>
+gdf_error COOtoCSRandCSCOffsets(T* srcs, T* dests, int64_t nnz, T maxId, O** rowOffsets, O** colOffsets) {
+    cudaStream_t stream{nullptr};
+    rmm_temp_allocator allocator(stream);
+
+    ALLOC_MANAGED_TRY((void**)rowOffsets, (maxId + 2) * sizeof(O), stream);
+    ALLOC_MANAGED_TRY((void**)colOffsets, (maxId + 2) * sizeof(O), stream);
+    CUDA_TRY(cudaMemset(*rowOffsets, 0, (maxId + 2) * sizeof(O)));
+    CUDA_TRY(cudaMemset(*colOffsets, 0, (maxId + 2) * sizeof(O)));
+
+    int threadsPerBlock = 1024;
+    int64_t numBlocks64 = (nnz + threadsPerBlock - 1) / threadsPerBlock;
+    int numBlocks = numBlocks64 < 65535 ? (int)numBlocks64 : 65535;
+    degreesKernel<<<numBlocks, threadsPerBlock>>>(nnz, srcs, dests, *rowOffsets, *colOffsets);
+
+    thrust::exclusive_scan(thrust::cuda::par(allocator).on(stream), *rowOffsets, *rowOffsets + maxId + 2, *rowOffsets);
+    thrust::exclusive_scan(thrust::cuda::par(allocator).on(stream), *colOffsets, *colOffsets + maxId + 2, *colOffsets);
+    return GDF_SUCCESS;
+}
+
+// Method for constructing CSR and CSC (CSR of the transposed graph) from COO in one pass.
+// Same results as ConvertCOOtoCSR on (sources, destinations) and (destinations, sources),
+// but the edge list is copied and the maximum id computed once, the degrees of both
+// directions come from the same read, and the CSC is sorted from the CSR order, which is
+// already sorted by source within each destination, so it needs one stable sort instead of two.
+template <typename T, typename O>
+gdf_error ConvertCOOtoCSRandCSC(T* sources, T* destinations, int64_t nnz, CSR_Result<T, O>& csr, CSR_Result<T, O>& csc) {
+    T* srcs{nullptr}, *dests{nullptr}, *cscIndices{nullptr};
+    cudaStream_t stream{nullptr};
+    rmm_temp_allocator allocator(stream);
+
+    ALLOC_MANAGED_TRY((void**)&srcs, sizeof(T) * nnz, stream);
+    ALLOC_MANAGED_TRY((void**)&dests, sizeof(T) * nnz, stream);
+    ALLOC_MANAGED_TRY((void**)&cscIndices, sizeof(T) * nnz, stream);
+    CUDA_TRY(cudaMemcpy(srcs, sources, sizeof(T) * nnz, cudaMemcpyDefault));
+    CUDA_TRY(cudaMemcpy(dests, destinations, sizeof(T) * nnz, cudaMemcpyDefault));
+
+    // CSR order: by source, then by destination
+    thrust::stable_sort_by_key(thrust::cuda::par(allocator).on(stream), dests, dests + nnz, srcs);
+    thrust::stable_sort_by_key(thrust::cuda::par(allocator).on(stream), srcs, srcs + nnz, dests);
+
+    T maxId = -1;
+    CUDA_TRY(cudaMemcpy(&maxId, &(srcs[nnz-1]), sizeof(T), cudaMemcpyDefault));
+    auto maxId_it = thrust::max_element(thrust::cuda::par(allocator).on(stream), dests, dests + nnz);
+    T maxId2;
+    CUDA_TRY(cudaMemcpy(&maxId2, maxId_it, sizeof(T), cudaMemcpyDefault));
+    maxId = maxId > maxId2 ? maxId : maxId2;
+    csr.size = csc.size = maxId + 1;
+
+    GDF_TRY(COOtoCSRandCSCOffsets(srcs, dests, nnz, maxId, &csr.rowOffsets, &csc.rowOffsets));
+
+    // CSC order: a stable sort by destination keeps the sources sorted,
+    // the sorted sources buffer is reused for the keys
+    CUDA_TRY(cudaMemcpy(cscIndices, srcs, sizeof(T) * nnz, cudaMemcpyDefault));
+    CUDA_TRY(cudaMemcpy(srcs, dests, sizeof(T) * nnz, cudaMemcpyDefault));
+    thrust::stable_sort_by_key(thrust::cuda::par(allocator).on(stream), srcs, srcs + nnz, cscIndices);
+
+    csr.nnz = csc.nnz = nnz;
+    csr.colIndices = dests;
+    csc.colIndices = cscIndices;
+    ALLOC_FREE_TRY(srcs, stream);
+    return GDF_SUCCESS;
+}
+
+// Weighted version of ConvertCOOtoCSRandCSC
+template <typename T, typename W, typename O>
+gdf_error ConvertCOOtoCSRandCSC_weighted(T* sources, T* destinations, W* edgeWeights, int64_t nnz,
+                                         CSR_Result_Weighted<T, W, O>& csr, CSR_Result_Weighted<T, W, O>& csc) {
+    T* srcs{nullptr}, *dests{nullptr}, *cscIndices{nullptr};
+    W* weights{nullptr}, *cscWeights{nullptr};
+    cudaStream_t stream{nullptr};
+    rmm_temp_allocator allocator(stream);
+
+    ALLOC_MANAGED_TRY((void**)&srcs, sizeof(T) * nnz, stream);
+    ALLOC_MANAGED_TRY((void**)&dests, sizeof(T) * nnz, stream);
+    ALLOC_MANAGED_TRY((void**)&weights, sizeof(W) * nnz, stream);
+    ALLOC_MANAGED_TRY((void**)&cscIndices, sizeof(T) * nnz, stream);
+    ALLOC_MANAGED_TRY((void**)&cscWeights, sizeof(W) * nnz, stream);
+    CUDA_TRY(cudaMemcpy(srcs, sources, sizeof(T) * nnz, cudaMemcpyDefault));
+    CUDA_TRY(cudaMemcpy(dests, destinations, sizeof(T) * nnz, cudaMemcpyDefault));
+    CUDA_TRY(cudaMemcpy(weights, edgeWeights, sizeof(W) * nnz, cudaMemcpyDefault));
+
+    // CSR order: by source, then by destination
+    thrust::stable_sort_by_key(thrust::cuda::par(allocator).on(stream), dests, dests + nnz, thrust::make_zip_iterator(thrust::make_tuple(srcs, weights)));
+    thrust::stable_sort_by_key(thrust::cuda::par(allocator).on(stream), srcs, srcs + nnz, thrust::make_zip_iterator(thrust::make_tuple(dests, weights)));
+
+    T maxId = -1;
+    CUDA_TRY(cudaMemcpy(&maxId, &(srcs[nnz-1]), sizeof(T), cudaMemcpyDefault));
+    auto maxId_it = thrust::max_element(thrust::cuda::par(allocator).on(stream), dests, dests + nnz);
+    T maxId2;
+    CUDA_TRY(cudaMemcpy(&maxId2, maxId_it, sizeof(T), cudaMemcpyDefault));
+    maxId = maxId > maxId2 ? maxId : maxId2;
+    csr.size = csc.size = maxId + 1;
+
+    GDF_TRY(COOtoCSRandCSCOffsets(srcs, dests, nnz, maxId, &csr.rowOffsets, &csc.rowOffsets));
+
+    // CSC order: a stable sort by destination keeps the sources sorted,
+    // the sorted sources buffer is reused for the keys
+    CUDA_TRY(cudaMemcpy(cscIndices, srcs, sizeof(T) * nnz, cudaMemcpyDefault));
+    CUDA_TRY(cudaMemcpy(cscWeights, weights, sizeof(W) * nnz, cudaMemcpyDefault));
+    CUDA_TRY(cudaMemcpy(srcs, dests, sizeof(T) * nnz, cudaMemcpyDefault));
+    thrust::stable_sort_by_key(thrust::cuda::par(allocator).on(stream), srcs, srcs + nnz, thrust::make_zip_iterator(thrust::make_tuple(cscIndices, cscWeights)));
+
+    csr.nnz = csc.nnz = nnz;
+    csr.colIndices = dests;
+    csr.edgeWeights = weights;
+    csc.colIndices = cscIndices;
+    csc.edgeWeights = cscWeights;
+    ALLOC_FREE_TRY(srcs, stream);
     return GDF_SUCCESS;
 }
@@ -468,4 +468,79 @@ namespace cugraph {
 	}
 
 	template class Bfs<int> ;
+
+	// a thread per frontier vertex, a vertex is claimed by the first thread setting its distance
+	template<typename IndexType, typename OffsetType>
+	__global__ void top_down_expand_kernel(	const OffsetType *row_offsets,
+															const IndexType *col_indices,
+															const IndexType *frontier,
+															IndexType frontier_size,
+															IndexType lvl,
+															IndexType *distances,
+															IndexType *predecessors,
+															IndexType *new_frontier,
+															IndexType *new_frontier_size) {
+		const IndexType unreached = std::numeric_limits<IndexType>::max();
+		for (IndexType i = threadIdx.x + (IndexType) blockIdx.x * blockDim.x; i < frontier_size;
+				i += (IndexType) gridDim.x * blockDim.x) {
+			IndexType v = frontier[i];
+			for (OffsetType e = row_offsets[v]; e < row_offsets[v + 1]; ++e) {
+				IndexType u = col_indices[e];
+				if (distances[u] == unreached && atomic_cas(distances + u, unreached, lvl) == unreached) {
+					if (predecessors)
+						predecessors[u] = v;
+					new_frontier[atomic_add(new_frontier_size, (IndexType) 1)] = u;
+				}
+			}
+		}
+	}
+
+	template<typename IndexType, typename OffsetType>
+	void bfs_top_down(	IndexType n,
+							const OffsetType *row_offsets,
+							const IndexType *col_indices,
+							IndexType source_vertex,
+							IndexType *distances,
+							IndexType *predecessors,
+							cudaStream_t stream) {
+		IndexType *frontier, *new_frontier, *d_new_frontier_size;
+		ALLOC_TRY(&frontier, n * sizeof(IndexType), stream);
+		ALLOC_TRY(&new_frontier, n * sizeof(IndexType), stream);
+		ALLOC_TRY(&d_new_frontier_size, sizeof(IndexType), stream);
+
+		fill_vec(distances, n, std::numeric_limits<IndexType>::max(), stream);
+		if (predecessors)
+			fill_vec(predecessors, n, (IndexType) -1, stream);
+		IndexType zero = 0;
+		cudaMemcpyAsync(distances + source_vertex, &zero, sizeof(IndexType), cudaMemcpyHostToDevice, stream);
+		cudaMemcpyAsync(frontier, &source_vertex, sizeof(IndexType), cudaMemcpyHostToDevice, stream);
+
+		IndexType frontier_size = 1;
+		for (IndexType lvl = 1; frontier_size > 0; ++lvl) {
+			cudaMemsetAsync(d_new_frontier_size, 0, sizeof(IndexType), stream);
+			dim3 grid, block;
+			block.x = min(frontier_size, (IndexType) CUDA_MAX_KERNEL_THREADS);
+			grid.x = min((frontier_size + block.x - 1) / block.x, (IndexType) CUDA_MAX_BLOCKS);
+			top_down_expand_kernel<<<grid, block, 0, stream>>>(row_offsets,
+																				col_indices,
+																				frontier,
+																				frontier_size,
+																				lvl,
+																				distances,
+																				predecessors,
+																				new_frontier,
+																				d_new_frontier_size);
+			cudaCheckError();
+			cudaMemcpyAsync(&frontier_size, d_new_frontier_size, sizeof(IndexType), cudaMemcpyDeviceToHost, stream);
+			cudaStreamSynchronize(stream);
+			std::swap(frontier, new_frontier);
+		}
+
+		ALLOC_FREE_TRY(frontier, stream);
+		ALLOC_FREE_TRY(new_frontier, stream);
+		ALLOC_FREE_TRY(d_new_frontier_size, stream);
+	}
+
+	template void bfs_top_down<int, int64_t>(int n, const int64_t *row_offsets, const int *col_indices, int source_vertex, int *distances, int *predecessors, cudaStream_t stream);
+	template void bfs_top_down<int64_t, int64_t>(int64_t n, const int64_t *row_offsets, const int64_t *col_indices, int64_t source_vertex, int64_t *distances, int64_t *predecessors, cudaStream_t stream);
 } // end namespace cugraph
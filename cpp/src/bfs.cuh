@@ -97,5 +97,17 @@ namespace cugraph {
 
 		void traverse(IndexType source_vertex);
 	};
+
+	// Level synchronous top down BFS for the graphs Bfs is not instantiated for
+	// (64 bits offsets or vertex ids). Unreached vertices are at the max of IndexType,
+	// with a -1 predecessor. predecessors can be nullptr.
+	template<typename IndexType, typename OffsetType>
+	void bfs_top_down(	IndexType n,
+							const OffsetType *row_offsets,
+							const IndexType *col_indices,
+							IndexType source_vertex,
+							IndexType *distances,
+							IndexType *predecessors,
+							cudaStream_t stream = 0);
 } // end namespace nvgraph
 
@@ -0,0 +1,547 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** ---------------------------------------------------------------------------*
+ * @brief Compression of the adjacency lists and the algorithms running on them
+ *
+ * @file compressed_adj_list.cu
+ * ---------------------------------------------------------------------------**/
+
+#include <climits>
+#include <iostream>
+#include <cugraph.h>
+#include "utilities/error_utils.h"
+#include <rmm_utils.h>
+#include "graph_utils.cuh"
+#include "compressed_adj_list.cuh"
+#include "pagerank.cuh"
+
+#include <thrust/device_vector.h>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/execution_policy.h>
+
+template<typename T>
+using Vector = thrust::device_vector<T, rmm_allocator<T>>;
+
+namespace {
+
+template<typename IndexType>
+struct row_blocks {
+	const IndexType* offsets;
+	row_blocks(const IndexType* _offsets) :
+			offsets(_offsets) {
+	}
+
+	__host__ __device__
+	IndexType operator()(IndexType v) const {
+		return (offsets[v + 1] - offsets[v] + COMPRESSED_BLOCK_SIZE - 1) / COMPRESSED_BLOCK_SIZE;
+	}
+};
+
+// First edge and length of block b, block_rows[b] being its row
+template<typename IndexType>
+struct block_range {
+	const IndexType* offsets;
+	const IndexType* block_offsets;
+	const IndexType* block_rows;
+
+	__host__ __device__
+	IndexType first(IndexType b) const {
+		IndexType row = block_rows[b];
+		return offsets[row] + (b - block_offsets[row]) * COMPRESSED_BLOCK_SIZE;
+	}
+
+	__host__ __device__
+	IndexType length(IndexType b) const {
+		IndexType left = offsets[block_rows[b] + 1] - first(b);
+		return left < COMPRESSED_BLOCK_SIZE ? left : COMPRESSED_BLOCK_SIZE;
+	}
+};
+
+// base, width and number of words of every block, words go to block_starts to be scanned
+template<typename IndexType>
+struct block_layout {
+	block_range<IndexType> range;
+	const IndexType* indices;
+	IndexType* block_bases;
+	int8_t* block_widths;
+	IndexType* block_starts;
+	int* unsorted;
+
+	__device__
+	void operator()(IndexType b) const {
+		if (!cugraph::compressed_block_layout(indices + range.first(b), range.length(b),
+																					block_bases + b, block_widths + b, block_starts + b))
+			*unsorted = 1;
+	}
+};
+
+template<typename IndexType>
+struct block_pack {
+	block_range<IndexType> range;
+	const IndexType* indices;
+	const int8_t* block_widths;
+	const IndexType* block_starts;
+	uint32_t* data;
+
+	__device__
+	void operator()(IndexType b) const {
+		cugraph::compressed_block_pack(indices + range.first(b), range.length(b), block_widths[b], data + block_starts[b]);
+	}
+};
+
+template<typename IndexType>
+struct write_neighbor {
+	IndexType* indices;
+	__device__
+	void operator()(IndexType e, IndexType u) {
+		indices[e] = u;
+	}
+};
+
+template<typename IndexType>
+struct decompress_row {
+	cugraph::CompressedAdjListView<IndexType> adj;
+	IndexType* indices;
+
+	__device__
+	void operator()(IndexType v) const {
+		write_neighbor<IndexType> f = { indices };
+		adj.for_each_neighbor(v, f);
+	}
+};
+
+// Visits the neighbors of a frontier vertex, the unvisited ones go to the next frontier
+template<typename IndexType>
+struct visit_neighbor {
+	IndexType v;
+	IndexType level;
+	IndexType* distances;
+	IndexType* predecessors;
+	IndexType* next;
+	IndexType* next_size;
+
+	__device__
+	void operator()(IndexType e, IndexType u) {
+		if (atomicCAS(distances + u, INT_MAX, level) == INT_MAX) {
+			if (predecessors)
+				predecessors[u] = v;
+			next[atomicAdd(next_size, 1)] = u;
+		}
+	}
+};
+
+template<typename IndexType>
+struct expand_vertex {
+	cugraph::CompressedAdjListView<IndexType> adj;
+	IndexType level;
+	IndexType* distances;
+	IndexType* predecessors;
+	IndexType* next;
+	IndexType* next_size;
+
+	__device__
+	void operator()(IndexType v) const {
+		visit_neighbor<IndexType> f = { v, level, distances, predecessors, next, next_size };
+		adj.for_each_neighbor(v, f);
+	}
+};
+
+template<typename IndexType>
+struct count_common {
+	cugraph::CompressedAdjListView<IndexType> adj;
+	IndexType other;
+	IndexType count;
+
+	__device__
+	void operator()(IndexType e, IndexType u) {
+		if (adj.contains(other, u))
+			count++;
+	}
+};
+
+// Jaccard coefficient of every edge, as jaccard_is and jaccard_jw do for the unweighted case:
+// every neighbor of the row of smaller degree is searched in the other one
+template<typename IndexType, typename ValueType>
+struct edge_jaccard {
+	cugraph::CompressedAdjListView<IndexType> adj;
+	const IndexType* edge_rows;
+	ValueType* result;
+
+	__device__
+	void operator()(IndexType e) const {
+		IndexType row = edge_rows[e];
+		IndexType col = adj.neighbor(row, e);
+		IndexType Ni = adj.degree(row);
+		IndexType Nj = adj.degree(col);
+		count_common<IndexType> f = { adj, (Ni < Nj) ? col : row, 0 };
+		adj.for_each_neighbor((Ni < Nj) ? row : col, f);
+		ValueType Wi = f.count;
+		ValueType Ws = Ni + Nj;
+		result[e] = Wi / (Ws - Wi);
+	}
+};
+
+template<typename IndexType>
+struct count_degree {
+	IndexType* degree;
+	__device__
+	void operator()(IndexType e, IndexType u) {
+		atomicAdd(degree + u, 1);
+	}
+};
+
+template<typename IndexType, typename ValueType>
+struct inverse_degree {
+	const IndexType* degree;
+	ValueType* val;
+	__device__
+	void operator()(IndexType e, IndexType u) {
+		val[e] = 1.0 / degree[u];
+	}
+};
+
+// H^T values on a compressed CSC: the out degree of a vertex is its number of occurrences as a neighbor
+template<typename IndexType, typename ValueType>
+struct HT_column {
+	cugraph::CompressedAdjListView<IndexType> adj;
+	IndexType* degree;
+	ValueType* val;
+
+	__device__
+	void operator()(IndexType v) const {
+		if (val == nullptr) {
+			count_degree<IndexType> f = { degree };
+			adj.for_each_neighbor(v, f);
+		}
+		else {
+			inverse_degree<IndexType, ValueType> f = { degree, val };
+			adj.for_each_neighbor(v, f);
+		}
+	}
+};
+
+template<typename IndexType>
+cugraph::CompressedAdjListView<IndexType> compressed_view(const gdf_compressed_adj_list* compressed) {
+	cugraph::CompressedAdjListView<IndexType> view;
+	view.n = compressed->offsets->size - 1;
+	view.offsets = static_cast<const IndexType*>(compressed->offsets->data);
+	view.block_offsets = static_cast<const IndexType*>(compressed->block_offsets->data);
+	view.block_bases = static_cast<const IndexType*>(compressed->block_bases->data);
+	view.block_starts = static_cast<const IndexType*>(compressed->block_starts->data);
+	view.block_widths = static_cast<const int8_t*>(compressed->block_widths->data);
+	view.data = static_cast<const uint32_t*>(compressed->data->data);
+	return view;
+}
+
+} // end anonymous namespace
+
+template<typename IndexType>
+gdf_error gdf_compress_adj_list_impl(const gdf_adj_list* adj, gdf_compressed_adj_list* compressed) {
+	cudaStream_t stream { nullptr };
+	rmm_temp_allocator allocator(stream);
+
+	IndexType n = adj->offsets->size - 1;
+	IndexType nnz = adj->indices->size;
+	const IndexType* offsets = static_cast<const IndexType*>(adj->offsets->data);
+	const IndexType* indices = static_cast<const IndexType*>(adj->indices->data);
+
+	IndexType *offsets_copy = nullptr, *block_offsets = nullptr;
+	ALLOC_TRY((void**)&offsets_copy, sizeof(IndexType) * (n + 1), stream);
+	ALLOC_TRY((void**)&block_offsets, sizeof(IndexType) * (n + 1), stream);
+	thrust::copy(thrust::cuda::par(allocator).on(stream), offsets, offsets + n + 1, offsets_copy);
+	CUDA_TRY(cudaMemset(block_offsets, 0, sizeof(IndexType)));
+	thrust::transform(thrust::cuda::par(allocator).on(stream),
+										thrust::make_counting_iterator<IndexType>(0),
+										thrust::make_counting_iterator<IndexType>(n),
+										block_offsets + 1,
+										row_blocks<IndexType>(offsets));
+	thrust::inclusive_scan(thrust::cuda::par(allocator).on(stream),
+													block_offsets + 1,
+													block_offsets + n + 1,
+													block_offsets + 1);
+	IndexType num_blocks;
+	CUDA_TRY(cudaMemcpy(&num_blocks, block_offsets + n, sizeof(IndexType), cudaMemcpyDefault));
+
+	// row of every block: the first row whose blocks end after it
+	Vector<IndexType> block_rows(num_blocks);
+	thrust::upper_bound(thrust::cuda::par(allocator).on(stream),
+											block_offsets + 1,
+											block_offsets + n + 1,
+											thrust::make_counting_iterator<IndexType>(0),
+											thrust::make_counting_iterator<IndexType>(num_blocks),
+											block_rows.begin());
+	block_range<IndexType> range = { offsets, block_offsets, thrust::raw_pointer_cast(block_rows.data()) };
+
+	IndexType *block_bases = nullptr, *block_starts = nullptr;
+	int8_t* block_widths = nullptr;
+	ALLOC_TRY((void**)&block_bases, sizeof(IndexType) * num_blocks, stream);
+	ALLOC_TRY((void**)&block_starts, sizeof(IndexType) * (num_blocks + 1), stream);
+	ALLOC_TRY((void**)&block_widths, sizeof(int8_t) * num_blocks, stream);
+	CUDA_TRY(cudaMemset(block_starts + num_blocks, 0, sizeof(IndexType)));
+
+	Vector<int> unsorted(1, 0);
+	block_layout<IndexType> layout = { range, indices, block_bases, block_widths, block_starts,
+																		 thrust::raw_pointer_cast(unsorted.data()) };
+	thrust::for_each(thrust::cuda::par(allocator).on(stream),
+									 thrust::make_counting_iterator<IndexType>(0),
+									 thrust::make_counting_iterator<IndexType>(num_blocks),
+									 layout);
+	if (unsorted[0]) {
+		ALLOC_FREE_TRY(offsets_copy, stream);
+		ALLOC_FREE_TRY(block_offsets, stream);
+		ALLOC_FREE_TRY(block_bases, stream);
+		ALLOC_FREE_TRY(block_starts, stream);
+		ALLOC_FREE_TRY(block_widths, stream);
+		return GDF_INVALID_API_CALL;
+	}
+
+	// skip pointers: the words of the blocks are contiguous
+	thrust::exclusive_scan(thrust::cuda::par(allocator).on(stream),
+													block_starts,
+													block_starts + num_blocks + 1,
+													block_starts);
+	IndexType num_words;
+	CUDA_TRY(cudaMemcpy(&num_words, block_starts + num_blocks, sizeof(IndexType), cudaMemcpyDefault));
+
+	uint32_t* data = nullptr;
+	ALLOC_TRY((void**)&data, sizeof(uint32_t) * (num_words + 2), stream);
+	CUDA_TRY(cudaMemset(data, 0, sizeof(uint32_t) * (num_words + 2)));
+	block_pack<IndexType> pack = { range, indices, block_widths, block_starts, data };
+	thrust::for_each(thrust::cuda::par(allocator).on(stream),
+									 thrust::make_counting_iterator<IndexType>(0),
+									 thrust::make_counting_iterator<IndexType>(num_blocks),
+									 pack);
+
+	compressed->offsets = new gdf_column;
+	compressed->block_offsets = new gdf_column;
+	compressed->block_bases = new gdf_column;
+	compressed->block_starts = new gdf_column;
+	compressed->block_widths = new gdf_column;
+	compressed->data = new gdf_column;
+	gdf_column_view(compressed->offsets, offsets_copy, nullptr, n + 1, adj->offsets->dtype);
+	gdf_column_view(compressed->block_offsets, block_offsets, nullptr, n + 1, adj->offsets->dtype);
+	gdf_column_view(compressed->block_bases, block_bases, nullptr, num_blocks, adj->offsets->dtype);
+	gdf_column_view(compressed->block_starts, block_starts, nullptr, num_blocks + 1, adj->offsets->dtype);
+	gdf_column_view(compressed->block_widths, block_widths, nullptr, num_blocks, GDF_INT8);
+	gdf_column_view(compressed->data, data, nullptr, num_words + 2, GDF_INT32);
+	return GDF_SUCCESS;
+}
+
+gdf_error gdf_compress_adj_list(gdf_graph* graph, bool transposed, gdf_compressed_adj_list* compressed) {
+	GDF_REQUIRE(graph != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(compressed != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(compressed->offsets == nullptr, GDF_INVALID_API_CALL);
+	if (transposed)
+		GDF_TRY(gdf_add_transposed_adj_list(graph));
+	else
+		GDF_TRY(gdf_add_adj_list(graph));
+	gdf_adj_list* adj = transposed ? graph->transposedAdjList : graph->adjList;
+	GDF_REQUIRE(adj->offsets->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
+	GDF_REQUIRE(adj->indices->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
+
+	return gdf_compress_adj_list_impl<int32_t>(adj, compressed);
+}
+
+gdf_error gdf_decompress_adj_list(const gdf_compressed_adj_list* compressed, gdf_column* indices) {
+	GDF_REQUIRE(compressed != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(compressed->offsets != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(indices != nullptr, GDF_INVALID_API_CALL);
+
+	cudaStream_t stream { nullptr };
+	rmm_temp_allocator allocator(stream);
+	cugraph::CompressedAdjListView<int32_t> adj = compressed_view<int32_t>(compressed);
+	int32_t nnz;
+	CUDA_TRY(cudaMemcpy(&nnz, adj.offsets + adj.n, sizeof(int32_t), cudaMemcpyDefault));
+
+	int32_t* indices_ptr = nullptr;
+	ALLOC_TRY((void**)&indices_ptr, sizeof(int32_t) * nnz, stream);
+	thrust::for_each(thrust::cuda::par(allocator).on(stream),
+									 thrust::make_counting_iterator<int32_t>(0),
+									 thrust::make_counting_iterator<int32_t>(adj.n),
+									 decompress_row<int32_t> { adj, indices_ptr });
+	gdf_column_view(indices, indices_ptr, nullptr, nnz, compressed->offsets->dtype);
+	return GDF_SUCCESS;
+}
+
+gdf_error gdf_bfs_compressed(const gdf_compressed_adj_list* compressed,
+															gdf_column* distances,
+															gdf_column* predecessors,
+															int start_node) {
+	GDF_REQUIRE(compressed != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(compressed->offsets != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(distances != nullptr && distances->data != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(distances->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
+	GDF_REQUIRE(predecessors == nullptr || predecessors->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
+
+	cudaStream_t stream { nullptr };
+	rmm_temp_allocator allocator(stream);
+	cugraph::CompressedAdjListView<int32_t> adj = compressed_view<int32_t>(compressed);
+	GDF_REQUIRE(start_node >= 0 && start_node < adj.n, GDF_INVALID_API_CALL);
+
+	int32_t* distances_ptr = static_cast<int32_t*>(distances->data);
+	int32_t* predecessors_ptr = predecessors ? static_cast<int32_t*>(predecessors->data) : nullptr;
+	thrust::fill(thrust::cuda::par(allocator).on(stream), distances_ptr, distances_ptr + adj.n, INT_MAX);
+	if (predecessors_ptr)
+		thrust::fill(thrust::cuda::par(allocator).on(stream), predecessors_ptr, predecessors_ptr + adj.n, -1);
+	CUDA_TRY(cudaMemset(distances_ptr + start_node, 0, sizeof(int32_t)));
+
+	// level synchronous, a vertex enters the frontier once
+	Vector<int32_t> frontier(1, start_node), next(adj.n), next_size(1);
+	for (int32_t level = 1; !frontier.empty(); ++level) {
+		next_size[0] = 0;
+		thrust::for_each(thrust::cuda::par(allocator).on(stream),
+										 frontier.begin(),
+										 frontier.end(),
+										 expand_vertex<int32_t> { adj,
+																							level,
+																							distances_ptr,
+																							predecessors_ptr,
+																							thrust::raw_pointer_cast(next.data()),
+																							thrust::raw_pointer_cast(next_size.data()) });
+		frontier.assign(next.begin(), next.begin() + next_size[0]);
+	}
+	return GDF_SUCCESS;
+}
+
+template<typename ValueType>
+gdf_error gdf_jaccard_compressed_impl(const gdf_compressed_adj_list* compressed, gdf_column* result) {
+	cudaStream_t stream { nullptr };
+	rmm_temp_allocator allocator(stream);
+	cugraph::CompressedAdjListView<int32_t> adj = compressed_view<int32_t>(compressed);
+	int32_t nnz;
+	CUDA_TRY(cudaMemcpy(&nnz, adj.offsets + adj.n, sizeof(int32_t), cudaMemcpyDefault));
+	GDF_REQUIRE(result->size == nnz, GDF_COLUMN_SIZE_MISMATCH);
+
+	Vector<int32_t> edge_rows(nnz);
+	thrust::upper_bound(thrust::cuda::par(allocator).on(stream),
+											adj.offsets + 1,
+											adj.offsets + adj.n + 1,
+											thrust::make_counting_iterator<int32_t>(0),
+											thrust::make_counting_iterator<int32_t>(nnz),
+											edge_rows.begin());
+	thrust::for_each(thrust::cuda::par(allocator).on(stream),
+									 thrust::make_counting_iterator<int32_t>(0),
+									 thrust::make_counting_iterator<int32_t>(nnz),
+									 edge_jaccard<int32_t, ValueType> { adj,
+																											thrust::raw_pointer_cast(edge_rows.data()),
+																											static_cast<ValueType*>(result->data) });
+	return GDF_SUCCESS;
+}
+
+gdf_error gdf_jaccard_compressed(const gdf_compressed_adj_list* compressed, gdf_column* result) {
+	GDF_REQUIRE(compressed != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(compressed->offsets != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(result != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(result->data != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(!result->valid, GDF_VALIDITY_UNSUPPORTED);
+
+	switch (result->dtype) {
+		case GDF_FLOAT32:
+			return gdf_jaccard_compressed_impl<float>(compressed, result);
+		case GDF_FLOAT64:
+			return gdf_jaccard_compressed_impl<double>(compressed, result);
+		default:
+			return GDF_UNSUPPORTED_DTYPE;
+	}
+}
+
+template<typename WT>
+gdf_error gdf_pagerank_compressed_impl(const gdf_compressed_adj_list* compressed,
+																				gdf_column* pagerank,
+																				float alpha,
+																				float tolerance,
+																				int max_iter,
+																				bool has_guess) {
+	cudaStream_t stream { nullptr };
+	rmm_temp_allocator allocator(stream);
+	cugraph::CompressedAdjListView<int32_t> adj = compressed_view<int32_t>(compressed);
+	int m = adj.n, nnz, status = 0;
+	CUDA_TRY(cudaMemcpy(&nnz, adj.offsets + m, sizeof(int), cudaMemcpyDefault));
+	GDF_REQUIRE(pagerank->size == m, GDF_COLUMN_SIZE_MISMATCH);
+
+	WT *d_pr, *d_val = nullptr, *d_leaf_vector = nullptr;
+	WT res = 1.0;
+	WT *residual = &res;
+	int *degree = nullptr;
+	ALLOC_MANAGED_TRY((void**)&d_leaf_vector, sizeof(WT) * m, stream);
+	ALLOC_MANAGED_TRY((void**)&d_val, sizeof(WT) * nnz, stream);
+	ALLOC_MANAGED_TRY((void**)&d_pr, sizeof(WT) * m, stream);
+	ALLOC_MANAGED_TRY((void**)&degree, sizeof(int) * m, stream);
+
+	// same values and dangling nodes as HT_matrix_csc_coo
+	CUDA_TRY(cudaMemset(degree, 0, sizeof(int) * m));
+	thrust::for_each(thrust::cuda::par(allocator).on(stream),
+									 thrust::make_counting_iterator<int>(0),
+									 thrust::make_counting_iterator<int>(m),
+									 HT_column<int, WT> { adj, degree, nullptr });
+	thrust::for_each(thrust::cuda::par(allocator).on(stream),
+									 thrust::make_counting_iterator<int>(0),
+									 thrust::make_counting_iterator<int>(m),
+									 HT_column<int, WT> { adj, degree, d_val });
+	cugraph::fill(m, d_leaf_vector, (WT) 0.0);
+	dim3 nthreads, nblocks;
+	nthreads.x = min(m, CUDA_MAX_KERNEL_THREADS);
+	nblocks.x = min((m + nthreads.x - 1) / nthreads.x, CUDA_MAX_BLOCKS);
+	cugraph::flag_leafs<int, WT> <<<nblocks, nthreads>>>(m, degree, d_leaf_vector);
+	ALLOC_FREE_TRY(degree, stream);
+
+	if (has_guess)
+		cugraph::copy<WT>(m, (WT*)pagerank->data, d_pr);
+
+	status = cugraph::pagerank_compressed<int, WT>(adj, d_val, alpha, d_leaf_vector, has_guess, tolerance, max_iter, d_pr, residual);
+
+	if (status != 0)
+		switch (status) {
+			case -1: std::cerr << "Error : bad parameters in Pagerank" << std::endl; return GDF_CUDA_ERROR;
+			case 1: std::cerr << "Warning : Pagerank did not reached the desired tolerance" << std::endl; return GDF_CUDA_ERROR;
+			default: std::cerr << "Pagerank failed" << std::endl; return GDF_CUDA_ERROR;
+		}
+
+	cugraph::copy<WT>(m, d_pr, (WT*)pagerank->data);
+
+	ALLOC_FREE_TRY(d_val, stream);
+	ALLOC_FREE_TRY(d_pr, stream);
+	ALLOC_FREE_TRY(d_leaf_vector, stream);
+	return GDF_SUCCESS;
+}
+
+gdf_error gdf_pagerank_compressed(const gdf_compressed_adj_list* compressed_transposed,
+																	gdf_column* pagerank,
+																	float alpha,
+																	float tolerance,
+																	int max_iter,
+																	bool has_guess) {
+	GDF_REQUIRE(compressed_transposed != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(compressed_transposed->offsets != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(pagerank != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(pagerank->data != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(pagerank->null_count == 0, GDF_VALIDITY_UNSUPPORTED);
+
+	switch (pagerank->dtype) {
+		case GDF_FLOAT32:
+			return gdf_pagerank_compressed_impl<float>(compressed_transposed, pagerank, alpha, tolerance, max_iter, has_guess);
+		case GDF_FLOAT64:
+			return gdf_pagerank_compressed_impl<double>(compressed_transposed, pagerank, alpha, tolerance, max_iter, has_guess);
+		default:
+			return GDF_UNSUPPORTED_DTYPE;
+	}
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** ---------------------------------------------------------------------------*
+ * @brief Compressed adjacency list layout and its decoders
+ *
+ * The neighbors of every row are cut in blocks of COMPRESSED_BLOCK_SIZE.
+ * A block stores its first neighbor (base), the bit width of its deltas
+ * and the first 32-bit word of its deltas in the packed data (skip pointer),
+ * the deltas between consecutive neighbors are bit-packed at the block width.
+ * Rows must be sorted. Blocks start on a word boundary so they are packed
+ * and decoded independently, the data has two padding words so that a delta
+ * is always read from two consecutive words.
+ * The row offsets are kept: degrees and edge ids (to index edge data) are
+ * the ones of the plain layout.
+ *
+ * @file compressed_adj_list.cuh
+ * ---------------------------------------------------------------------------**/
+
+#pragma once
+
+#include <stdint.h>
+
+#define COMPRESSED_BLOCK_SIZE 32
+
+namespace cugraph {
+
+template<typename IndexType>
+struct CompressedAdjListView {
+	IndexType n;
+	const IndexType *offsets;        // n+1, row offsets of the plain layout
+	const IndexType *block_offsets;  // n+1, first block of every row
+	const IndexType *block_bases;    // first neighbor of every block
+	const IndexType *block_starts;   // first word of every block in data
+	const int8_t *block_widths;      // bits of the deltas of every block
+	const uint32_t *data;
+
+	__host__ __device__ __forceinline__
+	IndexType degree(IndexType v) const {
+		return offsets[v + 1] - offsets[v];
+	}
+
+	// edge id of the first neighbor of block b of row v
+	__host__ __device__ __forceinline__
+	IndexType block_edge(IndexType v, IndexType b) const {
+		return offsets[v] + (b - block_offsets[v]) * COMPRESSED_BLOCK_SIZE;
+	}
+
+	// k-th delta of block b, 0 < k < block length
+	__host__ __device__ __forceinline__
+	IndexType delta(IndexType b, int k) const {
+		int width = block_widths[b];
+		uint64_t pos = (uint64_t) (k - 1) * width;
+		const uint32_t *w = data + block_starts[b] + (pos >> 5);
+		uint64_t two = ((uint64_t) w[1] << 32) | w[0];
+		return (IndexType) ((two >> (pos & 31)) & (((uint64_t) 1 << width) - 1));
+	}
+
+	// neighbor of edge e of row v, decodes the beginning of its block only
+	__host__ __device__ __forceinline__
+	IndexType neighbor(IndexType v, IndexType e) const {
+		IndexType b = block_offsets[v] + (e - offsets[v]) / COMPRESSED_BLOCK_SIZE;
+		int k = (e - offsets[v]) % COMPRESSED_BLOCK_SIZE;
+		IndexType u = block_bases[b];
+		for (int j = 1; j <= k; j++)
+			u += delta(b, j);
+		return u;
+	}
+
+	// calls f(edge id, neighbor) for the neighbors of v, in order
+	template<typename F>
+	__host__ __device__ __forceinline__
+	void for_each_neighbor(IndexType v, F &f) const {
+		IndexType end = offsets[v + 1];
+		for (IndexType b = block_offsets[v]; b < block_offsets[v + 1]; b++) {
+			IndexType e = block_edge(v, b);
+			IndexType len = end - e < COMPRESSED_BLOCK_SIZE ? end - e : COMPRESSED_BLOCK_SIZE;
+			IndexType u = block_bases[b];
+			f(e, u);
+			for (int k = 1; k < len; k++) {
+				u += delta(b, k);
+				f(e + k, u);
+			}
+		}
+	}
+
+	// true if u is a neighbor of v: binary search of the block bases, then decode one block
+	__host__ __device__ __forceinline__
+	bool contains(IndexType v, IndexType u) const {
+		IndexType left = block_offsets[v], right = block_offsets[v + 1] - 1;
+		if (left > right || block_bases[left] > u)
+			return false;
+		// last block whose base is <= u
+		while (left < right) {
+			IndexType middle = (left + right + 1) >> 1;
+			if (block_bases[middle] <= u)
+				left = middle;
+			else
+				right = middle - 1;
+		}
+		IndexType e = block_edge(v, left);
+		IndexType len = offsets[v + 1] - e < COMPRESSED_BLOCK_SIZE ? offsets[v + 1] - e : COMPRESSED_BLOCK_SIZE;
+		IndexType w = block_bases[left];
+		for (int k = 1; k < len && w < u; k++)
+			w += delta(left, k);
+		return w == u;
+	}
+};
+
+// Block layout of the sorted indices [e, e+len): base, width and number of words;
+// returns false if the indices are not sorted
+template<typename IndexType>
+__host__ __device__ __forceinline__
+bool compressed_block_layout(const IndexType *indices, IndexType len, IndexType *base, int8_t *width, IndexType *words) {
+	uint32_t max_delta = 0;
+	bool sorted = true;
+	for (IndexType k = 1; k < len; k++) {
+		IndexType d = indices[k] - indices[k - 1];
+		sorted = sorted && d >= 0;
+		max_delta |= (uint32_t) d;
+	}
+	int w = 0;
+	while (w < 32 && (max_delta >> w) != 0)
+		w++;
+	*base = indices[0];
+	*width = (int8_t) w;
+	*words = (IndexType) (((uint64_t) (len - 1) * w + 31) >> 5);
+	return sorted;
+}
+
+// Packs the deltas of the sorted indices [e, e+len) at width bits from data[0]
+template<typename IndexType>
+__host__ __device__ __forceinline__
+void compressed_block_pack(const IndexType *indices, IndexType len, int width, uint32_t *data) {
+	uint64_t acc = 0;
+	int bits = 0;
+	for (IndexType k = 1; k < len; k++) {
+		acc |= (uint64_t) (uint32_t) (indices[k] - indices[k - 1]) << bits;
+		bits += width;
+		if (bits >= 32) {
+			*data++ = (uint32_t) acc;
+			acc >>= 32;
+			bits -= 32;
+		}
+	}
+	if (bits > 0)
+		*data = (uint32_t) acc;
+}
+
+} //namespace cugraph
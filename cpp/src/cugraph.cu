@@ -66,8 +66,9 @@ gdf_error gdf_adj_list_view(gdf_graph *graph, const gdf_column *offsets,
                                  const gdf_column *indices, const gdf_column *edge_data) {
   GDF_REQUIRE( offsets->null_count == 0 , GDF_VALIDITY_UNSUPPORTED );                    
   GDF_REQUIRE( indices->null_count == 0 , GDF_VALIDITY_UNSUPPORTED );
-  GDF_REQUIRE( (offsets->dtype == indices->dtype), GDF_UNSUPPORTED_DTYPE );
-  GDF_REQUIRE( ((offsets->dtype == GDF_INT32) || (offsets->dtype == GDF_INT64)), GDF_UNSUPPORTED_DTYPE );
+  GDF_REQUIRE( ((indices->dtype == GDF_INT32) || (indices->dtype == GDF_INT64)), GDF_UNSUPPORTED_DTYPE );
+  // 64 bits offsets can index 32 bits vertices
+  GDF_REQUIRE( ((offsets->dtype == indices->dtype) || (offsets->dtype == GDF_INT64)), GDF_UNSUPPORTED_DTYPE );
   GDF_REQUIRE( (offsets->size > 0), GDF_DATASET_EMPTY ); 
   GDF_REQUIRE( (graph->adjList == nullptr) , GDF_INVALID_API_CALL);
 
@@ -92,7 +93,11 @@ gdf_error gdf_adj_list_view(gdf_graph *graph, const gdf_column *offsets,
 gdf_error gdf_adj_list::get_vertex_identifiers(gdf_column *identifiers) {
   GDF_REQUIRE( offsets != nullptr , GDF_INVALID_API_CALL);
   GDF_REQUIRE( offsets->data != nullptr , GDF_INVALID_API_CALL);
-  cugraph::sequence<int>((int)offsets->size-1, (int*)identifiers->data);
+  GDF_REQUIRE( identifiers->dtype == indices->dtype, GDF_UNSUPPORTED_DTYPE );
+  if (indices->dtype == GDF_INT64)
+    cugraph::sequence<int64_t>((int64_t)offsets->size-1, (int64_t*)identifiers->data);
+  else
+    cugraph::sequence<int>((int)offsets->size-1, (int*)identifiers->data);
   return GDF_SUCCESS;
 }
 
@@ -102,7 +107,12 @@ gdf_error gdf_adj_list::get_source_indices (gdf_column *src_indices) {
   GDF_REQUIRE( src_indices->size == indices->size, GDF_COLUMN_SIZE_MISMATCH );
   GDF_REQUIRE( src_indices->dtype == indices->dtype, GDF_UNSUPPORTED_DTYPE );
   GDF_REQUIRE( src_indices->size > 0, GDF_DATASET_EMPTY ); 
-  cugraph::offsets_to_indices<int>((int*)offsets->data, offsets->size-1, (int*)src_indices->data);
+  if (offsets->dtype == GDF_INT32)
+    cugraph::offsets_to_indices<int>((int*)offsets->data, offsets->size-1, (int*)src_indices->data);
+  else if (indices->dtype == GDF_INT32)
+    cugraph::offsets_to_indices<int>((int64_t*)offsets->data, offsets->size-1, (int*)src_indices->data);
+  else
+    cugraph::offsets_to_indices<int64_t>((int64_t*)offsets->data, offsets->size-1, (int64_t*)src_indices->data);
 
   return GDF_SUCCESS;
 }
@@ -135,11 +145,21 @@ gdf_error gdf_edge_list_view(gdf_graph *graph, const gdf_column *src_indices,
   return GDF_SUCCESS;
 }
 
-template <typename WT>
+// Type of the offsets of the adjacency lists built from an edge list: 64 bits if the vertex ids
+// are 64 bits or if the number of edges does not fit in 32 bits
+gdf_dtype gdf_offsets_dtype(const gdf_edge_list *edgeList) {
+  if (edgeList->src_indices->dtype == GDF_INT64 || (int64_t)edgeList->src_indices->size > (int64_t)INT32_MAX)
+    return GDF_INT64;
+  return GDF_INT32;
+}
+
+template <typename VT, typename ET, typename WT>
 gdf_error gdf_add_adj_list_impl (gdf_graph *graph) {
     if (graph->adjList == nullptr) {
       GDF_REQUIRE( graph->edgeList != nullptr , GDF_INVALID_API_CALL);
-      int nnz = graph->edgeList->src_indices->size, status = 0;
+      int64_t nnz = graph->edgeList->src_indices->size;
+      int status = 0;
+      gdf_dtype offsets_dtype = sizeof(ET) == sizeof(int64_t) ? GDF_INT64 : GDF_INT32;
       graph->adjList = new gdf_adj_list;
       graph->adjList->offsets = new gdf_column;
       graph->adjList->indices = new gdf_column;
@@ -148,21 +168,21 @@ gdf_error gdf_add_adj_list_impl (gdf_graph *graph) {
     if (graph->edgeList->edge_data!= nullptr) {
       graph->adjList->edge_data = new gdf_column;
 
-      CSR_Result_Weighted<int,WT> adj_list;
-      status = ConvertCOOtoCSR_weighted((int*)graph->edgeList->src_indices->data, (int*)graph->edgeList->dest_indices->data, (WT*)graph->edgeList->edge_data->data, nnz, adj_list);
+      CSR_Result_Weighted<VT,WT,ET> adj_list;
+      status = ConvertCOOtoCSR_weighted((VT*)graph->edgeList->src_indices->data, (VT*)graph->edgeList->dest_indices->data, (WT*)graph->edgeList->edge_data->data, nnz, adj_list);
       
       gdf_column_view(graph->adjList->offsets, adj_list.rowOffsets, 
-                            nullptr, adj_list.size+1, graph->edgeList->src_indices->dtype);
+                            nullptr, adj_list.size+1, offsets_dtype);
       gdf_column_view(graph->adjList->indices, adj_list.colIndices, 
                             nullptr, adj_list.nnz, graph->edgeList->src_indices->dtype);
       gdf_column_view(graph->adjList->edge_data, adj_list.edgeWeights, 
                           nullptr, adj_list.nnz, graph->edgeList->edge_data->dtype);
     }
     else {
-      CSR_Result<int> adj_list;
-      status = ConvertCOOtoCSR((int*)graph->edgeList->src_indices->data,(int*)graph->edgeList->dest_indices->data, nnz, adj_list);      
+      CSR_Result<VT,ET> adj_list;
+      status = ConvertCOOtoCSR((VT*)graph->edgeList->src_indices->data,(VT*)graph->edgeList->dest_indices->data, nnz, adj_list);      
       gdf_column_view(graph->adjList->offsets, adj_list.rowOffsets, 
-                            nullptr, adj_list.size+1, graph->edgeList->src_indices->dtype);
+                            nullptr, adj_list.size+1, offsets_dtype);
       gdf_column_view(graph->adjList->indices, adj_list.colIndices, 
                             nullptr, adj_list.nnz, graph->edgeList->src_indices->dtype);
     }
@@ -177,17 +197,22 @@ gdf_error gdf_add_adj_list_impl (gdf_graph *graph) {
 gdf_error gdf_add_edge_list (gdf_graph *graph) {
     if (graph->edgeList == nullptr) {
       GDF_REQUIRE( graph->adjList != nullptr , GDF_INVALID_API_CALL);
-      int *d_src;
+      void *d_src;
       graph->edgeList = new gdf_edge_list;
       graph->edgeList->src_indices = new gdf_column;
       graph->edgeList->dest_indices = new gdf_column;
       graph->edgeList->ownership = 2;
 
-      CUDA_TRY(cudaMallocManaged ((void**)&d_src, sizeof(int) * graph->adjList->indices->size));
+      size_t vertex_size = graph->adjList->indices->dtype == GDF_INT64 ? sizeof(int64_t) : sizeof(int);
+      CUDA_TRY(cudaMallocManaged ((void**)&d_src, vertex_size * graph->adjList->indices->size));
 
-      cugraph::offsets_to_indices<int>((int*)graph->adjList->offsets->data, 
-                                  graph->adjList->offsets->size-1, 
-                                  (int*)d_src);
+      gdf_column *offsets = graph->adjList->offsets;
+      if (offsets->dtype == GDF_INT32)
+        cugraph::offsets_to_indices<int>((int*)offsets->data, offsets->size-1, (int*)d_src);
+      else if (graph->adjList->indices->dtype == GDF_INT32)
+        cugraph::offsets_to_indices<int>((int64_t*)offsets->data, offsets->size-1, (int*)d_src);
+      else
+        cugraph::offsets_to_indices<int64_t>((int64_t*)offsets->data, offsets->size-1, (int64_t*)d_src);
 
       gdf_column_view(graph->edgeList->src_indices, d_src, 
                       nullptr, graph->adjList->indices->size, graph->adjList->indices->dtype);
@@ -202,11 +227,13 @@ gdf_error gdf_add_edge_list (gdf_graph *graph) {
 }
 
 
-template <typename WT>
+template <typename VT, typename ET, typename WT>
 gdf_error gdf_add_transposed_adj_list_impl (gdf_graph *graph) {
     if (graph->transposedAdjList == nullptr ) {
       GDF_REQUIRE( graph->edgeList != nullptr , GDF_INVALID_API_CALL);
-      int nnz = graph->edgeList->src_indices->size, status = 0;
+      int64_t nnz = graph->edgeList->src_indices->size;
+      int status = 0;
+      gdf_dtype offsets_dtype = sizeof(ET) == sizeof(int64_t) ? GDF_INT64 : GDF_INT32;
       graph->transposedAdjList = new gdf_adj_list;
       graph->transposedAdjList->offsets = new gdf_column;
       graph->transposedAdjList->indices = new gdf_column;
@@ -214,10 +241,10 @@ gdf_error gdf_add_transposed_adj_list_impl (gdf_graph *graph) {
     
       if (graph->edgeList->edge_data) {
         graph->transposedAdjList->edge_data = new gdf_column;
-        CSR_Result_Weighted<int,WT> adj_list;
-        status = ConvertCOOtoCSR_weighted( (int*)graph->edgeList->dest_indices->data, (int*)graph->edgeList->src_indices->data, (WT*)graph->edgeList->edge_data->data, nnz, adj_list);
+        CSR_Result_Weighted<VT,WT,ET> adj_list;
+        status = ConvertCOOtoCSR_weighted( (VT*)graph->edgeList->dest_indices->data, (VT*)graph->edgeList->src_indices->data, (WT*)graph->edgeList->edge_data->data, nnz, adj_list);
         gdf_column_view(graph->transposedAdjList->offsets, adj_list.rowOffsets, 
-                              nullptr, adj_list.size+1, graph->edgeList->src_indices->dtype);
+                              nullptr, adj_list.size+1, offsets_dtype);
         gdf_column_view(graph->transposedAdjList->indices, adj_list.colIndices, 
                               nullptr, adj_list.nnz, graph->edgeList->src_indices->dtype);
         gdf_column_view(graph->transposedAdjList->edge_data, adj_list.edgeWeights, 
@@ -225,10 +252,10 @@ gdf_error gdf_add_transposed_adj_list_impl (gdf_graph *graph) {
       }
       else {
 
-        CSR_Result<int> adj_list;
-        status = ConvertCOOtoCSR((int*)graph->edgeList->dest_indices->data, (int*)graph->edgeList->src_indices->data, nnz, adj_list);      
+        CSR_Result<VT,ET> adj_list;
+        status = ConvertCOOtoCSR((VT*)graph->edgeList->dest_indices->data, (VT*)graph->edgeList->src_indices->data, nnz, adj_list);      
         gdf_column_view(graph->transposedAdjList->offsets, adj_list.rowOffsets, 
-                              nullptr, adj_list.size+1, graph->edgeList->src_indices->dtype);
+                              nullptr, adj_list.size+1, offsets_dtype);
         gdf_column_view(graph->transposedAdjList->indices, adj_list.colIndices, 
                               nullptr, adj_list.nnz, graph->edgeList->src_indices->dtype);
       }
@@ -240,6 +267,60 @@ gdf_error gdf_add_transposed_adj_list_impl (gdf_graph *graph) {
     return GDF_SUCCESS;
 }
 
+template <typename VT, typename ET, typename WT>
+gdf_error gdf_add_adj_lists_impl (gdf_graph *graph) {
+    GDF_REQUIRE( graph->edgeList != nullptr , GDF_INVALID_API_CALL);
+    int64_t nnz = graph->edgeList->src_indices->size;
+    int status = 0;
+    gdf_dtype offsets_dtype = sizeof(ET) == sizeof(int64_t) ? GDF_INT64 : GDF_INT32;
+    graph->adjList = new gdf_adj_list;
+    graph->adjList->offsets = new gdf_column;
+    graph->adjList->indices = new gdf_column;
+    graph->adjList->ownership = 1;
+    graph->transposedAdjList = new gdf_adj_list;
+    graph->transposedAdjList->offsets = new gdf_column;
+    graph->transposedAdjList->indices = new gdf_column;
+    graph->transposedAdjList->ownership = 1;
+
+    if (graph->edgeList->edge_data != nullptr) {
+      graph->adjList->edge_data = new gdf_column;
+      graph->transposedAdjList->edge_data = new gdf_column;
+
+      CSR_Result_Weighted<VT,WT,ET> adj_list, transposed_adj_list;
+      status = ConvertCOOtoCSRandCSC_weighted((VT*)graph->edgeList->src_indices->data, (VT*)graph->edgeList->dest_indices->data, (WT*)graph->edgeList->edge_data->data, nnz, adj_list, transposed_adj_list);
+
+      gdf_column_view(graph->adjList->offsets, adj_list.rowOffsets, 
+                            nullptr, adj_list.size+1, offsets_dtype);
+      gdf_column_view(graph->adjList->indices, adj_list.colIndices, 
+                            nullptr, adj_list.nnz, graph->edgeList->src_indices->dtype);
+      gdf_column_view(graph->adjList->edge_data, adj_list.edgeWeights, 
+                          nullptr, adj_list.nnz, graph->edgeList->edge_data->dtype);
+      gdf_column_view(graph->transposedAdjList->offsets, transposed_adj_list.rowOffsets, 
+                            nullptr, transposed_adj_list.size+1, offsets_dtype);
+      gdf_column_view(graph->transposedAdjList->indices, transposed_adj_list.colIndices, 
+                            nullptr, transposed_adj_list.nnz, graph->edgeList->src_indices->dtype);
+      gdf_column_view(graph->transposedAdjList->edge_data, transposed_adj_list.edgeWeights, 
+                          nullptr, transposed_adj_list.nnz, graph->edgeList->edge_data->dtype);
+    }
+    else {
+      CSR_Result<VT,ET> adj_list, transposed_adj_list;
+      status = ConvertCOOtoCSRandCSC((VT*)graph->edgeList->src_indices->data, (VT*)graph->edgeList->dest_indices->data, nnz, adj_list, transposed_adj_list);
+      gdf_column_view(graph->adjList->offsets, adj_list.rowOffsets, 
+                            nullptr, adj_list.size+1, offsets_dtype);
+      gdf_column_view(graph->adjList->indices, adj_list.colIndices, 
+                            nullptr, adj_list.nnz, graph->edgeList->src_indices->dtype);
+      gdf_column_view(graph->transposedAdjList->offsets, transposed_adj_list.rowOffsets, 
+                            nullptr, transposed_adj_list.size+1, offsets_dtype);
+      gdf_column_view(graph->transposedAdjList->indices, transposed_adj_list.colIndices, 
+                            nullptr, transposed_adj_list.nnz, graph->edgeList->src_indices->dtype);
+    }
+    if (status !=0) {
+      std::cerr << "Could not generate the adj_lists" << std::endl;
+      return GDF_CUDA_ERROR;
+    }
+    return GDF_SUCCESS;
+}
+
 gdf_error gdf_degree_impl(int n, int e, gdf_column* col_ptr, gdf_column* degree, bool offsets) {
   if(offsets == true) {
     dim3 nthreads, nblocks;
@@ -309,35 +390,24 @@ gdf_error gdf_degree(gdf_graph *graph, gdf_column *degree, int x) {
 }
 
 
-template <typename WT>
+template <typename VT, typename ET, typename WT>
 gdf_error gdf_pagerank_impl (gdf_graph *graph,
                       gdf_column *pagerank, float alpha = 0.85,
                       float tolerance = 1e-4, int max_iter = 200,
                       bool has_guess = false) {
-  GDF_REQUIRE( graph->edgeList != nullptr, GDF_VALIDITY_UNSUPPORTED );
-  GDF_REQUIRE( graph->edgeList->src_indices->size == graph->edgeList->dest_indices->size, GDF_COLUMN_SIZE_MISMATCH ); 
-  GDF_REQUIRE( graph->edgeList->src_indices->dtype == graph->edgeList->dest_indices->dtype, GDF_UNSUPPORTED_DTYPE );  
-  GDF_REQUIRE( graph->edgeList->src_indices->null_count == 0 , GDF_VALIDITY_UNSUPPORTED );                 
-  GDF_REQUIRE( graph->edgeList->dest_indices->null_count == 0 , GDF_VALIDITY_UNSUPPORTED );  
-  GDF_REQUIRE( pagerank != nullptr , GDF_INVALID_API_CALL ); 
-  GDF_REQUIRE( pagerank->data != nullptr , GDF_INVALID_API_CALL ); 
-  GDF_REQUIRE( pagerank->null_count == 0 , GDF_VALIDITY_UNSUPPORTED );          
-  GDF_REQUIRE( pagerank->size > 0 , GDF_INVALID_API_CALL );         
-
-  int m=pagerank->size, nnz = graph->edgeList->src_indices->size, status = 0;
+  VT m = pagerank->size;
+  ET nnz = graph->transposedAdjList->indices->size;
+  int status = 0;
   WT *d_pr, *d_val = nullptr, *d_leaf_vector = nullptr; 
   WT res = 1.0;
   WT *residual = &res;
 
-  if (graph->transposedAdjList == nullptr) {
-    gdf_add_transposed_adj_list(graph);
-  }
   cudaStream_t stream{nullptr};
   ALLOC_MANAGED_TRY((void**)&d_leaf_vector, sizeof(WT) * m, stream);
   ALLOC_MANAGED_TRY((void**)&d_val, sizeof(WT) * nnz , stream);
   ALLOC_MANAGED_TRY((void**)&d_pr,    sizeof(WT) * m, stream);
 
-  cugraph::HT_matrix_csc_coo(m, nnz, (int*)graph->transposedAdjList->offsets->data, (int*)graph->transposedAdjList->indices->data, d_val, d_leaf_vector);
+  cugraph::HT_matrix_csc_coo(m, nnz, (ET*)graph->transposedAdjList->offsets->data, (VT*)graph->transposedAdjList->indices->data, d_val, d_leaf_vector);
 
   if (has_guess)
   {
@@ -345,7 +415,7 @@ gdf_error gdf_pagerank_impl (gdf_graph *graph,
     cugraph::copy<WT>(m, (WT*)pagerank->data, d_pr);
   }
 
-  status = cugraph::pagerank<int,WT>( m,nnz, (int*)graph->transposedAdjList->offsets->data, (int*)graph->transposedAdjList->indices->data, 
+  status = cugraph::pagerank<VT,WT,ET>( m,nnz, (ET*)graph->transposedAdjList->offsets->data, (VT*)graph->transposedAdjList->indices->data, 
     d_val, alpha, d_leaf_vector, false, tolerance, max_iter, d_pr, residual);
  
   if (status !=0)
@@ -364,6 +434,61 @@ gdf_error gdf_pagerank_impl (gdf_graph *graph,
   return GDF_SUCCESS;
 }
 
+template <typename WT>
+gdf_error gdf_pagerank_dispatch (gdf_graph *graph,
+                      gdf_column *pagerank, float alpha = 0.85,
+                      float tolerance = 1e-4, int max_iter = 200,
+                      bool has_guess = false) {
+  GDF_REQUIRE( graph->edgeList != nullptr, GDF_VALIDITY_UNSUPPORTED );
+  GDF_REQUIRE( graph->edgeList->src_indices->size == graph->edgeList->dest_indices->size, GDF_COLUMN_SIZE_MISMATCH ); 
+  GDF_REQUIRE( graph->edgeList->src_indices->dtype == graph->edgeList->dest_indices->dtype, GDF_UNSUPPORTED_DTYPE );  
+  GDF_REQUIRE( graph->edgeList->src_indices->null_count == 0 , GDF_VALIDITY_UNSUPPORTED );                 
+  GDF_REQUIRE( graph->edgeList->dest_indices->null_count == 0 , GDF_VALIDITY_UNSUPPORTED );  
+  GDF_REQUIRE( pagerank != nullptr , GDF_INVALID_API_CALL ); 
+  GDF_REQUIRE( pagerank->data != nullptr , GDF_INVALID_API_CALL ); 
+  GDF_REQUIRE( pagerank->null_count == 0 , GDF_VALIDITY_UNSUPPORTED );          
+  GDF_REQUIRE( pagerank->size > 0 , GDF_INVALID_API_CALL );         
+
+  if (graph->transposedAdjList == nullptr) {
+    GDF_TRY(gdf_add_transposed_adj_list(graph));
+  }
+  // the CSC keeps the widths it was built (or viewed) with
+  gdf_dtype offsets_dtype = graph->transposedAdjList->offsets->dtype;
+  gdf_dtype indices_dtype = graph->transposedAdjList->indices->dtype;
+  if (offsets_dtype == GDF_INT32)
+    return gdf_pagerank_impl<int32_t, int32_t, WT>(graph, pagerank, alpha, tolerance, max_iter, has_guess);
+  if (indices_dtype == GDF_INT32)
+    return gdf_pagerank_impl<int32_t, int64_t, WT>(graph, pagerank, alpha, tolerance, max_iter, has_guess);
+  return gdf_pagerank_impl<int64_t, int64_t, WT>(graph, pagerank, alpha, tolerance, max_iter, has_guess);
+}
+
+template <typename WT>
+gdf_error gdf_add_adj_list_dispatch (gdf_graph *graph) {
+  if (gdf_offsets_dtype(graph->edgeList) == GDF_INT32)
+    return gdf_add_adj_list_impl<int32_t, int32_t, WT>(graph);
+  if (graph->edgeList->src_indices->dtype == GDF_INT32)
+    return gdf_add_adj_list_impl<int32_t, int64_t, WT>(graph);
+  return gdf_add_adj_list_impl<int64_t, int64_t, WT>(graph);
+}
+
+template <typename WT>
+gdf_error gdf_add_transposed_adj_list_dispatch (gdf_graph *graph) {
+  if (gdf_offsets_dtype(graph->edgeList) == GDF_INT32)
+    return gdf_add_transposed_adj_list_impl<int32_t, int32_t, WT>(graph);
+  if (graph->edgeList->src_indices->dtype == GDF_INT32)
+    return gdf_add_transposed_adj_list_impl<int32_t, int64_t, WT>(graph);
+  return gdf_add_transposed_adj_list_impl<int64_t, int64_t, WT>(graph);
+}
+
+template <typename WT>
+gdf_error gdf_add_adj_lists_dispatch (gdf_graph *graph) {
+  if (gdf_offsets_dtype(graph->edgeList) == GDF_INT32)
+    return gdf_add_adj_lists_impl<int32_t, int32_t, WT>(graph);
+  if (graph->edgeList->src_indices->dtype == GDF_INT32)
+    return gdf_add_adj_lists_impl<int32_t, int64_t, WT>(graph);
+  return gdf_add_adj_lists_impl<int64_t, int64_t, WT>(graph);
+}
+
 gdf_error gdf_add_adj_list(gdf_graph *graph) {
   if (graph->adjList != nullptr)
     return GDF_SUCCESS;
@@ -373,13 +498,13 @@ gdf_error gdf_add_adj_list(gdf_graph *graph) {
 
   if (graph->edgeList->edge_data != nullptr) {
     switch (graph->edgeList->edge_data->dtype) {
-      case GDF_FLOAT32:   return gdf_add_adj_list_impl<float>(graph);
-      case GDF_FLOAT64:   return gdf_add_adj_list_impl<double>(graph);
+      case GDF_FLOAT32:   return gdf_add_adj_list_dispatch<float>(graph);
+      case GDF_FLOAT64:   return gdf_add_adj_list_dispatch<double>(graph);
       default: return GDF_UNSUPPORTED_DTYPE;
     }
   }
   else {
-    return gdf_add_adj_list_impl<float>(graph);
+    return gdf_add_adj_list_dispatch<float>(graph);
   }
 }
 
@@ -388,13 +513,34 @@ gdf_error gdf_add_transposed_adj_list(gdf_graph *graph) {
     gdf_add_edge_list(graph);
   if (graph->edgeList->edge_data != nullptr) {
     switch (graph->edgeList->edge_data->dtype) {
-      case GDF_FLOAT32:   return gdf_add_transposed_adj_list_impl<float>(graph);
-      case GDF_FLOAT64:   return gdf_add_transposed_adj_list_impl<double>(graph);
+      case GDF_FLOAT32:   return gdf_add_transposed_adj_list_dispatch<float>(graph);
+      case GDF_FLOAT64:   return gdf_add_transposed_adj_list_dispatch<double>(graph);
       default: return GDF_UNSUPPORTED_DTYPE;
     }
   }
   else {
-    return gdf_add_transposed_adj_list_impl<float>(graph);
+    return gdf_add_transposed_adj_list_dispatch<float>(graph);
+  }
+}
+
+gdf_error gdf_add_adj_lists(gdf_graph *graph) {
+  // only one direction is missing
+  if (graph->adjList != nullptr)
+    return gdf_add_transposed_adj_list(graph);
+  if (graph->transposedAdjList != nullptr)
+    return gdf_add_adj_list(graph);
+
+  GDF_REQUIRE( graph->edgeList != nullptr , GDF_INVALID_API_CALL);
+
+  if (graph->edgeList->edge_data != nullptr) {
+    switch (graph->edgeList->edge_data->dtype) {
+      case GDF_FLOAT32:   return gdf_add_adj_lists_dispatch<float>(graph);
+      case GDF_FLOAT64:   return gdf_add_adj_lists_dispatch<double>(graph);
+      default: return GDF_UNSUPPORTED_DTYPE;
+    }
+  }
+  else {
+    return gdf_add_adj_lists_dispatch<float>(graph);
   }
 }
 
@@ -424,8 +570,8 @@ gdf_error gdf_delete_transposed_adj_list(gdf_graph *graph) {
 
 gdf_error gdf_pagerank(gdf_graph *graph, gdf_column *pagerank, float alpha, float tolerance, int max_iter, bool has_guess) {
   switch (pagerank->dtype) {
-    case GDF_FLOAT32:   return gdf_pagerank_impl<float>(graph, pagerank, alpha, tolerance, max_iter, has_guess);
-    case GDF_FLOAT64:   return gdf_pagerank_impl<double>(graph, pagerank, alpha, tolerance, max_iter, has_guess);
+    case GDF_FLOAT32:   return gdf_pagerank_dispatch<float>(graph, pagerank, alpha, tolerance, max_iter, has_guess);
+    case GDF_FLOAT64:   return gdf_pagerank_dispatch<double>(graph, pagerank, alpha, tolerance, max_iter, has_guess);
     default: return GDF_UNSUPPORTED_DTYPE;
   }
 }
@@ -435,10 +581,29 @@ gdf_error gdf_bfs(gdf_graph *graph, gdf_column *distances, gdf_column *predecess
   gdf_error err = gdf_add_adj_list(graph);
   if (err != GDF_SUCCESS)
     return err;
-  GDF_REQUIRE(graph->adjList->offsets->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
-  GDF_REQUIRE(graph->adjList->indices->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
-  GDF_REQUIRE(distances->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
-  GDF_REQUIRE(predecessors->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
+  gdf_dtype indices_dtype = graph->adjList->indices->dtype;
+  GDF_REQUIRE(distances->dtype == indices_dtype, GDF_UNSUPPORTED_DTYPE);
+  GDF_REQUIRE(predecessors->dtype == indices_dtype, GDF_UNSUPPORTED_DTYPE);
+
+  // Bfs is instantiated for 32 bits graphs only, wider ones use a top down traversal
+  if (graph->adjList->offsets->dtype == GDF_INT64) {
+    if (indices_dtype == GDF_INT32)
+      cugraph::bfs_top_down<int32_t, int64_t>(graph->adjList->offsets->size - 1,
+                                             (int64_t*)graph->adjList->offsets->data,
+                                             (int32_t*)graph->adjList->indices->data,
+                                             start_node,
+                                             (int32_t*)distances->data,
+                                             (int32_t*)predecessors->data);
+    else
+      cugraph::bfs_top_down<int64_t, int64_t>(graph->adjList->offsets->size - 1,
+                                             (int64_t*)graph->adjList->offsets->data,
+                                             (int64_t*)graph->adjList->indices->data,
+                                             start_node,
+                                             (int64_t*)distances->data,
+                                             (int64_t*)predecessors->data);
+    return GDF_SUCCESS;
+  }
+  GDF_REQUIRE(indices_dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
 
   int n = graph->adjList->offsets->size - 1;
   int e = graph->adjList->indices->size;
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** ---------------------------------------------------------------------------*
+ * @brief Extraction of the k-hop ego network of a set of seed vertices
+ *
+ * @file ego_network.cu
+ * ---------------------------------------------------------------------------**/
+
+#include <cugraph.h>
+#include "utilities/error_utils.h"
+#include <rmm_utils.h>
+
+#include <thrust/device_vector.h>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/extrema.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/merge.h>
+#include <thrust/scan.h>
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/execution_policy.h>
+
+template<typename T>
+using Vector = thrust::device_vector<T, rmm_allocator<T>>;
+
+namespace {
+
+template<typename IndexType>
+struct vertex_degree {
+	const IndexType* offsets;
+	vertex_degree(const IndexType* _offsets) :
+			offsets(_offsets) {
+	}
+
+	__host__ __device__
+	IndexType operator()(IndexType v) const {
+		return offsets[v + 1] - offsets[v];
+	}
+};
+
+// Edge id of the k-th edge out of a set of vertices, owner[k] being the position of its source in the set
+template<typename IndexType>
+struct expanded_edge_id {
+	const IndexType* vertices;
+	const IndexType* offsets;
+	const IndexType* exsum_degree;
+	const IndexType* owner;
+	expanded_edge_id(const IndexType* _vertices,
+										const IndexType* _offsets,
+										const IndexType* _exsum_degree,
+										const IndexType* _owner) :
+			vertices(_vertices), offsets(_offsets), exsum_degree(_exsum_degree), owner(_owner) {
+	}
+
+	__host__ __device__
+	IndexType operator()(IndexType k) const {
+		IndexType o = owner[k];
+		return offsets[vertices[o]] + k - exsum_degree[o];
+	}
+};
+
+// Lists the edges out of the vertices of a set: exsum_degree gets the set size + 1 offsets of
+// their edge lists in the output, edge_ids the ids of the edges. Only touches those edges.
+template<typename IndexType>
+IndexType expand_edges(const IndexType* offsets,
+												const Vector<IndexType>& vertices,
+												Vector<IndexType>& exsum_degree,
+												Vector<IndexType>& edge_ids,
+												cudaStream_t stream) {
+	rmm_temp_allocator allocator(stream);
+	IndexType size = vertices.size();
+
+	exsum_degree.resize(size + 1);
+	exsum_degree[0] = 0;
+	thrust::transform(thrust::cuda::par(allocator).on(stream),
+										vertices.begin(),
+										vertices.end(),
+										exsum_degree.begin() + 1,
+										vertex_degree<IndexType>(offsets));
+	thrust::inclusive_scan(thrust::cuda::par(allocator).on(stream),
+													exsum_degree.begin() + 1,
+													exsum_degree.end(),
+													exsum_degree.begin() + 1);
+	IndexType num_edges = exsum_degree[size];
+
+	// owner of the k-th edge: the first vertex whose edge list ends after k
+	Vector<IndexType> owner(num_edges);
+	thrust::upper_bound(thrust::cuda::par(allocator).on(stream),
+											exsum_degree.begin() + 1,
+											exsum_degree.end(),
+											thrust::make_counting_iterator<IndexType>(0),
+											thrust::make_counting_iterator<IndexType>(num_edges),
+											owner.begin());
+
+	edge_ids.resize(num_edges);
+	thrust::transform(thrust::cuda::par(allocator).on(stream),
+										thrust::make_counting_iterator<IndexType>(0),
+										thrust::make_counting_iterator<IndexType>(num_edges),
+										edge_ids.begin(),
+										expanded_edge_id<IndexType>(thrust::raw_pointer_cast(vertices.data()),
+																								offsets,
+																								thrust::raw_pointer_cast(exsum_degree.data()),
+																								thrust::raw_pointer_cast(owner.data())));
+	return num_edges;
+}
+
+template<typename WT, typename IndexType>
+void gather_edge_data(const gdf_column* edge_data,
+											const Vector<IndexType>& kept_ids,
+											gdf_column* ego_edge_data,
+											cudaStream_t stream) {
+	rmm_temp_allocator allocator(stream);
+	WT* data = nullptr;
+	ALLOC_TRY((void**)&data, sizeof(WT) * kept_ids.size(), stream);
+	thrust::gather(thrust::cuda::par(allocator).on(stream),
+									kept_ids.begin(),
+									kept_ids.end(),
+									static_cast<WT*>(edge_data->data),
+									data);
+	gdf_column_view(ego_edge_data, data, nullptr, kept_ids.size(), edge_data->dtype);
+}
+
+} // end anonymous namespace
+
+template<typename IndexType>
+gdf_error gdf_extract_ego_network_impl(gdf_graph* graph,
+																				const gdf_column* seeds,
+																				int radius,
+																				gdf_graph* ego,
+																				gdf_column* vertex_map) {
+	cudaStream_t stream { nullptr };
+	rmm_temp_allocator allocator(stream);
+
+	IndexType num_verts = graph->adjList->offsets->size - 1;
+	const IndexType* offsets = static_cast<const IndexType*>(graph->adjList->offsets->data);
+	const IndexType* indices = static_cast<const IndexType*>(graph->adjList->indices->data);
+	const IndexType* seeds_ptr = static_cast<const IndexType*>(seeds->data);
+
+	auto seed_range = thrust::minmax_element(thrust::cuda::par(allocator).on(stream),
+																					 seeds_ptr,
+																					 seeds_ptr + seeds->size);
+	IndexType min_seed, max_seed;
+	CUDA_TRY(cudaMemcpy(&min_seed, seed_range.first, sizeof(IndexType), cudaMemcpyDefault));
+	CUDA_TRY(cudaMemcpy(&max_seed, seed_range.second, sizeof(IndexType), cudaMemcpyDefault));
+	GDF_REQUIRE(min_seed >= 0 && max_seed < num_verts, GDF_INVALID_API_CALL);
+
+	// Bounded frontier expansion: visited is kept sorted, each level only expands the new vertices
+	Vector<IndexType> visited(seeds_ptr, seeds_ptr + seeds->size);
+	thrust::sort(thrust::cuda::par(allocator).on(stream), visited.begin(), visited.end());
+	visited.erase(thrust::unique(thrust::cuda::par(allocator).on(stream), visited.begin(), visited.end()),
+								visited.end());
+
+	Vector<IndexType> frontier(visited);
+	Vector<IndexType> exsum_degree, edge_ids;
+	for (int level = 0; level < radius && !frontier.empty(); ++level) {
+		IndexType num_edges = expand_edges(offsets, frontier, exsum_degree, edge_ids, stream);
+
+		Vector<IndexType> neighbors(num_edges);
+		thrust::gather(thrust::cuda::par(allocator).on(stream),
+										edge_ids.begin(),
+										edge_ids.end(),
+										indices,
+										neighbors.begin());
+		thrust::sort(thrust::cuda::par(allocator).on(stream), neighbors.begin(), neighbors.end());
+		neighbors.erase(thrust::unique(thrust::cuda::par(allocator).on(stream), neighbors.begin(), neighbors.end()),
+										neighbors.end());
+
+		frontier.resize(neighbors.size());
+		frontier.erase(thrust::set_difference(thrust::cuda::par(allocator).on(stream),
+																					neighbors.begin(),
+																					neighbors.end(),
+																					visited.begin(),
+																					visited.end(),
+																					frontier.begin()),
+									 frontier.end());
+
+		Vector<IndexType> merged(visited.size() + frontier.size());
+		thrust::merge(thrust::cuda::par(allocator).on(stream),
+									visited.begin(),
+									visited.end(),
+									frontier.begin(),
+									frontier.end(),
+									merged.begin());
+		visited.swap(merged);
+	}
+
+	// Induced subgraph: keep the edges out of the ego vertices that end in the ego network
+	IndexType num_ego_verts = visited.size();
+	IndexType num_edges = expand_edges(offsets, visited, exsum_degree, edge_ids, stream);
+
+	Vector<IndexType> destinations(num_edges);
+	thrust::gather(thrust::cuda::par(allocator).on(stream),
+									edge_ids.begin(),
+									edge_ids.end(),
+									indices,
+									destinations.begin());
+	Vector<IndexType> kept_pos(num_edges + 1, 0);
+	thrust::binary_search(thrust::cuda::par(allocator).on(stream),
+												visited.begin(),
+												visited.end(),
+												destinations.begin(),
+												destinations.end(),
+												kept_pos.begin());
+	Vector<IndexType> kept(kept_pos);
+	thrust::exclusive_scan(thrust::cuda::par(allocator).on(stream),
+													kept_pos.begin(),
+													kept_pos.end(),
+													kept_pos.begin());
+	IndexType num_ego_edges = kept_pos[num_edges];
+
+	IndexType *ego_offsets = nullptr, *ego_indices = nullptr, *ego_map = nullptr;
+	ALLOC_TRY((void**)&ego_offsets, sizeof(IndexType) * (num_ego_verts + 1), stream);
+	ALLOC_TRY((void**)&ego_indices, sizeof(IndexType) * num_ego_edges, stream);
+	ALLOC_TRY((void**)&ego_map, sizeof(IndexType) * num_ego_verts, stream);
+
+	// row i starts at the number of edges kept before the edges of visited[i]
+	thrust::gather(thrust::cuda::par(allocator).on(stream),
+									exsum_degree.begin(),
+									exsum_degree.end(),
+									kept_pos.begin(),
+									ego_offsets);
+
+	Vector<IndexType> kept_ids(num_ego_edges), kept_destinations(num_ego_edges);
+	thrust::copy_if(thrust::cuda::par(allocator).on(stream),
+									edge_ids.begin(),
+									edge_ids.end(),
+									kept.begin(),
+									kept_ids.begin(),
+									thrust::identity<IndexType>());
+	thrust::copy_if(thrust::cuda::par(allocator).on(stream),
+									destinations.begin(),
+									destinations.end(),
+									kept.begin(),
+									kept_destinations.begin(),
+									thrust::identity<IndexType>());
+	// renumber: position in the sorted ego vertices
+	thrust::lower_bound(thrust::cuda::par(allocator).on(stream),
+											visited.begin(),
+											visited.end(),
+											kept_destinations.begin(),
+											kept_destinations.end(),
+											ego_indices);
+	thrust::copy(visited.begin(), visited.end(), ego_map);
+
+	ego->adjList = new gdf_adj_list;
+	ego->adjList->offsets = new gdf_column;
+	ego->adjList->indices = new gdf_column;
+	ego->adjList->ownership = 1;
+	gdf_column_view(ego->adjList->offsets, ego_offsets, nullptr, num_ego_verts + 1, graph->adjList->offsets->dtype);
+	gdf_column_view(ego->adjList->indices, ego_indices, nullptr, num_ego_edges, graph->adjList->indices->dtype);
+	gdf_column_view(vertex_map, ego_map, nullptr, num_ego_verts, graph->adjList->offsets->dtype);
+
+	if (graph->adjList->edge_data != nullptr) {
+		ego->adjList->edge_data = new gdf_column;
+		if (graph->adjList->edge_data->dtype == GDF_FLOAT32)
+			gather_edge_data<float>(graph->adjList->edge_data, kept_ids, ego->adjList->edge_data, stream);
+		else
+			gather_edge_data<double>(graph->adjList->edge_data, kept_ids, ego->adjList->edge_data, stream);
+	}
+	else
+		ego->adjList->edge_data = nullptr;
+	return GDF_SUCCESS;
+}
+
+gdf_error gdf_extract_ego_network(gdf_graph* graph,
+																	const gdf_column* seeds,
+																	int radius,
+																	gdf_graph* ego,
+																	gdf_column* vertex_map) {
+	GDF_REQUIRE(graph != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(seeds != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(ego != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(vertex_map != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(ego->adjList == nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(radius >= 0, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(seeds->size > 0, GDF_DATASET_EMPTY);
+	GDF_REQUIRE(seeds->null_count == 0, GDF_VALIDITY_UNSUPPORTED);
+	GDF_TRY(gdf_add_adj_list(graph));
+	GDF_REQUIRE(seeds->dtype == graph->adjList->offsets->dtype, GDF_UNSUPPORTED_DTYPE);
+	GDF_REQUIRE(graph->adjList->offsets->dtype == graph->adjList->indices->dtype, GDF_UNSUPPORTED_DTYPE);
+	GDF_REQUIRE(graph->adjList->edge_data == nullptr ||
+							graph->adjList->edge_data->dtype == GDF_FLOAT32 ||
+							graph->adjList->edge_data->dtype == GDF_FLOAT64, GDF_UNSUPPORTED_DTYPE);
+
+	switch (graph->adjList->offsets->dtype) {
+		case GDF_INT32:
+			return gdf_extract_ego_network_impl<int32_t>(graph, seeds, radius, ego, vertex_map);
+		case GDF_INT64:
+			return gdf_extract_ego_network_impl<int64_t>(graph, seeds, radius, ego, vertex_map);
+		default:
+			return GDF_UNSUPPORTED_DTYPE;
+	}
+}
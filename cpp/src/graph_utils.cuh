@@ -300,12 +300,29 @@ namespace cugraph
 		cudaCheckError();
 	}
 
+	static __device__ __forceinline__ int atomic_add(int *address, int val) {
+		return atomicAdd(address, val);
+	}
+
+	static __device__ __forceinline__ int64_t atomic_add(int64_t *address, int64_t val) {
+		return (int64_t) atomicAdd((unsigned long long *) address, (unsigned long long) val);
+	}
+
+	static __device__ __forceinline__ int atomic_cas(int *address, int compare, int val) {
+		return atomicCAS(address, compare, val);
+	}
+
+	static __device__ __forceinline__ int64_t atomic_cas(int64_t *address, int64_t compare, int64_t val) {
+		return (int64_t) atomicCAS((unsigned long long *) address, (unsigned long long) compare, (unsigned long long) val);
+	}
+
 //google matrix kernels
-	template<typename IndexType, typename ValueType>
+//the edge ids (and offsets) are of type OffsetType, which can be wider than the vertex ids
+	template<typename IndexType, typename ValueType, typename OffsetType = IndexType>
 	__global__ void __launch_bounds__(CUDA_MAX_KERNEL_THREADS)
-	degree_coo(const IndexType n, const IndexType e, const IndexType *ind, IndexType *degree) {
-		for (int i = threadIdx.x + blockIdx.x * blockDim.x; i < e; i += gridDim.x * blockDim.x)
-			atomicAdd(&degree[ind[i]], 1.0);
+	degree_coo(const IndexType n, const OffsetType e, const IndexType *ind, IndexType *degree) {
+		for (OffsetType i = threadIdx.x + blockIdx.x * blockDim.x; i < e; i += gridDim.x * blockDim.x)
+			atomic_add(&degree[ind[i]], (IndexType) 1);
 	}
 	template<typename IndexType, typename ValueType>
 	__global__ void __launch_bounds__(CUDA_MAX_KERNEL_THREADS)
@@ -321,7 +338,7 @@ namespace cugraph
 	template<typename IndexType, typename ValueType>
 	__global__ void __launch_bounds__(CUDA_MAX_KERNEL_THREADS)
 	flag_leafs(const IndexType n, IndexType *degree, ValueType *bookmark) {
-		for (int i = threadIdx.x + blockIdx.x * blockDim.x; i < n; i += gridDim.x * blockDim.x)
+		for (IndexType i = threadIdx.x + blockIdx.x * blockDim.x; i < n; i += gridDim.x * blockDim.x)
 			if (degree[i] == 0)
 				bookmark[i] = 1.0;
 	}
@@ -371,15 +388,16 @@ namespace cugraph
 		ALLOC_FREE_TRY(degree, stream);
 	}
 
-	template<typename IndexType, typename ValueType>
+	template<typename IndexType, typename ValueType, typename OffsetType = IndexType>
 	__global__ void __launch_bounds__(CUDA_MAX_KERNEL_THREADS)
 	equi_prob3(	const IndexType n,
-							const IndexType e,
-							const IndexType *csrPtr,
+							const OffsetType e,
+							const OffsetType *csrPtr,
 							const IndexType *csrInd,
 							ValueType *val,
 							IndexType *degree) {
-		int j, row, col;
+		IndexType row, col;
+		OffsetType j;
 		for (row = threadIdx.z + blockIdx.z * blockDim.z; row < n; row += gridDim.z * blockDim.z) {
 			for (j = csrPtr[row] + threadIdx.y + blockIdx.y * blockDim.y; j < csrPtr[row + 1];
 					j += gridDim.y * blockDim.y) {
@@ -412,10 +430,10 @@ namespace cugraph
 	}
 
 // compute the H^T values for an already transposed adjacency matrix, leveraging coo info
-	template<typename IndexType, typename ValueType>
+	template<typename IndexType, typename ValueType, typename OffsetType>
 	void HT_matrix_csc_coo(	const IndexType n,
-													const IndexType e,
-													const IndexType *csrPtr,
+													const OffsetType e,
+													const OffsetType *csrPtr,
 													const IndexType *csrInd,
 													ValueType *val,
 													ValueType *bookmark) {
@@ -425,13 +443,13 @@ namespace cugraph
 		cudaMemset(degree, 0, sizeof(IndexType) * n);
 
 		dim3 nthreads, nblocks;
-		nthreads.x = min(e, CUDA_MAX_KERNEL_THREADS);
+		nthreads.x = min(e, (OffsetType) CUDA_MAX_KERNEL_THREADS);
 		nthreads.y = 1;
 		nthreads.z = 1;
-		nblocks.x = min((e + nthreads.x - 1) / nthreads.x, CUDA_MAX_BLOCKS);
+		nblocks.x = min((e + nthreads.x - 1) / nthreads.x, (OffsetType) CUDA_MAX_BLOCKS);
 		nblocks.y = 1;
 		nblocks.z = 1;
-		degree_coo<IndexType, ValueType> <<<nblocks, nthreads>>>(n, e, csrInd, degree);
+		degree_coo<IndexType, ValueType, OffsetType> <<<nblocks, nthreads>>>(n, e, csrInd, degree);
 		cudaCheckError();
 
 		int y = 4;
@@ -440,8 +458,8 @@ namespace cugraph
 		nthreads.z = 8;
 		nblocks.x = 1;
 		nblocks.y = 1;
-		nblocks.z = min((n + nthreads.z - 1) / nthreads.z, CUDA_MAX_BLOCKS); //1;
-		equi_prob3<IndexType, ValueType> <<<nblocks, nthreads>>>(n, e, csrPtr, csrInd, val, degree);
+		nblocks.z = min((n + nthreads.z - 1) / nthreads.z, (IndexType) CUDA_MAX_BLOCKS); //1;
+		equi_prob3<IndexType, ValueType, OffsetType> <<<nblocks, nthreads>>>(n, e, csrPtr, csrInd, val, degree);
 		//printv(e, val , 0);
 		cudaCheckError();
 
@@ -449,10 +467,10 @@ namespace cugraph
 		fill(n, bookmark, a);
 		cudaCheckError();
 
-		nthreads.x = min(n, CUDA_MAX_KERNEL_THREADS);
+		nthreads.x = min(n, (IndexType) CUDA_MAX_KERNEL_THREADS);
 		nthreads.y = 1;
 		nthreads.z = 1;
-		nblocks.x = min((n + nthreads.x - 1) / nthreads.x, CUDA_MAX_BLOCKS);
+		nblocks.x = min((n + nthreads.x - 1) / nthreads.x, (IndexType) CUDA_MAX_BLOCKS);
 		nblocks.y = 1;
 		nblocks.z = 1;
 		flag_leafs<IndexType, ValueType> <<<nblocks, nthreads>>>(n, degree, bookmark);
@@ -558,8 +576,8 @@ namespace cugraph
 		}
 	}
 
-	template<typename IndexType>
-	__global__ void __launch_bounds__(CUDA_MAX_KERNEL_THREADS) offsets_to_indices_kernel(	const IndexType *offsets,
+	template<typename IndexType, typename OffsetType>
+	__global__ void __launch_bounds__(CUDA_MAX_KERNEL_THREADS) offsets_to_indices_kernel(	const OffsetType *offsets,
 																																												IndexType v,
 																																												IndexType *indices) {
 
@@ -567,12 +585,12 @@ namespace cugraph
 		tid = threadIdx.x;
 		ctaStart = blockIdx.x;
 
-		for (int j = ctaStart; j < v; j += gridDim.x) {
-			IndexType colStart = offsets[j];
-			IndexType colEnd = offsets[j + 1];
-			IndexType rowNnz = colEnd - colStart;
+		for (IndexType j = ctaStart; j < v; j += gridDim.x) {
+			OffsetType colStart = offsets[j];
+			OffsetType colEnd = offsets[j + 1];
+			OffsetType rowNnz = colEnd - colStart;
 
-			for (int i = 0; i < rowNnz; i += blockDim.x) {
+			for (OffsetType i = 0; i < rowNnz; i += blockDim.x) {
 				if ((colStart + tid + i) < colEnd) {
 					indices[colStart + tid + i] = j;
 				}
@@ -580,11 +598,11 @@ namespace cugraph
 		}
 	}
 
-	template<typename IndexType>
-	void offsets_to_indices(const IndexType *offsets, IndexType v, IndexType *indices)
+	template<typename IndexType, typename OffsetType>
+	void offsets_to_indices(const OffsetType *offsets, IndexType v, IndexType *indices)
 													{
-		int nthreads = min(v, CUDA_MAX_KERNEL_THREADS);
-		int nblocks = min((v + nthreads - 1) / nthreads, CUDA_MAX_BLOCKS);
+		int nthreads = min(v, (IndexType) CUDA_MAX_KERNEL_THREADS);
+		int nblocks = min((v + nthreads - 1) / nthreads, (IndexType) CUDA_MAX_BLOCKS);
 		offsets_to_indices_kernel<<<nblocks, nthreads>>>(offsets, v, indices);
 		cudaCheckError();
 	}
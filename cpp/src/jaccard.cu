@@ -354,6 +354,7 @@ gdf_error gdf_jaccard(gdf_graph *graph, gdf_column *weights, gdf_column *result)
 
 	GDF_TRY(gdf_add_adj_list(graph));
 	GDF_REQUIRE(graph->adjList != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(graph->adjList->offsets->dtype == graph->adjList->indices->dtype, GDF_UNSUPPORTED_DTYPE);
 
 	bool weighted = (weights != nullptr);
 
@@ -528,6 +529,7 @@ gdf_error gdf_jaccard_list(gdf_graph* graph,
 
 	GDF_TRY(gdf_add_adj_list(graph));
 	GDF_REQUIRE(graph->adjList != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(graph->adjList->offsets->dtype == graph->adjList->indices->dtype, GDF_UNSUPPORTED_DTYPE);
 
 	bool weighted = (weights != nullptr);
 
@@ -126,6 +126,8 @@ gdf_error gdf_createGraph_nvgraph(nvgraphHandle_t nvg_handle,
 			GDF_TRY(gdf_add_transposed_adj_list(gdf_G));
 		}
 		// using exiting transposedAdjList if it exisits and if adjList is missing
+		GDF_REQUIRE(gdf_G->transposedAdjList->offsets->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
+		GDF_REQUIRE(gdf_G->transposedAdjList->indices->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
 		TT = NVGRAPH_CSC_32;
 		nvgraphCSCTopology32I_st topoData;
 		topoData.nvertices = gdf_G->transposedAdjList->offsets->size - 1;
@@ -164,6 +166,8 @@ gdf_error gdf_createGraph_nvgraph(nvgraphHandle_t nvg_handle,
 		if (gdf_G->adjList == nullptr) {
 			GDF_TRY(gdf_add_adj_list(gdf_G));
 		}
+		GDF_REQUIRE(gdf_G->adjList->offsets->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
+		GDF_REQUIRE(gdf_G->adjList->indices->dtype == GDF_INT32, GDF_UNSUPPORTED_DTYPE);
 		TT = NVGRAPH_CSR_32;
 		nvgraphCSRTopology32I_st topoData;
 		topoData.nvertices = gdf_G->adjList->offsets->size - 1;
@@ -515,3 +519,66 @@ gdf_error gdf_AnalyzeClustering_ratio_cut_nvgraph(gdf_graph* gdf_G,
 	return GDF_SUCCESS;
 }
 
+gdf_error gdf_AnalyzeClustering_nvgraph(gdf_graph* gdf_G,
+																				const int n_clusters,
+																				gdf_column* clustering,
+																				float* modularity,
+																				float* edge_cut,
+																				float* ratio_cut,
+																				float* normalized_cut,
+																				int* cluster_sizes,
+																				float* cluster_volumes,
+																				float* cluster_cuts,
+																				float* cluster_conductances) {
+	GDF_REQUIRE(gdf_G != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE((gdf_G->adjList != nullptr) || (gdf_G->edgeList != nullptr), GDF_INVALID_API_CALL);
+	GDF_REQUIRE(clustering != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(clustering->data != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(!clustering->valid, GDF_VALIDITY_UNSUPPORTED);
+	GDF_REQUIRE(modularity != nullptr && edge_cut != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(ratio_cut != nullptr && normalized_cut != nullptr, GDF_INVALID_API_CALL);
+
+	// Initialize Nvgraph and wrap the graph
+	nvgraphHandle_t nvg_handle = nullptr;
+	nvgraphGraphDescr_t nvgraph_G = nullptr;
+	Vector<double> d_val;
+
+	NVG_TRY(nvgraphCreate(&nvg_handle));
+	GDF_TRY(gdf_createGraph_nvgraph(nvg_handle, gdf_G, &nvgraph_G, false));
+	int weight_index = 0;
+
+	cudaStream_t stream { nullptr };
+	rmm_temp_allocator allocator(stream);
+	if (gdf_G->adjList->edge_data == nullptr) {
+		// use a fp64 vector  [1,...,1]
+		d_val.resize(gdf_G->adjList->indices->size);
+		thrust::fill(thrust::cuda::par(allocator).on(stream), d_val.begin(), d_val.end(), 1.0);
+		NVG_TRY(nvgraphAttachEdgeData(nvg_handle,
+																	nvgraph_G,
+																	weight_index,
+																	CUDA_R_64F,
+																	(void * ) thrust::raw_pointer_cast(d_val.data())));
+	}
+
+	// Make Nvgraph call
+	struct nvgraphClusteringScores scores;
+	NVG_TRY(nvgraphAnalyzeClusteringAll(nvg_handle,
+																			nvgraph_G,
+																			weight_index,
+																			n_clusters,
+																			(const int* )clustering->data,
+																			&scores,
+																			cluster_sizes,
+																			cluster_volumes,
+																			cluster_cuts,
+																			cluster_conductances));
+	*modularity = scores.modularity;
+	*edge_cut = scores.edge_cut;
+	*ratio_cut = scores.ratio_cut;
+	*normalized_cut = scores.normalized_cut;
+
+	NVG_TRY(nvgraphDestroyGraphDescr(nvg_handle, nvgraph_G));
+	NVG_TRY(nvgraphDestroy(nvg_handle));
+	return GDF_SUCCESS;
+}
+
@@ -353,6 +353,7 @@ gdf_error gdf_overlap(gdf_graph *graph, gdf_column *weights, gdf_column *result)
 
 	GDF_TRY(gdf_add_adj_list(graph));
 	GDF_REQUIRE(graph->adjList != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(graph->adjList->offsets->dtype == graph->adjList->indices->dtype, GDF_UNSUPPORTED_DTYPE);
 
 	bool weighted = (weights != nullptr);
 
@@ -527,6 +528,7 @@ gdf_error gdf_overlap_list(gdf_graph* graph,
 
 	GDF_TRY(gdf_add_adj_list(graph));
 	GDF_REQUIRE(graph->adjList != nullptr, GDF_INVALID_API_CALL);
+	GDF_REQUIRE(graph->adjList->offsets->dtype == graph->adjList->indices->dtype, GDF_UNSUPPORTED_DTYPE);
 
 	bool weighted = (weights != nullptr);
 
@@ -33,16 +33,138 @@ namespace cugraph
 #ifdef DEBUG
   #define PR_VERBOSE
 #endif
+// y = H^T x with cub, on the CSC of H^T
 template <typename IndexType, typename ValueType>
-bool  pagerankIteration( IndexType n, IndexType e, IndexType *cscPtr, IndexType *cscInd,ValueType *cscVal,
+struct CubCscMV {
+    IndexType n, e;
+    IndexType *cscPtr, *cscInd;
+    ValueType *cscVal;
+    void*    cub_d_temp_storage;
+    size_t   cub_temp_storage_bytes;
+
+    CubCscMV(IndexType _n, IndexType _e, IndexType *_cscPtr, IndexType *_cscInd, ValueType *_cscVal, ValueType *x, ValueType *y)
+        : n(_n), e(_e), cscPtr(_cscPtr), cscInd(_cscInd), cscVal(_cscVal), cub_d_temp_storage(NULL), cub_temp_storage_bytes(0) {
+        cudaStream_t stream{nullptr};
+        cub::DeviceSpmv::CsrMV(cub_d_temp_storage, cub_temp_storage_bytes, cscVal,
+                                                   cscPtr, cscInd, x, y, n, n, e);
+         // Allocate temporary storage
+        ALLOC_MANAGED_TRY ((void**)&cub_d_temp_storage, cub_temp_storage_bytes, stream);
+        cudaCheckError()
+    }
+    ~CubCscMV() {
+        cudaStream_t stream{nullptr};
+        ALLOC_FREE_NOTHROW(cub_d_temp_storage, stream);
+    }
+    void operator()(ValueType *x, ValueType *y) {
+        cub::DeviceSpmv::CsrMV(cub_d_temp_storage, cub_temp_storage_bytes, cscVal,
+            cscPtr, cscInd, x, y,
+            n, n, e);
+    }
+};
+
+// y = H^T x on the compressed CSC of H^T: a warp per column, lane k decodes the k-th neighbor of every block
+template <typename IndexType, typename ValueType>
+__global__ void __launch_bounds__(CUDA_MAX_KERNEL_THREADS)
+compressed_spmv(CompressedAdjListView<IndexType> csc, const ValueType *cscVal, const ValueType *x, ValueType *y) {
+    int lane = threadIdx.x & 31;
+    IndexType warps = (gridDim.x * blockDim.x) >> 5;
+    for (IndexType row = (threadIdx.x + blockIdx.x * blockDim.x) >> 5; row < csc.n; row += warps) {
+        IndexType end = csc.offsets[row + 1];
+        ValueType sum = 0.0;
+        for (IndexType b = csc.block_offsets[row]; b < csc.block_offsets[row + 1]; b++) {
+            IndexType e = csc.block_edge(row, b);
+            bool valid = e + lane < end;
+            // neighbors are the block base plus the prefix sums of the deltas
+            IndexType id = (valid && lane > 0) ? csc.delta(b, lane) : 0;
+            for (int j = 1; j < 32; j *= 2) {
+                IndexType v = shfl_up(id, j);
+                if (lane >= j)
+                    id += v;
+            }
+            if (valid)
+                sum += cscVal[e + lane] * x[csc.block_bases[b] + id];
+        }
+        for (int j = 1; j < 32; j *= 2) {
+            ValueType v = shfl_up(sum, j);
+            if (lane >= j)
+                sum += v;
+        }
+        if (lane == 31)
+            y[row] = sum;
+    }
+}
+
+template <typename IndexType, typename ValueType>
+struct CompressedCscMV {
+    CompressedAdjListView<IndexType> csc;
+    ValueType *cscVal;
+
+    CompressedCscMV(CompressedAdjListView<IndexType> _csc, ValueType *_cscVal) : csc(_csc), cscVal(_cscVal) {}
+    void operator()(ValueType *x, ValueType *y) {
+        dim3 nthreads, nblocks;
+        nthreads.x = CUDA_MAX_KERNEL_THREADS;
+        nblocks.x = min((csc.n + (CUDA_MAX_KERNEL_THREADS >> 5) - 1) / (CUDA_MAX_KERNEL_THREADS >> 5), (IndexType) CUDA_MAX_BLOCKS);
+        compressed_spmv<IndexType, ValueType> <<<nblocks, nthreads>>>(csc, cscVal, x, y);
+        cudaCheckError();
+    }
+};
+
+// y = H^T x on a CSC of H^T whose offsets do not fit cub (64 bits edge ids): a warp per column
+template <typename IndexType, typename ValueType, typename OffsetType>
+__global__ void __launch_bounds__(CUDA_MAX_KERNEL_THREADS)
+warp_csc_spmv(IndexType n, const OffsetType *cscPtr, const IndexType *cscInd, const ValueType *cscVal, const ValueType *x, ValueType *y) {
+    int lane = threadIdx.x & 31;
+    IndexType warps = ((IndexType) gridDim.x * blockDim.x) >> 5;
+    for (IndexType row = ((IndexType) threadIdx.x + (IndexType) blockIdx.x * blockDim.x) >> 5; row < n; row += warps) {
+        ValueType sum = 0.0;
+        for (OffsetType e = cscPtr[row] + lane; e < cscPtr[row + 1]; e += 32)
+            sum += cscVal[e] * x[cscInd[e]];
+        for (int j = 1; j < 32; j *= 2) {
+            ValueType v = shfl_up(sum, j);
+            if (lane >= j)
+                sum += v;
+        }
+        if (lane == 31)
+            y[row] = sum;
+    }
+}
+
+template <typename IndexType, typename ValueType, typename OffsetType>
+struct WarpCscMV {
+    IndexType n;
+    OffsetType *cscPtr;
+    IndexType *cscInd;
+    ValueType *cscVal;
+
+    WarpCscMV(IndexType _n, OffsetType _e, OffsetType *_cscPtr, IndexType *_cscInd, ValueType *_cscVal, ValueType *x, ValueType *y)
+        : n(_n), cscPtr(_cscPtr), cscInd(_cscInd), cscVal(_cscVal) {}
+    void operator()(ValueType *x, ValueType *y) {
+        dim3 nthreads, nblocks;
+        nthreads.x = CUDA_MAX_KERNEL_THREADS;
+        nblocks.x = min((n + (CUDA_MAX_KERNEL_THREADS >> 5) - 1) / (CUDA_MAX_KERNEL_THREADS >> 5), (IndexType) CUDA_MAX_BLOCKS);
+        warp_csc_spmv<IndexType, ValueType, OffsetType> <<<nblocks, nthreads>>>(n, cscPtr, cscInd, cscVal, x, y);
+        cudaCheckError();
+    }
+};
+
+// cub's CsrMV takes int offsets and ids, wider CSCs use the warp per column kernel
+template <typename IndexType, typename ValueType, typename OffsetType>
+struct CscMV {
+    typedef WarpCscMV<IndexType, ValueType, OffsetType> type;
+};
+
+template <typename ValueType>
+struct CscMV<int, ValueType, int> {
+    typedef CubCscMV<int, ValueType> type;
+};
+
+template <typename IndexType, typename ValueType, typename SpMV>
+bool  pagerankIteration( IndexType n, SpMV &spmv,
                                      ValueType alpha, ValueType *a, ValueType *b, float tolerance, int iter, int max_iter, 
-                                     ValueType * &tmp,  void* cub_d_temp_storage, size_t  cub_temp_storage_bytes, 
-                                     ValueType * &pr, ValueType *residual) {
+                                     ValueType * &tmp, ValueType * &pr, ValueType *residual) {
     
     ValueType  dot_res;
-    cub::DeviceSpmv::CsrMV(cub_d_temp_storage, cub_temp_storage_bytes, cscVal,
-        cscPtr, cscInd, tmp, pr,
-        n, n, e);
+    spmv(tmp, pr);
    
     scal(n, alpha, pr);
     dot_res = dot( n, a, tmp);
@@ -69,8 +191,8 @@ bool  pagerankIteration( IndexType n, IndexType e, IndexType *cscPtr, IndexType
     }
 }
 
-template <typename IndexType, typename ValueType>
-int pagerank (  IndexType n, IndexType e, IndexType *cscPtr, IndexType *cscInd, ValueType *cscVal,
+template <typename IndexType, typename ValueType, typename SpMV>
+int pagerankSolver (  IndexType n, SpMV &spmv,
                        ValueType alpha, ValueType *a, bool has_guess, float tolerance, int max_iter, 
                        ValueType * &pagerank_vector, ValueType * &residual) {
   int max_it, i = 0 ;
@@ -78,8 +200,6 @@ int pagerank (  IndexType n, IndexType e, IndexType *cscPtr, IndexType *cscInd,
   bool converged = false;
   ValueType randomProbability =  static_cast<ValueType>( 1.0/n);
   ValueType *b=0, *tmp=0;
-  void*    cub_d_temp_storage = NULL;
-  size_t   cub_temp_storage_bytes = 0;
 
   if (max_iter > 0 )
       max_it = max_iter;
@@ -114,11 +234,6 @@ int pagerank (  IndexType n, IndexType e, IndexType *cscPtr, IndexType *cscInd,
   fill(n, b, randomProbability);
   update_dangling_nodes(n, a, alpha);
 
-  cub::DeviceSpmv::CsrMV(cub_d_temp_storage, cub_temp_storage_bytes, cscVal,
-                                             cscPtr, cscInd, tmp, pagerank_vector, n, n, e);
-   // Allocate temporary storage
- ALLOC_MANAGED_TRY ((void**)&cub_d_temp_storage, cub_temp_storage_bytes, stream);
- cudaCheckError()
   #ifdef PR_VERBOSE
       std::stringstream ss;
       ss.str(std::string());
@@ -132,9 +247,8 @@ int pagerank (  IndexType n, IndexType e, IndexType *cscPtr, IndexType *cscInd,
   while (!converged && i < max_it)
   { 
       i++;
-      converged = pagerankIteration(n, e, cscPtr, cscInd, cscVal,
+      converged = pagerankIteration(n, spmv,
                                            alpha, a, b, tol, i, max_it, tmp, 
-                                           cub_d_temp_storage, cub_temp_storage_bytes, 
                                            pagerank_vector, residual);
        #ifdef PR_VERBOSE
           ss.str(std::string());
@@ -151,13 +265,34 @@ int pagerank (  IndexType n, IndexType e, IndexType *cscPtr, IndexType *cscInd,
 
   ALLOC_FREE_TRY(b, stream);  
   ALLOC_FREE_TRY(tmp, stream);
-  ALLOC_FREE_TRY(cub_d_temp_storage, stream);    
   
   return converged ? 0 : 1;
 }
 
+template <typename IndexType, typename ValueType, typename OffsetType>
+int pagerank (  IndexType n, OffsetType e, OffsetType *cscPtr, IndexType *cscInd, ValueType *cscVal,
+                       ValueType alpha, ValueType *a, bool has_guess, float tolerance, int max_iter, 
+                       ValueType * &pagerank_vector, ValueType * &residual) {
+  typename CscMV<IndexType, ValueType, OffsetType>::type spmv(n, e, cscPtr, cscInd, cscVal, pagerank_vector, pagerank_vector);
+  return pagerankSolver(n, spmv, alpha, a, has_guess, tolerance, max_iter, pagerank_vector, residual);
+}
+
+template <typename IndexType, typename ValueType>
+int pagerank_compressed (  CompressedAdjListView<IndexType> csc, ValueType *cscVal,
+                       ValueType alpha, ValueType *a, bool has_guess, float tolerance, int max_iter, 
+                       ValueType * &pagerank_vector, ValueType * &residual) {
+  CompressedCscMV<IndexType, ValueType> spmv(csc, cscVal);
+  return pagerankSolver(csc.n, spmv, alpha, a, has_guess, tolerance, max_iter, pagerank_vector, residual);
+}
+
 //template int pagerank<int, half> (  int n, int e, int *cscPtr, int *cscInd,half *cscVal, half alpha, half *a, bool has_guess, float tolerance, int max_iter, half * &pagerank_vector, half * &residual);
 template int pagerank<int, float> (  int n, int e, int *cscPtr, int *cscInd,float *cscVal, float alpha, float *a, bool has_guess, float tolerance, int max_iter, float * &pagerank_vector, float * &residual);
 template int pagerank<int, double> (  int n, int e, int *cscPtr, int *cscInd,double *cscVal, double alpha, double *a, bool has_guess, float tolerance, int max_iter, double * &pagerank_vector, double * &residual);
+template int pagerank<int, float, int64_t> (  int n, int64_t e, int64_t *cscPtr, int *cscInd,float *cscVal, float alpha, float *a, bool has_guess, float tolerance, int max_iter, float * &pagerank_vector, float * &residual);
+template int pagerank<int, double, int64_t> (  int n, int64_t e, int64_t *cscPtr, int *cscInd,double *cscVal, double alpha, double *a, bool has_guess, float tolerance, int max_iter, double * &pagerank_vector, double * &residual);
+template int pagerank<int64_t, float, int64_t> (  int64_t n, int64_t e, int64_t *cscPtr, int64_t *cscInd,float *cscVal, float alpha, float *a, bool has_guess, float tolerance, int max_iter, float * &pagerank_vector, float * &residual);
+template int pagerank<int64_t, double, int64_t> (  int64_t n, int64_t e, int64_t *cscPtr, int64_t *cscInd,double *cscVal, double alpha, double *a, bool has_guess, float tolerance, int max_iter, double * &pagerank_vector, double * &residual);
+template int pagerank_compressed<int, float> (  CompressedAdjListView<int> csc, float *cscVal, float alpha, float *a, bool has_guess, float tolerance, int max_iter, float * &pagerank_vector, float * &residual);
+template int pagerank_compressed<int, double> (  CompressedAdjListView<int> csc, double *cscVal, double alpha, double *a, bool has_guess, float tolerance, int max_iter, double * &pagerank_vector, double * &residual);
 
 } //namespace cugraph
@@ -13,11 +13,19 @@
 // Author: Alex Fender afender@nvidia.com
  
 #pragma once
+#include "compressed_adj_list.cuh"
+
 namespace cugraph
 {
 
+// the offsets (and edge ids) of the CSC can be wider than the vertex ids
+template <typename IndexType, typename ValueType, typename OffsetType = IndexType>
+int pagerank (  IndexType n, OffsetType e, OffsetType *cscPtr, IndexType *cscInd,ValueType *cscVal,
+                       ValueType alpha, ValueType *a, bool has_guess, float tolerance, int max_iter, ValueType * &pagerank_vector, ValueType * &residual);
+
+// same solver, H^T is a compressed CSC with the values cscVal
 template <typename IndexType, typename ValueType>
-int pagerank (  IndexType n, IndexType e, IndexType *cscPtr, IndexType *cscInd,ValueType *cscVal,
+int pagerank_compressed (  CompressedAdjListView<IndexType> csc, ValueType *cscVal,
                        ValueType alpha, ValueType *a, bool has_guess, float tolerance, int max_iter, ValueType * &pagerank_vector, ValueType * &residual);
 
 } //namespace cugraph
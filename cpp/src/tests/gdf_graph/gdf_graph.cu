@@ -474,6 +474,57 @@ void offsets2indices(std::vector<int> &offsets, std::vector<int> &indices) {
     for (int j = offsets[i]; j < offsets[i+1]; ++j) 
       indices[j] = i;
 }
+
+TEST(gdf_graph, gdf_add_adj_lists)
+{
+  std::vector<int> src_h={0, 0, 1, 1, 2, 2, 2, 3, 4, 5, 5, 0};
+  std::vector<int> dest_h={1, 2, 0, 2, 0, 1, 3, 4, 5, 3, 0, 1};
+  std::vector<float> w_h={0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2};
+
+  gdf_graph *G = new gdf_graph, *G_ref = new gdf_graph;
+  gdf_column *col_src = new gdf_column, *col_dest = new gdf_column, *col_w = new gdf_column;
+  create_gdf_column(src_h, col_src);
+  create_gdf_column(dest_h, col_dest);
+  create_gdf_column(w_h, col_w);
+
+  ASSERT_EQ(gdf_edge_list_view(G, col_src, col_dest, col_w),GDF_SUCCESS);
+  ASSERT_EQ(gdf_edge_list_view(G_ref, col_src, col_dest, col_w),GDF_SUCCESS);
+
+  ASSERT_EQ(gdf_add_adj_lists(G),GDF_SUCCESS);
+  ASSERT_EQ(gdf_add_adj_list(G_ref),GDF_SUCCESS);
+  ASSERT_EQ(gdf_add_transposed_adj_list(G_ref),GDF_SUCCESS);
+
+  gdf_adj_list *lists[2] = {G->adjList, G->transposedAdjList};
+  gdf_adj_list *ref_lists[2] = {G_ref->adjList, G_ref->transposedAdjList};
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(lists[i]->offsets->size, ref_lists[i]->offsets->size);
+    ASSERT_EQ(lists[i]->indices->size, ref_lists[i]->indices->size);
+    std::vector<int> off_h(lists[i]->offsets->size), ind_h(lists[i]->indices->size);
+    std::vector<int> off_ref_h(off_h.size()), ind_ref_h(ind_h.size());
+    std::vector<float> w_out_h(ind_h.size()), w_ref_h(ind_h.size());
+    cudaMemcpy(&off_h[0], lists[i]->offsets->data, sizeof(int) * off_h.size(), cudaMemcpyDeviceToHost);
+    cudaMemcpy(&ind_h[0], lists[i]->indices->data, sizeof(int) * ind_h.size(), cudaMemcpyDeviceToHost);
+    cudaMemcpy(&w_out_h[0], lists[i]->edge_data->data, sizeof(float) * w_out_h.size(), cudaMemcpyDeviceToHost);
+    cudaMemcpy(&off_ref_h[0], ref_lists[i]->offsets->data, sizeof(int) * off_h.size(), cudaMemcpyDeviceToHost);
+    cudaMemcpy(&ind_ref_h[0], ref_lists[i]->indices->data, sizeof(int) * ind_h.size(), cudaMemcpyDeviceToHost);
+    cudaMemcpy(&w_ref_h[0], ref_lists[i]->edge_data->data, sizeof(float) * w_ref_h.size(), cudaMemcpyDeviceToHost);
+    EXPECT_EQ( eq(off_h,off_ref_h), 0);
+    EXPECT_EQ( eq(ind_h,ind_ref_h), 0);
+    EXPECT_EQ( eq(w_out_h,w_ref_h), 0);
+  }
+
+  // only the missing direction is built
+  ASSERT_EQ(gdf_delete_transposed_adj_list(G),GDF_SUCCESS);
+  ASSERT_EQ(gdf_add_adj_lists(G),GDF_SUCCESS);
+  EXPECT_NE(G->transposedAdjList, nullptr);
+
+  delete G;
+  delete G_ref;
+  gdf_col_delete(col_src);
+  gdf_col_delete(col_dest);
+  gdf_col_delete(col_w);
+}
+
 TEST(gdf_graph, gdf_add_edge_list)
 {
   
@@ -683,6 +734,246 @@ TEST(gdf_graph, gdf_column_overhead)
   gdf_col_delete(col_dest);
 }
 
+TEST(gdf_graph, gdf_extract_ego_network)
+{
+  // 0->1, 1->2, 2->3, 2->5, 3->4, 4->2, 5->0
+  std::vector<int> off_h = {0, 1, 2, 4, 5, 6, 7};
+  std::vector<int> ind_h = {1, 2, 3, 5, 4, 2, 0};
+  std::vector<float> w_h = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7};
+  std::vector<int> seeds_h = {2};
+
+  gdf_graph G;
+  gdf_column col_off, col_ind, col_w, col_seeds;
+  create_gdf_column(off_h, &col_off);
+  create_gdf_column(ind_h, &col_ind);
+  create_gdf_column(w_h, &col_w);
+  create_gdf_column(seeds_h, &col_seeds);
+  ASSERT_EQ(gdf_adj_list_view(&G, &col_off, &col_ind, &col_w),GDF_SUCCESS);
+
+  // 2 hops from 2: vertices 0, 2, 3, 4, 5, the edge 0->1 leaves the ego network
+  gdf_graph *ego = new gdf_graph;
+  gdf_column *vertex_map = new gdf_column;
+  ASSERT_EQ(gdf_extract_ego_network(&G, &col_seeds, 2, ego, vertex_map),GDF_SUCCESS);
+
+  std::vector<int> map_ref_h = {0, 2, 3, 4, 5};
+  std::vector<int> ego_off_ref_h = {0, 0, 2, 3, 4, 5};
+  std::vector<int> ego_ind_ref_h = {2, 4, 3, 1, 0};
+  std::vector<float> ego_w_ref_h = {0.3, 0.4, 0.5, 0.6, 0.7};
+  ASSERT_EQ((size_t)vertex_map->size, map_ref_h.size());
+  ASSERT_EQ((size_t)ego->adjList->offsets->size, ego_off_ref_h.size());
+  ASSERT_EQ((size_t)ego->adjList->indices->size, ego_ind_ref_h.size());
+  ASSERT_EQ((size_t)ego->adjList->edge_data->size, ego_w_ref_h.size());
+
+  std::vector<int> map_h(vertex_map->size), ego_off_h(ego->adjList->offsets->size), ego_ind_h(ego->adjList->indices->size);
+  std::vector<float> ego_w_h(ego->adjList->edge_data->size);
+  cudaMemcpy(&map_h[0], vertex_map->data, sizeof(int) * vertex_map->size, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&ego_off_h[0], ego->adjList->offsets->data, sizeof(int) * ego_off_h.size(), cudaMemcpyDeviceToHost);
+  cudaMemcpy(&ego_ind_h[0], ego->adjList->indices->data, sizeof(int) * ego_ind_h.size(), cudaMemcpyDeviceToHost);
+  cudaMemcpy(&ego_w_h[0], ego->adjList->edge_data->data, sizeof(float) * ego_w_h.size(), cudaMemcpyDeviceToHost);
+
+  EXPECT_EQ( eq(map_h,map_ref_h), 0);
+  EXPECT_EQ( eq(ego_off_h,ego_off_ref_h), 0);
+  EXPECT_EQ( eq(ego_ind_h,ego_ind_ref_h), 0);
+  EXPECT_EQ( eq(ego_w_h,ego_w_ref_h), 0);
+
+  delete ego;
+  gdf_col_delete(vertex_map);
+
+  // radius 0: subgraph induced by the seeds, duplicated seeds are ignored
+  std::vector<int> seeds2_h = {3, 2, 3};
+  gdf_column col_seeds2;
+  create_gdf_column(seeds2_h, &col_seeds2);
+  ego = new gdf_graph;
+  vertex_map = new gdf_column;
+  ASSERT_EQ(gdf_extract_ego_network(&G, &col_seeds2, 0, ego, vertex_map),GDF_SUCCESS);
+  ASSERT_EQ(vertex_map->size, 2);
+  ASSERT_EQ(ego->adjList->indices->size, 1);
+  delete ego;
+  gdf_col_delete(vertex_map);
+
+  // seeds must be vertices of G
+  seeds_h[0] = 6;
+  gdf_column col_seeds3;
+  create_gdf_column(seeds_h, &col_seeds3);
+  ego = new gdf_graph;
+  vertex_map = new gdf_column;
+  ASSERT_EQ(gdf_extract_ego_network(&G, &col_seeds3, 1, ego, vertex_map),GDF_INVALID_API_CALL);
+  delete ego;
+  delete vertex_map;
+}
+
+TEST(gdf_graph, gdf_compress_adj_list)
+{
+  // v -> v+1, v+2, ..., v+64 (mod n) and the 4 vertices v*7 (mod n): small deltas and a few large ones
+  int n = 1000;
+  std::vector<int> src_h, dest_h;
+  for (int v = 0; v < n; ++v) {
+    for (int k = 1; k <= 64; ++k) {
+      src_h.push_back(v);
+      dest_h.push_back((v + k) % n);
+    }
+    for (int k = 1; k <= 4; ++k) {
+      src_h.push_back(v);
+      dest_h.push_back((v * 7 * k) % n);
+    }
+  }
+  gdf_graph G;
+  gdf_column col_src, col_dest;
+  create_gdf_column(src_h, &col_src);
+  create_gdf_column(dest_h, &col_dest);
+  ASSERT_EQ(gdf_edge_list_view(&G, &col_src, &col_dest, nullptr),GDF_SUCCESS);
+
+  gdf_compressed_adj_list C;
+  ASSERT_EQ(gdf_compress_adj_list(&G, false, &C),GDF_SUCCESS);
+  int nnz = G.adjList->indices->size;
+  ASSERT_EQ(C.offsets->size, n + 1);
+
+  // round trip
+  gdf_column *indices = new gdf_column;
+  ASSERT_EQ(gdf_decompress_adj_list(&C, indices),GDF_SUCCESS);
+  ASSERT_EQ(indices->size, nnz);
+  std::vector<int> ind_h(nnz), ind_ref_h(nnz);
+  cudaMemcpy(&ind_h[0], indices->data, sizeof(int) * nnz, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&ind_ref_h[0], G.adjList->indices->data, sizeof(int) * nnz, cudaMemcpyDeviceToHost);
+  EXPECT_EQ( eq(ind_h,ind_ref_h), 0);
+  gdf_col_delete(indices);
+
+  // memory
+  gdf_column* cols[6] = {C.offsets, C.block_offsets, C.block_bases, C.block_starts, C.block_widths, C.data};
+  size_t bytes = 0;
+  for (int i = 0; i < 6; ++i)
+    bytes += cols[i]->size * (cols[i] == C.block_widths ? sizeof(int8_t) : sizeof(int));
+  EXPECT_LT(bytes, sizeof(int) * (n + 1 + nnz) / 2);
+
+  // same results as the algorithms on the adjacency list
+  std::vector<int> dist_h(n), pred_h(n), dist_ref_h(n), pred_ref_h(n);
+  gdf_column col_dist, col_pred, col_dist_ref, col_pred_ref;
+  create_gdf_column(dist_h, &col_dist);
+  create_gdf_column(pred_h, &col_pred);
+  create_gdf_column(dist_ref_h, &col_dist_ref);
+  create_gdf_column(pred_ref_h, &col_pred_ref);
+  ASSERT_EQ(gdf_bfs_compressed(&C, &col_dist, &col_pred, 3),GDF_SUCCESS);
+  ASSERT_EQ(gdf_bfs(&G, &col_dist_ref, &col_pred_ref, 3, true),GDF_SUCCESS);
+  cudaMemcpy(&dist_h[0], col_dist.data, sizeof(int) * n, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&pred_h[0], col_pred.data, sizeof(int) * n, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&dist_ref_h[0], col_dist_ref.data, sizeof(int) * n, cudaMemcpyDeviceToHost);
+  EXPECT_EQ( eq(dist_h,dist_ref_h), 0);
+  // predecessors can differ, they must be one level closer
+  for (int v = 0; v < n; ++v)
+    if (v != 3)
+      EXPECT_EQ(dist_h[pred_h[v]] + 1, dist_h[v]);
+  ASSERT_EQ(gdf_bfs_compressed(&C, &col_dist, &col_pred, n),GDF_INVALID_API_CALL);
+
+  std::vector<float> jac_h(nnz), jac_ref_h(nnz);
+  gdf_column col_jac, col_jac_ref;
+  create_gdf_column(jac_h, &col_jac);
+  create_gdf_column(jac_ref_h, &col_jac_ref);
+  ASSERT_EQ(gdf_jaccard_compressed(&C, &col_jac),GDF_SUCCESS);
+  ASSERT_EQ(gdf_jaccard(&G, nullptr, &col_jac_ref),GDF_SUCCESS);
+  cudaMemcpy(&jac_h[0], col_jac.data, sizeof(float) * nnz, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&jac_ref_h[0], col_jac_ref.data, sizeof(float) * nnz, cudaMemcpyDeviceToHost);
+  for (int i = 0; i < nnz; ++i)
+    EXPECT_NEAR(jac_h[i], jac_ref_h[i], 1e-6);
+
+  // rows must be sorted
+  std::vector<int> off_h = {0, 2, 3, 3}, unsorted_h = {2, 1, 0};
+  gdf_graph G2;
+  gdf_column col_off, col_ind;
+  create_gdf_column(off_h, &col_off);
+  create_gdf_column(unsorted_h, &col_ind);
+  ASSERT_EQ(gdf_adj_list_view(&G2, &col_off, &col_ind, nullptr),GDF_SUCCESS);
+  gdf_compressed_adj_list C2;
+  ASSERT_EQ(gdf_compress_adj_list(&G2, false, &C2),GDF_INVALID_API_CALL);
+}
+
+TEST(gdf_graph, int64_indices)
+{
+  // Zachary Karate Club, both directions
+  std::vector<int> off_h = {0, 16, 25, 35, 41, 44, 48, 52, 56, 61, 63, 66, 67, 69, 74, 76, 78, 80, 82, 84, 87, 89, 91, 93, 98, 101, 104, 106, 110, 113, 117, 121, 127, 
+      139, 156};
+  std::vector<int> ind_h = {1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 17, 19, 21, 31, 0, 2, 3, 7, 13, 17, 19, 21, 30, 0, 1, 3, 7, 8, 9, 13, 27, 28, 32, 0, 1, 2, 7, 12, 13, 0, 6, 10, 0, 
+      6, 10, 16, 0, 4, 5, 16, 0, 1, 2, 3, 0, 2, 30, 32, 33, 2, 33, 0, 4, 5, 0, 0, 3, 0, 1, 2, 3, 33, 32, 33, 32, 33, 5, 6, 0, 1, 32, 33, 0, 1, 33, 32, 33, 0, 1, 32, 33, 25, 27, 29, 32, 33, 
+      25, 27, 31, 23, 24, 31, 29, 33, 2, 23, 24, 33, 2, 31, 33, 23, 26, 32, 33, 1, 8, 32, 33, 0, 24, 25, 28, 32, 33, 2, 8, 14, 15, 18, 20, 22, 23, 29, 30, 31, 33, 8, 9, 13, 14, 15, 
+      18, 19, 20, 22, 23, 26, 27, 28, 29, 30, 31, 32};
+  int n = off_h.size() - 1, nnz = ind_h.size();
+  std::vector<int> src_h(nnz);
+  offsets2indices(off_h, src_h);
+  std::vector<int64_t> src64_h(src_h.begin(), src_h.end()), dest64_h(ind_h.begin(), ind_h.end());
+  std::vector<int64_t> off64_h(off_h.begin(), off_h.end());
+
+  gdf_graph G, G64, G_mixed;
+  gdf_column col_src, col_dest, col_src64, col_dest64, col_off64, col_ind;
+  create_gdf_column(src_h, &col_src);
+  create_gdf_column(ind_h, &col_dest);
+  create_gdf_column(src64_h, &col_src64);
+  create_gdf_column(dest64_h, &col_dest64);
+  ASSERT_EQ(gdf_edge_list_view(&G, &col_src, &col_dest, nullptr),GDF_SUCCESS);
+  ASSERT_EQ(gdf_edge_list_view(&G64, &col_src64, &col_dest64, nullptr),GDF_SUCCESS);
+
+  // 64 bits edge list: 64 bits offsets and indices, same CSR
+  ASSERT_EQ(gdf_add_adj_lists(&G64),GDF_SUCCESS);
+  ASSERT_EQ(G64.adjList->offsets->dtype, GDF_INT64);
+  ASSERT_EQ(G64.adjList->indices->dtype, GDF_INT64);
+  ASSERT_EQ(G64.transposedAdjList->offsets->dtype, GDF_INT64);
+  std::vector<int64_t> off64_out_h(n + 1), ind64_out_h(nnz);
+  cudaMemcpy(&off64_out_h[0], G64.adjList->offsets->data, sizeof(int64_t) * (n + 1), cudaMemcpyDeviceToHost);
+  cudaMemcpy(&ind64_out_h[0], G64.adjList->indices->data, sizeof(int64_t) * nnz, cudaMemcpyDeviceToHost);
+  EXPECT_EQ( eq(off64_out_h,off64_h), 0);
+  EXPECT_EQ( eq(ind64_out_h,dest64_h), 0);
+
+  // 32 bits vertex ids with 64 bits offsets
+  create_gdf_column(off64_h, &col_off64);
+  create_gdf_column(ind_h, &col_ind);
+  ASSERT_EQ(gdf_adj_list_view(&G_mixed, &col_off64, &col_ind, nullptr),GDF_SUCCESS);
+  gdf_column col_src_out;
+  std::vector<int> src_out_h(nnz);
+  create_gdf_column(src_out_h, &col_src_out);
+  ASSERT_EQ(G_mixed.adjList->get_source_indices(&col_src_out),GDF_SUCCESS);
+  cudaMemcpy(&src_out_h[0], col_src_out.data, sizeof(int) * nnz, cudaMemcpyDeviceToHost);
+  EXPECT_EQ( eq(src_out_h,src_h), 0);
+
+  // bfs: same distances as the 32 bits graph
+  std::vector<int> dist_ref_h(n), pred_ref_h(n), dist_h(n), pred_h(n);
+  std::vector<int64_t> dist64_h(n), pred64_h(n);
+  gdf_column col_dist_ref, col_pred_ref, col_dist, col_pred, col_dist64, col_pred64;
+  create_gdf_column(dist_ref_h, &col_dist_ref);
+  create_gdf_column(pred_ref_h, &col_pred_ref);
+  create_gdf_column(dist_h, &col_dist);
+  create_gdf_column(pred_h, &col_pred);
+  create_gdf_column(dist64_h, &col_dist64);
+  create_gdf_column(pred64_h, &col_pred64);
+  ASSERT_EQ(gdf_bfs(&G, &col_dist_ref, &col_pred_ref, 3, true),GDF_SUCCESS);
+  ASSERT_EQ(gdf_bfs(&G_mixed, &col_dist, &col_pred, 3, true),GDF_SUCCESS);
+  ASSERT_EQ(gdf_bfs(&G64, &col_dist64, &col_pred64, 3, true),GDF_SUCCESS);
+  ASSERT_EQ(gdf_bfs(&G64, &col_dist, &col_pred, 3, true),GDF_UNSUPPORTED_DTYPE);
+  cudaMemcpy(&dist_ref_h[0], col_dist_ref.data, sizeof(int) * n, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&dist_h[0], col_dist.data, sizeof(int) * n, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&pred_h[0], col_pred.data, sizeof(int) * n, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&dist64_h[0], col_dist64.data, sizeof(int64_t) * n, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&pred64_h[0], col_pred64.data, sizeof(int64_t) * n, cudaMemcpyDeviceToHost);
+  EXPECT_EQ( eq(dist_h,dist_ref_h), 0);
+  // predecessors can differ, they must be one level closer
+  for (int v = 0; v < n; ++v) {
+    EXPECT_EQ(dist64_h[v], dist_ref_h[v]);
+    if (v != 3) {
+      EXPECT_EQ(dist_h[pred_h[v]] + 1, dist_h[v]);
+      EXPECT_EQ(dist64_h[pred64_h[v]] + 1, dist64_h[v]);
+    }
+  }
+
+  // pagerank: same ranks as the 32 bits graph
+  std::vector<float> pr_ref_h(n), pr_h(n);
+  gdf_column col_pr_ref, col_pr;
+  create_gdf_column(pr_ref_h, &col_pr_ref);
+  create_gdf_column(pr_h, &col_pr);
+  ASSERT_EQ(gdf_pagerank(&G, &col_pr_ref, 0.85, 1e-6, 100, false),GDF_SUCCESS);
+  ASSERT_EQ(gdf_pagerank(&G64, &col_pr, 0.85, 1e-6, 100, false),GDF_SUCCESS);
+  cudaMemcpy(&pr_ref_h[0], col_pr_ref.data, sizeof(float) * n, cudaMemcpyDeviceToHost);
+  cudaMemcpy(&pr_h[0], col_pr.data, sizeof(float) * n, cudaMemcpyDeviceToHost);
+  for (int v = 0; v < n; ++v)
+    EXPECT_NEAR(pr_h[v], pr_ref_h[v], 1e-5);
+}
+
 int main(int argc, char **argv)  {
     srand(42);
     ::testing::InitGoogleTest(&argc, argv);
@@ -71,7 +71,7 @@ class Tests_Pagerank : public ::testing::TestWithParam<Pagerank_Usecase> {
   static std::vector<double> pagerank_time;   
 
 
-  template <typename T, bool manual_tanspose>
+  template <typename T, bool manual_tanspose, bool compressed = false>
   void run_current_test(const Pagerank_Usecase& param) {
      const ::testing::TestInfo* const test_info =::testing::UnitTest::GetInstance()->current_test_info();
      std::stringstream ss; 
@@ -122,11 +122,26 @@ class Tests_Pagerank : public ::testing::TestWithParam<Pagerank_Usecase> {
     if (manual_tanspose)
       ASSERT_EQ(gdf_add_transposed_adj_list(G.get()),0);
 
+    gdf_compressed_adj_list C;
+    if (compressed) {
+      ASSERT_EQ(gdf_compress_adj_list(G.get(), true, &C),0);
+      if (PERF) {
+        gdf_column* cols[6] = {C.offsets, C.block_offsets, C.block_bases, C.block_starts, C.block_widths, C.data};
+        size_t bytes = 0;
+        for (int i = 0; i < 6; ++i)
+          bytes += cols[i]->size * (cols[i] == C.block_widths ? sizeof(int8_t) : sizeof(int));
+        std::cout << "CSC bytes " << sizeof(int) * (m + 1 + nnz) << " compressed bytes " << bytes << std::endl;
+      }
+    }
+
     cudaDeviceSynchronize();
     if (PERF) {
       hr_clock.start();
       for (int i = 0; i < PERF_MULTIPLIER; ++i) {
-       status = gdf_pagerank(G.get(), col_pagerank.get(), alpha, tol, max_iter, has_guess);
+       if (compressed)
+         status = gdf_pagerank_compressed(&C, col_pagerank.get(), alpha, tol, max_iter, has_guess);
+       else
+         status = gdf_pagerank(G.get(), col_pagerank.get(), alpha, tol, max_iter, has_guess);
        cudaDeviceSynchronize();
       }
       hr_clock.stop(&time_tmp);
@@ -134,7 +149,10 @@ class Tests_Pagerank : public ::testing::TestWithParam<Pagerank_Usecase> {
     }
     else {
       cudaProfilerStart();
-      status = gdf_pagerank(G.get(), col_pagerank.get(), alpha, tol, max_iter, has_guess);
+      if (compressed)
+        status = gdf_pagerank_compressed(&C, col_pagerank.get(), alpha, tol, max_iter, has_guess);
+      else
+        status = gdf_pagerank(G.get(), col_pagerank.get(), alpha, tol, max_iter, has_guess);
       cudaProfilerStop();
       cudaDeviceSynchronize();
     }
@@ -196,6 +214,14 @@ TEST_P(Tests_Pagerank, CheckFP64) {
     run_current_test<double,false>(GetParam());
 }
 
+TEST_P(Tests_Pagerank, CheckFP32_compressed) {
+    run_current_test<float, false, true>(GetParam());
+}
+
+TEST_P(Tests_Pagerank, CheckFP64_compressed) {
+    run_current_test<double, false, true>(GetParam());
+}
+
 // --gtest_filter=*simple_test*
 INSTANTIATE_TEST_CASE_P(simple_test, Tests_Pagerank, 
                         ::testing::Values(  Pagerank_Usecase("networks/karate.mtx", "")
@@ -129,6 +129,7 @@ gdf_error gdf_get_two_hop_neighbors(gdf_graph* graph, gdf_column* first, gdf_col
 	GDF_REQUIRE(first != nullptr, GDF_INVALID_API_CALL);
 	GDF_REQUIRE(second != nullptr, GDF_INVALID_API_CALL);
 	GDF_TRY(gdf_add_adj_list(graph));
+	GDF_REQUIRE(graph->adjList->offsets->dtype == graph->adjList->indices->dtype, GDF_UNSUPPORTED_DTYPE);
 
 	size_t num_verts = graph->adjList->offsets->size - 1;
 	switch (graph->adjList->offsets->dtype) {